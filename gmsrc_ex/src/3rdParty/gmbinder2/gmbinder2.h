@@ -7,15 +7,18 @@
 //		Bind classes to script, control whether script can create an instance or not.
 //		Bind class variables to script.
 //			Supports bool,int,float,const char *,std::string,gmTableObject,gmFunctionObject,
-//		Bind static functions to script(up to 9 parameters). No glue function needed.
-//		Bind member functions to script(up to 9 parameters). No glue function needed.
+//		Bind static functions to script(up to 6 parameters). No glue function needed.
+//		Bind member functions to script(up to 6 parameters). No glue function needed.
 //		Bind class constants to script. Access through an instance currently.
 //
-// Unsupported Features:
-//		Automatic binding of overloaded functions. Overloaded functions must be bound to
-//			multiple script functions.
+//		Bind overloaded member functions to one name, chosen by argument count and types.
 //		Ex: If your class had: void DoSomething(int) and void DoSomething(float)
-//			you could bind both functions, but using different names for each script.
+//			you could bind both functions as DoSomething.
+//			The first bound signature that matches the arguments is called.
+//		Note: binding a second function to a name used to replace the first one, it now
+//			adds an overload.  Bind to a new name to keep both apart.
+//
+// Unsupported Features:
 //		Variable argument functions. To support variable arguments you must use one of the
 //			raw binding functions.
 //////////////////////////////////////////////////////////////////////////
@@ -29,6 +32,9 @@
 
 #include "gmbinder2_functraits.h"
 
+#include <string>
+#include <vector>
+
 namespace gmBind2
 {
 	//////////////////////////////////////////////////////////////////////////
@@ -74,6 +80,12 @@ namespace gmBind2
 	if(GetFromGMType<operand_type>(a_thread, 1, operand)==GM_EXCEPTION) \
 	return GM_EXCEPTION;
 	//////////////////////////////////////////////////////////////////////////
+#define FETCH_ARG(argnum) \
+	typedef typename FunctionTraits<Fn>::arg##argnum##_type trait_arg##argnum##type; \
+	typedef typename Meta::Argify<trait_arg##argnum##type>::type arg##argnum##_type; \
+	arg##argnum##_type arg##argnum; \
+	ArgType<arg##argnum##_type>::Get(a_thread, argnum, arg##argnum);
+	//////////////////////////////////////////////////////////////////////////
 	template<typename T>
 	int GetThisGMType(gmThread *a_thread, T *&a_var)
 	{
@@ -218,6 +230,85 @@ namespace gmBind2
 	}
 #endif
 	// and so forth for all the types you want to handle
+	//////////////////////////////////////////////////////////////////////////
+	// Unchecked parameter decoding, after Match() accepted the types GetFromGMType accepts
+	template<typename T>
+	struct ArgType
+	{
+		static bool Match(gmThread *a_thread, int idx)
+		{
+			gmType type = a_thread->ParamType(idx);
+			gmMachine *m = a_thread->GetMachine();
+			while(type && type != ClassBase<T>::ClassType())
+				type = m->GetTypeParent(type);
+			return type == ClassBase<T>::ClassType();
+		}
+		static void Get(gmThread *a_thread, int idx, T &a_var)
+		{
+			a_var = *static_cast<BoundObject<T>*>(a_thread->ParamUser(idx))->m_NativeObj; // COPY!
+		}
+	};
+	template<typename T>
+	struct ArgType<T*>
+	{
+		static bool Match(gmThread *a_thread, int idx)
+		{
+			return ArgType<T>::Match(a_thread, idx);
+		}
+		static void Get(gmThread *a_thread, int idx, T *&a_var)
+		{
+			a_var = static_cast<BoundObject<T>*>(a_thread->ParamUser(idx))->m_NativeObj;
+		}
+	};
+	template<>
+	struct ArgType<bool>
+	{
+		static bool Match(gmThread *a_thread, int idx) { return a_thread->ParamType(idx) == GM_INT; }
+		static void Get(gmThread *a_thread, int idx, bool &a_var) { a_var = a_thread->Param(idx).m_value.m_int != 0; }
+	};
+	template<>
+	struct ArgType<int>
+	{
+		static bool Match(gmThread *a_thread, int idx) { return a_thread->ParamType(idx) == GM_INT; }
+		static void Get(gmThread *a_thread, int idx, int &a_var) { a_var = a_thread->Param(idx).m_value.m_int; }
+	};
+	template<>
+	struct ArgType<float>
+	{
+		static bool Match(gmThread *a_thread, int idx)
+		{
+			const gmType type = a_thread->ParamType(idx);
+			return type == GM_FLOAT || type == GM_INT;
+		}
+		static void Get(gmThread *a_thread, int idx, float &a_var)
+		{
+			const gmVariable &v = a_thread->Param(idx);
+			a_var = (v.m_type == GM_FLOAT) ? v.m_value.m_float : (float)v.m_value.m_int;
+		}
+	};
+	template<>
+	struct ArgType<std::string>
+	{
+		static bool Match(gmThread *a_thread, int idx) { return a_thread->ParamType(idx) == GM_STRING; }
+		static void Get(gmThread *a_thread, int idx, std::string &a_var)
+		{
+			a_var = (const char *) *((gmStringObject *) GM_MOBJECT(a_thread->GetMachine(), a_thread->ParamRef(idx)));
+		}
+	};
+#if(GM_USE_VECTOR3_STACK)
+	template<>
+	struct ArgType<Vec3>
+	{
+		static bool Match(gmThread *a_thread, int idx) { return a_thread->ParamType(idx) == GM_VEC3; }
+		static void Get(gmThread *a_thread, int idx, Vec3 &a_var)
+		{
+			Vec3 v = ConvertVec3(a_thread->Param(idx).m_value.m_vec3);
+			a_var[0] = v.x;
+			a_var[1] = v.y;
+			a_var[2] = v.z;
+		}
+	};
+#endif
 	//////////////////////////////////////////////////////////////////////////
 	template<typename T>
 #ifdef _WIN32
@@ -329,6 +420,125 @@ namespace gmBind2
 	}
 #endif
 	//////////////////////////////////////////////////////////////////////////
+	//////////////////////////////////////////////////////////////////////////
+	// A bound function checks the types of all its arguments up front, see GMExportFunctor, and
+	// then reads them unchecked.  A failed check runs the checked reads for the exception message.
+#define MATCH_ARG(argnum) \
+	ArgType<typename Meta::Argify<typename FunctionTraits<Fn>::arg##argnum##_type>::type>::Match(a_thread, argnum)
+	template<typename Fn, int>
+	struct GMSignature {};
+	template<typename Fn>
+	struct GMSignature<Fn, 0>
+	{
+		static bool Match(gmThread *a_thread)
+		{
+			return true;
+		}
+		static int Raise(gmThread *a_thread)
+		{
+			return GM_EXCEPTION;
+		}
+	};
+	template<typename Fn>
+	struct GMSignature<Fn, 1>
+	{
+		static bool Match(gmThread *a_thread)
+		{
+			return a_thread->GetNumParams() >= 1 && MATCH_ARG(0);
+		}
+		static int Raise(gmThread *a_thread)
+		{
+			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
+			CHECKTYPE_ARG(0);
+			return GM_EXCEPTION;
+		}
+	};
+	template<typename Fn>
+	struct GMSignature<Fn, 2>
+	{
+		static bool Match(gmThread *a_thread)
+		{
+			return a_thread->GetNumParams() >= 2 && MATCH_ARG(0) && MATCH_ARG(1);
+		}
+		static int Raise(gmThread *a_thread)
+		{
+			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
+			CHECKTYPE_ARG(0);
+			CHECKTYPE_ARG(1);
+			return GM_EXCEPTION;
+		}
+	};
+	template<typename Fn>
+	struct GMSignature<Fn, 3>
+	{
+		static bool Match(gmThread *a_thread)
+		{
+			return a_thread->GetNumParams() >= 3 && MATCH_ARG(0) && MATCH_ARG(1) && MATCH_ARG(2);
+		}
+		static int Raise(gmThread *a_thread)
+		{
+			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
+			CHECKTYPE_ARG(0);
+			CHECKTYPE_ARG(1);
+			CHECKTYPE_ARG(2);
+			return GM_EXCEPTION;
+		}
+	};
+	template<typename Fn>
+	struct GMSignature<Fn, 4>
+	{
+		static bool Match(gmThread *a_thread)
+		{
+			return a_thread->GetNumParams() >= 4 && MATCH_ARG(0) && MATCH_ARG(1) && MATCH_ARG(2) && MATCH_ARG(3);
+		}
+		static int Raise(gmThread *a_thread)
+		{
+			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
+			CHECKTYPE_ARG(0);
+			CHECKTYPE_ARG(1);
+			CHECKTYPE_ARG(2);
+			CHECKTYPE_ARG(3);
+			return GM_EXCEPTION;
+		}
+	};
+	template<typename Fn>
+	struct GMSignature<Fn, 5>
+	{
+		static bool Match(gmThread *a_thread)
+		{
+			return a_thread->GetNumParams() >= 5 && MATCH_ARG(0) && MATCH_ARG(1) && MATCH_ARG(2) && MATCH_ARG(3) && MATCH_ARG(4);
+		}
+		static int Raise(gmThread *a_thread)
+		{
+			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
+			CHECKTYPE_ARG(0);
+			CHECKTYPE_ARG(1);
+			CHECKTYPE_ARG(2);
+			CHECKTYPE_ARG(3);
+			CHECKTYPE_ARG(4);
+			return GM_EXCEPTION;
+		}
+	};
+	template<typename Fn>
+	struct GMSignature<Fn, 6>
+	{
+		static bool Match(gmThread *a_thread)
+		{
+			return a_thread->GetNumParams() >= 6 && MATCH_ARG(0) && MATCH_ARG(1) && MATCH_ARG(2) && MATCH_ARG(3) && MATCH_ARG(4) && MATCH_ARG(5);
+		}
+		static int Raise(gmThread *a_thread)
+		{
+			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
+			CHECKTYPE_ARG(0);
+			CHECKTYPE_ARG(1);
+			CHECKTYPE_ARG(2);
+			CHECKTYPE_ARG(3);
+			CHECKTYPE_ARG(4);
+			CHECKTYPE_ARG(5);
+			return GM_EXCEPTION;
+		}
+	};
+#undef MATCH_ARG
 	template<typename Fn, int>
 	struct GMExportStruct {};
 
@@ -338,14 +548,12 @@ namespace gmBind2
 		//////////////////////////////////////////////////////////////////////////
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<false>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			fn();
 			return GM_OK;
 		}
 		//////////////////////////////////////////////////////////////////////////
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<false>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			ret_type ret = fn();
 			return PushReturnToGM(a_thread, ret);
@@ -354,7 +562,6 @@ namespace gmBind2
 		// member function, no return value
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<true>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			CHECKTHIS;
 			(obj->*fn)();
 			return GM_OK;
@@ -363,7 +570,6 @@ namespace gmBind2
 		// member function, one return value
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<true>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			CHECKTHIS;
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			ret_type ret = (obj->*fn)();
@@ -376,16 +582,14 @@ namespace gmBind2
 		//////////////////////////////////////////////////////////////////////////
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<false>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
-			CHECKTYPE_ARG(0);
+			FETCH_ARG(0);
 			fn(arg0);
 			return GM_OK;
 		}
 		//////////////////////////////////////////////////////////////////////////
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<false>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
-			CHECKTYPE_ARG(0);
+			FETCH_ARG(0);
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			ret_type ret = fn(arg0);
 			return PushReturnToGM(a_thread, ret);
@@ -394,9 +598,8 @@ namespace gmBind2
 		// member function, no return value
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<true>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			CHECKTHIS;
-			CHECKTYPE_ARG(0);
+			FETCH_ARG(0);
 			(obj->*fn)(arg0);
 			return GM_OK;
 		}
@@ -404,9 +607,8 @@ namespace gmBind2
 		// member function, one return value
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<true>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			CHECKTHIS;
-			CHECKTYPE_ARG(0);
+			FETCH_ARG(0);
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			ret_type ret = (obj->*fn)(arg0);
 			return PushReturnToGM(a_thread, ret);
@@ -418,18 +620,16 @@ namespace gmBind2
 		//////////////////////////////////////////////////////////////////////////
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<false>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
 			fn(arg0, arg1);
 			return GM_OK;
 		}
 		//////////////////////////////////////////////////////////////////////////
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<false>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			ret_type ret = fn(arg0, arg1);
 			return PushReturnToGM(a_thread, ret);
@@ -438,10 +638,9 @@ namespace gmBind2
 		// member function, no return value
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<true>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			CHECKTHIS;
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
 			(obj->*fn)(arg0, arg1);
 			return GM_OK;
 		}
@@ -449,10 +648,9 @@ namespace gmBind2
 		// member function, one return value
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<true>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			CHECKTHIS;
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			ret_type ret = (obj->*fn)(arg0, arg1);
 			return PushReturnToGM(a_thread, ret);
@@ -464,20 +662,18 @@ namespace gmBind2
 		//////////////////////////////////////////////////////////////////////////
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<false>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
-			CHECKTYPE_ARG(2);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
 			fn(arg0, arg1, arg2);
 			return GM_OK;
 		}
 		//////////////////////////////////////////////////////////////////////////
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<false>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
-			CHECKTYPE_ARG(2);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			ret_type ret = fn(arg0, arg1, arg2);
 			return PushReturnToGM(a_thread, ret);
@@ -486,11 +682,10 @@ namespace gmBind2
 		// member function, no return value
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<true>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			CHECKTHIS;
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
-			CHECKTYPE_ARG(2);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
 			(obj->*fn)(arg0, arg1, arg2);
 			return GM_OK;
 		}
@@ -498,11 +693,10 @@ namespace gmBind2
 		// member function, one return value
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<true>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			CHECKTHIS;
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
-			CHECKTYPE_ARG(2);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			ret_type ret = (obj->*fn)(arg0, arg1, arg2);
 			return PushReturnToGM(a_thread, ret);
@@ -514,22 +708,20 @@ namespace gmBind2
 		//////////////////////////////////////////////////////////////////////////
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<false>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
-			CHECKTYPE_ARG(2);
-			CHECKTYPE_ARG(3);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
+			FETCH_ARG(3);
 			fn(arg0, arg1, arg2, arg3);
 			return GM_OK;
 		}
 		//////////////////////////////////////////////////////////////////////////
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<false>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
-			CHECKTYPE_ARG(2);
-			CHECKTYPE_ARG(3);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
+			FETCH_ARG(3);
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			ret_type ret = fn(arg0, arg1, arg2, arg3);
 			return PushReturnToGM(a_thread, ret);
@@ -538,12 +730,11 @@ namespace gmBind2
 		// member function, no return value
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<true>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			CHECKTHIS;
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
-			CHECKTYPE_ARG(2);
-			CHECKTYPE_ARG(3);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
+			FETCH_ARG(3);
 			(obj->*fn)(arg0, arg1, arg2, arg3);
 			return GM_OK;
 		}
@@ -551,12 +742,11 @@ namespace gmBind2
 		// member function, one return value
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<true>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			CHECKTHIS;
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
-			CHECKTYPE_ARG(2);
-			CHECKTYPE_ARG(3);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
+			FETCH_ARG(3);
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			ret_type ret = (obj->*fn)(arg0, arg1, arg2, arg3);
 			return PushReturnToGM(a_thread, ret);
@@ -568,24 +758,22 @@ namespace gmBind2
 		//////////////////////////////////////////////////////////////////////////
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<false>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
-			CHECKTYPE_ARG(2);
-			CHECKTYPE_ARG(3);
-			CHECKTYPE_ARG(4);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
+			FETCH_ARG(3);
+			FETCH_ARG(4);
 			fn(arg0, arg1, arg2, arg3, arg4);
 			return GM_OK;
 		}
 		//////////////////////////////////////////////////////////////////////////
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<false>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
-			CHECKTYPE_ARG(2);
-			CHECKTYPE_ARG(3);
-			CHECKTYPE_ARG(4);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
+			FETCH_ARG(3);
+			FETCH_ARG(4);
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			ret_type ret = fn(arg0, arg1, arg2, arg3, arg4);
 			return PushReturnToGM(a_thread, ret);
@@ -594,13 +782,12 @@ namespace gmBind2
 		// member function, no return value
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<true>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			CHECKTHIS;
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
-			CHECKTYPE_ARG(2);
-			CHECKTYPE_ARG(3);
-			CHECKTYPE_ARG(4);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
+			FETCH_ARG(3);
+			FETCH_ARG(4);
 			(obj->*fn)(arg0, arg1, arg2, arg3, arg4);
 			return GM_OK;
 		}
@@ -608,18 +795,75 @@ namespace gmBind2
 		// member function, one return value
 		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<true>)
 		{
-			GM_CHECK_NUM_PARAMS(FunctionTraits<Fn>::Arity);
 			CHECKTHIS;
-			CHECKTYPE_ARG(0);
-			CHECKTYPE_ARG(1);
-			CHECKTYPE_ARG(2);
-			CHECKTYPE_ARG(3);
-			CHECKTYPE_ARG(4);
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
+			FETCH_ARG(3);
+			FETCH_ARG(4);
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			ret_type ret = (obj->*fn)(arg0, arg1, arg2, arg3, arg4);
 			return PushReturnToGM(a_thread, ret);
 		}
 	};
+	template<typename Fn>
+	struct GMExportStruct<Fn, 6>
+	{
+		//////////////////////////////////////////////////////////////////////////
+		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<false>)
+		{
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
+			FETCH_ARG(3);
+			FETCH_ARG(4);
+			FETCH_ARG(5);
+			fn(arg0, arg1, arg2, arg3, arg4, arg5);
+			return GM_OK;
+		}
+		//////////////////////////////////////////////////////////////////////////
+		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<false>)
+		{
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
+			FETCH_ARG(3);
+			FETCH_ARG(4);
+			FETCH_ARG(5);
+			typedef typename FunctionTraits<Fn>::return_type ret_type;
+			ret_type ret = fn(arg0, arg1, arg2, arg3, arg4, arg5);
+			return PushReturnToGM(a_thread, ret);
+		}
+		//////////////////////////////////////////////////////////////////////////
+		// member function, no return value
+		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<true>, Meta::BoolToType<true>)
+		{
+			CHECKTHIS;
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
+			FETCH_ARG(3);
+			FETCH_ARG(4);
+			FETCH_ARG(5);
+			(obj->*fn)(arg0, arg1, arg2, arg3, arg4, arg5);
+			return GM_OK;
+		}
+		//////////////////////////////////////////////////////////////////////////
+		// member function, one return value
+		static int Call(gmThread *a_thread, Fn fn, Meta::BoolToType<false>, Meta::BoolToType<true>)
+		{
+			CHECKTHIS;
+			FETCH_ARG(0);
+			FETCH_ARG(1);
+			FETCH_ARG(2);
+			FETCH_ARG(3);
+			FETCH_ARG(4);
+			FETCH_ARG(5);
+			typedef typename FunctionTraits<Fn>::return_type ret_type;
+			ret_type ret = (obj->*fn)(arg0, arg1, arg2, arg3, arg4, arg5);
+			return PushReturnToGM(a_thread, ret);
+		}
+	};
 	//...
 	//////////////////////////////////////////////////////////////////////////
 	template<typename Fn, int>
@@ -797,21 +1041,105 @@ namespace gmBind2
 	template <typename Fn>
 	struct GMExportFunctor : public gmObjFunctor
 	{
+		typedef GMSignature<Fn, FunctionTraits<Fn>::Arity> Signature;
+
 		int operator()(gmThread *a_thread)
+		{
+			if(!Signature::Match(a_thread))
+				return Signature::Raise(a_thread);
+			return Invoke(a_thread, this);
+		}
+		// call without checking the arguments
+		static int Invoke(gmThread *a_thread, gmObjFunctor *a_functor)
 		{
 			using namespace Meta;
 			typedef typename FunctionTraits<Fn>::return_type ret_type;
 			return GMExportStruct<Fn, FunctionTraits<Fn>::Arity>::Call(
 				a_thread,
-				m_Function,
+				static_cast<GMExportFunctor*>(a_functor)->m_Function,
 				BoolToType<IsSame<ret_type, void>::value>(), // void return
 				BoolToType<IsMemberFunction<Fn>::value>()); // member function
 		}
+		static gmObjFunctor *Clone(gmObjFunctor *a_functor)
+		{
+			return new GMExportFunctor(static_cast<GMExportFunctor*>(a_functor)->m_Function);
+		}
 		GMExportFunctor(Fn a_fn) : m_Function(a_fn) {}
 	private:
 		Fn				m_Function;
 	};
 	//////////////////////////////////////////////////////////////////////////
+	// Functions bound to the same name, dispatched by the number of arguments and then the
+	// first signature that matches, in the order they were bound.
+	struct GMOverloadFunctor : public gmObjFunctor
+	{
+		typedef bool (*pfnMatch)(gmThread *a_thread);
+		typedef int (*pfnInvoke)(gmThread *a_thread, gmObjFunctor *a_functor);
+		typedef gmObjFunctor *(*pfnClone)(gmObjFunctor *a_functor);
+
+		enum { MaxArity = 6 };
+
+		int operator()(gmThread *a_thread)
+		{
+			const int numParams = a_thread->GetNumParams();
+			if(numParams <= MaxArity)
+			{
+				const std::vector<Overload> &overloads = m_Overloads[numParams];
+				for(size_t i = 0; i < overloads.size(); ++i)
+				{
+					if(overloads[i].m_Match(a_thread))
+						return overloads[i].m_Invoke(a_thread, overloads[i].m_Functor);
+				}
+			}
+			GM_EXCEPTION_MSG("no overload of %s takes these %d param(s)", m_Name.c_str(), numParams);
+			return GM_EXCEPTION;
+		}
+		template <typename Fn>
+		void Add(Fn a_fn)
+		{
+			GM_ASSERT(FunctionTraits<Fn>::Arity <= MaxArity);
+			Overload o;
+			o.m_Match = GMExportFunctor<Fn>::Signature::Match;
+			o.m_Invoke = GMExportFunctor<Fn>::Invoke;
+			o.m_Clone = GMExportFunctor<Fn>::Clone;
+			o.m_Functor = new GMExportFunctor<Fn>(a_fn);
+			m_Overloads[FunctionTraits<Fn>::Arity].push_back(o);
+		}
+		GMOverloadFunctor(const char *a_name) : m_Name(a_name) {}
+		GMOverloadFunctor(const GMOverloadFunctor &a_other) : m_Name(a_other.m_Name)
+		{
+			for(int a = 0; a <= MaxArity; ++a)
+			{
+				for(size_t i = 0; i < a_other.m_Overloads[a].size(); ++i)
+				{
+					Overload o = a_other.m_Overloads[a][i];
+					o.m_Functor = o.m_Clone(o.m_Functor);
+					m_Overloads[a].push_back(o);
+				}
+			}
+		}
+		~GMOverloadFunctor()
+		{
+			for(int a = 0; a <= MaxArity; ++a)
+			{
+				for(size_t i = 0; i < m_Overloads[a].size(); ++i)
+					delete m_Overloads[a][i].m_Functor;
+			}
+		}
+	private:
+		struct Overload
+		{
+			pfnMatch		m_Match;
+			pfnInvoke		m_Invoke;
+			pfnClone		m_Clone;
+			gmObjFunctor	*m_Functor;
+		};
+		std::vector<Overload>	m_Overloads[MaxArity + 1];
+		std::string				m_Name;
+
+		GMOverloadFunctor &operator=(const GMOverloadFunctor &);
+	};
+	//////////////////////////////////////////////////////////////////////////
 	template <typename Fn>
 	struct GMExportOpFunctor : public gmObjFunctor
 	{
@@ -23,9 +23,11 @@
 #ifndef _GMBINDER2_CLASS_H_
 #define _GMBINDER2_CLASS_H_
 
+#include <string.h>
 #include <string>
 #include <map>
 #include <list>
+#include <vector>
 
 #define GMBIND2_DOCUMENT_SUPPORT 1
 
@@ -185,10 +187,20 @@ namespace gmBind2
 			typedef typename FunctionTraits<Fn>::Class_Type cls_type;
 			GM_ASSERT(ClassBase<cls_type>::ClassType() != GM_NULL);
 
+			// a name bound again is an overload, dispatched through a table of every function bound to it
+			typename OverloadMap::iterator it = m_Overloads.find(a_funcname);
+			const bool overloaded = it != m_Overloads.end();
+			if(!overloaded)
+				it = m_Overloads.insert(std::make_pair(std::string(a_funcname), GMOverloadFunctor(a_funcname))).first;
+			it->second.Add(a_fn);
+
 			gmFunctionEntry fn = {0,0,0};
 			fn.m_name = a_funcname;
 			fn.m_function = 0;
-			fn.m_functor = new GMExportFunctor<Fn>(a_fn);
+			if(overloaded)
+				fn.m_functor = new GMOverloadFunctor(it->second);
+			else
+				fn.m_functor = new GMExportFunctor<Fn>(a_fn);
 			ClassBase<ClassT>::m_Machine->RegisterTypeLibrary(ClassBase<ClassT>::ClassType(), &fn, 1);
 
 			//////////////////////////////////////////////////////////////////////////
@@ -260,8 +272,7 @@ namespace gmBind2
 			pr.m_PropertyOffset = get_offset(_var);
 			pr.m_TraceObject = GMProperty::TraceProperty<VarType>;
 			pr.m_Static = false;
-			GM_ASSERT(m_Properties.find(_name)==m_Properties.end());
-			m_Properties.insert(std::make_pair(_name, pr));
+			AddProperty(_name, pr);
 
 			//////////////////////////////////////////////////////////////////////////
 #if(GMBIND2_DOCUMENT_SUPPORT)
@@ -280,8 +291,7 @@ namespace gmBind2
 			pr.m_PropertyOffset = (size_t)(_var);
 			pr.m_TraceObject = GMProperty::TraceProperty<VarType>;
 			pr.m_Static = true;
-			GM_ASSERT(m_Properties.find(_name)==m_Properties.end());
-			m_Properties.insert(std::make_pair(_name, pr));
+			AddProperty(_name, pr);
 
 			//////////////////////////////////////////////////////////////////////////
 #if(GMBIND2_DOCUMENT_SUPPORT)
@@ -299,8 +309,7 @@ namespace gmBind2
 			pr.m_PropertyOffset = get_offset(_var);
 			pr.m_TraceObject = GMProperty::TraceProperty<VarType>;
 			pr.m_Static = false;
-			GM_ASSERT(m_Properties.find(_name)==m_Properties.end());
-			m_Properties.insert(std::make_pair(_name, pr));
+			AddProperty(_name, pr);
 
 			//////////////////////////////////////////////////////////////////////////
 #if(GMBIND2_DOCUMENT_SUPPORT)
@@ -316,8 +325,7 @@ namespace gmBind2
 			pr.m_SetterRaw = _setter;
 			pr.m_PropertyOffset = 0;
 			pr.m_Static = false;
-			GM_ASSERT(m_Properties.find(_name)==m_Properties.end());
-			m_Properties.insert(std::make_pair(_name, pr));
+			AddProperty(_name, pr);
 
 			//////////////////////////////////////////////////////////////////////////
 #if(GMBIND2_DOCUMENT_SUPPORT)
@@ -335,8 +343,7 @@ namespace gmBind2
 			pr.m_PropertyOffset = get_offset(_var);
 			pr.m_BitfieldOffset = _bit;
 			pr.m_Static = false;
-			GM_ASSERT(m_Properties.find(_name)==m_Properties.end());
-			m_Properties.insert(std::make_pair(_name, pr));
+			AddProperty(_name, pr);
 
 			//////////////////////////////////////////////////////////////////////////
 #if(GMBIND2_DOCUMENT_SUPPORT)
@@ -692,6 +699,9 @@ namespace gmBind2
 			GM_ASSERT(ClassBase<ClassT>::ClassType()!=GM_NULL);
 
 			m_Properties.clear();
+			m_PropertySlots.clear();
+			m_PropertySlotCount = 0;
+			m_Overloads.clear();
 
 			_machine->RegisterUserCallbacks(ClassBase<ClassT>::ClassType(), 
 				gmfTraceObject, 
@@ -738,6 +748,79 @@ namespace gmBind2
 		typedef std::map<std::string, gmPropertyFunctionPair> PropertyMap;
 		static PropertyMap m_Properties;
 
+		// every function bound to a name, the type variable holds a copy once there is more than one
+		typedef std::map<std::string, GMOverloadFunctor> OverloadMap;
+		static OverloadMap m_Overloads;
+
+		// m_Properties open addressed on the property name, for the dot operators.  The
+		// class is shared by every machine that binds it, so the names are hashed by contents.
+		struct PropertySlot
+		{
+			const char				*m_Name;
+			int						m_Length;
+			size_t					m_Hash;
+			gmPropertyFunctionPair	*m_Funcs;
+		};
+		typedef std::vector<PropertySlot> PropertySlots;
+		static PropertySlots m_PropertySlots;
+		static size_t m_PropertySlotCount;
+
+		static size_t HashPropertyName(const char *a_name, int a_length)
+		{
+			size_t hash = 2166136261u;
+			for(int i = 0; i < a_length; ++i)
+				hash = (hash ^ (unsigned char)a_name[i]) * 16777619u;
+			return hash;
+		}
+		static void InsertPropertySlot(const PropertySlot &a_slot)
+		{
+			if((m_PropertySlotCount + 1) * 2 > m_PropertySlots.size())
+			{
+				PropertySlots old;
+				old.swap(m_PropertySlots);
+				PropertySlot empty = { NULL, 0, 0, NULL };
+				m_PropertySlots.resize(old.empty() ? 16 : old.size() * 2, empty);
+				m_PropertySlotCount = 0;
+				for(size_t i = 0; i < old.size(); ++i)
+				{
+					if(old[i].m_Name)
+						InsertPropertySlot(old[i]);
+				}
+			}
+			const size_t mask = m_PropertySlots.size() - 1;
+			size_t i = a_slot.m_Hash & mask;
+			while(m_PropertySlots[i].m_Name)
+				i = (i + 1) & mask;
+			m_PropertySlots[i] = a_slot;
+			++m_PropertySlotCount;
+		}
+		static gmPropertyFunctionPair *FindProperty(const gmStringObject *a_name)
+		{
+			if(m_PropertySlots.empty())
+				return NULL;
+			const int length = a_name->GetLength();
+			const size_t hash = HashPropertyName(a_name->GetString(), length);
+			const size_t mask = m_PropertySlots.size() - 1;
+			for(size_t i = hash & mask;; i = (i + 1) & mask)
+			{
+				const PropertySlot &slot = m_PropertySlots[i];
+				if(!slot.m_Name)
+					return NULL;
+				if(slot.m_Hash == hash && slot.m_Length == length && memcmp(slot.m_Name, a_name->GetString(), length) == 0)
+					return slot.m_Funcs;
+			}
+		}
+
+		void AddProperty(const char *_name, const gmPropertyFunctionPair &_pr)
+		{
+			GM_ASSERT(m_Properties.find(_name)==m_Properties.end());
+			typename PropertyMap::iterator it = m_Properties.insert(std::make_pair(_name, _pr)).first;
+			// the map key keeps its address, the slot points at it
+			const int length = (int)it->first.length();
+			PropertySlot slot = { it->first.c_str(), length, HashPropertyName(it->first.c_str(), length), &it->second };
+			InsertPropertySlot(slot);
+		}
+
 		struct gmDoc
 		{
 			enum DocType { Prop,Func,Operator };
@@ -803,33 +886,32 @@ namespace gmBind2
 				return GM_EXCEPTION;
 			}
 
-			const char *pString = a_operands[1].GetCStringSafe();
-			if(pString)
+			gmStringObject *pName = a_operands[1].GetStringObjectSafe();
+			if(pName)
 			{
 				// custom handler defined?
 				if(ClassBase<ClassT>::m_GetDotEx && 
-					ClassBase<ClassT>::m_GetDotEx(a_thread,bo->m_NativeObj,pString,a_operands))
+					ClassBase<ClassT>::m_GetDotEx(a_thread,bo->m_NativeObj,pName->GetString(),a_operands))
 				{
 					return GM_OK;
 				}
 
-				typename Class<ClassT>::PropertyMap::iterator it = m_Properties.find(pString);
-				if(it != m_Properties.end())
+				gmPropertyFunctionPair *propfuncs = FindProperty(pName);
+				if(propfuncs)
 				{
-					gmPropertyFunctionPair &propfuncs = it->second;
-					if(propfuncs.m_Getter)
+					if(propfuncs->m_Getter)
 					{
-						return propfuncs.m_Getter(
+						return propfuncs->m_Getter(
 							bo->m_NativeObj, 
 							a_thread, 
 							a_operands, 
-							propfuncs.m_PropertyOffset, 
-							propfuncs.m_BitfieldOffset,
-							propfuncs.m_Static);
+							propfuncs->m_PropertyOffset, 
+							propfuncs->m_BitfieldOffset,
+							propfuncs->m_Static);
 					}
-					else if(propfuncs.m_GetterRaw)
+					else if(propfuncs->m_GetterRaw)
 					{
-						return propfuncs.m_GetterRaw(
+						return propfuncs->m_GetterRaw(
 							bo->m_NativeObj, 
 							a_thread, 
 							a_operands);						
@@ -839,7 +921,7 @@ namespace gmBind2
 				{
 					if(bo->m_Table)
 					{
-						a_operands[0] = bo->m_Table->Get(a_thread->GetMachine(),pString);
+						a_operands[0] = bo->m_Table->Get(a_operands[1]);
 						return GM_OK;
 					}
 				}
@@ -860,33 +942,32 @@ namespace gmBind2
 				return GM_EXCEPTION;
 			}
 
-			const char *pString = a_operands[2].GetCStringSafe();
-			if(pString)
+			gmStringObject *pName = a_operands[2].GetStringObjectSafe();
+			if(pName)
 			{
 				// custom handler defined?
 				if(ClassBase<ClassT>::m_SetDotEx && 
-					ClassBase<ClassT>::m_SetDotEx(a_thread,bo->m_NativeObj,pString,a_operands))
+					ClassBase<ClassT>::m_SetDotEx(a_thread,bo->m_NativeObj,pName->GetString(),a_operands))
 				{
 					return GM_OK;
 				}
 
-				typename Class<ClassT>::PropertyMap::iterator it = m_Properties.find(pString);
-				if(it != m_Properties.end())
+				gmPropertyFunctionPair *propfuncs = FindProperty(pName);
+				if(propfuncs)
 				{
-					gmPropertyFunctionPair &propfuncs = it->second;
-					if(propfuncs.m_Setter)
+					if(propfuncs->m_Setter)
 					{
-						return propfuncs.m_Setter(
+						return propfuncs->m_Setter(
 							bo->m_NativeObj, 
 							a_thread, 
 							a_operands, 
-							propfuncs.m_PropertyOffset, 
-							propfuncs.m_BitfieldOffset,
-							propfuncs.m_Static);
+							propfuncs->m_PropertyOffset, 
+							propfuncs->m_BitfieldOffset,
+							propfuncs->m_Static);
 					}
-					else if(propfuncs.m_SetterRaw)
+					else if(propfuncs->m_SetterRaw)
 					{
-						return propfuncs.m_SetterRaw(
+						return propfuncs->m_SetterRaw(
 							bo->m_NativeObj, 
 							a_thread, 
 							a_operands);
@@ -896,7 +977,7 @@ namespace gmBind2
 				{
 					if(bo->m_Table)
 					{
-						bo->m_Table->Set(a_thread->GetMachine(),pString,a_operands[1]);
+						bo->m_Table->Set(a_thread->GetMachine(),a_operands[2],a_operands[1]);
 						return GM_OK;
 					}
 				}
@@ -948,6 +1029,12 @@ namespace gmBind2
 
 	template <typename ClassT>
 	typename Class<ClassT>::PropertyMap Class<ClassT>::m_Properties;
+	template <typename ClassT>
+	typename Class<ClassT>::OverloadMap Class<ClassT>::m_Overloads;
+	template <typename ClassT>
+	typename Class<ClassT>::PropertySlots Class<ClassT>::m_PropertySlots;
+	template <typename ClassT>
+	size_t Class<ClassT>::m_PropertySlotCount = 0;
 	
 #if(GMBIND2_DOCUMENT_SUPPORT)
 	template <typename ClassT>
@@ -0,0 +1,588 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#include "gmConfig.h"
+#include "gmActor.h"
+#include "gmThread.h"
+#include "gmMachine.h"
+#include "gmHelpers.h"
+
+#if GM_ACTOR_LIB
+
+#include <chrono>
+
+//
+//
+// Implementation of actor messages
+//
+//
+
+bool gmActorMessage::Set(gmMachine * a_machine, const gmVariable &a_var, int a_from)
+{
+  m_from = a_from;
+  m_data.Reset();
+  return Write(a_machine, a_var, 0);
+}
+
+
+gmVariable gmActorMessage::Get(gmMachine * a_machine)
+{
+  // tables are rebuilt bottom up, don't let the gc see them half built
+  DisableGCInScope gcEn(a_machine);
+  m_data.Seek(0);
+  return Read(a_machine);
+}
+
+
+bool gmActorMessage::Write(gmMachine * a_machine, const gmVariable &a_var, int a_depth)
+{
+  if(!a_var.IsReference())
+  {
+    m_data.Write(&a_var, sizeof(gmVariable));
+    return true;
+  }
+
+  gmint32 type = a_var.m_type;
+  if(type == GM_STRING)
+  {
+    gmStringObject * str = (gmStringObject *) GM_MOBJECT(a_machine, a_var.m_value.m_ref);
+    gmint32 len = str->GetLength();
+    m_data.Write(&type, sizeof(type));
+    m_data.Write(&len, sizeof(len));
+    m_data.Write(str->GetString(), len + 1); // keep the terminator, the string pool expects it
+    return true;
+  }
+  else if(type == GM_TABLE)
+  {
+    if(a_depth >= GM_ACTOR_MAX_DEPTH)
+    {
+      return false;
+    }
+    gmTableObject * table = (gmTableObject *) GM_MOBJECT(a_machine, a_var.m_value.m_ref);
+    gmint32 count = table->Count();
+    m_data.Write(&type, sizeof(type));
+    m_data.Write(&count, sizeof(count));
+
+    gmTableIterator it;
+    for(gmTableNode * node = table->GetFirst(it); node; node = table->GetNext(it))
+    {
+      if(!Write(a_machine, node->m_key, a_depth + 1) || !Write(a_machine, node->m_value, a_depth + 1))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // functions and user objects belong to their machine
+  return false;
+}
+
+
+gmVariable gmActorMessage::Read(gmMachine * a_machine)
+{
+  gmVariable var;
+  unsigned int pos = m_data.Tell();
+  gmint32 type = GM_NULL;
+  m_data.Read(&type, sizeof(type));
+
+  if(type == GM_STRING)
+  {
+    gmint32 len = 0;
+    m_data.Read(&len, sizeof(len));
+    var.SetString(a_machine->AllocStringObject(m_data.GetData() + m_data.Tell(), len));
+    m_data.Seek(m_data.Tell() + len + 1);
+  }
+  else if(type == GM_TABLE)
+  {
+    gmint32 count = 0;
+    m_data.Read(&count, sizeof(count));
+    gmTableObject * table = a_machine->AllocTableObject();
+    for(int i = 0; i < count; ++i)
+    {
+      gmVariable key = Read(a_machine);
+      gmVariable value = Read(a_machine);
+      table->Set(a_machine, key, value);
+    }
+    var.SetTable(table);
+  }
+  else
+  {
+    // value types were written whole, the type led the variable
+    m_data.Seek(pos);
+    m_data.Read(&var, sizeof(gmVariable));
+  }
+  return var;
+}
+
+
+//
+//
+// Implementation of the mailbox, intrusive mpsc queue with a stub node
+//
+//
+
+gmActorMailbox::gmActorMailbox()
+{
+  m_head.store(&m_stub);
+  m_tail = &m_stub;
+}
+
+
+gmActorMailbox::~gmActorMailbox()
+{
+  while(gmActorMessage * message = Pop())
+  {
+    delete message;
+  }
+}
+
+
+void gmActorMailbox::Push(gmActorMessage * a_message)
+{
+  a_message->m_next.store(NULL, std::memory_order_relaxed);
+  gmActorMessage * prev = m_head.exchange(a_message);
+  prev->m_next.store(a_message, std::memory_order_release);
+}
+
+
+gmActorMessage * gmActorMailbox::Pop()
+{
+  gmActorMessage * tail = m_tail;
+  gmActorMessage * next = tail->m_next.load(std::memory_order_acquire);
+
+  if(tail == &m_stub)
+  {
+    if(next == NULL)
+    {
+      return NULL;
+    }
+    m_tail = next;
+    tail = next;
+    next = next->m_next.load(std::memory_order_acquire);
+  }
+
+  if(next)
+  {
+    m_tail = next;
+    return tail;
+  }
+
+  // a producer has swapped the head but not linked it yet
+  if(tail != m_head.load())
+  {
+    return NULL;
+  }
+
+  Push(&m_stub);
+  next = tail->m_next.load(std::memory_order_acquire);
+  if(next)
+  {
+    m_tail = next;
+    return tail;
+  }
+  return NULL;
+}
+
+
+bool gmActorMailbox::IsEmpty() const
+{
+  return (m_tail->m_next.load(std::memory_order_acquire) == NULL && m_head.load() == m_tail);
+}
+
+
+//
+//
+// Implementation of an actor
+//
+//
+
+class gmActor
+{
+public:
+
+  gmActor(gmActorPool * a_pool, int a_id);
+  ~gmActor();
+
+  void Run(gmActorInitCallback a_init, void * a_user, bool a_exitWhenIdle, std::atomic<int> * a_numFailed);
+  void Post(gmActorMessage * a_message);
+  void Wake();
+
+  int Receive(gmThread * a_thread);
+
+  gmActorPool * m_pool;
+  int m_id;
+  std::thread m_thread;
+  std::atomic<bool> m_stop;
+
+private:
+
+  void Deliver();
+  void Wait(int a_timeoutMs);
+  gmVariable MakeResult(gmActorMessage * a_message, gmTableObject * a_result);
+
+  gmMachine * m_machine;
+  gmActorMailbox m_mailbox;
+
+  // messages taken from the mailbox with no receiver waiting
+  gmActorMessage * m_inboxHead;
+  gmActorMessage * m_inboxTail;
+
+  // tables threads are blocked on in actorReceive(), keyed [m_waitFirst, m_waitLast)
+  gmTableObject * m_waiters;
+  int m_waitFirst;
+  int m_waitLast;
+
+  std::mutex m_wakeMutex;
+  std::condition_variable m_wake;
+  std::atomic<bool> m_idle;
+};
+
+
+/// \brief Script function bound per machine, carries the owning actor.
+class gmActorFunctor : public gmObjFunctor
+{
+public:
+
+  typedef int (GM_CDECL *Function)(gmThread * a_thread, gmActor * a_actor);
+
+  gmActorFunctor(gmActor * a_actor, Function a_function) : m_actor(a_actor), m_function(a_function) {}
+  virtual int operator()(gmThread * a_thread) { return m_function(a_thread, m_actor); }
+
+private:
+
+  gmActor * m_actor;
+  Function m_function;
+};
+
+
+static int GM_CDECL gmfActorId(gmThread * a_thread, gmActor * a_actor)
+{
+  GM_CHECK_NUM_PARAMS(0);
+  a_thread->PushInt(a_actor->m_id);
+  return GM_OK;
+}
+
+
+static int GM_CDECL gmfActorCount(gmThread * a_thread, gmActor * a_actor)
+{
+  GM_CHECK_NUM_PARAMS(0);
+  a_thread->PushInt(a_actor->m_pool->GetNumActors());
+  return GM_OK;
+}
+
+
+static int GM_CDECL gmfActorSend(gmThread * a_thread, gmActor * a_actor)
+{
+  GM_CHECK_NUM_PARAMS(2);
+  GM_CHECK_INT_PARAM(id, 0);
+
+  gmActorMessage * message = new gmActorMessage;
+  if(!message->Set(a_thread->GetMachine(), a_thread->Param(1), a_actor->m_id))
+  {
+    delete message;
+    GM_EXCEPTION_MSG("actorSend value can not be copied between machines");
+    return GM_EXCEPTION;
+  }
+  a_thread->PushInt(a_actor->m_pool->Post(id, message) ? 1 : 0);
+  return GM_OK;
+}
+
+
+static int GM_CDECL gmfActorReceive(gmThread * a_thread, gmActor * a_actor)
+{
+  GM_CHECK_NUM_PARAMS(0);
+  return a_actor->Receive(a_thread);
+}
+
+
+gmActor::gmActor(gmActorPool * a_pool, int a_id)
+  : m_pool(a_pool)
+  , m_id(a_id)
+  , m_stop(false)
+  , m_machine(NULL)
+  , m_inboxHead(NULL)
+  , m_inboxTail(NULL)
+  , m_waiters(NULL)
+  , m_waitFirst(0)
+  , m_waitLast(0)
+  , m_idle(false)
+{
+}
+
+
+gmActor::~gmActor()
+{
+  while(m_inboxHead)
+  {
+    gmActorMessage * message = m_inboxHead;
+    m_inboxHead = message->m_next.load(std::memory_order_relaxed);
+    delete message;
+  }
+}
+
+
+void gmActor::Run(gmActorInitCallback a_init, void * a_user, bool a_exitWhenIdle, std::atomic<int> * a_numFailed)
+{
+  m_machine = new gmMachine;
+  m_machine->RegisterLibraryFunction("actorId", NULL, NULL, new gmActorFunctor(this, gmfActorId));
+  m_machine->RegisterLibraryFunction("actorCount", NULL, NULL, new gmActorFunctor(this, gmfActorCount));
+  m_machine->RegisterLibraryFunction("actorSend", NULL, NULL, new gmActorFunctor(this, gmfActorSend));
+  m_machine->RegisterLibraryFunction("actorReceive", NULL, NULL, new gmActorFunctor(this, gmfActorReceive));
+
+  m_waiters = m_machine->AllocTableObject();
+  m_machine->AddCPPOwnedGMObject(m_waiters);
+
+  bool ok = a_init(m_machine, m_id, a_user);
+  if(!ok)
+  {
+    ++(*a_numFailed);
+  }
+
+  std::chrono::steady_clock::time_point last = std::chrono::steady_clock::now();
+  long long elapsedUs = 0;
+
+  while(ok && !m_stop.load())
+  {
+    Deliver();
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    elapsedUs += std::chrono::duration_cast<std::chrono::microseconds>(now - last).count();
+    last = now;
+    gmuint32 deltaMs = (gmuint32) (elapsedUs / 1000);
+    elapsedUs -= deltaMs * 1000;
+
+    m_machine->Execute(deltaMs);
+
+    if(m_machine->HasRunningThreads())
+    {
+      continue;
+    }
+    if(m_machine->GetNumThreads() == 0)
+    {
+      if(a_exitWhenIdle && m_inboxHead == NULL && m_mailbox.IsEmpty())
+      {
+        break;
+      }
+      Wait(100);
+    }
+    else
+    {
+      // sleeping or blocked threads, wake for the next tick or a message
+      Wait(1);
+    }
+  }
+
+  m_machine->RemoveCPPOwnedGMObject(m_waiters);
+  m_waiters = NULL;
+  delete m_machine;
+  m_machine = NULL;
+}
+
+
+void gmActor::Post(gmActorMessage * a_message)
+{
+  m_mailbox.Push(a_message);
+  if(m_idle.load())
+  {
+    Wake();
+  }
+}
+
+
+void gmActor::Wake()
+{
+  std::lock_guard<std::mutex> lock(m_wakeMutex);
+  m_wake.notify_one();
+}
+
+
+void gmActor::Wait(int a_timeoutMs)
+{
+  std::unique_lock<std::mutex> lock(m_wakeMutex);
+  m_idle.store(true);
+  if(m_mailbox.IsEmpty() && !m_stop.load())
+  {
+    m_wake.wait_for(lock, std::chrono::milliseconds(a_timeoutMs));
+  }
+  m_idle.store(false);
+}
+
+
+gmVariable gmActor::MakeResult(gmActorMessage * a_message, gmTableObject * a_result)
+{
+  gmVariable data = a_message->Get(m_machine);
+  a_result->Set(m_machine, "from", gmVariable(a_message->GetFrom()));
+  a_result->Set(m_machine, "data", data);
+  return gmVariable(a_result);
+}
+
+
+int gmActor::Receive(gmThread * a_thread)
+{
+  Deliver();
+
+  if(m_inboxHead)
+  {
+    gmActorMessage * message = m_inboxHead;
+    m_inboxHead = message->m_next.load(std::memory_order_relaxed);
+    if(m_inboxHead == NULL) m_inboxTail = NULL;
+
+    a_thread->Push(MakeResult(message, m_machine->AllocTableObject()));
+    delete message;
+    return GM_OK;
+  }
+
+  // block on a fresh table, Deliver() fills it in and signals it when a message arrives
+  gmTableObject * result = m_machine->AllocTableObject();
+  gmVariable block(result);
+  m_waiters->Set(m_machine, m_waitLast++, block);
+  m_machine->Sys_Block(a_thread, 1, &block);
+  return GM_SYS_BLOCK;
+}
+
+
+void gmActor::Deliver()
+{
+  while(gmActorMessage * message = m_mailbox.Pop())
+  {
+    message->m_next.store(NULL, std::memory_order_relaxed);
+    if(m_inboxTail) m_inboxTail->m_next.store(message, std::memory_order_relaxed);
+    else m_inboxHead = message;
+    m_inboxTail = message;
+  }
+
+  while(m_inboxHead && m_waitFirst != m_waitLast)
+  {
+    gmTableObject * result = m_waiters->Get(m_waitFirst).GetTableObjectSafe();
+
+    // a receiver killed while blocked leaves its table behind, skip it
+    if(result && m_machine->Signal(MakeResult(m_inboxHead, result), GM_INVALID_THREAD, GM_INVALID_THREAD))
+    {
+      gmActorMessage * message = m_inboxHead;
+      m_inboxHead = message->m_next.load(std::memory_order_relaxed);
+      if(m_inboxHead == NULL) m_inboxTail = NULL;
+      delete message;
+    }
+    m_waiters->Set(m_machine, m_waitFirst++, gmVariable::s_null);
+  }
+}
+
+
+//
+//
+// Implementation of the pool
+//
+//
+
+gmActorPool::gmActorPool()
+  : m_actors(NULL)
+  , m_numActors(0)
+  , m_numFailed(0)
+{
+}
+
+
+gmActorPool::~gmActorPool()
+{
+  Stop();
+}
+
+
+bool gmActorPool::Start(int a_numActors, gmActorInitCallback a_init, void * a_user, bool a_exitWhenIdle)
+{
+  if(m_actors || a_numActors <= 0 || a_init == NULL)
+  {
+    return false;
+  }
+
+  m_numActors = a_numActors;
+  m_numFailed = 0;
+  m_actors = new gmActor*[a_numActors];
+  for(int i = 0; i < a_numActors; ++i)
+  {
+    m_actors[i] = new gmActor(this, i);
+  }
+  // all actors exist before any runs, so an early actorSend() always has somewhere to go
+  for(int i = 0; i < a_numActors; ++i)
+  {
+    m_actors[i]->m_thread = std::thread(&gmActor::Run, m_actors[i], a_init, a_user, a_exitWhenIdle, &m_numFailed);
+  }
+  return true;
+}
+
+
+void gmActorPool::Stop()
+{
+  if(m_actors == NULL)
+  {
+    return;
+  }
+  for(int i = 0; i < m_numActors; ++i)
+  {
+    m_actors[i]->m_stop.store(true);
+    m_actors[i]->Wake();
+  }
+  Join();
+}
+
+
+void gmActorPool::Join()
+{
+  if(m_actors == NULL)
+  {
+    return;
+  }
+  for(int i = 0; i < m_numActors; ++i)
+  {
+    if(m_actors[i]->m_thread.joinable())
+    {
+      m_actors[i]->m_thread.join();
+    }
+  }
+  for(int i = 0; i < m_numActors; ++i)
+  {
+    delete m_actors[i];
+  }
+  delete [] m_actors;
+  m_actors = NULL;
+  m_numActors = 0;
+}
+
+
+bool gmActorPool::Post(int a_actorId, gmActorMessage * a_message)
+{
+  if(a_message == NULL)
+  {
+    return false;
+  }
+  if(a_actorId < 0 || a_actorId >= m_numActors)
+  {
+    delete a_message;
+    return false;
+  }
+  m_actors[a_actorId]->Post(a_message);
+  return true;
+}
+
+
+bool gmActorPool::Send(int a_actorId, gmMachine * a_machine, const gmVariable &a_var, int a_from)
+{
+  gmActorMessage * message = new gmActorMessage;
+  if(!message->Set(a_machine, a_var, a_from))
+  {
+    delete message;
+    return false;
+  }
+  return Post(a_actorId, message);
+}
+
+#endif // GM_ACTOR_LIB
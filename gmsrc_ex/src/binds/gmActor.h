@@ -0,0 +1,149 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#ifndef _GMACTOR_H_
+#define _GMACTOR_H_
+
+#include "gmConfig.h"
+#include "gmVariable.h"
+#include "gmStreamBuffer.h"
+
+#define GM_ACTOR_LIB 1
+#define GM_ACTOR_MAX_DEPTH      32   // max table nesting copied into a message, catches cycles
+
+#if GM_ACTOR_LIB
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Fwd decls
+class gmMachine;
+class gmActor;
+class gmActorPool;
+
+/*!
+  \class gmActorMessage
+  \brief A value deep copied out of one machine so it can be rebuilt in another.
+
+  Null, int, float, vec3, entity, string and (nested) table values may be sent.
+  Functions and user objects are owned by their machine and can not.
+*/
+class gmActorMessage
+{
+public:
+
+  gmActorMessage() : m_next(NULL), m_from(-1) {}
+
+  /// \brief Set() copies a_var out of a_machine.
+  /// \return false if a_var contains a type that can not be sent.
+  bool Set(gmMachine * a_machine, const gmVariable &a_var, int a_from = -1);
+
+  /// \brief Get() rebuilds the value inside a_machine.
+  gmVariable Get(gmMachine * a_machine);
+
+  /// \brief GetFrom() returns the id of the sending actor, -1 for the host.
+  inline int GetFrom() const { return m_from; }
+
+private:
+
+  bool Write(gmMachine * a_machine, const gmVariable &a_var, int a_depth);
+  gmVariable Read(gmMachine * a_machine);
+
+  std::atomic<gmActorMessage *> m_next;
+  int m_from;
+  gmStreamBufferDynamic m_data;
+
+  friend class gmActorMailbox;
+  friend class gmActor;
+};
+
+
+/*!
+  \class gmActorMailbox
+  \brief Lock free multiple producer, single consumer message queue.
+*/
+class gmActorMailbox
+{
+public:
+
+  gmActorMailbox();
+  ~gmActorMailbox();
+
+  /// \brief Push() may be called from any thread.
+  void Push(gmActorMessage * a_message);
+  /// \brief Pop() may only be called from the owning actor's thread.
+  gmActorMessage * Pop();
+  /// \brief IsEmpty() may only be called from the owning actor's thread.
+  bool IsEmpty() const;
+
+private:
+
+  std::atomic<gmActorMessage *> m_head;
+  gmActorMessage * m_tail;
+  gmActorMessage m_stub;
+};
+
+
+/// \brief Called on the actor's own thread to bind libraries and load script.
+/// Actors initialise in parallel, use gmMachine::SetPrintCallback() etc rather than the globals.
+typedef bool (GM_CDECL *gmActorInitCallback)(gmMachine * a_machine, int a_actorId, void * a_user);
+
+
+/*!
+  \class gmActorPool
+  \brief Runs a number of gmMachines, one per OS thread, that talk by message passing only.
+
+  Each actor owns its machine outright, no script object is ever shared.  Script gets:
+    int actorId()                  - this actor's id, 0 to actorCount() - 1
+    int actorCount()               - number of actors in the pool
+    int actorSend(id, value)       - post a copy of value to actor id, returns 1 on success
+    table actorReceive()           - block until a message arrives, returns { from=id, data=value }
+*/
+class gmActorPool
+{
+public:
+
+  gmActorPool();
+  ~gmActorPool();
+
+  /// \brief Start() creates a_numActors machines and threads.
+  /// \param a_exitWhenIdle true to let an actor finish once it has no threads left
+  bool Start(int a_numActors, gmActorInitCallback a_init, void * a_user = NULL, bool a_exitWhenIdle = false);
+
+  /// \brief Stop() asks all actors to finish and waits for them.
+  void Stop();
+
+  /// \brief Join() waits for all actors to finish by themselves.
+  void Join();
+
+  /// \brief Post() hands a message to an actor, the pool takes ownership.
+  bool Post(int a_actorId, gmActorMessage * a_message);
+
+  /// \brief Send() copies a_var out of a_machine and posts it.
+  bool Send(int a_actorId, gmMachine * a_machine, const gmVariable &a_var, int a_from = -1);
+
+  inline int GetNumActors() const { return m_numActors; }
+
+  /// \brief GetNumFailed() returns the number of actors whose init callback failed.
+  inline int GetNumFailed() const { return m_numFailed; }
+
+private:
+
+  gmActor ** m_actors;
+  int m_numActors;
+  std::atomic<int> m_numFailed;
+};
+
+#endif // GM_ACTOR_LIB
+
+#endif // _GMACTOR_H_
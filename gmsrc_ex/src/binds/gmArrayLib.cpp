@@ -14,6 +14,10 @@
 #include "gmThread.h"
 #include "gmMachine.h"
 #include "gmHelpers.h"
+#include "gmCall.h"
+
+#include <algorithm>
+#include <vector>
 
 //
 //
@@ -24,19 +28,30 @@
 #if GM_ARRAY_LIB
 
 // Statics and globals
-gmType GM_ARRAY = GM_NULL;
-gmVariable gmUserArray::m_null;
+gmLibType GM_ARRAY;
+const gmVariable gmUserArray::m_null(GM_NULL, 0);
 
 
 bool gmUserArray::Construct(gmMachine * a_machine, int a_size)
 {
-  m_null.Nullify();
   m_array = NULL;
   m_size = 0;
+  m_owner = NULL;
+  m_offset = 0;
   return Resize(a_machine, a_size);
 }
 
 
+void gmUserArray::ConstructView(gmUserObject * a_arrayObject, int a_offset, int a_count)
+{
+  gmUserArray * array = (gmUserArray *) a_arrayObject->m_user;
+  m_array = NULL;
+  m_size = a_count;
+  m_owner = array->m_owner ? array->m_owner : a_arrayObject;
+  m_offset = array->m_offset + a_offset;
+}
+
+
 void gmUserArray::Destruct(gmMachine * a_machine)
 {
   if(m_array)
@@ -45,12 +60,20 @@ void gmUserArray::Destruct(gmMachine * a_machine)
     m_array = NULL;
   }
   m_size = 0;
+  m_owner = NULL;
 }
 
 
 bool gmUserArray::Resize(gmMachine * a_machine, int a_size)
 {
   if(a_size < 0) a_size = 0;
+  if(m_owner)
+  {
+    int size = ((gmUserArray *) m_owner->m_user)->m_size - m_offset;
+    m_size = (a_size < size) ? a_size : size;
+    if(m_size < 0) m_size = 0;
+    return true;
+  }
   int copysize = (a_size > m_size) ? m_size : a_size;
   gmVariable * array = (gmVariable *) a_machine->Sys_Alloc(sizeof(gmVariable) * a_size);
   // copy contents.
@@ -75,6 +98,13 @@ bool gmUserArray::Resize(gmMachine * a_machine, int a_size)
 #if GM_USE_INCGC
 bool gmUserArray::Trace(gmMachine * a_machine, gmGarbageCollector* a_gc, const int a_workLeftToGo, int& a_workDone)
 {
+  if(m_owner)
+  {
+    a_gc->GetNextObject(m_owner);
+    ++a_workDone;
+    return true;
+  }
+
   int i;
   for(i = 0; i < m_size; ++i)
   {
@@ -92,6 +122,12 @@ bool gmUserArray::Trace(gmMachine * a_machine, gmGarbageCollector* a_gc, const i
 #else //GM_USE_INCGC
 void gmUserArray::Mark(gmMachine * a_machine, gmuint32 a_mark)
 {
+  if(m_owner)
+  {
+    if(m_owner->NeedsMark(a_mark)) m_owner->Mark(a_machine, a_mark);
+    return;
+  }
+
   int i;
   for(i = 0; i < m_size; ++i)
   {
@@ -107,31 +143,33 @@ void gmUserArray::Mark(gmMachine * a_machine, gmuint32 a_mark)
 
 bool gmUserArray::Shift(int a_shift)
 {
+  gmVariable * array = GetData();
+  int size = Size();
   if(a_shift < 0) // shift left
   {
     a_shift = -a_shift;
-    if(a_shift >= m_size)
+    if(a_shift >= size)
     {
-      memset(m_array, 0, m_size);
+      memset(array, 0, sizeof(gmVariable) * size);
     }
     else
     {
-      int size = m_size - a_shift;
-      memmove(m_array, m_array + a_shift, sizeof(gmVariable) * size);
-      memset(m_array + size, 0, sizeof(gmVariable) * a_shift);
+      size -= a_shift;
+      memmove(array, array + a_shift, sizeof(gmVariable) * size);
+      memset(array + size, 0, sizeof(gmVariable) * a_shift);
     }
   }
   else if(a_shift > 0) // shift right
   {
-    if(a_shift >= m_size)
+    if(a_shift >= size)
     {
-      memset(m_array, 0, m_size);
+      memset(array, 0, sizeof(gmVariable) * size);
     }
     else
     {
-      int size = m_size - a_shift;
-      memmove(m_array + a_shift, m_array, sizeof(gmVariable) * size);
-      memset(m_array, 0, sizeof(gmVariable) * a_shift);
+      size -= a_shift;
+      memmove(array + a_shift, array, sizeof(gmVariable) * size);
+      memset(array, 0, sizeof(gmVariable) * a_shift);
     }
   }
   return true;
@@ -143,6 +181,7 @@ int gmUserArray::Move(int a_dest, int a_src, int a_size)
   int start = a_src;
   int dest = a_dest;
   int size = a_size;
+  int arraySize = Size();
 
   if(start < 0)
   {
@@ -159,26 +198,26 @@ int gmUserArray::Move(int a_dest, int a_src, int a_size)
   }
 
   if(size <= 0) return 0;
-  if(start >= m_size) return 0;
-  if(dest >= m_size) return 0;
+  if(start >= arraySize) return 0;
+  if(dest >= arraySize) return 0;
   if((dest + size) < 0) return 0;
 
-  if(start + size > m_size)
+  if(start + size > arraySize)
   {
-    size = m_size - start;
+    size = arraySize - start;
   }
-  if(dest + size > m_size)
+  if(dest + size > arraySize)
   {
-    size = m_size - dest;
+    size = arraySize - dest;
   }
   if(size <= 0) return 0;
 
   GM_ASSERT(dest >= 0);
   GM_ASSERT(start >= 0);
-  GM_ASSERT(start + size <= m_size);
-  GM_ASSERT(dest + size <= m_size);
+  GM_ASSERT(start + size <= arraySize);
+  GM_ASSERT(dest + size <= arraySize);
 
-  memmove(m_array + dest, m_array + start, sizeof(gmVariable) * size);
+  memmove(GetData() + dest, GetData() + start, sizeof(gmVariable) * size);
 
   return size;
 }
@@ -198,14 +237,14 @@ static int GM_CDECL gmfArray(gmThread * a_thread) // size
   GM_INT_PARAM(size, 0, 0);
   gmUserArray * array = (gmUserArray *) a_thread->GetMachine()->Sys_Alloc(sizeof(gmUserArray));
   array->Construct(a_thread->GetMachine(), size);
-  a_thread->PushNewUser(array, GM_ARRAY);
+  a_thread->PushNewUser(array, GM_ARRAY.Get(a_thread));
   return GM_OK;
 }
 
 static int GM_CDECL gmfArraySize(gmThread * a_thread) // return size
 {
   gmUserObject * arrayObject = a_thread->ThisUserObject();
-  GM_ASSERT(arrayObject->m_userType == GM_ARRAY);
+  GM_ASSERT(arrayObject->m_userType == GM_ARRAY.Get(a_thread));
   if(arrayObject->m_user)
   {
     gmUserArray * array = (gmUserArray *) arrayObject->m_user;
@@ -218,7 +257,7 @@ static int GM_CDECL gmfArrayResize(gmThread * a_thread) // size
 {
   GM_INT_PARAM(size, 0, 0);
   gmUserObject * arrayObject = a_thread->ThisUserObject();
-  GM_ASSERT(arrayObject->m_userType == GM_ARRAY);
+  GM_ASSERT(arrayObject->m_userType == GM_ARRAY.Get(a_thread));
   if(arrayObject->m_user)
   {
     gmUserArray * array = (gmUserArray *) arrayObject->m_user;
@@ -233,7 +272,7 @@ static int GM_CDECL gmfArrayShift(gmThread * a_thread) // shift
   GM_CHECK_INT_PARAM(shift, 0);
 
   gmUserObject * arrayObject = a_thread->ThisUserObject();
-  GM_ASSERT(arrayObject->m_userType == GM_ARRAY);
+  GM_ASSERT(arrayObject->m_userType == GM_ARRAY.Get(a_thread));
   if(arrayObject->m_user)
   {
     gmUserArray * array = (gmUserArray *) arrayObject->m_user;
@@ -250,7 +289,7 @@ static int GM_CDECL gmfArrayMove(gmThread * a_thread) // dst, src, size
   GM_CHECK_INT_PARAM(size, 2);
 
   gmUserObject * arrayObject = a_thread->ThisUserObject();
-  GM_ASSERT(arrayObject->m_userType == GM_ARRAY);
+  GM_ASSERT(arrayObject->m_userType == GM_ARRAY.Get(a_thread));
   if(arrayObject->m_user)
   {
     gmUserArray * array = (gmUserArray *) arrayObject->m_user;
@@ -259,10 +298,314 @@ static int GM_CDECL gmfArrayMove(gmThread * a_thread) // dst, src, size
   return GM_OK;
 }
 
+/// \brief gmThisArray() returns the array of this.
+static gmUserArray * gmThisArray(gmThread * a_thread)
+{
+  gmUserObject * arrayObject = a_thread->ThisUserObject();
+  GM_ASSERT(arrayObject->m_userType == GM_ARRAY.Get(a_thread));
+  return (gmUserArray *) arrayObject->m_user;
+}
+
+#define GM_ARRAY_THIS(VAR) \
+  gmUserArray * VAR = gmThisArray(a_thread); \
+  if(!VAR) { GM_EXCEPTION_MSG("expecting this as array"); return GM_EXCEPTION; }
+
+/// \brief gmArrayCall() calls a_call once with a_numParams, false if the function raised an exception or did not finish.
+static bool gmArrayCall(gmThread * a_thread, gmBatchCall &a_call, const gmVariable * a_params, int a_numParams, gmVariable &a_return)
+{
+  if(a_call.CallParams(a_params, a_numParams, 1, &a_return) == 0)
+  {
+    if(a_call.GetNumUnfinished() == 0) return true;
+    GM_EXCEPTION_MSG("array function must not yield");
+  }
+  return false;
+}
+
+/// \brief gmArrayIsTrue() tests a function return the way if() would, except for operator bool of user types.
+static GM_FORCEINLINE bool gmArrayIsTrue(const gmVariable &a_var)
+{
+  return a_var.m_type != GM_NULL && a_var.m_value.m_int != 0;
+}
+
+/// \brief gmArrayEqual() compares ints and floats by value, vec3s by component and other types by reference.
+static bool gmArrayEqual(const gmVariable &a_a, const gmVariable &a_b)
+{
+  if(a_a.m_type != a_b.m_type)
+  {
+    if(a_a.m_type == GM_INT && a_b.m_type == GM_FLOAT) return (float) a_a.m_value.m_int == a_b.m_value.m_float;
+    if(a_a.m_type == GM_FLOAT && a_b.m_type == GM_INT) return a_a.m_value.m_float == (float) a_b.m_value.m_int;
+    return false;
+  }
+  switch(a_a.m_type)
+  {
+    case GM_NULL : return true;
+    case GM_INT : return a_a.m_value.m_int == a_b.m_value.m_int;
+    case GM_FLOAT : return a_a.m_value.m_float == a_b.m_value.m_float;
+#if GM_USE_VECTOR3_STACK
+    case GM_VEC3 : return a_a.m_value.m_vec3 == a_b.m_value.m_vec3;
+#endif // GM_USE_VECTOR3_STACK
+    default : return a_a.m_value.m_ref == a_b.m_value.m_ref;
+  }
+}
+
+/// \brief gmArrayLess orders null, then ints and floats by value, then strings, then other types by type and reference.
+struct gmArrayLess
+{
+  static int Rank(gmType a_type)
+  {
+    if(a_type == GM_NULL) return 0;
+    if(a_type == GM_INT || a_type == GM_FLOAT) return 1;
+    if(a_type == GM_STRING) return 2;
+    return 3;
+  }
+
+  bool operator()(const gmVariable &a_a, const gmVariable &a_b) const
+  {
+    int rankA = Rank(a_a.m_type), rankB = Rank(a_b.m_type);
+    if(rankA != rankB) return rankA < rankB;
+    switch(rankA)
+    {
+      case 0 : return false;
+      case 1 :
+      {
+        if(a_a.m_type == GM_INT && a_b.m_type == GM_INT) return a_a.m_value.m_int < a_b.m_value.m_int;
+        float a = (a_a.m_type == GM_INT) ? (float) a_a.m_value.m_int : a_a.m_value.m_float;
+        float b = (a_b.m_type == GM_INT) ? (float) a_b.m_value.m_int : a_b.m_value.m_float;
+        return a < b;
+      }
+      case 2 : return strcmp(a_a.GetCStringSafe(), a_b.GetCStringSafe()) < 0;
+    }
+    if(a_a.m_type != a_b.m_type) return a_a.m_type < a_b.m_type;
+#if GM_USE_VECTOR3_STACK
+    if(a_a.m_type == GM_VEC3)
+    {
+      if(a_a.m_value.m_vec3.x != a_b.m_value.m_vec3.x) return a_a.m_value.m_vec3.x < a_b.m_value.m_vec3.x;
+      if(a_a.m_value.m_vec3.y != a_b.m_value.m_vec3.y) return a_a.m_value.m_vec3.y < a_b.m_value.m_vec3.y;
+      return a_a.m_value.m_vec3.z < a_b.m_value.m_vec3.z;
+    }
+#endif // GM_USE_VECTOR3_STACK
+    return a_a.m_value.m_ref < a_b.m_value.m_ref;
+  }
+};
+
+/// \brief gmArrayCompare orders indices into a_values by a script function returning < 0 for less, like tableSort.
+///        After an exception every compare is false, so the sort finishes quickly and the result is thrown away.
+struct gmArrayCompare
+{
+  gmArrayCompare(gmThread * a_thread, gmBatchCall &a_call, const gmVariable * a_values, bool &a_failed)
+    : m_thread(a_thread), m_call(a_call), m_values(a_values), m_failed(a_failed) {}
+
+  bool operator()(int a_a, int a_b) const
+  {
+    if(m_failed) return false;
+    gmVariable params[2] = { m_values[a_a], m_values[a_b] };
+    gmVariable ret;
+    if(!gmArrayCall(m_thread, m_call, params, 2, ret))
+    {
+      m_failed = true;
+      return false;
+    }
+    if(ret.m_type == GM_FLOAT) return ret.m_value.m_float < 0.0f;
+    return ret.m_type == GM_INT && ret.m_value.m_int < 0;
+  }
+
+  gmThread * m_thread;
+  gmBatchCall &m_call;
+  const gmVariable * m_values;
+  bool &m_failed;
+};
+
+static int GM_CDECL gmfArraySlice(gmThread * a_thread) // start, count, return view
+{
+  GM_INT_PARAM(start, 0, 0);
+  GM_ARRAY_THIS(array);
+  GM_INT_PARAM(count, 1, array->Size() - start);
+  if(start < 0) { count += start; start = 0; }
+  if(start > array->Size()) start = array->Size();
+  if(count > array->Size() - start) count = array->Size() - start;
+  if(count < 0) count = 0;
+
+  gmUserArray * view = (gmUserArray *) a_thread->GetMachine()->Sys_Alloc(sizeof(gmUserArray));
+  view->ConstructView(a_thread->ThisUserObject(), start, count);
+  a_thread->PushNewUser(view, GM_ARRAY.Get(a_thread));
+  return GM_OK;
+}
+
+static int GM_CDECL gmfArrayMap(gmThread * a_thread) // function, return new array
+{
+  GM_CHECK_NUM_PARAMS(1);
+  GM_CHECK_FUNCTION_PARAM(func, 0);
+  GM_ARRAY_THIS(array);
+
+  gmMachine * machine = a_thread->GetMachine();
+  int size = array->Size();
+  gmUserArray * result = gmUserArray_Create(machine, size);
+  a_thread->PushNewUser(result, GM_ARRAY.Get(a_thread));
+
+  gmBatchCall call;
+  call.BeginFunction(machine, func);
+  gmVariable params[2];
+  for(int i = 0; i < size; ++i)
+  {
+    params[0] = array->GetAt(i);
+    params[1].SetInt(i);
+    if(!gmArrayCall(a_thread, call, params, 2, result->m_array[i])) return GM_EXCEPTION;
+  }
+  return GM_OK;
+}
+
+static int GM_CDECL gmfArrayFilter(gmThread * a_thread) // function, return new array
+{
+  GM_CHECK_NUM_PARAMS(1);
+  GM_CHECK_FUNCTION_PARAM(func, 0);
+  GM_ARRAY_THIS(array);
+
+  gmMachine * machine = a_thread->GetMachine();
+  int size = array->Size();
+  gmUserArray * result = gmUserArray_Create(machine, size);
+  a_thread->PushNewUser(result, GM_ARRAY.Get(a_thread));
+
+  gmBatchCall call;
+  call.BeginFunction(machine, func);
+  gmVariable params[2], ret;
+  int count = 0;
+  for(int i = 0; i < size; ++i)
+  {
+    params[0] = array->GetAt(i);
+    params[1].SetInt(i);
+    if(!gmArrayCall(a_thread, call, params, 2, ret)) return GM_EXCEPTION;
+    if(gmArrayIsTrue(ret))
+    {
+      result->m_array[count++] = params[0];
+    }
+  }
+  result->Resize(machine, count);
+  return GM_OK;
+}
+
+static int GM_CDECL gmfArrayReduce(gmThread * a_thread) // function, initial, return result
+{
+  GM_CHECK_NUM_PARAMS(1);
+  GM_CHECK_FUNCTION_PARAM(func, 0);
+  GM_ARRAY_THIS(array);
+
+  // the result is kept on the stack, where the garbage collector can see it between calls
+  int size = array->Size();
+  int i = 0;
+  if(a_thread->GetNumParams() > 1) a_thread->Push(a_thread->Param(1));
+  else a_thread->Push(array->GetAt(i++));
+  gmVariable * result = a_thread->GetTop() - 1;
+
+  gmBatchCall call;
+  call.BeginFunction(a_thread->GetMachine(), func);
+  gmVariable params[3];
+  for(; i < size; ++i)
+  {
+    params[0] = *result;
+    params[1] = array->GetAt(i);
+    params[2].SetInt(i);
+    if(!gmArrayCall(a_thread, call, params, 3, *result)) return GM_EXCEPTION;
+  }
+  return GM_OK;
+}
+
+static int GM_CDECL gmfArrayFind(gmThread * a_thread) // value, start, return index or -1
+{
+  GM_CHECK_NUM_PARAMS(1);
+  GM_INT_PARAM(start, 1, 0);
+  GM_ARRAY_THIS(array);
+
+  const gmVariable &value = a_thread->Param(0);
+  const gmVariable * data = array->GetData();
+  int size = array->Size();
+  for(int i = (start < 0) ? 0 : start; i < size; ++i)
+  {
+    if(gmArrayEqual(data[i], value))
+    {
+      a_thread->PushInt(i);
+      return GM_OK;
+    }
+  }
+  a_thread->PushInt(-1);
+  return GM_OK;
+}
+
+static int GM_CDECL gmfArraySort(gmThread * a_thread) // function
+{
+  GM_FUNCTION_PARAM(func, 0, NULL);
+  GM_ARRAY_THIS(array);
+
+  int size = array->Size();
+  if(!func)
+  {
+    std::stable_sort(array->GetData(), array->GetData() + size, gmArrayLess());
+    return GM_OK;
+  }
+
+  // sort indices of a copy, so the values stay where the garbage collector can see them while the function runs,
+  // and the function can not upset the sort by changing the array.
+  gmMachine * machine = a_thread->GetMachine();
+  gmUserArray * values = gmUserArray_Create(machine, size);
+  a_thread->PushNewUser(values, GM_ARRAY.Get(a_thread));
+  memcpy(values->m_array, array->GetData(), sizeof(gmVariable) * size);
+
+  std::vector<int> order(size);
+  for(int i = 0; i < size; ++i) order[i] = i;
+
+  gmBatchCall call;
+  call.BeginFunction(machine, func);
+  bool failed = false;
+  std::stable_sort(order.begin(), order.end(), gmArrayCompare(a_thread, call, values->m_array, failed));
+  if(failed) return GM_EXCEPTION;
+
+  if(array->Size() != size)
+  {
+    GM_EXCEPTION_MSG("array resized while sorting");
+    return GM_EXCEPTION;
+  }
+  gmVariable * data = array->GetData();
+  for(int i = 0; i < size; ++i) data[i] = values->m_array[order[i]];
+  a_thread->Pop();
+  return GM_OK;
+}
+
+static int GM_CDECL gmfArrayConcat(gmThread * a_thread) // ..., return new array
+{
+  GM_ARRAY_THIS(array);
+
+  // arrays add their elements, other values are added as one element
+  int numParams = a_thread->GetNumParams();
+  int size = array->Size();
+  for(int i = 0; i < numParams; ++i)
+  {
+    gmUserArray * param = (gmUserArray *) a_thread->ParamUserCheckType(i, GM_ARRAY.Get(a_thread));
+    size += (param) ? param->Size() : 1;
+  }
+
+  gmUserArray * result = gmUserArray_Create(a_thread->GetMachine(), size);
+  memcpy(result->m_array, array->GetData(), sizeof(gmVariable) * array->Size());
+  size = array->Size();
+  for(int i = 0; i < numParams; ++i)
+  {
+    gmUserArray * param = (gmUserArray *) a_thread->ParamUserCheckType(i, GM_ARRAY.Get(a_thread));
+    if(param)
+    {
+      memcpy(result->m_array + size, param->GetData(), sizeof(gmVariable) * param->Size());
+      size += param->Size();
+    }
+    else
+    {
+      result->m_array[size++] = a_thread->Param(i);
+    }
+  }
+  a_thread->PushNewUser(result, GM_ARRAY.Get(a_thread));
+  return GM_OK;
+}
+
 static int GM_CDECL gmArrayGetInd(gmThread * a_thread, gmVariable * a_operands)
 {
   gmUserObject * arrayObject = (gmUserObject *) GM_OBJECT(a_operands->m_value.m_ref);
-  GM_ASSERT(arrayObject->m_userType == GM_ARRAY);
+  GM_ASSERT(arrayObject->m_userType == GM_ARRAY.Get(a_thread));
   gmUserArray * array = (gmUserArray *) arrayObject->m_user;
   if(a_operands[1].m_type == GM_INT)
   {
@@ -277,7 +620,7 @@ static int GM_CDECL gmArrayGetInd(gmThread * a_thread, gmVariable * a_operands)
 static int GM_CDECL gmArraySetInd(gmThread * a_thread, gmVariable * a_operands)
 {
   gmUserObject * arrayObject = (gmUserObject *) GM_OBJECT(a_operands->m_value.m_ref);
-  GM_ASSERT(arrayObject->m_userType == GM_ARRAY);
+  GM_ASSERT(arrayObject->m_userType == GM_ARRAY.Get(a_thread));
   gmUserArray * array = (gmUserArray *) arrayObject->m_user;
   if(a_operands[1].m_type == GM_INT)
   {
@@ -293,6 +636,8 @@ static int GM_CDECL gmArraySetInd(gmThread * a_thread, gmVariable * a_operands)
 #endif //GM_USE_INCGC
 
     array->SetAt(index, a_operands[2]);
+    a_operands->Nullify();
+    return GM_OK;
   }
   a_operands->Nullify();
   return GM_EXCEPTION;
@@ -392,22 +737,75 @@ static gmFunctionEntry s_arrayTypeLib[] =
     \return null
   */
   {"Move", gmfArrayMove},
+  /*gm
+    \function Slice
+    \brief Slice will return a view of part of the array, sharing its elements rather than copying them.
+           The view shrinks if the array does.
+    \param int start optional (0)
+    \param int count optional (to the end)
+    \return array view
+  */
+  {"Slice", gmfArraySlice},
+  /*gm
+    \function Map
+    \brief Map will call a function for each element and return a new array of the results
+    \param function func(value, index)
+    \return array
+  */
+  {"Map", gmfArrayMap},
+  /*gm
+    \function Filter
+    \brief Filter will return a new array of the elements a function returns true for
+    \param function func(value, index)
+    \return array
+  */
+  {"Filter", gmfArrayFilter},
+  /*gm
+    \function Reduce
+    \brief Reduce will call a function for each element with the result of the previous call, and return the last result
+    \param function func(result, value, index)
+    \param initial optional (the first element, which is then not passed to func)
+    \return result
+  */
+  {"Reduce", gmfArrayReduce},
+  /*gm
+    \function Find
+    \brief Find will return the index of the first element equal to a value.  Numbers compare by value, other types by reference.
+    \param value
+    \param int start optional (0)
+    \return int index, -1 if not found
+  */
+  {"Find", gmfArrayFind},
+  /*gm
+    \function Sort
+    \brief Sort will sort the array in place, keeping the order of equal elements.  Without a function null sorts first,
+           then numbers, then strings, then other types.
+    \param function func(a, b) optional, returns < 0 if a goes before b
+    \return null
+  */
+  {"Sort", gmfArraySort},
+  /*gm
+    \function Concat
+    \brief Concat will return a new array of the elements of this array followed by the params.  An array param adds its elements.
+    \param ... values
+    \return array
+  */
+  {"Concat", gmfArrayConcat},
 };
 
 void gmBindArrayLib(gmMachine * a_machine)
 {
-  gmUserArray::m_null.Nullify(); //Init static null
-
   a_machine->RegisterLibrary(s_arrayLib, sizeof(s_arrayLib) / sizeof(s_arrayLib[0]));
-  GM_ARRAY = a_machine->CreateUserType("array");
-  a_machine->RegisterTypeLibrary(GM_ARRAY, s_arrayTypeLib, sizeof(s_arrayTypeLib) / sizeof(s_arrayTypeLib[0]));
+  gmType type = a_machine->CreateUserType("array");
+  GM_ARRAY.Set(a_machine, type);
+  a_machine->RegisterTypeLibrary(type, s_arrayTypeLib, sizeof(s_arrayTypeLib) / sizeof(s_arrayTypeLib[0]));
 #if GM_USE_INCGC
-  a_machine->RegisterUserCallbacks(GM_ARRAY, gmGCTraceArrayUserType, gmGCDestructArrayUserType);
+  a_machine->RegisterUserCallbacks(type, gmGCTraceArrayUserType, gmGCDestructArrayUserType);
 #else //GM_USE_INCGC
-  a_machine->RegisterUserCallbacks(GM_ARRAY, gmMarkArrayUserType, gmGCArrayUserType);
+  a_machine->RegisterUserCallbacks(type, gmMarkArrayUserType, gmGCArrayUserType);
 #endif //GM_USE_INCGC
-  a_machine->RegisterTypeOperator(GM_ARRAY, O_GETIND, NULL, gmArrayGetInd);
-  a_machine->RegisterTypeOperator(GM_ARRAY, O_SETIND, NULL, gmArraySetInd);
+  a_machine->RegisterTypeOperator(type, O_GETIND, NULL, gmArrayGetInd);
+  a_machine->RegisterTypeOperator(type, O_SETIND, NULL, gmArraySetInd);
 }
 
 #endif // GM_ARRAY_LIB
@@ -14,21 +14,25 @@
 
 #include "gmConfig.h"
 #include "gmVariable.h"
+#include "gmUserObject.h"
 
 // Fwd decls
 class gmMachine;
+class gmLibType;
 
 #define GM_ARRAY_LIB 1
 #define GM_ARRAY_LIB_GROW_BY    16
 
 #if GM_ARRAY_LIB
 
-extern gmType GM_ARRAY;
+extern gmLibType GM_ARRAY;
 
 void gmBindArrayLib(gmMachine * a_machine);
 
 /*!
   \class gmUserArray
+  \brief gmUserArray is an array, or a view of a window of another array.  A view holds the array it
+         looks into, never a view, and shares its elements.  A view shrinks with the array it looks into.
 */
 class gmUserArray
 {
@@ -46,12 +50,25 @@ public:
   void Mark(gmMachine * a_machine, gmuint32 a_mark);
 #endif //GM_USE_INCGC
 
+  /// \brief ConstructView() makes this a view of a_count elements of a_array from a_offset.
+  void ConstructView(gmUserObject * a_arrayObject, int a_offset, int a_count);
+
+  /// \brief IsView()
+  GM_FORCEINLINE bool IsView() const { return m_owner != NULL; }
+
+  /// \brief GetData() returns the first element, shared with the owner for a view.
+  GM_FORCEINLINE gmVariable * GetData() const
+  {
+    if(m_owner) return ((gmUserArray *) m_owner->m_user)->m_array + m_offset;
+    return m_array;
+  }
+
   /// \brief GetAt()
   GM_FORCEINLINE const gmVariable &GetAt(int a_index)
   {
-    if(a_index >= 0 && a_index < m_size)
+    if(a_index >= 0 && a_index < Size())
     {
-      return m_array[a_index];
+      return GetData()[a_index];
     }
     return m_null;
   }
@@ -59,18 +76,26 @@ public:
   /// \brief SetAt()
   GM_FORCEINLINE bool SetAt(int a_index, const gmVariable &a_variable)
   {
-    if(a_index >= 0 && a_index < m_size)
+    if(a_index >= 0 && a_index < Size())
     {
-      m_array[a_index] = a_variable;
+      GetData()[a_index] = a_variable;
       return true;
     }
     return false;
   }
 
   /// \brief Size()
-  GM_FORCEINLINE int Size() const { return m_size; }
+  GM_FORCEINLINE int Size() const
+  {
+    if(m_owner)
+    {
+      int size = ((gmUserArray *) m_owner->m_user)->m_size - m_offset;
+      return (size < m_size) ? ((size < 0) ? 0 : size) : m_size;
+    }
+    return m_size;
+  }
 
-  /// \brief Resize()
+  /// \brief Resize(), a view can not grow past the end of its owner.
   bool Resize(gmMachine * a_machine, int a_size);
 
   /// \brief Shift()
@@ -80,10 +105,12 @@ public:
   int Move(int a_dest, int a_src, int a_size);
 
   // data
-  gmVariable * m_array;
+  gmVariable * m_array;           ///< NULL for a view
   int m_size;
+  gmUserObject * m_owner;         ///< array a view looks into, NULL if not a view
+  int m_offset;                   ///< of a view into its owner
 
-  static gmVariable m_null;
+  static const gmVariable m_null; ///< read only, shared by all machines
 };
 
 
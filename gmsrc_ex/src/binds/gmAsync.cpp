@@ -0,0 +1,246 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#include "gmConfig.h"
+#include "gmAsync.h"
+#include "gmThread.h"
+#include "gmMachine.h"
+
+#if GM_ASYNC_LIB
+
+gmAsyncPool::gmAsyncPool()
+  : m_workers(NULL)
+  , m_numWorkers(0)
+  , m_stop(false)
+  , m_queueHead(NULL)
+  , m_queueTail(NULL)
+  , m_running(NULL)
+  , m_doneHead(NULL)
+  , m_doneTail(NULL)
+{
+}
+
+
+gmAsyncPool::~gmAsyncPool()
+{
+  Stop();
+}
+
+
+bool gmAsyncPool::Start(int a_numWorkers)
+{
+  if(m_workers || a_numWorkers <= 0)
+  {
+    return false;
+  }
+
+  m_stop = false;
+  m_numWorkers = a_numWorkers;
+  m_workers = new std::thread[a_numWorkers];
+  for(int i = 0; i < a_numWorkers; ++i)
+  {
+    m_workers[i] = std::thread(&gmAsyncPool::Work, this);
+  }
+  return true;
+}
+
+
+void gmAsyncPool::Stop()
+{
+  if(m_workers)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_wake.notify_all();
+    for(int i = 0; i < m_numWorkers; ++i)
+    {
+      m_workers[i].join();
+    }
+    delete [] m_workers;
+    m_workers = NULL;
+    m_numWorkers = 0;
+  }
+
+  gmAsyncJob * lists[2] = { m_queueHead, m_doneHead };
+  for(int i = 0; i < 2; ++i)
+  {
+    while(lists[i])
+    {
+      gmAsyncJob * job = lists[i];
+      lists[i] = job->m_next;
+      delete job;
+    }
+  }
+  m_queueHead = m_queueTail = NULL;
+  m_doneHead = m_doneTail = NULL;
+}
+
+
+int gmAsyncPool::Await(gmThread * a_thread, gmAsyncJob * a_job)
+{
+  gmMachine * machine = a_thread->GetMachine();
+
+  if(m_numWorkers == 0)
+  {
+    a_job->Run();
+    a_thread->Push(a_job->Finish(machine));
+    delete a_job;
+    return GM_OK;
+  }
+
+  // block on a fresh table, the blocked thread keeps it alive and nothing else can signal it
+  gmVariable handle(machine->AllocTableObject());
+  machine->Sys_Block(a_thread, 1, &handle);
+
+  a_job->m_next = NULL;
+  a_job->m_machine = machine;
+  a_thread->Sys_Promote(); // the job finds the thread by id
+  a_job->m_threadId = a_thread->GetId();
+  a_job->m_handle = handle;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Push(m_queueHead, m_queueTail, a_job);
+  }
+  m_wake.notify_one();
+  return GM_SYS_BLOCK;
+}
+
+
+int gmAsyncPool::Update(gmMachine * a_machine)
+{
+  gmAsyncJob * done;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    done = m_doneHead;
+    m_doneHead = m_doneTail = NULL;
+  }
+
+  int count = 0;
+  gmAsyncJob * keepHead = NULL, * keepTail = NULL;
+  while(done)
+  {
+    gmAsyncJob * job = done;
+    done = job->m_next;
+    job->m_next = NULL;
+
+    if(job->m_machine != a_machine)
+    {
+      Push(keepHead, keepTail, job);
+      continue;
+    }
+
+    // a thread killed while waiting has no use for the result
+    gmThread * thread = a_machine->GetThread(job->m_threadId);
+    if(thread && thread->GetState() == gmThread::BLOCKED)
+    {
+      a_machine->SignalResult(job->m_handle, job->Finish(a_machine), job->m_threadId);
+    }
+    delete job;
+    ++count;
+  }
+
+  if(keepHead)
+  {
+    // put other machines' jobs back in front of any that finished meanwhile
+    std::lock_guard<std::mutex> lock(m_mutex);
+    keepTail->m_next = m_doneHead;
+    if(m_doneHead == NULL) m_doneTail = keepTail;
+    m_doneHead = keepHead;
+  }
+  return count;
+}
+
+
+void gmAsyncPool::Cancel(gmMachine * a_machine)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  gmAsyncJob ** lists[2] = { &m_queueHead, &m_doneHead };
+  gmAsyncJob ** tails[2] = { &m_queueTail, &m_doneTail };
+  for(int i = 0; i < 2; ++i)
+  {
+    gmAsyncJob * list = *lists[i];
+    *lists[i] = *tails[i] = NULL;
+    while(list)
+    {
+      gmAsyncJob * job = list;
+      list = job->m_next;
+      if(job->m_machine == a_machine)
+      {
+        delete job;
+      }
+      else
+      {
+        job->m_next = NULL;
+        Push(*lists[i], *tails[i], job);
+      }
+    }
+  }
+
+  // jobs being run are deleted by their worker
+  for(gmAsyncJob * job = m_running; job; job = job->m_next)
+  {
+    if(job->m_machine == a_machine) job->m_machine = NULL;
+  }
+}
+
+
+void gmAsyncPool::Work()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  for(;;)
+  {
+    while(m_queueHead == NULL && !m_stop)
+    {
+      m_wake.wait(lock);
+    }
+    if(m_stop)
+    {
+      return;
+    }
+
+    gmAsyncJob * job = m_queueHead;
+    m_queueHead = job->m_next;
+    if(m_queueHead == NULL) m_queueTail = NULL;
+    job->m_next = m_running;
+    m_running = job;
+
+    lock.unlock();
+    job->Run();
+    lock.lock();
+
+    gmAsyncJob ** link = &m_running;
+    while(*link != job) link = &(*link)->m_next;
+    *link = job->m_next;
+    job->m_next = NULL;
+
+    if(job->m_machine)
+    {
+      Push(m_doneHead, m_doneTail, job);
+    }
+    else
+    {
+      delete job; // cancelled while running
+    }
+  }
+}
+
+
+void gmAsyncPool::Push(gmAsyncJob * &a_head, gmAsyncJob * &a_tail, gmAsyncJob * a_job)
+{
+  if(a_tail) a_tail->m_next = a_job;
+  else a_head = a_job;
+  a_tail = a_job;
+}
+
+#endif // GM_ASYNC_LIB
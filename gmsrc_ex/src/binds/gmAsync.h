@@ -0,0 +1,118 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#ifndef _GMASYNC_H_
+#define _GMASYNC_H_
+
+#include "gmConfig.h"
+#include "gmVariable.h"
+
+#define GM_ASYNC_LIB 1
+
+#if GM_ASYNC_LIB
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Fwd decls
+class gmMachine;
+class gmThread;
+
+
+/*!
+  \class gmAsyncJob
+  \brief Work a native function hands to a gmAsyncPool rather than doing inline.
+*/
+class gmAsyncJob
+{
+public:
+
+  virtual ~gmAsyncJob() {}
+
+  /// \brief Run() is called on a worker thread, it must not touch any gmMachine.
+  virtual void Run() = 0;
+
+  /// \brief Finish() is called on the machine's thread once Run() is done.
+  /// \return the value the waiting script thread gets back from the native call.
+  virtual gmVariable Finish(gmMachine * a_machine) = 0;
+
+private:
+
+  gmAsyncJob * m_next;
+  gmMachine * m_machine;
+  int m_threadId;
+  gmVariable m_handle;
+
+  friend class gmAsyncPool;
+};
+
+
+/*!
+  \class gmAsyncPool
+  \brief Runs gmAsyncJobs on worker threads while the calling script threads sit blocked.
+
+  A native function queues its job and returns Await(), eg.
+
+    static int GM_CDECL gmfLoadFile(gmThread * a_thread)
+    {
+      GM_CHECK_STRING_PARAM(filename, 0);
+      return s_pool.Await(a_thread, new LoadFileJob(filename));
+    }
+
+  The host calls Update() on the machine's thread, typically just before gmMachine::Execute(),
+  which wakes each waiting thread with its job's result.  Other script threads keep running meanwhile.
+*/
+class gmAsyncPool
+{
+public:
+
+  gmAsyncPool();
+  ~gmAsyncPool();
+
+  /// \brief Start() creates a_numWorkers threads, with no workers Await() runs jobs inline.
+  bool Start(int a_numWorkers);
+
+  /// \brief Stop() waits for running jobs and deletes the rest, their script threads stay blocked.
+  void Stop();
+
+  /// \brief Await() takes ownership of a_job and blocks a_thread until it is done.
+  /// \return the value for the native function to return.
+  int Await(gmThread * a_thread, gmAsyncJob * a_job);
+
+  /// \brief Update() finishes a_machine's completed jobs and wakes their threads.
+  /// \return the number of jobs finished.
+  int Update(gmMachine * a_machine);
+
+  /// \brief Cancel() deletes all of a_machine's jobs that have not been finished, call before deleting a machine.
+  void Cancel(gmMachine * a_machine);
+
+  inline int GetNumWorkers() const { return m_numWorkers; }
+
+private:
+
+  void Work();
+  static void Push(gmAsyncJob * &a_head, gmAsyncJob * &a_tail, gmAsyncJob * a_job);
+
+  std::thread * m_workers;
+  int m_numWorkers;
+  bool m_stop;
+
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  gmAsyncJob * m_queueHead, * m_queueTail; ///< waiting to run
+  gmAsyncJob * m_running;                  ///< being run, at most one per worker
+  gmAsyncJob * m_doneHead, * m_doneTail;   ///< run, waiting for Update()
+};
+
+#endif // GM_ASYNC_LIB
+
+#endif // _GMASYNC_H_
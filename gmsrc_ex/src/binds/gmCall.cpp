@@ -21,6 +21,7 @@ gmCall::gmCall()
 	, m_paramCount(0) 
 	, m_threadId(GM_INVALID_THREAD)
 	, m_delayExecuteFlag(false)
+	, m_callThread(false)
 #ifdef GM_DEBUG_BUILD
 	, m_locked(false)
 #endif //GM_DEBUG_BUILD
@@ -155,8 +156,17 @@ bool gmCall::BeginFunction(gmMachine * a_machine,
 
 	if( GM_FUNCTION == a_funcObj->GetType() )         // Check found variable is a function
 	{
-		int threadId = GM_INVALID_THREAD;
-		m_thread = m_machine->CreateThread(&threadId,a_priority);     // Create thread for func to run on      
+		// Run immediate calls on a pooled call thread, it only becomes a thread if the call does not finish
+		m_callThread = !a_delayExecuteFlag && !a_priority && !m_machine->GetDebugMode();
+		if(m_callThread)
+		{
+			m_thread = m_machine->Sys_AcquireCallThread();
+		}
+		else
+		{
+			int threadId = GM_INVALID_THREAD;
+			m_thread = m_machine->CreateThread(&threadId,a_priority);     // Create thread for func to run on      
+		}
 		m_thread->Push(a_thisVar);                // this
 		m_thread->PushFunction(a_funcObj);        // function
 		m_delayExecuteFlag = a_delayExecuteFlag;
@@ -318,6 +328,11 @@ int gmCall::End()
 		m_machine->Sys_SwitchState(m_thread, gmThread::KILLED);
 	}
 
+	if(m_callThread)
+	{
+		m_machine->Sys_ReleaseCallThread(m_thread);
+	}
+
 	// If we requested a thread Id
 	if(state != gmThread::KILLED)
 		m_threadId = m_thread->GetId();
@@ -408,3 +423,187 @@ bool gmCall::GetReturnedUserOrNull(void *& a_value, int a_userType)
 	}
 	return false;
 }
+
+gmBatchCall::gmBatchCall()
+	: m_machine(0)
+	, m_function(0)
+	, m_held(0)
+	, m_heldRoot(0)
+	, m_numUnfinished(0)
+{
+}
+
+bool gmBatchCall::BeginGlobalFunction(gmMachine * a_machine, const char * a_funcName)
+{
+	GM_ASSERT(a_machine);
+
+	gmStringObject * funcNameStringObj = a_machine->AllocPermanantStringObject(a_funcName); // Slow
+
+	return BeginGlobalFunction(a_machine, funcNameStringObj);
+}
+
+bool gmBatchCall::BeginGlobalFunction(gmMachine * a_machine, gmStringObject * a_funcNameStringObj)
+{
+	GM_ASSERT(a_machine);
+	GM_ASSERT(a_funcNameStringObj);
+
+	gmVariable lookUpVar;
+	lookUpVar.SetString(a_funcNameStringObj);
+	gmVariable foundFunc = a_machine->GetGlobals()->Get(lookUpVar);
+
+	if( GM_FUNCTION == foundFunc.m_type )         // Check found variable is a function
+	{
+		return BeginFunction(a_machine, (gmFunctionObject *)foundFunc.m_value.m_ref);
+	}
+	return false;
+}
+
+bool gmBatchCall::BeginFunction(gmMachine * a_machine, gmFunctionObject * a_funcObj)
+{
+	GM_ASSERT(a_machine);
+	GM_ASSERT(a_funcObj);
+
+	m_machine = a_machine;
+	m_function = a_funcObj;
+	m_failed.Reset();
+	m_numUnfinished = 0;
+	return true;
+}
+
+int gmBatchCall::CallThis(const gmVariable * a_this, int a_count, gmVariable * a_returns)
+{
+	GM_ASSERT(m_function);
+
+	m_failed.Reset();
+	m_numUnfinished = 0;
+
+	gmVariable returnVar;
+	for(int i = 0; i < a_count; ++i)
+	{
+		gmVariable &ret = (a_returns) ? a_returns[i] : returnVar;
+		if(!Call(a_this[i], NULL, 0, ret))
+		{
+			m_failed.InsertLast(i);
+		}
+		else if(a_returns)
+		{
+			Hold(i, ret);
+		}
+	}
+	ReleaseHeld();
+	return (int) m_failed.Count();
+}
+
+int gmBatchCall::CallParams(const gmVariable * a_params, int a_numParams, int a_count, gmVariable * a_returns, 
+							const gmVariable * a_this, bool a_thisArray)
+{
+	GM_ASSERT(m_function);
+
+	m_failed.Reset();
+	m_numUnfinished = 0;
+
+	gmVariable returnVar;
+	for(int i = 0; i < a_count; ++i)
+	{
+		const gmVariable &thisVar = (a_this == NULL) ? gmVariable::s_null : ((a_thisArray) ? a_this[i] : *a_this);
+		gmVariable &ret = (a_returns) ? a_returns[i] : returnVar;
+		if(!Call(thisVar, a_params + i * a_numParams, a_numParams, ret))
+		{
+			m_failed.InsertLast(i);
+		}
+		else if(a_returns)
+		{
+			Hold(i, ret);
+		}
+	}
+	ReleaseHeld();
+	return (int) m_failed.Count();
+}
+
+void gmBatchCall::Hold(int a_index, const gmVariable &a_return)
+{
+	if(!a_return.IsReference())
+	{
+		return;
+	}
+	if(m_held == NULL)
+	{
+		m_held = m_machine->AllocTableObject();
+		m_heldRoot = m_machine->AddRoot(m_held);
+	}
+	m_held->Set(m_machine, a_index, a_return);
+}
+
+void gmBatchCall::ReleaseHeld()
+{
+	if(m_held)
+	{
+		m_machine->RemoveRoot(m_heldRoot);
+		m_held = NULL;
+		m_heldRoot = 0;
+	}
+}
+
+bool gmBatchCall::Call(const gmVariable &a_this, const gmVariable * a_params, int a_numParams, gmVariable &a_return)
+{
+	// The debugger wants every call on a thread of its own, see gmCall::BeginFunction()
+	bool callThread = !m_machine->GetDebugMode();
+	gmThread * thread = (callThread) ? m_machine->Sys_AcquireCallThread() : m_machine->CreateThread();
+
+	// a script exception leaves the return untouched
+	a_return.m_type = GM_INVALID_TYPE;
+	a_return.m_value.m_int = 0;
+
+	int state = gmThread::SYS_EXCEPTION;
+	if(thread->Touch(a_numParams + 2))
+	{
+		thread->Push(a_this);
+		thread->PushFunction(m_function);
+		for(int i = 0; i < a_numParams; ++i)
+		{
+			thread->Push(a_params[i]);
+		}
+
+		state = thread->PushStackFrame(a_numParams);
+		if(state == gmThread::RUNNING)
+		{
+			state = thread->Sys_Execute(&a_return);
+		}
+		else if(state == gmThread::KILLED)
+		{
+			// Was a C function call, grab return var off top of stack
+			a_return = *(thread->GetTop() - 1);
+			m_machine->Sys_SwitchState(thread, gmThread::KILLED);
+		}
+	}
+
+	bool ok = true;
+	if(state == gmThread::KILLED)
+	{
+		ok = (a_return.m_type != GM_INVALID_TYPE);
+	}
+	else if(state == gmThread::BLOCKED || state == gmThread::SLEEPING || state == gmThread::RUNNING)
+	{
+		++m_numUnfinished;
+	}
+	else
+	{
+		// a native that raised an exception, or an exception kept for the debugger
+		if(thread->GetState() != gmThread::EXCEPTION)
+		{
+			m_machine->Sys_SwitchState(thread, gmThread::KILLED);
+		}
+		ok = false;
+	}
+
+	if(callThread)
+	{
+		m_machine->Sys_ReleaseCallThread(thread);
+	}
+
+	if(a_return.m_type == GM_INVALID_TYPE)
+	{
+		a_return.Nullify();
+	}
+	return ok;
+}
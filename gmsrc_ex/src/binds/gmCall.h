@@ -15,6 +15,7 @@ See Copyright Notice in gmMachine.h
 #include "gmConfig.h"
 #include "gmThread.h"
 #include "gmMachine.h"
+#include "gmArraySimple.h"
 
 #if(GM_USE_VECTOR3_STACK)
 #include "mathlib/vector.h"
@@ -24,6 +25,8 @@ See Copyright Notice in gmMachine.h
 /// \brief A helper class to call script functions from C
 /// Warning: Do not store any of the reference type return variables (eg. GM_SRING).  
 /// As the object may be garbage collected.  Instead, copy immediately as necessary.
+/// Calls that execute now, without a priority, run on a pooled thread that only gets an id, and the machine
+/// create and destroy callbacks, if the function yields, sleeps, blocks or raises an exception.
 class gmCall
 {
 public:
@@ -200,6 +203,7 @@ protected:
 	int m_threadId;
 	bool m_returnFlag;
 	bool m_delayExecuteFlag;
+	bool m_callThread;
 #ifdef GM_DEBUG_BUILD
 	bool m_locked;
 #endif //GM_DEBUG_BUILD
@@ -214,9 +218,69 @@ protected:
 		m_returnFlag = false;
 		m_paramCount = 0;
 		m_delayExecuteFlag = false;
+		m_callThread = false;
 	};
 
 };
 
 
+/// \class gmBatchCall
+/// \brief Calls one script function many times, eg. once per entity each tick.  The function is looked up once,
+/// every call runs on the same pooled thread stack, and an exception only fails its own item.
+/// Reference type return values are held from collection until the batch returns, after that the same
+/// warning as gmCall applies.
+class gmBatchCall
+{
+public:
+
+	/// \brief Constructor
+	gmBatchCall();
+
+	/// \brief Begin calls of a global function
+	/// \return true on sucess, false if function was not found.
+	bool BeginGlobalFunction(gmMachine * a_machine, const char * a_funcName);
+	bool BeginGlobalFunction(gmMachine * a_machine, gmStringObject * a_funcNameStringObj);
+
+	/// \brief Begin calls of a function object
+	bool BeginFunction(gmMachine * a_machine, gmFunctionObject * a_funcObj);
+
+	/// \brief Call the function once for each of a_count 'this' values, without parameters.
+	/// \param a_returns receives a_count return values, null for an item that failed or did not finish.  May be NULL.
+	/// \return the number of items that raised an exception, see GetFailed().
+	int CallThis(const gmVariable * a_this, int a_count, gmVariable * a_returns = NULL);
+
+	/// \brief Call the function once for each of a_count tuples of a_numParams parameters, packed one after the other.
+	/// \param a_this is the 'this' of every call, or an array of a_count 'this' values if a_thisArray.
+	/// \param a_returns receives a_count return values, null for an item that failed or did not finish.  May be NULL.
+	/// \return the number of items that raised an exception, see GetFailed().
+	int CallParams(const gmVariable * a_params, int a_numParams, int a_count, gmVariable * a_returns = NULL,
+		const gmVariable * a_this = NULL, bool a_thisArray = false);
+
+	/// \brief Returns the number of items of the last call that raised an exception.
+	int GetNumFailed() const { return (int) m_failed.Count(); }
+	/// \brief Returns the index of a failed item of the last call.
+	int GetFailed(int a_index) const { return m_failed[a_index]; }
+
+	/// \brief Returns the number of items of the last call that yielded, slept or blocked and carry on as threads.
+	int GetNumUnfinished() const { return m_numUnfinished; }
+
+protected:
+
+	/// \brief Used internally to make one call.
+	/// \return false if the call raised an exception.
+	bool Call(const gmVariable &a_this, const gmVariable * a_params, int a_numParams, gmVariable &a_return);
+	/// \brief Used internally to keep a return value of item a_index from collection while later items run.
+	void Hold(int a_index, const gmVariable &a_return);
+	/// \brief Used internally to let the held return values go.
+	void ReleaseHeld();
+
+	gmMachine * m_machine;
+	gmFunctionObject * m_function;
+	gmTableObject * m_held; ///< reference return values of the running batch, by item
+	gmRootHandle m_heldRoot;
+	gmArraySimple<int> m_failed;
+	int m_numUnfinished;
+};
+
+
 #endif // _GMCALL_H_
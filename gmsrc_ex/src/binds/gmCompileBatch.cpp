@@ -0,0 +1,170 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#include "gmConfig.h"
+#include "gmCompileBatch.h"
+#include "gmMachine.h"
+#include "gmCodeTree.h"
+#include "gmCodeGen.h"
+#include "gmLibHooks.h"
+
+#include <thread>
+
+
+gmCompileBatch::gmCompileBatch()
+  : m_machine(NULL)
+  , m_numCompiled(0)
+  , m_numBound(0)
+  , m_next(0)
+{
+}
+
+
+gmCompileBatch::~gmCompileBatch()
+{
+  Reset();
+}
+
+
+int gmCompileBatch::Add(const char * a_source, const char * a_filename)
+{
+  Entry * entry = new Entry;
+  entry->m_source = a_source;
+  if(a_filename) entry->m_filename = a_filename;
+  entry->m_errors = 0;
+  entry->m_function = NULL;
+  entry->m_root = 0;
+  m_entries.push_back(entry);
+  return (int) m_entries.size() - 1;
+}
+
+
+int gmCompileBatch::Compile(int a_numThreads, bool a_debug)
+{
+  int count = (int) m_entries.size() - m_numCompiled;
+  if(count <= 0)
+  {
+    return 0;
+  }
+
+  if(a_numThreads <= 0)
+  {
+    a_numThreads = (int) std::thread::hardware_concurrency();
+  }
+  if(a_numThreads > count) a_numThreads = count;
+
+  // this thread works too
+  m_next = m_numCompiled;
+  std::vector<std::thread> workers;
+  for(int i = 1; i < a_numThreads; ++i)
+  {
+    workers.push_back(std::thread(&gmCompileBatch::Work, this, a_debug, true));
+  }
+  Work(a_debug, false);
+  for(size_t i = 0; i < workers.size(); ++i)
+  {
+    workers[i].join();
+  }
+
+  int failed = 0;
+  for(int i = m_numCompiled; i < (int) m_entries.size(); ++i)
+  {
+    if(m_entries[i]->m_errors) ++failed;
+  }
+  m_numCompiled = (int) m_entries.size();
+  return failed;
+}
+
+
+int gmCompileBatch::Bind(gmMachine * a_machine, bool a_lazy)
+{
+  GM_ASSERT(m_machine == NULL || m_machine == a_machine);
+  m_machine = a_machine;
+
+  int failed = 0;
+  for(; m_numBound < m_numCompiled; ++m_numBound)
+  {
+    Entry * entry = m_entries[m_numBound];
+    const char * filename = (entry->m_filename.empty()) ? NULL : entry->m_filename.c_str();
+
+    if(entry->m_errors == 0)
+    {
+      entry->m_function = a_machine->BindLibToFunction(entry->m_lib.GetData(), entry->m_lib.GetSize(), filename, a_lazy);
+      if(entry->m_function) entry->m_root = a_machine->AddRoot(entry->m_function);
+    }
+    if(entry->m_function == NULL)
+    {
+      bool first = true;
+      const char * message;
+      while((message = entry->m_log.GetEntry(first)))
+      {
+        a_machine->GetLog().LogEntry("%s", message);
+      }
+      if(filename) a_machine->GetLog().LogEntry("Could not compile file %s", filename);
+      ++failed;
+    }
+  }
+  return failed;
+}
+
+
+void gmCompileBatch::Reset()
+{
+  for(size_t i = 0; i < m_entries.size(); ++i)
+  {
+    if(m_entries[i]->m_root) m_machine->RemoveRoot(m_entries[i]->m_root);
+    delete m_entries[i];
+  }
+  m_entries.clear();
+  m_machine = NULL;
+  m_numCompiled = 0;
+  m_numBound = 0;
+  m_next = 0;
+}
+
+
+void gmCompileBatch::Work(bool a_debug, bool a_release)
+{
+  int count = (int) m_entries.size();
+  for(;;)
+  {
+    int index = m_next++;
+    if(index >= count)
+    {
+      break;
+    }
+    Entry * entry = m_entries[index];
+
+#if GMMACHINE_REMOVECOMPILER
+    entry->m_log.LogEntry("No compiler in build");
+    entry->m_errors = 1;
+#else // GMMACHINE_REMOVECOMPILER
+    // parse and generate code with this thread's compiler, as gmMachine::CompileStringToLib()
+    entry->m_errors = gmCodeTree::Get().Lock(entry->m_source.c_str(), &entry->m_log);
+    if(entry->m_errors == 0)
+    {
+      gmLibHooks hooks(entry->m_lib, entry->m_source.c_str());
+      entry->m_errors = gmCodeGen::Get().Lock(gmCodeTree::Get().GetCodeTree(), &hooks, a_debug, &entry->m_log);
+      gmCodeGen::Get().Unlock();
+    }
+    gmCodeTree::Get().Unlock();
+#endif // GMMACHINE_REMOVECOMPILER
+  }
+
+#if !GMMACHINE_REMOVECOMPILER
+  // worker threads free their compiler before exiting
+  if(a_release)
+  {
+    gmCodeTree::Release();
+    gmCodeGen::Release();
+  }
+#endif // !GMMACHINE_REMOVECOMPILER
+}
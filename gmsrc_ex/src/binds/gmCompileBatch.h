@@ -0,0 +1,105 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#ifndef _GMCOMPILEBATCH_H_
+#define _GMCOMPILEBATCH_H_
+
+#include "gmConfig.h"
+#include "gmLog.h"
+#include "gmStreamBuffer.h"
+#include "gmRootTable.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+// Fwd decls
+class gmMachine;
+class gmFunctionObject;
+
+
+/*!
+  \class gmCompileBatch
+  \brief Compiles many scripts to .gmlib images on worker threads, then binds them to a machine.
+
+  The parser and code generator keep their state per OS thread, so compiling needs no machine.
+  The bound root functions are held as machine roots until Reset(), so call Reset() or destroy the batch
+  before the machine.  eg.
+
+    gmCompileBatch batch;
+    for(...) batch.Add(source, filename);
+    batch.Compile(0, machine.GetDebugMode());
+    batch.Bind(&machine);
+    for(int i = 0; i < batch.GetNumSources(); ++i) machine.ExecuteFunction(batch.GetFunction(i));
+*/
+class gmCompileBatch
+{
+public:
+
+  gmCompileBatch();
+  ~gmCompileBatch();
+
+  /// \brief Add() copies a script into the batch.
+  /// \return the index of the script.
+  int Add(const char * a_source, const char * a_filename = NULL);
+
+  /// \brief Compile() compiles every script added since the last Compile(), blocking until done.
+  /// \param a_numThreads is the number of threads to use, 0 for one per core.
+  /// \param a_debug compiles debug info, to match gmMachine::GetDebugMode().
+  /// \return the number of scripts that failed to compile.
+  int Compile(int a_numThreads = 0, bool a_debug = false);
+
+  /// \brief Bind() binds the scripts compiled since the last Bind() to a_machine, call on the machine's thread.
+  ///        Compile errors are copied to the machine log.  Every Bind() of a batch must use the same machine.
+  /// \param a_lazy see gmMachine::BindLibToFunction()
+  /// \return the number of scripts that failed to compile or bind.
+  int Bind(gmMachine * a_machine, bool a_lazy = false);
+
+  /// \brief Reset() removes all scripts and releases their root functions.
+  void Reset();
+
+  inline int GetNumSources() const { return (int) m_entries.size(); }
+  inline const char * GetFilename(int a_index) const { return m_entries[a_index]->m_filename.c_str(); }
+
+  /// \brief GetErrors() returns the number of compile errors for a script, see GetLog() for details.
+  inline int GetErrors(int a_index) const { return m_entries[a_index]->m_errors; }
+  inline gmLog &GetLog(int a_index) { return m_entries[a_index]->m_log; }
+
+  /// \brief GetLib() returns the compiled .gmlib image of a script, eg. to save it or put it in a compile cache.
+  inline const gmStreamBufferDynamic &GetLib(int a_index) const { return m_entries[a_index]->m_lib; }
+
+  /// \brief GetFunction() returns the root function of a script after Bind(), NULL if it failed.
+  ///        The batch keeps the function from being collected until Reset().
+  inline gmFunctionObject * GetFunction(int a_index) const { return m_entries[a_index]->m_function; }
+
+private:
+
+  struct Entry
+  {
+    std::string m_source;
+    std::string m_filename;
+    gmStreamBufferDynamic m_lib;
+    gmLog m_log;
+    int m_errors;
+    gmFunctionObject * m_function;
+    gmRootHandle m_root; ///< holds m_function
+  };
+
+  void Work(bool a_debug, bool a_release);
+
+  std::vector<Entry *> m_entries;
+  gmMachine * m_machine; ///< machine the root functions are bound to
+  int m_numCompiled; ///< entries before this have been compiled
+  int m_numBound; ///< entries before this have been bound
+  std::atomic<int> m_next; ///< next entry for a worker to take
+};
+
+#endif // _GMCOMPILEBATCH_H_
@@ -0,0 +1,181 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#include "gmConfig.h"
+#include "gmCompileCache.h"
+#include "gmThread.h"
+#include "gmMachine.h"
+#include "gmCrc.h"
+#include "gmStreamBuffer.h"
+
+#include <string>
+#include <time.h>
+
+// Bump when the byte code or the .gmlib layout changes so old cache entries are not picked up.
+#define GM_COMPILE_CACHE_VERSION 3
+
+static std::string s_cacheDir;
+static bool s_cacheEnabled = false;
+
+
+void gmSetCompileCacheDir(const char * a_dir)
+{
+  s_cacheEnabled = (a_dir && a_dir[0]);
+  s_cacheDir = (s_cacheEnabled) ? a_dir : "";
+  if(s_cacheEnabled)
+  {
+    char last = s_cacheDir[s_cacheDir.length() - 1];
+    if(last != '/' && last != '\\') s_cacheDir += '/';
+  }
+}
+
+
+const char * gmGetCompileCacheDir()
+{
+  return (s_cacheEnabled) ? s_cacheDir.c_str() : NULL;
+}
+
+
+// 64 bit fnv-1a
+static gmuint64 gmCompileCacheHash(gmuint64 a_hash, const void * a_data, size_t a_size)
+{
+  const gmuint8 * data = (const gmuint8 *) a_data;
+  for(size_t i = 0; i < a_size; ++i)
+  {
+    a_hash ^= data[i];
+    a_hash *= 1099511628211ULL;
+  }
+  return a_hash;
+}
+
+
+static std::string gmCompileCachePath(gmMachine * a_machine, const char * a_source)
+{
+  gmuint32 flags[3] = { GM_COMPILE_CACHE_VERSION, (gmuint32) sizeof(gmptr), (a_machine->GetDebugMode()) ? 1u : 0u };
+
+  gmuint64 hash = 14695981039346656037ULL;
+  hash = gmCompileCacheHash(hash, GM_VERSION, sizeof(GM_VERSION));
+  hash = gmCompileCacheHash(hash, flags, sizeof(flags));
+  hash = gmCompileCacheHash(hash, a_source, strlen(a_source));
+
+  char name[64];
+  sprintf(name, "%08x%08x%08x.gmlib", (gmuint32) (hash >> 32), (gmuint32) hash, gmCrc32String(a_source));
+  return s_cacheDir + name;
+}
+
+
+static char * gmCompileCacheReadFile(const char * a_filename, unsigned int * a_size)
+{
+  FILE * fp = fopen(a_filename, "rb");
+  if(fp == NULL)
+  {
+    return NULL;
+  }
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  rewind(fp);
+  char * data = NULL;
+  if(size >= 0)
+  {
+    data = new char[size + 1];
+    if(fread(data, 1, size, fp) != (size_t) size)
+    {
+      delete [] data;
+      data = NULL;
+    }
+    else
+    {
+      data[size] = 0;
+      if(a_size) *a_size = (unsigned int) size;
+    }
+  }
+  fclose(fp);
+  return data;
+}
+
+
+gmFunctionObject * gmCompileCached(gmMachine * a_machine, const char * a_source, const char * a_filename, int * a_errors)
+{
+  if(a_errors) *a_errors = 0;
+
+  if(!s_cacheEnabled)
+  {
+    return a_machine->CompileStringToFunction(a_source, a_errors, a_filename);
+  }
+
+  std::string path = gmCompileCachePath(a_machine, a_source);
+
+  // hit
+  unsigned int size = 0;
+  char * lib = gmCompileCacheReadFile(path.c_str(), &size);
+  if(lib)
+  {
+    // functions are decoded as they are first called, a script seldom uses all it defines
+    gmFunctionObject * function = a_machine->BindLibToFunction(lib, size, a_filename, true);
+    delete [] lib;
+    if(function)
+    {
+      return function;
+    }
+    // unreadable entry, compile over it
+  }
+
+  // miss
+  gmStreamBufferDynamic stream;
+  int errors = a_machine->CompileStringToLib(a_source, stream);
+  if(a_errors) *a_errors = errors;
+  if(errors)
+  {
+    return NULL;
+  }
+
+  // write a temporary file and rename it so other loaders never see a part written lib
+  char suffix[64];
+  sprintf(suffix, ".%p.%x.tmp", (void *) a_machine, (unsigned int) clock());
+  std::string temp = path + suffix;
+  FILE * fp = fopen(temp.c_str(), "wb");
+  if(fp)
+  {
+    bool written = (fwrite(stream.GetData(), 1, stream.GetSize(), fp) == stream.GetSize());
+    written = (fclose(fp) == 0) && written;
+    if(!written || rename(temp.c_str(), path.c_str()) != 0)
+    {
+      remove(temp.c_str());
+    }
+  }
+
+  return a_machine->BindLibToFunction(stream.GetData(), stream.GetSize(), a_filename, true);
+}
+
+
+int gmExecuteFileCached(gmThread * a_thread, const char * a_filename, gmVariable &a_this)
+{
+  gmMachine * machine = a_thread->GetMachine();
+
+  char * source = gmCompileCacheReadFile(a_filename, NULL);
+  if(source == NULL)
+  {
+    machine->GetLog().LogEntry("failed to open file '%s'", a_filename);
+    return GM_EXCEPTION;
+  }
+
+  int errors = 0;
+  gmFunctionObject * function = gmCompileCached(machine, source, a_filename, &errors);
+  delete [] source;
+  if(function == NULL)
+  {
+    if(errors) machine->GetLog().LogEntry("Could not parse file %s", a_filename);
+    return GM_EXCEPTION;
+  }
+
+  machine->ExecuteFunction(function, NULL, true, &a_this);
+  return GM_OK;
+}
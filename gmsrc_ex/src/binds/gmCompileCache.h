@@ -0,0 +1,47 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#ifndef _GMCOMPILECACHE_H_
+#define _GMCOMPILECACHE_H_
+
+#include "gmConfig.h"
+#include "gmVariable.h"
+
+// Fwd decls
+class gmMachine;
+class gmThread;
+class gmFunctionObject;
+
+//
+// Compile cache.  Compiled scripts are kept as .gmlib files in a cache directory, named by a hash of
+// the source text, the compile flags and the byte code version.  Loading an unchanged script again
+// binds the lib rather than scanning, parsing and generating code.  Stale entries are never read as
+// any change to the source gives a new name, clear the directory to reclaim space.
+//
+
+/// \brief gmSetCompileCacheDir() enables the cache in a_dir, which must exist. NULL disables it.
+///        Set once at startup, before any machine is running.
+void gmSetCompileCacheDir(const char * a_dir);
+
+/// \brief gmGetCompileCacheDir() returns the cache directory, NULL if caching is disabled.
+const char * gmGetCompileCacheDir();
+
+/// \brief gmCompileCached() compiles a_source like gmMachine::CompileStringToFunction(), going through the cache.
+/// \param a_errors optional, set to the number of compile errors, see the machine log for details.
+/// \return the root function or NULL on error.
+gmFunctionObject * gmCompileCached(gmMachine * a_machine, const char * a_source, const char * a_filename = NULL, int * a_errors = NULL);
+
+/// \brief gmExecuteFileCached() loads, compiles and runs a script file now, using the cache.
+///        Suitable for gmMachine::SetExecuteFileCallback() so import() uses the cache.
+/// \return GM_OK, or GM_EXCEPTION if the file could not be read or compiled.
+int gmExecuteFileCached(gmThread * a_thread, const char * a_filename, gmVariable &a_this);
+
+#endif // _GMCOMPILECACHE_H_
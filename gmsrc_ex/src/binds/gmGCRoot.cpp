@@ -42,7 +42,7 @@ void gmGCRootManager::Destroy()
 }
 
 
-gmgcrHolder* gmGCRootManager::FindOrAdd(gmObject* a_object, gmMachine* a_machine)
+gmgcrHolder* gmGCRootManager::Add(gmObject* a_object, gmMachine* a_machine)
 {
   GM_ASSERT(a_object);
   GM_ASSERT(a_machine);
@@ -54,29 +54,40 @@ gmgcrHolder* gmGCRootManager::FindOrAdd(gmObject* a_object, gmMachine* a_machine
   
   MachineHolders* machineSet = FindOrAddMachine(a_machine);
   
-  gmgcrHolder* holder = NULL;
-  if( !machineSet->m_mapPtrToHolder.GetAt(a_object, holder) )
+  gmgcrHolder* holder = m_memHolder.Alloc();
+  holder->Init(a_object, a_machine); // Add to GC roots
+
+  // Link so the machine can nullify it
+  holder->m_next = machineSet->m_firstHolder;
+  if( holder->m_next )
   {
-    // Add new
-    holder = m_memHolder.Alloc();
-    holder->Init(a_object, a_machine);
-    machineSet->m_mapPtrToHolder.SetAt(a_object, holder);
-    
-    a_machine->AddCPPOwnedGMObject(a_object); // Add to GC roots
+    holder->m_next->m_prev = holder;
   }
+  machineSet->m_firstHolder = holder;
   return holder;
 }
 
 
-void gmGCRootManager::RemoveObject(gmObject* a_object, gmMachine* a_machine)
+void gmGCRootManager::RemoveHolder(const gmgcrHolder* a_holder)
 {
-  if( a_object && a_machine )
+  if( a_holder && a_holder->m_machine )
   {
-    a_machine->RemoveCPPOwnedGMObject(a_object); // Remove from GC roots
-
-    gmGCRootManager::MachineHolders* machineSet = FindOrAddMachine(a_machine);
+    a_holder->m_machine->RemoveRoot(a_holder->m_handle); // Remove from GC roots
 
-    machineSet->m_mapPtrToHolder.RemoveAt(a_object);
+    if( a_holder->m_next )
+    {
+      a_holder->m_next->m_prev = a_holder->m_prev;
+    }
+    if( a_holder->m_prev )
+    {
+      a_holder->m_prev->m_next = a_holder->m_next;
+    }
+    else
+    {
+      MachineHolders* machineSet = FindOrAddMachine(a_holder->m_machine);
+      machineSet->m_firstHolder = a_holder->m_next;
+    }
+    a_holder->m_prev = a_holder->m_next = NULL;
   }
 }
 
@@ -108,24 +119,11 @@ void gmGCRootManager::DestroyMachine(gmMachine* a_machine)
   {
     MachineHolders* destroySet = &m_machineHolderSet[foundIndex];
     
-    // Cleanup all internal pointers
-    gmgcrMap<gmObject*, gmgcrHolder*>::Iterator it;
-    
-    // Iterate carefully as we are deleting while iterating
-    destroySet->m_mapPtrToHolder.GetFirst(it);
-    while( !destroySet->m_mapPtrToHolder.IsNull(it) )
+    // Cleanup all internal pointers, each unlinks itself
+    while( destroySet->m_firstHolder )
     {
-      gmgcrHolder* toDelete = NULL;
-      if( destroySet->m_mapPtrToHolder.GetValue(it, toDelete) )
-      {
-        // NOTE: Delete this found value after incrementing iterator
-      }
-      destroySet->m_mapPtrToHolder.GetNext(it);
-      if( toDelete )
-      {
-        toDelete->Destroy();
-      }
-    }    
+      destroySet->m_firstHolder->Destroy();
+    }
 
     // Remove machine set
     m_machineHolderSet.RemoveAt(foundIndex);
@@ -152,6 +150,7 @@ gmGCRootManager::MachineHolders* gmGCRootManager::FindOrAddMachine(gmMachine* a_
   int newIndex = m_machineHolderSet.AddEmpty();
   MachineHolders* newSet = &m_machineHolderSet[newIndex];
   newSet->m_machine = a_machine;
+  newSet->m_firstHolder = NULL;
   return newSet;
 }
 
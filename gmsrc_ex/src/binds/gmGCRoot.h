@@ -17,10 +17,10 @@
 // Automatically adds and removed CPP owned gmObject* from gmMachine roots
 //
 // It works by storing the gmObject* inside a shared reference counted holder 
-// object. When a gmObject* is first wrapped, a holder object is created to 
-// store it. Subsequent initializations will share the same holder object.  It 
-// is much more efficient to assign the pointer from one gmGCRoot to another 
-// than create a new one from the raw gmObject*.
+// object, which roots it with a gmMachine::AddRoot() handle.  Each wrap of a
+// raw gmObject* creates a holder, copies share it.  It is more efficient to
+// assign the pointer from one gmGCRoot to another than create a new one from
+// the raw gmObject*.
 //
 //
 // To use, you must initialize and destroy the system with:
@@ -110,14 +110,14 @@ public:
   
   ~gmGCRootManager();
 
-  // Find or Add shard holder for gmObject
-  gmgcrHolder* FindOrAdd(gmObject* a_object, gmMachine* a_machine);
+  // Add holder for gmObject
+  gmgcrHolder* Add(gmObject* a_object, gmMachine* a_machine);
   
   // Free holder memory only
   void FreeHolder(const gmgcrHolder* a_holder);
   
   // Dissassociate holder contents
-  void RemoveObject(gmObject* a_object, gmMachine* a_machine);
+  void RemoveHolder(const gmgcrHolder* a_holder);
   
   /// Call before destroying a gmMachine so that any associated objects can be disassociated and have pointers nullified.
   void DestroyMachine(gmMachine* a_machine);
@@ -129,8 +129,7 @@ protected:
   {
   public:
     gmMachine* m_machine;
-    //gmgcrMap m_mapPtrToHolder;
-    gmgcrMap<gmObject*, gmgcrHolder*> m_mapPtrToHolder;
+    const gmgcrHolder* m_firstHolder;               // List of holders with an object
   };
 
   static gmGCRootManager* s_staticInstance;         // Singleton
@@ -160,6 +159,8 @@ public:
   {
     m_object = NULL;
     m_machine = NULL;
+    m_handle = 0;
+    m_prev = m_next = NULL;
   }
   
   /// Initialize with real object
@@ -168,6 +169,8 @@ public:
   {
     m_object = a_object;
     m_machine = a_machine;
+    m_handle = a_machine->AddRoot(a_object);
+    m_prev = m_next = NULL;
   }
 
   /// Destroy object pointer (May occur before this holder dies)
@@ -176,11 +179,12 @@ public:
     if( m_object )
     {
       GM_ASSERT( gmGCRootManager::Get() );
-      gmGCRootManager::Get()->RemoveObject(m_object, m_machine);
+      gmGCRootManager::Get()->RemoveHolder(this);
     }
     
     m_object = NULL;
     m_machine = NULL;
+    m_handle = 0;
   }
 
   /// Get the real pointer
@@ -200,7 +204,11 @@ private:
 
   mutable gmObject* m_object;                     ///< The object
   mutable gmMachine* m_machine;                   ///< The owning machine
-  
+  mutable gmRootHandle m_handle;                  ///< Rooting m_object in m_machine
+  mutable const gmgcrHolder* m_prev;              ///< Holders of the same machine
+  mutable const gmgcrHolder* m_next;
+
+  friend class gmGCRootManager;
 };
 
 
@@ -208,7 +216,7 @@ private:
 /// It adds the gmObject to the gmMachine GC roots so that the object is not collected while held
 /// Initialize via constructor or Set(). eg. gmGCRoot<gmStringObject> ptr(myString, myMachine);
 /// Fast cast to native type and fast copy to compatible pointer.
-/// Slower FIRST construct and FINAL destruct as shared holder object performs map insert/removal.
+/// Construct from a raw pointer and FINAL destruct add and remove a machine root, in constant time.
 /// If gmMachine is destructed, contents will be nullified. (As long as manager was called correctly.)
 template< typename TYPE >
 class gmGCRoot
@@ -255,7 +263,7 @@ public:
    
     GM_ASSERT( gmGCRootManager::Get() );
    
-    m_ptrToHolder = gmGCRootManager::Get()->FindOrAdd( (gmObject*)a_object, (gmMachine*) a_machine );
+    m_ptrToHolder = gmGCRootManager::Get()->Add( (gmObject*)a_object, (gmMachine*) a_machine );
     m_ptrToHolder->AddReference();
   }
 
@@ -0,0 +1,802 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#include "gmConfig.h"
+#include "gmHeapImage.h"
+#include "gmMachine.h"
+#include "gmByteCode.h"
+#include "gmCodeGenHooks.h"
+#include "gmStringObject.h"
+#include "gmTableObject.h"
+#include "gmUserObject.h"
+
+#include <set>
+
+/*
+Heap image format 'gmh0' (native endian)
+
+'gmh0'                      [4 bytes]
+sizeof(gmVariable)          [4 bytes]  // with 'gmh0', a check the image is from the same build
+flags                       [4 bytes]  // 0x01 - functions have debug info, 0x02 - functions have num_clear_locals
+num_types                   [4 bytes]
+num_objects                 [4 bytes]
+types                       [num_types] { name [string], type_table [object] }
+globals                     [object]
+objects                     [num_objects] { kind [4 bytes], size [4 bytes], payload [size bytes] }
+
+string                      length [4 bytes], bytes, 0
+object                      id [4 bytes], 1 based index into objects, 0 for none
+variable                    type [4 bytes], then an object for references, else the gmVariable value bytes
+
+payloads by kind
+GM_HEAP_STRING              string
+GM_HEAP_TABLE               count [4 bytes], count * { key [variable], value [variable] }
+GM_HEAP_FUNCTION            num_params, num_locals, [num_clear_locals], max_stack_size, byte_code_len [4 bytes each],
+                            byte code with objects ids as reference operands, debug [4 bytes], if debug
+                            { has_name [4 bytes], name [string], line_count [4 bytes], gmLineInfo[line_count],
+                              num_symbols [4 bytes], symbols [string] }
+GM_HEAP_NATIVE              path [string], gmCFunction [sizeof(gmCFunction)]
+GM_HEAP_USER                type [4 bytes], then as written by the type's gmHeapSaveCallback
+
+A native path is "G" for the globals or "T" and a type name for a type table, followed by '\x01' and a key
+for each table down to the function.
+*/
+
+#define ID_gmh0 GM_MAKE_ID32('g','m','h','0')
+
+// deepest table a native function is looked for in
+#define GM_HEAP_NATIVE_DEPTH 8
+
+enum gmHeapRecord
+{
+  GM_HEAP_STRING = 1,
+  GM_HEAP_TABLE,
+  GM_HEAP_FUNCTION,
+  GM_HEAP_NATIVE,
+  GM_HEAP_USER,
+};
+
+struct gmHeapHeader
+{
+  gmuint32 m_id;
+  gmuint32 m_variableSize;
+  gmuint32 m_flags;
+  gmuint32 m_numTypes;
+  gmuint32 m_numObjects;
+};
+
+
+static inline bool gmHeapIsNative(const gmFunctionObject * a_function)
+{
+  return (a_function->m_cFunction != NULL || a_function->m_cFunctor != NULL);
+}
+
+
+// byte code operands holding object references, as found by gmFunctionObject::Init()
+static inline bool gmHeapNextOperand(const gmuint8 * &a_instruction, const gmuint8 * a_end, gmuint32 &a_opcode)
+{
+  while(a_instruction + sizeof(gmuint32) <= a_end)
+  {
+    memcpy(&a_opcode, a_instruction, sizeof(gmuint32));
+    a_instruction += sizeof(gmuint32);
+    switch(a_opcode)
+    {
+      case BC_BRA :
+      case BC_BRZ :
+      case BC_BRNZ :
+      case BC_BRZK :
+      case BC_BRNZK :
+      case BC_FORK : a_instruction += sizeof(gmptr); break;
+      case BC_FOREACH :
+      case BC_PUSHINT : a_instruction += sizeof(gmint); break;
+      case BC_PUSHFP : a_instruction += sizeof(gmfloat); break;
+
+      case BC_CALL :
+      case BC_TAILCALL :
+      case BC_GETLOCAL :
+      case BC_SETLOCAL : a_instruction += sizeof(gmuint32); break;
+
+      case BC_GETDOT :
+      case BC_GETDOTX :
+      case BC_GETDOTY :
+      case BC_GETDOTZ :
+      case BC_SETDOT :
+      case BC_GETGLOBAL :
+      case BC_SETGLOBAL :
+      case BC_GETTHIS :
+      case BC_SETTHIS :
+      case BC_PUSHSTR :
+      case BC_PUSHFN : return (a_instruction + sizeof(gmptr) <= a_end);
+
+      default : break;
+    }
+  }
+  return false;
+}
+
+
+// native functions reachable through string keys from the globals and type tables, each at its first path
+static void gmHeapFindNatives(gmMachine * a_machine, std::vector< std::pair<std::string, gmFunctionObject *> > &a_natives)
+{
+  struct Node
+  {
+    gmTableObject * m_table;
+    std::string m_path;
+    int m_depth;
+  };
+
+  std::vector<Node> queue;
+  std::set<gmTableObject *> tables;
+  std::set<gmFunctionObject *> found;
+
+  Node root = { a_machine->GetGlobals(), "G", 0 };
+  queue.push_back(root);
+  for(gmType type = GM_NULL; a_machine->GetTypeTable(type); ++type)
+  {
+    Node node = { a_machine->GetTypeTable(type), std::string("T") + a_machine->GetTypeName(type), 0 };
+    queue.push_back(node);
+  }
+
+  for(size_t i = 0; i < queue.size(); ++i)
+  {
+    Node node = queue[i];
+    if(!tables.insert(node.m_table).second)
+    {
+      continue;
+    }
+
+    gmTableIterator it;
+    for(gmTableNode * entry = node.m_table->GetFirst(it); entry; entry = node.m_table->GetNext(it))
+    {
+      if(entry->m_key.m_type != GM_STRING)
+      {
+        continue;
+      }
+      gmStringObject * key = (gmStringObject *) a_machine->GetGMObject(entry->m_key.m_value.m_ref);
+      std::string path = node.m_path + '\x01' + std::string(key->GetString(), key->GetLength());
+
+      if(entry->m_value.m_type == GM_FUNCTION)
+      {
+        gmFunctionObject * function = (gmFunctionObject *) a_machine->GetGMObject(entry->m_value.m_value.m_ref);
+        if(gmHeapIsNative(function) && found.insert(function).second)
+        {
+          a_natives.push_back(std::make_pair(path, function));
+        }
+      }
+      else if(entry->m_value.m_type == GM_TABLE && node.m_depth < GM_HEAP_NATIVE_DEPTH)
+      {
+        Node child = { (gmTableObject *) a_machine->GetGMObject(entry->m_value.m_value.m_ref), path, node.m_depth + 1 };
+        queue.push_back(child);
+      }
+    }
+  }
+}
+
+
+//
+// gmHeapWriter
+//
+
+
+gmuint32 gmHeapWriter::GetId(gmObject * a_object)
+{
+  if(a_object == NULL)
+  {
+    return 0;
+  }
+  std::map<gmObject *, gmuint32>::iterator it = m_ids.find(a_object);
+  if(it != m_ids.end())
+  {
+    return it->second;
+  }
+  m_objects.push_back(a_object);
+  gmuint32 id = (gmuint32) m_objects.size();
+  m_ids[a_object] = id;
+  return id;
+}
+
+
+void gmHeapWriter::WriteString(const char * a_string, int a_length)
+{
+  gmuint32 length = (gmuint32) ((a_length < 0) ? strlen(a_string) : a_length);
+  *m_stream << length;
+  m_stream->Write(a_string, length);
+  *m_stream << (gmuint8) 0;
+}
+
+
+void gmHeapWriter::WriteVariable(const gmVariable &a_variable)
+{
+  *m_stream << (gmuint32) a_variable.m_type;
+  if(a_variable.IsReference())
+  {
+    WriteObject(m_machine->GetGMObject(a_variable.m_value.m_ref));
+  }
+  else
+  {
+    m_stream->Write(&a_variable.m_value, sizeof(a_variable.m_value));
+  }
+}
+
+
+void gmHeapWriter::WriteObject(gmObject * a_object)
+{
+  *m_stream << GetId(a_object);
+}
+
+
+//
+// gmHeapReader
+//
+
+
+bool gmHeapReader::Read(void * a_data, unsigned int a_size)
+{
+  if((unsigned int) (m_end - m_pos) < a_size)
+  {
+    m_pos = m_end;
+    return false;
+  }
+  memcpy(a_data, m_pos, a_size);
+  m_pos += a_size;
+  return true;
+}
+
+
+const char * gmHeapReader::ReadString(int * a_length)
+{
+  gmuint32 length;
+  if(!Read(&length, sizeof(length)) || (unsigned int) (m_end - m_pos) <= length || m_pos[length] != 0)
+  {
+    m_pos = m_end;
+    return NULL;
+  }
+  const char * string = (const char *) m_pos;
+  m_pos += length + 1;
+  if(a_length) *a_length = (int) length;
+  return string;
+}
+
+
+bool gmHeapReader::ReadObject(gmObject * &a_object)
+{
+  gmuint32 id;
+  if(!Read(&id, sizeof(id)) || id > m_objects->size())
+  {
+    return false;
+  }
+  a_object = (id) ? (*m_objects)[id - 1] : NULL;
+  return true;
+}
+
+
+bool gmHeapReader::ReadVariable(gmVariable &a_variable)
+{
+  gmuint32 type;
+  if(!Read(&type, sizeof(type)))
+  {
+    return false;
+  }
+  if((gmType) type >= GM_STRING)
+  {
+    gmObject * object;
+    if(!ReadObject(object) || object == NULL)
+    {
+      return false;
+    }
+    // user type ids may differ in this machine
+    a_variable.m_type = (gmType) object->GetType();
+    a_variable.m_value.m_ref = object->GetRef();
+    return true;
+  }
+  a_variable.m_type = (gmType) type;
+  return Read(&a_variable.m_value, sizeof(a_variable.m_value));
+}
+
+
+//
+// gmHeapImage
+//
+
+
+void gmHeapImage::RegisterUserType(const char * a_typeName, gmHeapSaveCallback a_save, gmHeapRestoreCallback a_restore)
+{
+  UserType & type = m_userTypes[a_typeName];
+  type.m_save = a_save;
+  type.m_restore = a_restore;
+}
+
+
+bool gmHeapImage::Save(gmMachine * a_machine, gmStream &a_stream)
+{
+  gmHeapWriter writer;
+  writer.m_machine = a_machine;
+
+  gmStreamBufferDynamic body, record;
+  writer.m_stream = &record;
+
+  // roots
+  gmuint32 globals = writer.GetId(a_machine->GetGlobals());
+  std::vector<gmuint32> typeTables;
+  gmType type;
+  for(type = GM_NULL; a_machine->GetTypeTable(type); ++type)
+  {
+    typeTables.push_back(writer.GetId(a_machine->GetTypeTable(type)));
+  }
+
+  std::vector< std::pair<std::string, gmFunctionObject *> > natives;
+  gmHeapFindNatives(a_machine, natives);
+  std::map<gmFunctionObject *, std::string> nativePaths;
+  for(size_t i = 0; i < natives.size(); ++i)
+  {
+    nativePaths[natives[i].second] = natives[i].first;
+  }
+
+  gmuint32 flags = 0x02;
+  std::vector<gmuint8> byteCode;
+  gmArraySimple<const char *> symbols;
+  gmArraySimple<gmLineInfo> lineInfo;
+
+  // each object written adds the objects it references to the end of the queue
+  for(size_t i = 0; i < writer.m_objects.size(); ++i)
+  {
+    gmObject * object = writer.m_objects[i];
+    gmuint32 kind = 0;
+    record.Reset();
+
+    switch(object->GetType())
+    {
+      case GM_STRING :
+      {
+        gmStringObject * string = (gmStringObject *) object;
+        kind = GM_HEAP_STRING;
+        writer.WriteString(string->GetString(), string->GetLength());
+        break;
+      }
+
+      case GM_TABLE :
+      {
+        gmTableObject * table = (gmTableObject *) object;
+        kind = GM_HEAP_TABLE;
+        record << (gmuint32) table->Count();
+        gmTableIterator it;
+        for(gmTableNode * node = table->GetFirst(it); node; node = table->GetNext(it))
+        {
+          writer.WriteVariable(node->m_key);
+          writer.WriteVariable(node->m_value);
+        }
+        break;
+      }
+
+      case GM_FUNCTION :
+      {
+        gmFunctionObject * function = (gmFunctionObject *) object;
+        if(gmHeapIsNative(function))
+        {
+          std::map<gmFunctionObject *, std::string>::iterator path = nativePaths.find(function);
+          if(path == nativePaths.end() && function->m_cFunctor)
+          {
+            a_machine->GetLog().LogEntry("heap image: native function object not found in a table, can not be saved");
+            return false;
+          }
+          kind = GM_HEAP_NATIVE;
+          writer.WriteString((path != nativePaths.end()) ? path->second.c_str() : "");
+          record.Write(&function->m_cFunction, sizeof(function->m_cFunction));
+          break;
+        }
+
+        // compact debug info is read without expanding it
+        gmFunctionInfo info;
+        function->GetInfo(info, symbols, lineInfo);
+        kind = GM_HEAP_FUNCTION;
+        record << (gmuint32) info.m_numParams << (gmuint32) info.m_numLocals << (gmuint32) info.m_numClearLocals << (gmuint32) info.m_maxStackSize;
+        record << (gmuint32) info.m_byteCodeLength;
+
+        // replace references with object ids
+        byteCode.assign((const gmuint8 *) info.m_byteCode, (const gmuint8 *) info.m_byteCode + info.m_byteCodeLength);
+        const gmuint8 * instruction = &byteCode[0];
+        const gmuint8 * end = instruction + byteCode.size();
+        gmuint32 opcode;
+        while(gmHeapNextOperand(instruction, end, opcode))
+        {
+          gmptr reference;
+          memcpy(&reference, instruction, sizeof(gmptr));
+          reference = (gmptr) writer.GetId(a_machine->GetGMObject(reference));
+          memcpy((gmuint8 *) instruction, &reference, sizeof(gmptr));
+          instruction += sizeof(gmptr);
+        }
+        if(info.m_byteCodeLength) record.Write(&byteCode[0], info.m_byteCodeLength);
+
+        bool debug = (info.m_debugName || info.m_lineInfo || info.m_symbols);
+        record << (gmuint32) ((debug) ? 1 : 0);
+        if(debug)
+        {
+          flags |= 0x01;
+          record << (gmuint32) ((info.m_debugName) ? 1 : 0);
+          writer.WriteString((info.m_debugName) ? info.m_debugName : "");
+          record << (gmuint32) info.m_lineInfoCount;
+          record.Write(info.m_lineInfo, sizeof(gmLineInfo) * info.m_lineInfoCount);
+          int numSymbols = (info.m_symbols) ? info.m_numParams + info.m_numLocals : 0;
+          record << (gmuint32) numSymbols;
+          for(int s = 0; s < numSymbols; ++s)
+          {
+            writer.WriteString(info.m_symbols[s]);
+          }
+        }
+        break;
+      }
+
+      default :
+      {
+        gmUserObject * user = (gmUserObject *) object;
+        const char * typeName = a_machine->GetTypeName(user->GetType());
+        std::map<std::string, UserType>::iterator userType = m_userTypes.find(typeName);
+        if(userType == m_userTypes.end() || userType->second.m_save == NULL)
+        {
+          a_machine->GetLog().LogEntry("heap image: type %s was not registered, can not be saved", typeName);
+          return false;
+        }
+        kind = GM_HEAP_USER;
+        record << (gmuint32) user->GetType();
+        if(!userType->second.m_save(writer, user))
+        {
+          a_machine->GetLog().LogEntry("heap image: could not save a %s", typeName);
+          return false;
+        }
+        break;
+      }
+    }
+
+    body << kind << (gmuint32) record.GetSize();
+    body.Write(record.GetData(), record.GetSize());
+  }
+
+  gmHeapHeader header;
+  header.m_id = ID_gmh0;
+  header.m_variableSize = sizeof(gmVariable);
+  header.m_flags = flags;
+  header.m_numTypes = (gmuint32) typeTables.size();
+  header.m_numObjects = (gmuint32) writer.m_objects.size();
+
+  writer.m_stream = &a_stream;
+  a_stream.Write(&header, sizeof(header));
+  for(type = GM_NULL; type < (gmType) typeTables.size(); ++type)
+  {
+    writer.WriteString(a_machine->GetTypeName(type));
+    a_stream << typeTables[type];
+  }
+  a_stream << globals;
+  a_stream.Write(body.GetData(), body.GetSize());
+  return true;
+}
+
+
+bool gmHeapImage::Restore(gmMachine * a_machine, const void * a_image, unsigned int a_size)
+{
+  gmHeapReader reader;
+  std::vector<gmObject *> objects;
+  reader.m_machine = a_machine;
+  reader.m_pos = (const gmuint8 *) a_image;
+  reader.m_end = reader.m_pos + a_size;
+  reader.m_objects = &objects;
+
+  gmLog &log = a_machine->GetLog();
+
+  gmHeapHeader header;
+  if(!reader.Read(&header, sizeof(header)) || header.m_id != ID_gmh0 || header.m_variableSize != sizeof(gmVariable) ||
+     header.m_numObjects > a_size / (sizeof(gmuint32) * 2))
+  {
+    log.LogEntry("heap image: not a heap image from this build");
+    return false;
+  }
+
+  // types by name, their tables are restored into this machine's
+  std::vector<gmType> types(header.m_numTypes, GM_INVALID_TYPE);
+  std::vector<gmuint32> typeTables(header.m_numTypes, 0);
+  for(gmuint32 t = 0; t < header.m_numTypes; ++t)
+  {
+    const char * name = reader.ReadString();
+    if(name == NULL || !reader.Read(&typeTables[t], sizeof(gmuint32)) || typeTables[t] > header.m_numObjects)
+    {
+      log.LogEntry("heap image: corrupt");
+      return false;
+    }
+    types[t] = a_machine->GetTypeId(name);
+  }
+  gmuint32 globals;
+  if(!reader.Read(&globals, sizeof(globals)) || globals > header.m_numObjects)
+  {
+    log.LogEntry("heap image: corrupt");
+    return false;
+  }
+
+  // references resolve to the live root tables, their contents are restored into staged tables and only
+  // copied over once the whole image has been restored
+  std::vector<gmTableObject *> roots(header.m_numObjects + 1, (gmTableObject *) NULL);
+  std::map<gmuint32, gmTableObject *> staged;
+  roots[globals] = a_machine->GetGlobals();
+  for(gmuint32 t = 0; t < header.m_numTypes; ++t)
+  {
+    if(types[t] != GM_INVALID_TYPE) roots[typeTables[t]] = a_machine->GetTypeTable(types[t]);
+  }
+
+  std::map<std::string, gmFunctionObject *> nativesByPath;
+  std::map<gmCFunction, gmFunctionObject *> nativesByAddress;
+  {
+    std::vector< std::pair<std::string, gmFunctionObject *> > natives;
+    gmHeapFindNatives(a_machine, natives);
+    for(size_t i = 0; i < natives.size(); ++i)
+    {
+      nativesByPath[natives[i].first] = natives[i].second;
+      gmFunctionObject * native = natives[i].second;
+      if(native->m_cFunction && !native->m_cFunctor && nativesByAddress.find(native->m_cFunction) == nativesByAddress.end())
+      {
+        nativesByAddress[native->m_cFunction] = native;
+      }
+    }
+  }
+
+  // objects are only reachable once the second pass links them.  Each comes from the machine's fixed size
+  // object pools, so is already a free list pop, and must be registered with the collector one by one.
+  bool gcEnabled = a_machine->IsGCEnabled();
+  a_machine->EnableGC(false);
+
+  struct Record
+  {
+    gmuint32 m_kind;
+    const gmuint8 * m_payload;
+    const gmuint8 * m_end;
+  };
+  std::vector<Record> records(header.m_numObjects);
+  objects.resize(header.m_numObjects, NULL);
+
+  // first pass, create every object, checking all can be restored before any variable is set
+  bool result = true;
+  for(gmuint32 i = 0; i < header.m_numObjects && result; ++i)
+  {
+    Record &record = records[i];
+    gmuint32 size;
+    if(!reader.Read(&record.m_kind, sizeof(gmuint32)) || !reader.Read(&size, sizeof(size)) ||
+       (unsigned int) (reader.m_end - reader.m_pos) < size)
+    {
+      log.LogEntry("heap image: corrupt");
+      result = false;
+      break;
+    }
+    record.m_payload = reader.m_pos;
+    record.m_end = reader.m_pos + size;
+    reader.m_pos = record.m_end;
+
+    gmHeapReader payload = reader;
+    payload.m_pos = record.m_payload;
+    payload.m_end = record.m_end;
+
+    switch(record.m_kind)
+    {
+      case GM_HEAP_STRING :
+      {
+        int length;
+        const char * string = payload.ReadString(&length);
+        if(string) objects[i] = a_machine->AllocStringObject(string, length);
+        break;
+      }
+
+      case GM_HEAP_TABLE :
+      {
+        objects[i] = a_machine->AllocTableObject();
+        if(roots[i + 1])
+        {
+          staged[i] = (gmTableObject *) objects[i];
+          objects[i] = roots[i + 1];
+        }
+        break;
+      }
+
+      case GM_HEAP_FUNCTION :
+      {
+        objects[i] = a_machine->AllocFunctionObject();
+        break;
+      }
+
+      case GM_HEAP_NATIVE :
+      {
+        const char * path = payload.ReadString();
+        gmCFunction function;
+        if(path == NULL || !payload.Read(&function, sizeof(function)))
+        {
+          break;
+        }
+        std::map<std::string, gmFunctionObject *>::iterator byPath = nativesByPath.find(path);
+        std::map<gmCFunction, gmFunctionObject *>::iterator byAddress = nativesByAddress.find(function);
+        if(byPath != nativesByPath.end())
+        {
+          objects[i] = byPath->second;
+        }
+        else if(byAddress != nativesByAddress.end())
+        {
+          objects[i] = byAddress->second;
+        }
+        else
+        {
+          std::string name(path);
+          for(size_t c = 0; c < name.length(); ++c) if(name[c] == '\x01') name[c] = '.';
+          log.LogEntry("heap image: native function %s is not bound", (name.empty()) ? "?" : name.c_str() + 1);
+          result = false;
+        }
+        break;
+      }
+
+      case GM_HEAP_USER :
+      {
+        gmuint32 type;
+        if(!payload.Read(&type, sizeof(type)) || type >= header.m_numTypes)
+        {
+          break;
+        }
+        if(types[type] == GM_INVALID_TYPE || m_userTypes.find(a_machine->GetTypeName(types[type])) == m_userTypes.end())
+        {
+          log.LogEntry("heap image: type %s is not registered", (types[type] == GM_INVALID_TYPE) ? "?" : a_machine->GetTypeName(types[type]));
+          result = false;
+          break;
+        }
+        // the restore callback sets the user pointer
+        objects[i] = a_machine->AllocUserObject(NULL, types[type]);
+        break;
+      }
+
+      default : break;
+    }
+
+    if(result && objects[i] == NULL)
+    {
+      log.LogEntry("heap image: corrupt");
+      result = false;
+    }
+  }
+
+  // second pass, fill in the objects
+  std::vector<gmuint8> byteCode;
+  std::vector<const char *> symbols;
+  std::vector<gmLineInfo> lineInfo;
+  for(gmuint32 i = 0; i < header.m_numObjects && result; ++i)
+  {
+    const Record &record = records[i];
+    gmHeapReader payload = reader;
+    payload.m_pos = record.m_payload;
+    payload.m_end = record.m_end;
+
+    switch(record.m_kind)
+    {
+      case GM_HEAP_TABLE :
+      {
+        gmTableObject * table = (roots[i + 1]) ? staged[i] : (gmTableObject *) objects[i];
+        gmuint32 count;
+        result = payload.Read(&count, sizeof(count)) && count <= (gmuint32) (payload.m_end - payload.m_pos);
+        if(result) table->Reserve(a_machine, (int) count);
+        for(gmuint32 n = 0; n < count && result; ++n)
+        {
+          gmVariable key, value;
+          result = payload.ReadVariable(key) && payload.ReadVariable(value) && !key.IsNull();
+          if(result) table->Set(a_machine, key, value);
+        }
+        break;
+      }
+
+      case GM_HEAP_FUNCTION :
+      {
+        gmuint32 numParams, numLocals, numClearLocals, maxStackSize, byteCodeLength, debug = 0;
+        result = payload.Read(&numParams, sizeof(gmuint32)) && payload.Read(&numLocals, sizeof(gmuint32)) &&
+                 ((header.m_flags & 0x02) == 0 || payload.Read(&numClearLocals, sizeof(gmuint32))) &&
+                 payload.Read(&maxStackSize, sizeof(gmuint32)) && payload.Read(&byteCodeLength, sizeof(gmuint32)) &&
+                 byteCodeLength <= (gmuint32) (payload.m_end - payload.m_pos);
+        if(!result) break;
+
+        // object ids back to references, symbols as the lib loader makes them
+        byteCode.assign(payload.m_pos, payload.m_pos + byteCodeLength);
+        payload.m_pos += byteCodeLength;
+        gmuint8 * start = (byteCodeLength) ? &byteCode[0] : NULL;
+        const gmuint8 * instruction = start;
+        gmuint32 opcode;
+        while(result && gmHeapNextOperand(instruction, start + byteCodeLength, opcode))
+        {
+          gmptr reference;
+          memcpy(&reference, instruction, sizeof(gmptr));
+          gmObject * object = (reference > 0 && reference <= (gmptr) objects.size()) ? objects[(size_t) reference - 1] : NULL;
+          int expected = (opcode == BC_PUSHFN) ? GM_FUNCTION : GM_STRING;
+          result = (object != NULL && object->GetType() == expected);
+          if(!result) break;
+          if(opcode != BC_PUSHSTR && opcode != BC_PUSHFN)
+          {
+            gmStringObject * string = (gmStringObject *) object;
+            object = a_machine->AllocPermanantStringObject(string->GetString(), string->GetLength());
+          }
+          reference = object->GetRef();
+          memcpy(start + (instruction - start), &reference, sizeof(gmptr));
+          instruction += sizeof(gmptr);
+        }
+
+        gmFunctionInfo info;
+        memset(&info, 0, sizeof(info));
+        info.m_byteCode = start;
+        info.m_byteCodeLength = (int) byteCodeLength;
+        info.m_numParams = (int) numParams;
+        info.m_numLocals = (int) numLocals;
+        info.m_numClearLocals = (header.m_flags & 0x02) ? (int) numClearLocals : (int) numLocals;
+        info.m_maxStackSize = (int) maxStackSize;
+
+        result = result && payload.Read(&debug, sizeof(debug));
+        if(result && debug)
+        {
+          gmuint32 hasName, lineInfoCount, numSymbols;
+          const char * name = NULL;
+          result = payload.Read(&hasName, sizeof(hasName)) && (name = payload.ReadString()) != NULL &&
+                   payload.Read(&lineInfoCount, sizeof(lineInfoCount)) &&
+                   lineInfoCount <= (gmuint32) (payload.m_end - payload.m_pos) / sizeof(gmLineInfo);
+          if(!result) break;
+          info.m_debugName = (hasName) ? name : NULL;
+          info.m_lineInfoCount = (int) lineInfoCount;
+          // the line info may not be aligned in the image
+          lineInfo.resize(lineInfoCount);
+          if(lineInfoCount) memcpy(&lineInfo[0], payload.m_pos, sizeof(gmLineInfo) * lineInfoCount);
+          info.m_lineInfo = (lineInfoCount) ? &lineInfo[0] : NULL;
+          payload.m_pos += sizeof(gmLineInfo) * lineInfoCount;
+          result = payload.Read(&numSymbols, sizeof(numSymbols)) && (numSymbols == 0 || numSymbols == numParams + numLocals);
+          symbols.clear();
+          for(gmuint32 s = 0; s < numSymbols && result; ++s)
+          {
+            symbols.push_back(payload.ReadString());
+            result = (symbols.back() != NULL);
+          }
+          info.m_symbols = (numSymbols) ? &symbols[0] : NULL;
+        }
+        if(result)
+        {
+          ((gmFunctionObject *) objects[i])->Init(a_machine, a_machine->GetDebugMode(), info);
+        }
+        break;
+      }
+
+      case GM_HEAP_USER :
+      {
+        gmUserObject * user = (gmUserObject *) objects[i];
+        payload.m_pos += sizeof(gmuint32);
+        const UserType &type = m_userTypes[a_machine->GetTypeName(user->GetType())];
+        void * data = NULL;
+        result = (type.m_restore != NULL) && type.m_restore(payload, user->GetType(), data);
+        user->m_user = data;
+        if(!result)
+        {
+          log.LogEntry("heap image: could not restore a %s", a_machine->GetTypeName(user->GetType()));
+        }
+        break;
+      }
+
+      default : break;
+    }
+
+    if(!result && record.m_kind != GM_HEAP_USER)
+    {
+      log.LogEntry("heap image: corrupt");
+    }
+  }
+
+  // the image is good, set the globals and type variables
+  if(result)
+  {
+    for(std::map<gmuint32, gmTableObject *>::iterator it = staged.begin(); it != staged.end(); ++it)
+    {
+      it->second->CopyTo(a_machine, (gmTableObject *) objects[it->first]);
+    }
+  }
+
+  a_machine->EnableGC(gcEnabled);
+  return result;
+}
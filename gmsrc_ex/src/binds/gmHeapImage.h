@@ -0,0 +1,133 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#ifndef _GMHEAPIMAGE_H_
+#define _GMHEAPIMAGE_H_
+
+#include "gmConfig.h"
+#include "gmVariable.h"
+#include "gmStreamBuffer.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Fwd decls
+class gmMachine;
+class gmUserObject;
+
+
+/// \class gmHeapWriter
+/// \brief gmHeapWriter is handed to a user type's save callback to write its object.
+class gmHeapWriter
+{
+public:
+
+  void Write(const void * a_data, unsigned int a_size) { m_stream->Write(a_data, a_size); }
+  /// \brief WriteString() writes a_length bytes of a_string, all of it if a_length is -1.
+  void WriteString(const char * a_string, int a_length = -1);
+  void WriteVariable(const gmVariable &a_variable);
+  /// \brief WriteObject() writes a reference, the object is saved too.  a_object may be NULL.
+  void WriteObject(gmObject * a_object);
+
+  inline gmMachine * GetMachine() const { return m_machine; }
+
+private:
+
+  gmuint32 GetId(gmObject * a_object);
+
+  gmMachine * m_machine;
+  gmStream * m_stream;
+  std::map<gmObject *, gmuint32> m_ids;
+  std::vector<gmObject *> m_objects; ///< by id - 1, in the order they are saved
+
+  friend class gmHeapImage;
+};
+
+
+/// \class gmHeapReader
+/// \brief gmHeapReader is handed to a user type's restore callback to read back its object.
+///        Every object in the image exists by then, so references can be read.
+class gmHeapReader
+{
+public:
+
+  bool Read(void * a_data, unsigned int a_size);
+  /// \brief ReadString() returns a string inside the image, NULL on error.
+  const char * ReadString(int * a_length = NULL);
+  bool ReadVariable(gmVariable &a_variable);
+  bool ReadObject(gmObject * &a_object);
+
+  inline gmMachine * GetMachine() const { return m_machine; }
+
+private:
+
+  gmMachine * m_machine;
+  const gmuint8 * m_pos;
+  const gmuint8 * m_end;
+  const std::vector<gmObject *> * m_objects;
+
+  friend class gmHeapImage;
+};
+
+
+/// \brief gmHeapSaveCallback writes a user object, return false if it can not be saved.
+typedef bool (GM_CDECL *gmHeapSaveCallback)(gmHeapWriter &a_writer, gmUserObject * a_object);
+/// \brief gmHeapRestoreCallback reads back a user object, setting a_user to the native object.
+typedef bool (GM_CDECL *gmHeapRestoreCallback)(gmHeapReader &a_reader, gmType a_type, void * &a_user);
+
+
+/*!
+  \class gmHeapImage
+  \brief Saves everything reachable from a machine's globals and type variables, and restores it into
+         a freshly initialised machine, instead of running the scripts that built it again.
+
+  The restoring machine must have bound the same libraries and registered the same types, native
+  functions are found at the same table paths, or failing that by address.  Strings, tables and script
+  functions are saved whole, user objects through callbacks registered by type name.  Threads, their
+  stacks and source code for the debugger are not saved.  An image only loads into the same build.
+
+    // once, after startup
+    gmHeapImage image;
+    image.RegisterUserType("Vec2", SaveVec2, RestoreVec2);
+    gmStreamBufferDynamic stream;
+    image.Save(&machine, stream);
+
+    // every restart
+    image.Restore(&newMachine, data, size);
+*/
+class gmHeapImage
+{
+public:
+
+  /// \brief RegisterUserType() sets how objects of a user type are saved and restored.
+  void RegisterUserType(const char * a_typeName, gmHeapSaveCallback a_save, gmHeapRestoreCallback a_restore);
+
+  /// \brief Save() writes the reachable heap of an idle machine, ie. not from inside gmMachine::Execute().
+  /// \return false on an object that can not be saved, see the machine log.
+  bool Save(gmMachine * a_machine, gmStream &a_stream);
+
+  /// \brief Restore() rebuilds a saved heap, setting its globals and type variables over a_machine's.
+  /// \return false on a bad image or a missing native function or type, see the machine log.
+  bool Restore(gmMachine * a_machine, const void * a_image, unsigned int a_size);
+
+private:
+
+  struct UserType
+  {
+    gmHeapSaveCallback m_save;
+    gmHeapRestoreCallback m_restore;
+  };
+
+  std::map<std::string, UserType> m_userTypes;
+};
+
+#endif // _GMHEAPIMAGE_H_
@@ -0,0 +1,368 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#include "gmConfig.h"
+#include "gmHotReload.h"
+#include "gmThread.h"
+#include "gmMachine.h"
+#include "gmCodeTree.h"
+#include "gmCodeGen.h"
+#include "gmLibHooks.h"
+
+typedef std::map<gmFunctionObject *, gmFunctionObject *> gmHotReloadRetired;
+
+
+static inline const gmlHeader1 * gmHotReloadHeader(const std::vector<gmuint8> &a_lib)
+{
+  return (const gmlHeader1 *) &a_lib[0];
+}
+
+
+static inline const gmlFunction1 * gmHotReloadFunctions(const std::vector<gmuint8> &a_lib)
+{
+  return (const gmlFunction1 *) (&a_lib[0] + gmHotReloadHeader(a_lib)->m_fnOffset);
+}
+
+
+// string table offset or function id in the operand of a relocation
+static inline gmptr gmHotReloadOperand(const std::vector<gmuint8> &a_lib, const gmlFunction1 &a_function, gmuint32 a_reloc)
+{
+  gmptr operand;
+  memcpy(&operand, &a_lib[a_function.m_byteCodeOffset + (a_reloc >> 2)], sizeof(gmptr));
+  return operand;
+}
+
+
+static inline const char * gmHotReloadString(const std::vector<gmuint8> &a_lib, gmuint32 a_offset)
+{
+  return (const char *) &a_lib[gmHotReloadHeader(a_lib)->m_stOffset + a_offset];
+}
+
+
+// function byte code, stack sizes and line info compared with strings and functions resolved
+static bool gmHotReloadSame(const std::vector<gmuint8> &a_oldLib, const std::vector<std::string> &a_oldPaths, const gmlFunction1 &a_old,
+                            const std::vector<gmuint8> &a_newLib, const std::vector<std::string> &a_newPaths, const gmlFunction1 &a_new, bool a_debug)
+{
+  if(a_old.m_numParams != a_new.m_numParams || a_old.m_numLocals != a_new.m_numLocals || a_old.m_maxStackSize != a_new.m_maxStackSize ||
+     a_old.m_byteCodeLen != a_new.m_byteCodeLen || a_old.m_numRelocs != a_new.m_numRelocs)
+  {
+    return false;
+  }
+
+  std::vector<gmuint8> oldCode(&a_oldLib[a_old.m_byteCodeOffset], &a_oldLib[a_old.m_byteCodeOffset] + a_old.m_byteCodeLen);
+  std::vector<gmuint8> newCode(&a_newLib[a_new.m_byteCodeOffset], &a_newLib[a_new.m_byteCodeOffset] + a_new.m_byteCodeLen);
+  const gmuint32 * oldReloc = (const gmuint32 *) &a_oldLib[a_old.m_relocOffset];
+  const gmuint32 * newReloc = (const gmuint32 *) &a_newLib[a_new.m_relocOffset];
+  for(gmuint32 j = 0; j < a_old.m_numRelocs; ++j)
+  {
+    if(oldReloc[j] != newReloc[j])
+    {
+      return false;
+    }
+    gmptr oldOperand = gmHotReloadOperand(a_oldLib, a_old, oldReloc[j]);
+    gmptr newOperand = gmHotReloadOperand(a_newLib, a_new, newReloc[j]);
+    if((oldReloc[j] & 3) == GM_LIB_RELOC_FUNCTION)
+    {
+      const std::string &path = a_oldPaths[oldOperand];
+      if(path[0] == '?' || path != a_newPaths[newOperand]) return false;
+    }
+    else if(strcmp(gmHotReloadString(a_oldLib, (gmuint32) oldOperand), gmHotReloadString(a_newLib, (gmuint32) newOperand)) != 0)
+    {
+      return false;
+    }
+    memset(&oldCode[oldReloc[j] >> 2], 0, sizeof(gmptr));
+    memset(&newCode[newReloc[j] >> 2], 0, sizeof(gmptr));
+  }
+  if(a_old.m_byteCodeLen && memcmp(&oldCode[0], &newCode[0], a_old.m_byteCodeLen) != 0)
+  {
+    return false;
+  }
+
+  // moved lines and renamed locals only matter to the debugger
+  if(a_debug)
+  {
+    const gmuint32 * oldInfo = (const gmuint32 *) &a_oldLib[a_old.m_debugOffset];
+    const gmuint32 * newInfo = (const gmuint32 *) &a_newLib[a_new.m_debugOffset];
+    if(oldInfo[1] != newInfo[1] || memcmp(oldInfo + 2, newInfo + 2, sizeof(gmuint32) * 2 * oldInfo[1]) != 0)
+    {
+      return false;
+    }
+    oldInfo += 2 + 2 * oldInfo[1];
+    newInfo += 2 + 2 * newInfo[1];
+    for(gmuint32 j = 0; j < a_old.m_numParams + a_old.m_numLocals; ++j)
+    {
+      if(oldInfo[j] != newInfo[j] && (oldInfo[j] == (gmuint32) ~0 || newInfo[j] == (gmuint32) ~0 ||
+         strcmp(gmHotReloadString(a_oldLib, oldInfo[j]), gmHotReloadString(a_newLib, newInfo[j])) != 0))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+
+// point frames running a changed function at the object now holding its old byte code
+static bool GM_CDECL gmHotReloadRetire(gmThread * a_thread, void * a_context)
+{
+  gmHotReloadRetired * retired = (gmHotReloadRetired *) a_context;
+  gmVariable * base = a_thread->GetBase();
+  const gmStackFrame * frame = a_thread->GetFrame();
+  while(frame)
+  {
+    gmVariable * fnVar = base - 1;
+    if(fnVar->m_type == GM_FUNCTION)
+    {
+      gmHotReloadRetired::iterator it = retired->find((gmFunctionObject *) GM_MOBJECT(a_thread->GetMachine(), fnVar->m_value.m_ref));
+      if(it != retired->end())
+      {
+#if GM_USE_INCGC
+        a_thread->GetMachine()->GetGC()->WriteBarrier(it->first);
+#endif //GM_USE_INCGC
+        fnVar->m_value.m_ref = it->second->GetRef();
+      }
+    }
+    base = a_thread->GetBottom() + frame->m_returnBase;
+    frame = frame->m_prev;
+  }
+  return true;
+}
+
+
+gmHotReload::gmHotReload(gmMachine * a_machine)
+  : m_machine(a_machine)
+{
+}
+
+
+gmHotReload::~gmHotReload()
+{
+  while(!m_scripts.empty())
+  {
+    Forget(m_scripts.begin()->first.c_str());
+  }
+}
+
+
+gmFunctionObject * gmHotReload::Load(const char * a_source, const char * a_filename)
+{
+  Script * script = new Script;
+  if(!Compile(a_source, a_filename, *script))
+  {
+    delete script;
+    return NULL;
+  }
+
+  bool gc = m_machine->IsGCEnabled();
+  m_machine->EnableGC(false);
+  for(size_t i = 0; i < script->m_functions.size(); ++i)
+  {
+    script->m_functions[i] = m_machine->AllocFunctionObject();
+    if(script->m_paths[i].empty()) script->m_root = script->m_functions[i];
+  }
+  Bind(*script, a_source, a_filename, std::vector<bool>(script->m_functions.size(), true));
+  m_machine->AddCPPOwnedGMObject(script->m_root);
+  m_machine->EnableGC(gc);
+
+  Forget(a_filename);
+  m_scripts[a_filename] = script;
+  return script->m_root;
+}
+
+
+int gmHotReload::Reload(const char * a_source, const char * a_filename, int * a_numAdded, int * a_numRemoved)
+{
+  std::map<std::string, Script *>::iterator found = m_scripts.find(a_filename);
+  if(found == m_scripts.end())
+  {
+    m_machine->GetLog().LogEntry("%s was not loaded for reloading", a_filename);
+    return -1;
+  }
+
+  Script * script = new Script;
+  if(!Compile(a_source, a_filename, *script))
+  {
+    delete script;
+    return -1;
+  }
+  Script * old = found->second;
+
+  std::map<std::string, gmuint32> oldIds;
+  for(gmuint32 id = 0; id < (gmuint32) old->m_paths.size(); ++id)
+  {
+    if(old->m_paths[id][0] != '?') oldIds[old->m_paths[id]] = id;
+  }
+  std::vector<const gmlFunction1 *> oldEntries(old->m_paths.size(), (const gmlFunction1 *) NULL);
+  const gmlFunction1 * oldFunctions = gmHotReloadFunctions(old->m_lib);
+  for(gmuint32 i = 0; i < (gmuint32) oldEntries.size(); ++i)
+  {
+    oldEntries[oldFunctions[i].m_id] = &oldFunctions[i];
+  }
+
+  bool gc = m_machine->IsGCEnabled();
+  m_machine->EnableGC(false);
+
+  // changed functions keep their object, the old body moves to a new one
+  const gmlFunction1 * functions = gmHotReloadFunctions(script->m_lib);
+  std::vector<bool> bind(script->m_functions.size(), false);
+  gmHotReloadRetired retired;
+  int replaced = 0, added = 0, matched = 0;
+  for(gmuint32 i = 0; i < (gmuint32) script->m_functions.size(); ++i)
+  {
+    const gmlFunction1 &function = functions[i];
+    const std::string &path = script->m_paths[function.m_id];
+    std::map<std::string, gmuint32>::iterator match = (path[0] == '?') ? oldIds.end() : oldIds.find(path);
+    if(match == oldIds.end())
+    {
+      script->m_functions[function.m_id] = m_machine->AllocFunctionObject();
+      bind[i] = true;
+      ++added;
+      continue;
+    }
+
+    gmFunctionObject * object = old->m_functions[match->second];
+    script->m_functions[function.m_id] = object;
+    ++matched;
+    if(!gmHotReloadSame(old->m_lib, old->m_paths, *oldEntries[match->second], script->m_lib, script->m_paths, function, m_machine->GetDebugMode()))
+    {
+      gmFunctionObject * body = m_machine->AllocFunctionObject();
+      object->Swap(m_machine, body);
+      retired[object] = body;
+      bind[i] = true;
+      ++replaced;
+    }
+  }
+  script->m_root = old->m_root;
+
+  Bind(*script, a_source, a_filename, bind);
+  if(!retired.empty())
+  {
+    m_machine->ForEachThread(gmHotReloadRetire, &retired);
+  }
+  m_machine->EnableGC(gc);
+
+  if(a_numAdded) *a_numAdded = added;
+  if(a_numRemoved) *a_numRemoved = (int) oldIds.size() - matched;
+  delete old;
+  found->second = script;
+  return replaced;
+}
+
+
+void gmHotReload::Forget(const char * a_filename)
+{
+  std::map<std::string, Script *>::iterator found = m_scripts.find(a_filename);
+  if(found != m_scripts.end())
+  {
+    m_machine->RemoveCPPOwnedGMObject(found->second->m_root);
+    delete found->second;
+    m_scripts.erase(found);
+  }
+}
+
+
+bool gmHotReload::Compile(const char * a_source, const char * a_filename, Script &a_script)
+{
+#if GMMACHINE_REMOVECOMPILER
+  m_machine->GetLog().LogEntry("No compiler in build");
+  return false;
+#else // GMMACHINE_REMOVECOMPILER
+  // always with debug info, for the function names
+  gmStreamBufferDynamic stream;
+  int errors = gmCodeTree::Get().Lock(a_source, &m_machine->GetLog());
+  if(errors == 0)
+  {
+    gmLibHooks hooks(stream, a_source);
+    errors = gmCodeGen::Get().Lock(gmCodeTree::Get().GetCodeTree(), &hooks, true, &m_machine->GetLog());
+    gmCodeGen::Get().Unlock();
+  }
+  gmCodeTree::Get().Unlock();
+  if(errors || !gmLibHooks::CheckLibImage(stream.GetData(), stream.GetSize()))
+  {
+    m_machine->GetLog().LogEntry("Could not compile file %s", a_filename);
+    return false;
+  }
+  a_script.m_lib.assign(stream.GetData(), stream.GetData() + stream.GetSize());
+
+  // path each function by walking down from the root through the functions each one pushes
+  const gmlHeader1 * header = gmHotReloadHeader(a_script.m_lib);
+  const gmlFunction1 * functions = gmHotReloadFunctions(a_script.m_lib);
+  gmuint32 numFunctions = header->m_numFunctions;
+  std::vector<const gmlFunction1 *> entries(numFunctions, (const gmlFunction1 *) NULL);
+  std::vector<gmuint32> stack;
+  a_script.m_paths.assign(numFunctions, "?");
+  a_script.m_functions.assign(numFunctions, (gmFunctionObject *) NULL);
+  for(gmuint32 i = 0; i < numFunctions; ++i)
+  {
+    entries[functions[i].m_id] = &functions[i];
+    if(functions[i].m_flags & 1)
+    {
+      a_script.m_paths[functions[i].m_id] = "";
+      stack.push_back(functions[i].m_id);
+    }
+  }
+
+  while(!stack.empty())
+  {
+    gmuint32 id = stack.back();
+    stack.pop_back();
+    const gmlFunction1 &function = *entries[id];
+    const gmuint32 * reloc = (const gmuint32 *) &a_script.m_lib[function.m_relocOffset];
+    std::map<std::string, int> counts;
+    for(gmuint32 j = 0; j < function.m_numRelocs; ++j)
+    {
+      if((reloc[j] & 3) != GM_LIB_RELOC_FUNCTION) continue;
+      gmuint32 child = (gmuint32) gmHotReloadOperand(a_script.m_lib, function, reloc[j]);
+      if(entries[child] == NULL || a_script.m_paths[child] != "?") continue;
+
+      const char * name = gmHotReloadString(a_script.m_lib, ((const gmuint32 *) &a_script.m_lib[entries[child]->m_debugOffset])[0]);
+      char count[16];
+      sprintf(count, "#%d", counts[name]++);
+      a_script.m_paths[child] = a_script.m_paths[id] + "/" + name + count;
+      stack.push_back(child);
+    }
+  }
+  return true;
+#endif // GMMACHINE_REMOVECOMPILER
+}
+
+
+void gmHotReload::Bind(Script &a_script, const char * a_source, const char * a_filename, const std::vector<bool> &a_bind)
+{
+  const gmlHeader1 * header = gmHotReloadHeader(a_script.m_lib);
+  const gmlFunction1 * functions = gmHotReloadFunctions(a_script.m_lib);
+  gmuint32 maxByteCodeLen = 0, maxSymbols = 0;
+  for(gmuint32 i = 0; i < header->m_numFunctions; ++i)
+  {
+    if(functions[i].m_byteCodeLen > maxByteCodeLen) maxByteCodeLen = functions[i].m_byteCodeLen;
+    if(functions[i].m_numParams + functions[i].m_numLocals > maxSymbols) maxSymbols = functions[i].m_numParams + functions[i].m_numLocals;
+  }
+  std::vector<gmuint8> byteCode(maxByteCodeLen + sizeof(gmptr));
+  std::vector<const char *> symbols(maxSymbols + 1);
+
+  gmLibImage lib;
+  memset(&lib, 0, sizeof(lib));
+  lib.m_machine = m_machine;
+  lib.m_image = &a_script.m_lib[0];
+  lib.m_numFunctions = header->m_numFunctions;
+  lib.m_functionObjects = &a_script.m_functions[0];
+  lib.m_symbols = &symbols[0];
+  lib.m_debug = true;
+  if(m_machine->GetDebugMode())
+  {
+    lib.m_sourceCodeId = m_machine->AddSourceCode(a_source, a_filename);
+  }
+
+  for(gmuint32 i = 0; i < header->m_numFunctions; ++i)
+  {
+    if(a_bind[i]) lib.Bind(i, &byteCode[0]);
+  }
+}
@@ -0,0 +1,79 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#ifndef _GMHOTRELOAD_H_
+#define _GMHOTRELOAD_H_
+
+#include "gmConfig.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Fwd decls
+class gmMachine;
+class gmFunctionObject;
+
+
+/*!
+  \class gmHotReload
+  \brief Reloads changed functions of a running script in place, without executing the script again.
+
+  Functions are matched by path, the names of the functions they are nested in and their own name, eg.
+  "/Player#0/OnDamage#0" for a function assigned to OnDamage inside the function assigned to Player.
+  The number counts earlier functions of the same name in the same parent.  A changed function keeps
+  its gmFunctionObject, so every table and variable holding it calls the new byte code from the next call.
+  Calls already running finish in the old byte code.  Data is not touched, functions that are new or
+  removed only take effect where a changed function creates them, run the script again for new globals.
+
+    gmHotReload reload(&machine);
+    machine.ExecuteFunction(reload.Load(source, "player.gm"));
+    ...
+    reload.Reload(newSource, "player.gm");
+*/
+class gmHotReload
+{
+public:
+
+  gmHotReload(gmMachine * a_machine);
+  ~gmHotReload();
+
+  /// \brief Load() compiles a script and remembers its functions for Reload().
+  /// \return the root function for the caller to execute, NULL on a compile error, see the machine log.
+  gmFunctionObject * Load(const char * a_source, const char * a_filename);
+
+  /// \brief Reload() compiles the new source of a loaded script and replaces the bodies of changed functions.
+  ///        Call between gmMachine::Execute() calls, not from a native function.
+  /// \param a_numAdded, a_numRemoved optional, set to the number of functions with a new path and missing paths.
+  /// \return the number of functions replaced, -1 on a compile error or if the script was not loaded.
+  int Reload(const char * a_source, const char * a_filename, int * a_numAdded = NULL, int * a_numRemoved = NULL);
+
+  /// \brief Forget() stops tracking a script, its functions may then be collected as usual.
+  void Forget(const char * a_filename);
+
+private:
+
+  struct Script
+  {
+    std::vector<gmuint8> m_lib;                 ///< 'gml1' lib the functions were bound from, with debug info
+    std::vector<std::string> m_paths;           ///< by function id
+    std::vector<gmFunctionObject *> m_functions; ///< by function id
+    gmFunctionObject * m_root;                  ///< owned by the machine for as long as the script is tracked
+  };
+
+  bool Compile(const char * a_source, const char * a_filename, Script &a_script);
+  void Bind(Script &a_script, const char * a_source, const char * a_filename, const std::vector<bool> &a_bind);
+
+  gmMachine * m_machine;
+  std::map<std::string, Script *> m_scripts;
+};
+
+#endif // _GMHOTRELOAD_H_
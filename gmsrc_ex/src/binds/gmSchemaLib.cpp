@@ -10,8 +10,8 @@
 
 namespace gmSchema
 {
-	gmType GM_SCHEMA = GM_NULL;
-	gmType GM_SCHEMA_ELEMENT = GM_NULL;
+	gmLibType GM_SCHEMA;
+	gmLibType GM_SCHEMA_ELEMENT;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -52,7 +52,8 @@ public:
 		while(pNode)
 		{
 			const char *Msg = pNode->m_value.GetCStringSafe(0);
-			gmMachine::s_printCallback(a_machine,Msg);
+			gmPrintCallback printCallback = a_machine->GetPrintCallback();
+			if(printCallback) printCallback(a_machine,Msg);
 			pNode = m_Errors->GetNext(tIt);
 		}
 	}
@@ -492,13 +493,13 @@ static int GM_CDECL gmfSchemaCheck(gmThread * a_thread)
 	if(checktable || checkUser)
 	{
 		gmMachine *pM = a_thread->GetMachine();
-		gmTableObject *SchemaTable = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA));
+		gmTableObject *SchemaTable = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA.Get(a_thread)));
 
 		gmTableIterator tIt;
 		gmTableNode *pNode = SchemaTable->GetFirst(tIt);
 		while(pNode)
 		{
-			gmTableObject *SchemaDef = static_cast<gmTableObject*>(pNode->m_value.GetUserSafe(gmSchema::GM_SCHEMA_ELEMENT));
+			gmTableObject *SchemaDef = static_cast<gmTableObject*>(pNode->m_value.GetUserSafe(gmSchema::GM_SCHEMA_ELEMENT.Get(a_thread)));
 			gmVariable SchemaDefault = SchemaDef->Get(pM,"default");
 			GM_ASSERT(SchemaDef);
 
@@ -619,7 +620,7 @@ static int GM_CDECL gmfSchemaCheck(gmThread * a_thread)
 //////////////////////////////////////////////////////////////////////////
 #define CREATE_ELEMENT() \
 	gmTableObject *tbl = a_thread->GetMachine()->AllocTableObject(); \
-	gmUserObject *obj = a_thread->GetMachine()->AllocUserObject(tbl,gmSchema::GM_SCHEMA_ELEMENT);
+	gmUserObject *obj = a_thread->GetMachine()->AllocUserObject(tbl,gmSchema::GM_SCHEMA_ELEMENT.Get(a_thread));
 
 static int gmfSchemaEnum(gmThread *a_thread)
 {
@@ -717,7 +718,7 @@ static int gmfSchemaTableOf(gmThread *a_thread)
 static int gmfSchemaElementDefault(gmThread *a_thread)
 {
 	GM_CHECK_NUM_PARAMS(1);
-	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT));
+	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT.Get(a_thread)));
 	GM_ASSERT(tbl);
 
 	SchemaErrors errs(a_thread->GetMachine());
@@ -737,7 +738,7 @@ static int gmfSchemaElementDefault(gmThread *a_thread)
 static int gmfSchemaReadOnly(gmThread *a_thread)
 {
 	GM_CHECK_NUM_PARAMS(1);
-	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT));
+	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT.Get(a_thread)));
 	GM_ASSERT(tbl);
 
 	SchemaErrors errs(a_thread->GetMachine());
@@ -779,7 +780,7 @@ static int gmfSchemaCheckValue(gmThread *a_thread)
 {
 	GM_CHECK_NUM_PARAMS(1);
 	GM_CHECK_TABLE_PARAM(checktable,0); (void)checktable;
-	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT));
+	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT.Get(a_thread)));
 	GM_ASSERT(tbl);
 	tbl->Set(a_thread->GetMachine(),"checkvalue",a_thread->Param(0));
 	a_thread->PushUser(a_thread->ThisUserObject());
@@ -790,7 +791,7 @@ static int gmfSchemaCheckKey(gmThread *a_thread)
 {
 	GM_CHECK_NUM_PARAMS(1);
 	GM_CHECK_TABLE_PARAM(checktable,0); (void)checktable;
-	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT));
+	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT.Get(a_thread)));
 	GM_ASSERT(tbl);
 	tbl->Set(a_thread->GetMachine(),"checkkey",a_thread->Param(0));
 	a_thread->PushUser(a_thread->ThisUserObject());
@@ -799,7 +800,7 @@ static int gmfSchemaCheckKey(gmThread *a_thread)
 
 static int gmfSchemaGetEnumOptions(gmThread *a_thread)
 {
-	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT));
+	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT.Get(a_thread)));
 	GM_ASSERT(tbl);
 	gmTableObject *options = tbl->Get(a_thread->GetMachine(),"enum").GetTableObjectSafe();
 	if(options)
@@ -813,7 +814,7 @@ static int gmfSchemaCheckCallback(gmThread *a_thread)
 {
 	GM_CHECK_NUM_PARAMS(1);
 	GM_CHECK_FUNCTION_PARAM(cb,0);
-	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT));
+	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT.Get(a_thread)));
 	GM_ASSERT(tbl);
 
 	if(tbl)
@@ -825,7 +826,7 @@ static int gmfSchemaCheckCallback(gmThread *a_thread)
 static int gmfSchemaElementCheck(gmThread *a_thread)
 {
 	GM_CHECK_NUM_PARAMS(2);
-	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT));
+	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT.Get(a_thread)));
 	GM_ASSERT(tbl);
 
 	if(a_thread->ParamType(0)>=GM_USER || a_thread->ParamType(0)==GM_TABLE)
@@ -844,7 +845,7 @@ static int gmfSchemaElementCheck(gmThread *a_thread)
 static int gmfSchemaElementCheckPrintErrors(gmThread *a_thread)
 {
 	GM_CHECK_NUM_PARAMS(2);
-	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT));
+	gmTableObject *tbl = static_cast<gmTableObject*>(a_thread->ThisUserCheckType(gmSchema::GM_SCHEMA_ELEMENT.Get(a_thread)));
 	GM_ASSERT(tbl);
 
 	if(a_thread->ParamType(0)>=GM_USER || a_thread->ParamType(0)==GM_TABLE)
@@ -867,7 +868,7 @@ static int gmfSchemaElementCheckPrintErrors(gmThread *a_thread)
 int gmfCreateSchema(gmThread *a_thread)
 {
 	gmTableObject *SchemaTbl = a_thread->GetMachine()->AllocTableObject();
-	a_thread->PushNewUser(SchemaTbl,gmSchema::GM_SCHEMA);
+	a_thread->PushNewUser(SchemaTbl,gmSchema::GM_SCHEMA.Get(a_thread));
 	return GM_OK;
 }
 
@@ -876,7 +877,7 @@ int gmfCreateSchema(gmThread *a_thread)
 
 static bool gmfTraceSchema(gmMachine *a_machine, gmUserObject*a_object, gmGarbageCollector*a_gc, const int a_workLeftToGo, int& a_workDone)
 {
-	GM_ASSERT(a_object->GetType()==gmSchema::GM_SCHEMA);
+	GM_ASSERT(a_object->GetType()==gmSchema::GM_SCHEMA.Get(a_machine));
 	gmTableObject *Tbl = static_cast<gmTableObject*>(a_object->m_user);
 	if(Tbl)
 	{
@@ -888,7 +889,7 @@ static bool gmfTraceSchema(gmMachine *a_machine, gmUserObject*a_object, gmGarbag
 
 static bool gmfTraceSchemaElement(gmMachine *a_machine, gmUserObject*a_object, gmGarbageCollector*a_gc, const int a_workLeftToGo, int& a_workDone)
 {
-	GM_ASSERT(a_object->GetType()==gmSchema::GM_SCHEMA_ELEMENT);
+	GM_ASSERT(a_object->GetType()==gmSchema::GM_SCHEMA_ELEMENT.Get(a_machine));
 	gmTableObject *Tbl = static_cast<gmTableObject*>(a_object->m_user);
 	if(Tbl)
 	{
@@ -902,7 +903,7 @@ static bool gmfTraceSchemaElement(gmMachine *a_machine, gmUserObject*a_object, g
 
 static int GM_CDECL gmSchemaGetDot(gmThread * a_thread, gmVariable * a_operands)
 {
-	gmTableObject *Tbl = static_cast<gmTableObject*>(a_operands[0].GetUserSafe(gmSchema::GM_SCHEMA));
+	gmTableObject *Tbl = static_cast<gmTableObject*>(a_operands[0].GetUserSafe(gmSchema::GM_SCHEMA.Get(a_thread)));
 	GM_ASSERT(Tbl);
 	if(Tbl)
 	{
@@ -915,7 +916,7 @@ static int GM_CDECL gmSchemaGetDot(gmThread * a_thread, gmVariable * a_operands)
 
 static int GM_CDECL gmSchemaSetDot(gmThread * a_thread, gmVariable * a_operands)
 {
-	gmTableObject *Tbl = static_cast<gmTableObject*>(a_operands[0].GetUserSafe(gmSchema::GM_SCHEMA));
+	gmTableObject *Tbl = static_cast<gmTableObject*>(a_operands[0].GetUserSafe(gmSchema::GM_SCHEMA.Get(a_thread)));
 	GM_ASSERT(Tbl);
 	if(Tbl)
 	{
@@ -984,22 +985,24 @@ namespace gmSchema
 		a_machine->RegisterLibrary(s_schemaLib,array_size(s_schemaLib));
 		a_machine->RegisterLibrary(s_createElementLib,array_size(s_createElementLib),"Validate");
 
-		GM_SCHEMA = a_machine->CreateUserType("Schema");
-		a_machine->RegisterTypeLibrary(GM_SCHEMA, s_schemaTypeLib, array_size(s_schemaTypeLib));
-		a_machine->RegisterUserCallbacks(GM_SCHEMA,gmfTraceSchema,NULL,NULL,NULL);
-		a_machine->RegisterTypeOperator(GM_SCHEMA, O_GETDOT, NULL, gmSchemaGetDot);
-		a_machine->RegisterTypeOperator(GM_SCHEMA, O_SETDOT, NULL, gmSchemaSetDot);
-
-		GM_SCHEMA_ELEMENT = a_machine->CreateUserType("SchemaElement");
-		a_machine->RegisterTypeLibrary(GM_SCHEMA_ELEMENT, s_schemaElementTypeLib, array_size(s_schemaElementTypeLib));
-		a_machine->RegisterUserCallbacks(GM_SCHEMA_ELEMENT,gmfTraceSchemaElement,NULL,NULL,NULL);
+		gmType schema = a_machine->CreateUserType("Schema");
+		GM_SCHEMA.Set(a_machine, schema);
+		a_machine->RegisterTypeLibrary(schema, s_schemaTypeLib, array_size(s_schemaTypeLib));
+		a_machine->RegisterUserCallbacks(schema,gmfTraceSchema,NULL,NULL,NULL);
+		a_machine->RegisterTypeOperator(schema, O_GETDOT, NULL, gmSchemaGetDot);
+		a_machine->RegisterTypeOperator(schema, O_SETDOT, NULL, gmSchemaSetDot);
+
+		gmType element = a_machine->CreateUserType("SchemaElement");
+		GM_SCHEMA_ELEMENT.Set(a_machine, element);
+		a_machine->RegisterTypeLibrary(element, s_schemaElementTypeLib, array_size(s_schemaElementTypeLib));
+		a_machine->RegisterUserCallbacks(element,gmfTraceSchemaElement,NULL,NULL,NULL);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 
 	ElementType GetElementType(gmMachine *a_machine, gmVariable &a_schema)
 	{
-		gmTableObject *a_SchemaEl = static_cast<gmTableObject*>(a_schema.GetUserSafe(GM_SCHEMA_ELEMENT));
+		gmTableObject *a_SchemaEl = static_cast<gmTableObject*>(a_schema.GetUserSafe(GM_SCHEMA_ELEMENT.Get(a_machine)));
 		if(a_SchemaEl)
 		{
 			if(a_SchemaEl->Get(a_machine,"enum").GetTableObjectSafe())
@@ -1021,7 +1024,7 @@ namespace gmSchema
 	{
 		if(GetElementType(a_machine,a_schema) == EL_ENUM)
 		{
-			gmTableObject *a_SchemaEl = static_cast<gmTableObject*>(a_schema.GetUserSafe(GM_SCHEMA_ELEMENT));
+			gmTableObject *a_SchemaEl = static_cast<gmTableObject*>(a_schema.GetUserSafe(GM_SCHEMA_ELEMENT.Get(a_machine)));
 			return a_SchemaEl->Get(a_machine,"enum").GetTableObjectSafe();
 		}
 		return 0;
@@ -1031,7 +1034,7 @@ namespace gmSchema
 	{
 		if(GetElementType(a_machine,a_schema) == EL_NUMRANGE)
 		{
-			gmTableObject *a_SchemaEl = static_cast<gmTableObject*>(a_schema.GetUserSafe(GM_SCHEMA_ELEMENT));
+			gmTableObject *a_SchemaEl = static_cast<gmTableObject*>(a_schema.GetUserSafe(GM_SCHEMA_ELEMENT.Get(a_machine)));
 
 			return 
 				a_SchemaEl->Get(a_machine,"numrange").IsInt() &&
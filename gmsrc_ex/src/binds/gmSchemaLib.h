@@ -6,10 +6,11 @@
 #include "gmVariable.h"
 
 class gmMachine;
+class gmLibType;
 
 namespace gmSchema
 {
-	extern gmType GM_SCHEMA;
+	extern gmLibType GM_SCHEMA;
 
 	void BindLib(gmMachine * a_machine);
 
@@ -19,11 +19,11 @@ extern "C"
 
 #undef		GetObject
 
-static gmType s_gmSqliteType = GM_NULL;
+static gmLibType s_gmSqliteType;
 
 static int GM_CDECL gmfSqlite(gmThread * a_thread)
 {
-	a_thread->PushNewUser(NULL, s_gmSqliteType);
+	a_thread->PushNewUser(NULL, s_gmSqliteType.Get(a_thread));
 	return GM_OK;
 };
 
@@ -49,7 +49,7 @@ static int GM_CDECL gmfSqliteOpen(gmThread * a_thread) // path
 
 	gmUserObject * sqliteObject = a_thread->ThisUserObject();
 
-	GM_ASSERT(sqliteObject->m_userType == s_gmSqliteType);
+	GM_ASSERT(sqliteObject->m_userType == s_gmSqliteType.Get(a_thread));
 
 	if(sqliteObject->m_user)
 		sqlite3_close((sqlite3*) sqliteObject->m_user);
@@ -78,7 +78,7 @@ static int GM_CDECL gmfSqliteOpen(gmThread * a_thread) // path
 static int GM_CDECL gmfSqliteClose(gmThread * a_thread)
 {
 	gmUserObject * sqliteObject = a_thread->ThisUserObject();
-	GM_ASSERT(sqliteObject->m_userType == s_gmSqliteType);
+	GM_ASSERT(sqliteObject->m_userType == s_gmSqliteType.Get(a_thread));
 	if(sqliteObject->m_user)
 	{
 		sqlite3_close((sqlite3*)sqliteObject->m_user);
@@ -92,7 +92,7 @@ static int GM_CDECL gmfSqliteQuery(gmThread * a_thread)
 	GM_CHECK_STRING_PARAM(query, 0);
 	
 	gmUserObject * sqliteObject = a_thread->ThisUserObject();
-	GM_ASSERT(sqliteObject->m_userType == s_gmSqliteType);
+	GM_ASSERT(sqliteObject->m_userType == s_gmSqliteType.Get(a_thread));
 
 	sqlite3 *pSqlite = (sqlite3*)sqliteObject->m_user;
 	if(pSqlite)
@@ -185,13 +185,13 @@ void gmBindSqliteLib(gmMachine * a_machine)
 {
 	a_machine->RegisterLibrary(s_SqliteLib, sizeof(s_SqliteLib) / sizeof(s_SqliteLib[0]));
 	// sql
-	s_gmSqliteType = a_machine->CreateUserType("sqlite");
+	s_gmSqliteType.Set(a_machine, a_machine->CreateUserType("sqlite"));
 #if GM_USE_INCGC
-	a_machine->RegisterUserCallbacks(s_gmSqliteType, NULL, gmGCDestructSqliteUserType);
+	a_machine->RegisterUserCallbacks(s_gmSqliteType.Get(a_machine), NULL, gmGCDestructSqliteUserType);
 #else //GM_USE_INCGC
-	a_machine->RegisterUserCallbacks(s_gmSqliteType, NULL, gmGCSqliteUserType);
+	a_machine->RegisterUserCallbacks(s_gmSqliteType.Get(a_machine), NULL, gmGCSqliteUserType);
 #endif //GM_USE_INCGC
-	a_machine->RegisterTypeLibrary(s_gmSqliteType, s_sqliteLib, sizeof(s_sqliteLib) / sizeof(s_sqliteLib[0]));
+	a_machine->RegisterTypeLibrary(s_gmSqliteType.Get(a_machine), s_sqliteLib, sizeof(s_sqliteLib) / sizeof(s_sqliteLib[0]));
 
 }
 
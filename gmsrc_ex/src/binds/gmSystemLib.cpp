@@ -14,6 +14,7 @@ See Copyright Notice in gmMachine.h
 #include "gmThread.h"
 #include "gmMachine.h"
 #include "gmHelpers.h"
+#include "gmCompileCache.h"
 
 #if GM_SYSTEM_LIB
 
@@ -99,16 +100,17 @@ static int GM_CDECL gmfDoFile(gmThread * a_thread) // filename, now (1), return
 		}
 		if(string == NULL) return GM_OK;
 
-		int errors = a_thread->GetMachine()->ExecuteString(string, &id, (now) ? true : false, filename, &paramThis);
+		// compile through the cache, an unchanged file binds its cached lib
+		int errors = 0;
+		gmFunctionObject * function = gmCompileCached(a_thread->GetMachine(), string, filename, &errors);
 		delete[] string;
-		if(errors)
+		if(function == NULL)
 		{
+			if(errors) a_thread->GetMachine()->GetLog().LogEntry("Could not parse file %s", filename);
 			return GM_EXCEPTION;
 		}
-		else
-		{
-			a_thread->PushInt(id);
-		}
+		a_thread->GetMachine()->ExecuteFunction(function, &id, (now) ? true : false, &paramThis);
+		a_thread->PushInt(id);
 	}
 	return GM_OK;
 }
@@ -119,11 +121,11 @@ static int GM_CDECL gmfDoFile(gmThread * a_thread) // filename, now (1), return
 //
 //
 
-static gmType s_gmFileType = GM_NULL;
+static gmLibType s_gmFileType;
 
 static int GM_CDECL gmfFile(gmThread * a_thread)
 {
-	a_thread->PushNewUser(NULL, s_gmFileType);
+	a_thread->PushNewUser(NULL, s_gmFileType.Get(a_thread));
 	return GM_OK;
 }
 
@@ -150,7 +152,7 @@ static int GM_CDECL gmfFileOpen(gmThread * a_thread) // path, readonly(true), re
 	GM_INT_PARAM(readonly, 1, 1);
 
 	gmUserObject * fileObject = a_thread->ThisUserObject();
-	GM_ASSERT(fileObject->m_userType == s_gmFileType);
+	GM_ASSERT(fileObject->m_userType == s_gmFileType.Get(a_thread));
 	if(fileObject->m_user) fclose((FILE *) fileObject->m_user);
 	fileObject->m_user = (void *) fopen(filename, (readonly) ? "rb" : "wb");
 	if(fileObject->m_user) a_thread->PushInt(1);
@@ -165,7 +167,7 @@ static int GM_CDECL gmfFileOpenText(gmThread * a_thread) // path, readonly(true)
 	GM_INT_PARAM(readonly, 1, 1);
 
 	gmUserObject * fileObject = a_thread->ThisUserObject();
-	GM_ASSERT(fileObject->m_userType == s_gmFileType);
+	GM_ASSERT(fileObject->m_userType == s_gmFileType.Get(a_thread));
 	if(fileObject->m_user) fclose((FILE *) fileObject->m_user);
 	fileObject->m_user = (void *) fopen(filename, (readonly) ? "r" : "w");
 	if(fileObject->m_user) a_thread->PushInt(1);
@@ -176,7 +178,7 @@ static int GM_CDECL gmfFileOpenText(gmThread * a_thread) // path, readonly(true)
 static int GM_CDECL gmfFileClose(gmThread * a_thread)
 {
 	gmUserObject * fileObject = a_thread->ThisUserObject();
-	GM_ASSERT(fileObject->m_userType == s_gmFileType);
+	GM_ASSERT(fileObject->m_userType == s_gmFileType.Get(a_thread));
 	if(fileObject->m_user) fclose((FILE *) fileObject->m_user);
 	fileObject->m_user = NULL;
 	return GM_OK;
@@ -185,7 +187,7 @@ static int GM_CDECL gmfFileClose(gmThread * a_thread)
 static int GM_CDECL gmfFileIsOpen(gmThread * a_thread) // return 1 if open, else 0
 {
 	gmUserObject * fileObject = a_thread->ThisUserObject();
-	GM_ASSERT(fileObject->m_userType == s_gmFileType);
+	GM_ASSERT(fileObject->m_userType == s_gmFileType.Get(a_thread));
 	a_thread->PushInt((fileObject->m_user) ? 1 : 0);
 	return GM_OK;
 }
@@ -224,7 +226,7 @@ static int GM_CDECL gmFileOpGetDot(gmThread * a_thread, gmVariable * a_operands)
 static int GM_CDECL gmfFileSeek(gmThread * a_thread) // return false on error
 {
 	gmUserObject * fileObject = a_thread->ThisUserObject();
-	GM_ASSERT(fileObject->m_userType == s_gmFileType);
+	GM_ASSERT(fileObject->m_userType == s_gmFileType.Get(a_thread));
 
 	GM_CHECK_NUM_PARAMS(2);
 	GM_CHECK_INT_PARAM(offset, 0);
@@ -250,7 +252,7 @@ static int GM_CDECL gmfFileSeek(gmThread * a_thread) // return false on error
 static int GM_CDECL gmfFileTell(gmThread * a_thread) // return -1 on error, else file pos.
 {
 	gmUserObject * fileObject = a_thread->ThisUserObject();
-	GM_ASSERT(fileObject->m_userType == s_gmFileType);
+	GM_ASSERT(fileObject->m_userType == s_gmFileType.Get(a_thread));
 	long pos = -1;
 	if(fileObject->m_user) pos = ftell((FILE *) fileObject->m_user);
 	a_thread->PushInt(pos);
@@ -263,7 +265,7 @@ static int GM_CDECL gmfFileReadLine(gmThread * a_thread) // flag keep \n (0), re
 	const int len = GM_SYSTEM_LIB_MAX_LINE;
 	char buffer[len];
 	gmUserObject * fileObject = a_thread->ThisUserObject();
-	GM_ASSERT(fileObject->m_userType == s_gmFileType);
+	GM_ASSERT(fileObject->m_userType == s_gmFileType.Get(a_thread));
 	if(fileObject->m_user)
 	{
 		char * str = fgets(buffer, len, (FILE *) fileObject->m_user);
@@ -284,7 +286,7 @@ static int GM_CDECL gmfFileReadLine(gmThread * a_thread) // flag keep \n (0), re
 static int GM_CDECL gmfFileReadChar(gmThread * a_thread) // return int, return NULL on eof, or on error
 {
 	gmUserObject * fileObject = a_thread->ThisUserObject();
-	GM_ASSERT(fileObject->m_userType == s_gmFileType);
+	GM_ASSERT(fileObject->m_userType == s_gmFileType.Get(a_thread));
 	if(fileObject->m_user)
 	{
 		int c = fgetc((FILE*) fileObject->m_user);
@@ -299,7 +301,7 @@ static int GM_CDECL gmfFileWriteChar(gmThread * a_thread) // int, return char wr
 	GM_CHECK_INT_PARAM(c, 0);
 
 	gmUserObject * fileObject = a_thread->ThisUserObject();
-	GM_ASSERT(fileObject->m_userType == s_gmFileType);
+	GM_ASSERT(fileObject->m_userType == s_gmFileType.Get(a_thread));
 	if(fileObject->m_user)
 	{
 		int r = fputc(c, (FILE *) fileObject->m_user);
@@ -314,7 +316,7 @@ static int GM_CDECL gmfFileWriteString(gmThread * a_thread) // string, return 1
 	GM_CHECK_STRING_PARAM(s, 0);
 
 	gmUserObject * fileObject = a_thread->ThisUserObject();
-	GM_ASSERT(fileObject->m_userType == s_gmFileType);
+	GM_ASSERT(fileObject->m_userType == s_gmFileType.Get(a_thread));
 	if(fileObject->m_user)
 	{
 		if(fputs(s, (FILE *) fileObject->m_user) != EOF) a_thread->PushInt(1);
@@ -342,7 +344,7 @@ static void GM_CDECL gmGCFileUserType(gmMachine * a_machine, gmUserObject * a_ob
 //
 //
 
-static gmType s_gmFileFindType = GM_NULL;
+static gmLibType s_gmFileFindType;
 
 struct gmFileFindUser
 {
@@ -356,7 +358,7 @@ struct gmFileFindUser
 //
 //
 
-static gmType s_gmFileInfoType = GM_NULL;
+static gmLibType s_gmFileInfoType;
 
 struct gmFileInfoUser
 {
@@ -386,7 +388,7 @@ static int GM_CDECL gmfFindFirstFile(gmThread * a_thread)
 		return GM_OK;
 	}
 
-	a_thread->PushNewUser(fileFind, s_gmFileFindType);
+	a_thread->PushNewUser(fileFind, s_gmFileFindType.Get(a_thread));
 	return GM_OK;
 }
 
@@ -395,7 +397,7 @@ static int GM_CDECL gmfFindNextFile(gmThread * a_thread)
 {
 	GM_CHECK_NUM_PARAMS(1);
 
-	if(a_thread->ParamType(0) == s_gmFileFindType)
+	if(a_thread->ParamType(0) == s_gmFileFindType.Get(a_thread))
 	{
 		gmFileFindUser * fileFind = (gmFileFindUser *) a_thread->ParamUser(0);
 		if(fileFind && fileFind->m_iterator != INVALID_HANDLE_VALUE)
@@ -428,7 +430,7 @@ static int GM_CDECL gmfFileInfo(gmThread * a_thread)
 		fileInfo->m_accessedTime = buf.st_atime;
 		fileInfo->m_modifiedTime = buf.st_mtime;
 		fileInfo->m_size = buf.st_size;
-		a_thread->PushNewUser(fileInfo, s_gmFileInfoType);
+		a_thread->PushNewUser(fileInfo, s_gmFileInfoType.Get(a_thread));
 	}
 	_close( fh );
 	return GM_OK;
@@ -600,7 +602,7 @@ static int GM_CDECL gmfFileFindGetAttribute(gmThread * a_thread)
 	GM_CHECK_NUM_PARAMS(1);
 	GM_CHECK_INT_PARAM(attribute, 0);
 
-	GM_ASSERT(a_thread->GetThis()->m_type == s_gmFileFindType);
+	GM_ASSERT(a_thread->GetThis()->m_type == s_gmFileFindType.Get(a_thread));
 	gmFileFindUser * fileFind = (gmFileFindUser *) a_thread->ThisUser();
 
 	DWORD attr = 0;
@@ -962,33 +964,33 @@ void gmBindSystemLib(gmMachine * a_machine)
 	a_machine->RegisterLibrary(s_systemLib, sizeof(s_systemLib) / sizeof(s_systemLib[0]), "system");
 
 	// file
-	s_gmFileType = a_machine->CreateUserType("file");
+	s_gmFileType.Set(a_machine, a_machine->CreateUserType("file"));
 #if GM_USE_INCGC
-	a_machine->RegisterUserCallbacks(s_gmFileType, NULL, gmGCDestructFileUserType);
+	a_machine->RegisterUserCallbacks(s_gmFileType.Get(a_machine), NULL, gmGCDestructFileUserType);
 #else //GM_USE_INCGC
-	a_machine->RegisterUserCallbacks(s_gmFileType, NULL, gmGCFileUserType);
+	a_machine->RegisterUserCallbacks(s_gmFileType.Get(a_machine), NULL, gmGCFileUserType);
 #endif //GM_USE_INCGC
-	a_machine->RegisterTypeLibrary(s_gmFileType, s_fileLib, sizeof(s_fileLib) / sizeof(s_fileLib[0]));
-	a_machine->RegisterTypeOperator(s_gmFileType, O_GETDOT, NULL, gmFileOpGetDot);
+	a_machine->RegisterTypeLibrary(s_gmFileType.Get(a_machine), s_fileLib, sizeof(s_fileLib) / sizeof(s_fileLib[0]));
+	a_machine->RegisterTypeOperator(s_gmFileType.Get(a_machine), O_GETDOT, NULL, gmFileOpGetDot);
 
 	// fileFind
-	s_gmFileFindType = a_machine->CreateUserType("fileFind");
-	a_machine->RegisterTypeLibrary(s_gmFileFindType, s_fileFindLib, sizeof(s_fileFindLib) / sizeof(s_fileFindLib[0]));
+	s_gmFileFindType.Set(a_machine, a_machine->CreateUserType("fileFind"));
+	a_machine->RegisterTypeLibrary(s_gmFileFindType.Get(a_machine), s_fileFindLib, sizeof(s_fileFindLib) / sizeof(s_fileFindLib[0]));
 #if GM_USE_INCGC
-	a_machine->RegisterUserCallbacks(s_gmFileFindType, NULL, gmGCDestructFileFindUserType);
+	a_machine->RegisterUserCallbacks(s_gmFileFindType.Get(a_machine), NULL, gmGCDestructFileFindUserType);
 #else //GM_USE_INCGC
-	a_machine->RegisterUserCallbacks(s_gmFileFindType, NULL, gmGCFileFindUserType);
+	a_machine->RegisterUserCallbacks(s_gmFileFindType.Get(a_machine), NULL, gmGCFileFindUserType);
 #endif //GM_USE_INCGC
-	a_machine->RegisterTypeOperator(s_gmFileFindType, O_GETDOT, NULL, gmFileFindOpGetDot);
+	a_machine->RegisterTypeOperator(s_gmFileFindType.Get(a_machine), O_GETDOT, NULL, gmFileFindOpGetDot);
 
 	// fileInfo
-	s_gmFileInfoType = a_machine->CreateUserType("fileInfo");
+	s_gmFileInfoType.Set(a_machine, a_machine->CreateUserType("fileInfo"));
 #if GM_USE_INCGC
-	a_machine->RegisterUserCallbacks(s_gmFileInfoType, NULL, gmGCDestructFileInfoUserType);
+	a_machine->RegisterUserCallbacks(s_gmFileInfoType.Get(a_machine), NULL, gmGCDestructFileInfoUserType);
 #else //GM_USE_INCGC
-	a_machine->RegisterUserCallbacks(s_gmFileInfoType, NULL, gmGCFileInfoUserType);
+	a_machine->RegisterUserCallbacks(s_gmFileInfoType.Get(a_machine), NULL, gmGCFileInfoUserType);
 #endif //GM_USE_INCGC
-	a_machine->RegisterTypeOperator(s_gmFileInfoType, O_GETDOT, NULL, gmFileInfoOpGetDot);
+	a_machine->RegisterTypeOperator(s_gmFileInfoType.Get(a_machine), O_GETDOT, NULL, gmFileInfoOpGetDot);
 }
 
 #endif // GM_SYSTEM_LIB
@@ -0,0 +1,874 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#include "gmConfig.h"
+#include "gmTypedArrayLib.h"
+#include "gmThread.h"
+#include "gmMachine.h"
+#include "gmHelpers.h"
+
+#include <algorithm>
+#include <functional>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GM_TYPEDARRAY_SSE2 1
+#include <emmintrin.h>
+#else
+#define GM_TYPEDARRAY_SSE2 0
+#endif
+
+//
+//
+// Implementation of typed array binding
+//
+//
+
+#if GM_TYPEDARRAY_LIB
+
+// Statics and globals
+gmLibType GM_FLOAT32ARRAY;
+gmLibType GM_INT32ARRAY;
+#if GM_USE_VECTOR3_STACK
+gmLibType GM_VEC3ARRAY;
+#endif // GM_USE_VECTOR3_STACK
+
+
+bool gmTypedArray::Construct(gmMachine * a_machine, Kind a_kind, int a_size)
+{
+  m_data = NULL;
+  m_size = 0;
+  m_kind = a_kind;
+  return Resize(a_machine, a_size);
+}
+
+
+void gmTypedArray::Destruct(gmMachine * a_machine)
+{
+  if(m_data)
+  {
+    a_machine->Sys_Free(m_data);
+    m_data = NULL;
+  }
+  m_size = 0;
+}
+
+
+bool gmTypedArray::Resize(gmMachine * a_machine, int a_size)
+{
+  if(a_size < 0) a_size = 0;
+  const int elemSize = sizeof(gmint32) * Width();
+  int copysize = (a_size > m_size) ? m_size : a_size;
+  void * data = (a_size) ? a_machine->Sys_Alloc(elemSize * a_size) : NULL;
+  if(m_data)
+  {
+    memcpy(data, m_data, elemSize * copysize);
+    a_machine->Sys_Free(m_data);
+  }
+  if(a_size > copysize)
+  {
+    memset((char *) data + elemSize * copysize, 0, elemSize * (a_size - copysize));
+  }
+  m_data = data;
+  m_size = a_size;
+  return true;
+}
+
+
+gmTypedArray * gmTypedArray_Create(gmMachine * a_machine, gmTypedArray::Kind a_kind, int a_size)
+{
+  gmTypedArray * newArray = (gmTypedArray *) a_machine->Sys_Alloc(sizeof(gmTypedArray));
+  newArray->Construct(a_machine, a_kind, a_size);
+  return newArray;
+}
+
+
+gmType gmTypedArray_GetType(gmMachine * a_machine, gmTypedArray::Kind a_kind)
+{
+  switch(a_kind)
+  {
+    case gmTypedArray::FLOAT32 : return GM_FLOAT32ARRAY.Get(a_machine);
+    case gmTypedArray::INT32 : return GM_INT32ARRAY.Get(a_machine);
+#if GM_USE_VECTOR3_STACK
+    case gmTypedArray::VEC3 : return GM_VEC3ARRAY.Get(a_machine);
+#endif // GM_USE_VECTOR3_STACK
+    default : break;
+  }
+  return GM_NULL;
+}
+
+
+//
+// kernels, a_count values.  The SSE2 versions do 4 values at a time and finish with the scalar loop.
+//
+
+static void gmKernelFill(float * a_dst, int a_count, float a_value)
+{
+  int i = 0;
+#if GM_TYPEDARRAY_SSE2
+  __m128 v = _mm_set1_ps(a_value);
+  for(; i + 4 <= a_count; i += 4) _mm_storeu_ps(a_dst + i, v);
+#endif // GM_TYPEDARRAY_SSE2
+  for(; i < a_count; ++i) a_dst[i] = a_value;
+}
+
+static void gmKernelAdd(float * a_dst, const float * a_src, int a_count)
+{
+  int i = 0;
+#if GM_TYPEDARRAY_SSE2
+  for(; i + 4 <= a_count; i += 4) _mm_storeu_ps(a_dst + i, _mm_add_ps(_mm_loadu_ps(a_dst + i), _mm_loadu_ps(a_src + i)));
+#endif // GM_TYPEDARRAY_SSE2
+  for(; i < a_count; ++i) a_dst[i] += a_src[i];
+}
+
+static void gmKernelMul(float * a_dst, const float * a_src, int a_count)
+{
+  int i = 0;
+#if GM_TYPEDARRAY_SSE2
+  for(; i + 4 <= a_count; i += 4) _mm_storeu_ps(a_dst + i, _mm_mul_ps(_mm_loadu_ps(a_dst + i), _mm_loadu_ps(a_src + i)));
+#endif // GM_TYPEDARRAY_SSE2
+  for(; i < a_count; ++i) a_dst[i] *= a_src[i];
+}
+
+/// a_dst = a_dst * a_mul + a_add
+static void gmKernelScale(float * a_dst, int a_count, float a_mul, float a_add)
+{
+  int i = 0;
+#if GM_TYPEDARRAY_SSE2
+  __m128 m = _mm_set1_ps(a_mul), a = _mm_set1_ps(a_add);
+  for(; i + 4 <= a_count; i += 4) _mm_storeu_ps(a_dst + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a_dst + i), m), a));
+#endif // GM_TYPEDARRAY_SSE2
+  for(; i < a_count; ++i) a_dst[i] = a_dst[i] * a_mul + a_add;
+}
+
+static float gmKernelDot(const float * a_a, const float * a_b, int a_count)
+{
+  int i = 0;
+  float result = 0.0f;
+#if GM_TYPEDARRAY_SSE2
+  __m128 sum = _mm_setzero_ps();
+  for(; i + 4 <= a_count; i += 4) sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(a_a + i), _mm_loadu_ps(a_b + i)));
+  float lanes[4];
+  _mm_storeu_ps(lanes, sum);
+  result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif // GM_TYPEDARRAY_SSE2
+  for(; i < a_count; ++i) result += a_a[i] * a_b[i];
+  return result;
+}
+
+static float gmKernelSum(const float * a_src, int a_count)
+{
+  int i = 0;
+  float result = 0.0f;
+#if GM_TYPEDARRAY_SSE2
+  __m128 sum = _mm_setzero_ps();
+  for(; i + 4 <= a_count; i += 4) sum = _mm_add_ps(sum, _mm_loadu_ps(a_src + i));
+  float lanes[4];
+  _mm_storeu_ps(lanes, sum);
+  result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif // GM_TYPEDARRAY_SSE2
+  for(; i < a_count; ++i) result += a_src[i];
+  return result;
+}
+
+/// a_count > 0
+static float gmKernelMinMax(const float * a_src, int a_count, bool a_max)
+{
+  int i = 0;
+  float result = a_src[0];
+#if GM_TYPEDARRAY_SSE2
+  if(a_count >= 4)
+  {
+    __m128 r = _mm_loadu_ps(a_src);
+    for(i = 4; i + 4 <= a_count; i += 4) r = a_max ? _mm_max_ps(r, _mm_loadu_ps(a_src + i)) : _mm_min_ps(r, _mm_loadu_ps(a_src + i));
+    float lanes[4];
+    _mm_storeu_ps(lanes, r);
+    for(int l = 1; l < 4; ++l) result = a_max ? ((lanes[l] > result) ? lanes[l] : result) : ((lanes[l] < result) ? lanes[l] : result);
+    result = a_max ? ((lanes[0] > result) ? lanes[0] : result) : ((lanes[0] < result) ? lanes[0] : result);
+  }
+#endif // GM_TYPEDARRAY_SSE2
+  for(; i < a_count; ++i) result = a_max ? ((a_src[i] > result) ? a_src[i] : result) : ((a_src[i] < result) ? a_src[i] : result);
+  return result;
+}
+
+static void gmKernelFill(gmint32 * a_dst, int a_count, gmint32 a_value)
+{
+  int i = 0;
+#if GM_TYPEDARRAY_SSE2
+  __m128i v = _mm_set1_epi32(a_value);
+  for(; i + 4 <= a_count; i += 4) _mm_storeu_si128((__m128i *) (a_dst + i), v);
+#endif // GM_TYPEDARRAY_SSE2
+  for(; i < a_count; ++i) a_dst[i] = a_value;
+}
+
+static void gmKernelAdd(gmint32 * a_dst, const gmint32 * a_src, int a_count)
+{
+  int i = 0;
+#if GM_TYPEDARRAY_SSE2
+  for(; i + 4 <= a_count; i += 4) _mm_storeu_si128((__m128i *) (a_dst + i), _mm_add_epi32(_mm_loadu_si128((const __m128i *) (a_dst + i)), _mm_loadu_si128((const __m128i *) (a_src + i))));
+#endif // GM_TYPEDARRAY_SSE2
+  for(; i < a_count; ++i) a_dst[i] = (gmint32) ((gmuint32) a_dst[i] + (gmuint32) a_src[i]);
+}
+
+static void gmKernelMul(gmint32 * a_dst, const gmint32 * a_src, int a_count)
+{
+  for(int i = 0; i < a_count; ++i) a_dst[i] = (gmint32) ((gmuint32) a_dst[i] * (gmuint32) a_src[i]);
+}
+
+static void gmKernelScale(gmint32 * a_dst, int a_count, gmint32 a_mul, gmint32 a_add)
+{
+  for(int i = 0; i < a_count; ++i) a_dst[i] = (gmint32) ((gmuint32) a_dst[i] * (gmuint32) a_mul + (gmuint32) a_add);
+}
+
+static gmint32 gmKernelDot(const gmint32 * a_a, const gmint32 * a_b, int a_count)
+{
+  gmuint32 result = 0;
+  for(int i = 0; i < a_count; ++i) result += (gmuint32) a_a[i] * (gmuint32) a_b[i];
+  return (gmint32) result;
+}
+
+static gmint32 gmKernelSum(const gmint32 * a_src, int a_count)
+{
+  int i = 0;
+  gmuint32 result = 0;
+#if GM_TYPEDARRAY_SSE2
+  __m128i sum = _mm_setzero_si128();
+  for(; i + 4 <= a_count; i += 4) sum = _mm_add_epi32(sum, _mm_loadu_si128((const __m128i *) (a_src + i)));
+  gmuint32 lanes[4];
+  _mm_storeu_si128((__m128i *) lanes, sum);
+  result = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif // GM_TYPEDARRAY_SSE2
+  for(; i < a_count; ++i) result += (gmuint32) a_src[i];
+  return (gmint32) result;
+}
+
+static gmint32 gmKernelMinMax(const gmint32 * a_src, int a_count, bool a_max)
+{
+  gmint32 result = a_src[0];
+  for(int i = 1; i < a_count; ++i) result = a_max ? ((a_src[i] > result) ? a_src[i] : result) : ((a_src[i] < result) ? a_src[i] : result);
+  return result;
+}
+
+/// NaN sorts last, which keeps the ordering strict
+static bool gmFloatLess(float a_a, float a_b) { return (a_a < a_b) || (a_b != a_b && a_a == a_a); }
+static bool gmFloatGreater(float a_a, float a_b) { return (a_a > a_b) || (a_b != a_b && a_a == a_a); }
+
+
+//
+// functions
+//
+
+static gmTypedArray * gmThisTypedArray(gmThread * a_thread)
+{
+  const gmVariable * self = a_thread->GetThis();
+  if(self->m_type < GM_USER) return NULL;
+  if(self->m_type == GM_FLOAT32ARRAY.Get(a_thread) || self->m_type == GM_INT32ARRAY.Get(a_thread)
+#if GM_USE_VECTOR3_STACK
+    || self->m_type == GM_VEC3ARRAY.Get(a_thread)
+#endif // GM_USE_VECTOR3_STACK
+    )
+  {
+    return (gmTypedArray *) ((gmUserObject *) GM_OBJECT(self->m_value.m_ref))->m_user;
+  }
+  return NULL;
+}
+
+#define GM_TYPEDARRAY_THIS(VAR) \
+  gmTypedArray * VAR = gmThisTypedArray(a_thread); \
+  if(!VAR) { GM_EXCEPTION_MSG("expecting this as typed array"); return GM_EXCEPTION; }
+
+/// \brief gmParamTypedArray() returns param a_param if it is an array of a_kind.
+static gmTypedArray * gmParamTypedArray(gmThread * a_thread, int a_param, gmTypedArray::Kind a_kind)
+{
+  return (gmTypedArray *) a_thread->ParamUserCheckType(a_param, gmTypedArray_GetType(a_thread->GetMachine(), a_kind));
+}
+
+#define GM_CHECK_TYPEDARRAY_PARAM(VAR, PARAM, KIND) \
+  gmTypedArray * VAR = gmParamTypedArray(a_thread, (PARAM), (KIND)); \
+  if(!VAR) \
+  { GM_EXCEPTION_MSG("expecting param %d as %s, got %s", (PARAM), a_thread->GetMachine()->GetTypeName(gmTypedArray_GetType(a_thread->GetMachine(), KIND)), a_thread->ParamTypeName(PARAM)); \
+    return GM_EXCEPTION; \
+  }
+
+static int gmTypedArrayNew(gmThread * a_thread, gmTypedArray::Kind a_kind, int a_size)
+{
+  gmTypedArray * array = gmTypedArray_Create(a_thread->GetMachine(), a_kind, a_size);
+  a_thread->PushNewUser(array, gmTypedArray_GetType(a_thread->GetMachine(), a_kind));
+  return GM_OK;
+}
+
+static int GM_CDECL gmfFloat32Array(gmThread * a_thread) // size
+{
+  GM_INT_PARAM(size, 0, 0);
+  return gmTypedArrayNew(a_thread, gmTypedArray::FLOAT32, size);
+}
+
+static int GM_CDECL gmfInt32Array(gmThread * a_thread) // size
+{
+  GM_INT_PARAM(size, 0, 0);
+  return gmTypedArrayNew(a_thread, gmTypedArray::INT32, size);
+}
+
+#if GM_USE_VECTOR3_STACK
+static int GM_CDECL gmfVec3Array(gmThread * a_thread) // size
+{
+  GM_INT_PARAM(size, 0, 0);
+  return gmTypedArrayNew(a_thread, gmTypedArray::VEC3, size);
+}
+#endif // GM_USE_VECTOR3_STACK
+
+static int GM_CDECL gmfTypedArraySize(gmThread * a_thread) // return size
+{
+  GM_TYPEDARRAY_THIS(array);
+  a_thread->PushInt(array->Size());
+  return GM_OK;
+}
+
+static int GM_CDECL gmfTypedArrayResize(gmThread * a_thread) // size
+{
+  GM_INT_PARAM(size, 0, 0);
+  GM_TYPEDARRAY_THIS(array);
+  array->Resize(a_thread->GetMachine(), size);
+  return GM_OK;
+}
+
+static int GM_CDECL gmfTypedArrayFill(gmThread * a_thread) // value
+{
+  GM_CHECK_NUM_PARAMS(1);
+  GM_TYPEDARRAY_THIS(array);
+  switch(array->GetKind())
+  {
+    case gmTypedArray::FLOAT32 :
+    {
+      GM_FLOAT_OR_INT_PARAM(value, 0, 0.0f);
+      gmKernelFill(array->GetFloats(), array->Size(), value);
+      break;
+    }
+    case gmTypedArray::INT32 :
+    {
+      GM_CHECK_INT_PARAM(value, 0);
+      gmKernelFill(array->GetInts(), array->Size(), value);
+      break;
+    }
+#if GM_USE_VECTOR3_STACK
+    case gmTypedArray::VEC3 :
+    {
+      GM_CHECK_VECTOR_PARAM(value, 0);
+      float * v = array->GetFloats();
+      for(int i = 0; i < array->Size(); ++i, v += 3)
+      {
+        v[0] = value.x; v[1] = value.y; v[2] = value.z;
+      }
+      break;
+    }
+#endif // GM_USE_VECTOR3_STACK
+  }
+  return GM_OK;
+}
+
+/// \brief gmTypedArrayAddMul() adds or multiplies by an array of the same kind, element by element, or a value.
+static int gmTypedArrayAddMul(gmThread * a_thread, bool a_mul)
+{
+  GM_CHECK_NUM_PARAMS(1);
+  GM_TYPEDARRAY_THIS(array);
+
+  gmTypedArray * other = gmParamTypedArray(a_thread, 0, array->GetKind());
+  if(other)
+  {
+    const int count = ((array->Size() < other->Size()) ? array->Size() : other->Size()) * array->Width();
+    if(array->GetKind() == gmTypedArray::INT32)
+    {
+      if(a_mul) gmKernelMul(array->GetInts(), other->GetInts(), count);
+      else gmKernelAdd(array->GetInts(), other->GetInts(), count);
+    }
+    else
+    {
+      if(a_mul) gmKernelMul(array->GetFloats(), other->GetFloats(), count);
+      else gmKernelAdd(array->GetFloats(), other->GetFloats(), count);
+    }
+    return GM_OK;
+  }
+
+  if(array->GetKind() == gmTypedArray::INT32)
+  {
+    GM_CHECK_INT_PARAM(value, 0);
+    gmKernelScale(array->GetInts(), array->Size(), a_mul ? value : 1, a_mul ? 0 : value);
+    return GM_OK;
+  }
+#if GM_USE_VECTOR3_STACK
+  if(array->GetKind() == gmTypedArray::VEC3 && a_thread->ParamType(0) == GM_VEC3)
+  {
+    const gmVec3Data &value = a_thread->Param(0).m_value.m_vec3;
+    float * v = array->GetFloats();
+    for(int i = 0; i < array->Size(); ++i, v += 3)
+    {
+      if(a_mul) { v[0] *= value.x; v[1] *= value.y; v[2] *= value.z; }
+      else { v[0] += value.x; v[1] += value.y; v[2] += value.z; }
+    }
+    return GM_OK;
+  }
+#endif // GM_USE_VECTOR3_STACK
+  GM_FLOAT_OR_INT_PARAM(value, 0, 0.0f);
+  gmKernelScale(array->GetFloats(), array->Size() * array->Width(), a_mul ? value : 1.0f, a_mul ? 0.0f : value);
+  return GM_OK;
+}
+
+static int GM_CDECL gmfTypedArrayAdd(gmThread * a_thread) // array or value
+{
+  return gmTypedArrayAddMul(a_thread, false);
+}
+
+static int GM_CDECL gmfTypedArrayMul(gmThread * a_thread) // array or value
+{
+  return gmTypedArrayAddMul(a_thread, true);
+}
+
+static int GM_CDECL gmfTypedArrayScale(gmThread * a_thread) // mul, add
+{
+  GM_CHECK_NUM_PARAMS(1);
+  GM_TYPEDARRAY_THIS(array);
+  if(array->GetKind() == gmTypedArray::INT32)
+  {
+    GM_CHECK_INT_PARAM(mul, 0);
+    GM_INT_PARAM(add, 1, 0);
+    gmKernelScale(array->GetInts(), array->Size(), mul, add);
+  }
+  else
+  {
+    GM_FLOAT_OR_INT_PARAM(mul, 0, 1.0f);
+    GM_FLOAT_OR_INT_PARAM(add, 1, 0.0f);
+    gmKernelScale(array->GetFloats(), array->Size() * array->Width(), mul, add);
+  }
+  return GM_OK;
+}
+
+static int GM_CDECL gmfTypedArrayDot(gmThread * a_thread) // array
+{
+  GM_CHECK_NUM_PARAMS(1);
+  GM_TYPEDARRAY_THIS(array);
+  GM_CHECK_TYPEDARRAY_PARAM(other, 0, array->GetKind());
+  const int count = ((array->Size() < other->Size()) ? array->Size() : other->Size()) * array->Width();
+  if(array->GetKind() == gmTypedArray::INT32)
+  {
+    a_thread->PushInt(gmKernelDot(array->GetInts(), other->GetInts(), count));
+  }
+  else
+  {
+    a_thread->PushFloat(gmKernelDot(array->GetFloats(), other->GetFloats(), count));
+  }
+  return GM_OK;
+}
+
+static int GM_CDECL gmfTypedArraySum(gmThread * a_thread) // return sum
+{
+  GM_TYPEDARRAY_THIS(array);
+  switch(array->GetKind())
+  {
+    case gmTypedArray::FLOAT32 : a_thread->PushFloat(gmKernelSum(array->GetFloats(), array->Size())); break;
+    case gmTypedArray::INT32 : a_thread->PushInt(gmKernelSum(array->GetInts(), array->Size())); break;
+#if GM_USE_VECTOR3_STACK
+    case gmTypedArray::VEC3 :
+    {
+      float sum[3] = {0.0f, 0.0f, 0.0f};
+      const float * v = array->GetFloats();
+      for(int i = 0; i < array->Size(); ++i, v += 3)
+      {
+        sum[0] += v[0]; sum[1] += v[1]; sum[2] += v[2];
+      }
+      a_thread->Push(gmVariable(sum[0], sum[1], sum[2]));
+      break;
+    }
+#endif // GM_USE_VECTOR3_STACK
+  }
+  return GM_OK;
+}
+
+/// \brief gmTypedArrayMinMax() pushes the smallest or largest element, by component for a Vec3Array.
+static int gmTypedArrayMinMax(gmThread * a_thread, bool a_max)
+{
+  GM_TYPEDARRAY_THIS(array);
+  if(array->Size() == 0) return GM_OK;
+  switch(array->GetKind())
+  {
+    case gmTypedArray::FLOAT32 : a_thread->PushFloat(gmKernelMinMax(array->GetFloats(), array->Size(), a_max)); break;
+    case gmTypedArray::INT32 : a_thread->PushInt(gmKernelMinMax(array->GetInts(), array->Size(), a_max)); break;
+#if GM_USE_VECTOR3_STACK
+    case gmTypedArray::VEC3 :
+    {
+      float r[3];
+      const float * v = array->GetFloats();
+      r[0] = v[0]; r[1] = v[1]; r[2] = v[2];
+      for(int i = 1; i < array->Size(); ++i)
+      {
+        v += 3;
+        for(int c = 0; c < 3; ++c) r[c] = a_max ? ((v[c] > r[c]) ? v[c] : r[c]) : ((v[c] < r[c]) ? v[c] : r[c]);
+      }
+      a_thread->Push(gmVariable(r[0], r[1], r[2]));
+      break;
+    }
+#endif // GM_USE_VECTOR3_STACK
+  }
+  return GM_OK;
+}
+
+static int GM_CDECL gmfTypedArrayMin(gmThread * a_thread) // return min
+{
+  return gmTypedArrayMinMax(a_thread, false);
+}
+
+static int GM_CDECL gmfTypedArrayMax(gmThread * a_thread) // return max
+{
+  return gmTypedArrayMinMax(a_thread, true);
+}
+
+static int GM_CDECL gmfTypedArraySort(gmThread * a_thread) // descending
+{
+  GM_INT_PARAM(descending, 0, 0);
+  GM_TYPEDARRAY_THIS(array);
+  if(array->GetKind() == gmTypedArray::FLOAT32)
+  {
+    float * v = array->GetFloats();
+    std::sort(v, v + array->Size(), descending ? gmFloatGreater : gmFloatLess);
+  }
+  else if(array->GetKind() == gmTypedArray::INT32)
+  {
+    gmint32 * v = array->GetInts();
+    if(descending) std::sort(v, v + array->Size(), std::greater<gmint32>());
+    else std::sort(v, v + array->Size());
+  }
+  return GM_OK;
+}
+
+static int GM_CDECL gmfTypedArraySlice(gmThread * a_thread) // start, count, return new array
+{
+  GM_INT_PARAM(start, 0, 0);
+  GM_TYPEDARRAY_THIS(array);
+  GM_INT_PARAM(count, 1, array->Size() - start);
+  if(start < 0) { count += start; start = 0; }
+  if(start > array->Size()) start = array->Size();
+  if(count > array->Size() - start) count = array->Size() - start;
+  if(count < 0) count = 0;
+
+  gmTypedArray * slice = gmTypedArray_Create(a_thread->GetMachine(), array->GetKind(), count);
+  memcpy(slice->m_data, array->GetInts() + start * array->Width(), sizeof(gmint32) * array->Width() * count);
+  a_thread->PushNewUser(slice, gmTypedArray_GetType(a_thread->GetMachine(), array->GetKind()));
+  return GM_OK;
+}
+
+static int GM_CDECL gmfTypedArrayCopyFrom(gmThread * a_thread) // src, dst index, src index, count, return count copied
+{
+  GM_CHECK_NUM_PARAMS(1);
+  GM_TYPEDARRAY_THIS(array);
+  GM_CHECK_TYPEDARRAY_PARAM(src, 0, array->GetKind());
+  GM_INT_PARAM(dst, 1, 0);
+  GM_INT_PARAM(start, 2, 0);
+  GM_INT_PARAM(count, 3, src->Size());
+  if(start < 0) { count += start; dst -= start; start = 0; }
+  if(dst < 0) { count += dst; start -= dst; dst = 0; }
+  if(count > src->Size() - start) count = src->Size() - start;
+  if(count > array->Size() - dst) count = array->Size() - dst;
+  if(count < 0) count = 0;
+
+  const int width = array->Width();
+  memmove(array->GetInts() + dst * width, src->GetInts() + start * width, sizeof(gmint32) * width * count);
+  a_thread->PushInt(count);
+  return GM_OK;
+}
+
+
+//
+// operators
+//
+
+static int GM_CDECL gmFloat32ArrayGetInd(gmThread * a_thread, gmVariable * a_operands)
+{
+  gmTypedArray * array = (gmTypedArray *) ((gmUserObject *) GM_OBJECT(a_operands->m_value.m_ref))->m_user;
+  if(a_operands[1].m_type == GM_INT)
+  {
+    gmuint32 index = (gmuint32) a_operands[1].m_value.m_int;
+    if(index < (gmuint32) array->Size()) a_operands->SetFloat(array->GetFloats()[index]);
+    else a_operands->Nullify();
+    return GM_OK;
+  }
+  a_operands->Nullify();
+  return GM_EXCEPTION;
+}
+
+static int GM_CDECL gmFloat32ArraySetInd(gmThread * a_thread, gmVariable * a_operands)
+{
+  gmTypedArray * array = (gmTypedArray *) ((gmUserObject *) GM_OBJECT(a_operands->m_value.m_ref))->m_user;
+  gmuint32 index = (gmuint32) a_operands[1].m_value.m_int;
+  if(a_operands[1].m_type == GM_INT && index < (gmuint32) array->Size())
+  {
+    if(a_operands[2].m_type == GM_FLOAT)
+    {
+      array->GetFloats()[index] = a_operands[2].m_value.m_float;
+      return GM_OK;
+    }
+    if(a_operands[2].m_type == GM_INT)
+    {
+      array->GetFloats()[index] = (float) a_operands[2].m_value.m_int;
+      return GM_OK;
+    }
+  }
+  a_operands->Nullify();
+  return GM_EXCEPTION;
+}
+
+static int GM_CDECL gmInt32ArrayGetInd(gmThread * a_thread, gmVariable * a_operands)
+{
+  gmTypedArray * array = (gmTypedArray *) ((gmUserObject *) GM_OBJECT(a_operands->m_value.m_ref))->m_user;
+  if(a_operands[1].m_type == GM_INT)
+  {
+    gmuint32 index = (gmuint32) a_operands[1].m_value.m_int;
+    if(index < (gmuint32) array->Size()) a_operands->SetInt(array->GetInts()[index]);
+    else a_operands->Nullify();
+    return GM_OK;
+  }
+  a_operands->Nullify();
+  return GM_EXCEPTION;
+}
+
+static int GM_CDECL gmInt32ArraySetInd(gmThread * a_thread, gmVariable * a_operands)
+{
+  gmTypedArray * array = (gmTypedArray *) ((gmUserObject *) GM_OBJECT(a_operands->m_value.m_ref))->m_user;
+  gmuint32 index = (gmuint32) a_operands[1].m_value.m_int;
+  if(a_operands[1].m_type == GM_INT && index < (gmuint32) array->Size() && a_operands[2].m_type == GM_INT)
+  {
+    array->GetInts()[index] = a_operands[2].m_value.m_int;
+    return GM_OK;
+  }
+  a_operands->Nullify();
+  return GM_EXCEPTION;
+}
+
+#if GM_USE_VECTOR3_STACK
+static int GM_CDECL gmVec3ArrayGetInd(gmThread * a_thread, gmVariable * a_operands)
+{
+  gmTypedArray * array = (gmTypedArray *) ((gmUserObject *) GM_OBJECT(a_operands->m_value.m_ref))->m_user;
+  if(a_operands[1].m_type == GM_INT)
+  {
+    gmuint32 index = (gmuint32) a_operands[1].m_value.m_int;
+    if(index < (gmuint32) array->Size()) a_operands->SetVector(array->GetFloats() + index * 3);
+    else a_operands->Nullify();
+    return GM_OK;
+  }
+  a_operands->Nullify();
+  return GM_EXCEPTION;
+}
+
+static int GM_CDECL gmVec3ArraySetInd(gmThread * a_thread, gmVariable * a_operands)
+{
+  gmTypedArray * array = (gmTypedArray *) ((gmUserObject *) GM_OBJECT(a_operands->m_value.m_ref))->m_user;
+  gmuint32 index = (gmuint32) a_operands[1].m_value.m_int;
+  if(a_operands[1].m_type == GM_INT && index < (gmuint32) array->Size() && a_operands[2].m_type == GM_VEC3)
+  {
+    a_operands[2].GetVector(array->GetFloats() + index * 3);
+    return GM_OK;
+  }
+  a_operands->Nullify();
+  return GM_EXCEPTION;
+}
+#endif // GM_USE_VECTOR3_STACK
+
+#if GM_USE_INCGC
+static void GM_CDECL gmGCDestructTypedArrayUserType(gmMachine * a_machine, gmUserObject* a_object)
+{
+  if(a_object->m_user)
+  {
+    gmTypedArray * array = (gmTypedArray *) a_object->m_user;
+    array->Destruct(a_machine);
+    a_machine->Sys_Free(array);
+  }
+  a_object->m_user = NULL;
+}
+#else //GM_USE_INCGC
+static void GM_CDECL gmGCTypedArrayUserType(gmMachine * a_machine, gmUserObject * a_object, gmuint32 a_mark)
+{
+  if(a_object->m_user)
+  {
+    gmTypedArray * array = (gmTypedArray *) a_object->m_user;
+    array->Destruct(a_machine);
+    a_machine->Sys_Free(array);
+  }
+  a_object->m_user = NULL;
+}
+#endif //GM_USE_INCGC
+
+// libs
+
+static gmFunctionEntry s_typedArrayLib[] =
+{
+  /*gm
+    \lib gm
+  */
+  /*gm
+    \function Float32Array
+    \brief Float32Array will create a fixed size array of floats, all 0
+    \param int size optional (0)
+    \return Float32Array
+  */
+  {"Float32Array", gmfFloat32Array},
+  /*gm
+    \function Int32Array
+    \brief Int32Array will create a fixed size array of ints, all 0
+    \param int size optional (0)
+    \return Int32Array
+  */
+  {"Int32Array", gmfInt32Array},
+#if GM_USE_VECTOR3_STACK
+  /*gm
+    \function Vec3Array
+    \brief Vec3Array will create a fixed size array of vec3s, all 0
+    \param int size optional (0)
+    \return Vec3Array
+  */
+  {"Vec3Array", gmfVec3Array},
+#endif // GM_USE_VECTOR3_STACK
+};
+
+static gmFunctionEntry s_typedArrayTypeLib[] =
+{
+  /*gm
+    \lib Float32Array Int32Array Vec3Array
+  */
+  /*gm
+    \function Size
+    \brief Size will return the number of elements
+    \return int array size
+  */
+  {"Size", gmfTypedArraySize},
+  /*gm
+    \function Resize
+    \brief Resize will resize the array to a new size, new elements are 0
+    \param int size optional (0)
+    \return null
+  */
+  {"Resize", gmfTypedArrayResize},
+  /*gm
+    \function Fill
+    \brief Fill will set every element to a value
+    \param value an element
+    \return null
+  */
+  {"Fill", gmfTypedArrayFill},
+  /*gm
+    \function Add
+    \brief Add will add an array of the same type element by element, or a value to every element
+    \param value array or element, a Vec3Array also takes a number
+    \return null
+  */
+  {"Add", gmfTypedArrayAdd},
+  /*gm
+    \function Mul
+    \brief Mul will multiply by an array of the same type element by element, or every element by a value
+    \param value array or element, a Vec3Array also takes a number
+    \return null
+  */
+  {"Mul", gmfTypedArrayMul},
+  /*gm
+    \function Scale
+    \brief Scale will set every value to value * mul + add
+    \param number mul
+    \param number add optional (0)
+    \return null
+  */
+  {"Scale", gmfTypedArrayScale},
+  /*gm
+    \function Dot
+    \brief Dot will return the sum of the products with an array of the same type, over the shorter array
+    \param array
+    \return float, int for an Int32Array
+  */
+  {"Dot", gmfTypedArrayDot},
+  /*gm
+    \function Sum
+    \brief Sum will return the sum of the elements
+    \return element
+  */
+  {"Sum", gmfTypedArraySum},
+  /*gm
+    \function Min
+    \brief Min will return the smallest element, by component for a Vec3Array
+    \return element, null if empty
+  */
+  {"Min", gmfTypedArrayMin},
+  /*gm
+    \function Max
+    \brief Max will return the largest element, by component for a Vec3Array
+    \return element, null if empty
+  */
+  {"Max", gmfTypedArrayMax},
+  /*gm
+    \function Slice
+    \brief Slice will return a new array with a copy of a range of elements
+    \param int start optional (0)
+    \param int count optional (to the end)
+    \return array
+  */
+  {"Slice", gmfTypedArraySlice},
+  /*gm
+    \function CopyFrom
+    \brief CopyFrom will copy a range of elements from an array of the same type, which may be this array
+    \param array src
+    \param int dst optional (0)
+    \param int start optional (0)
+    \param int count optional (all of src)
+    \return int number of elements copied
+  */
+  {"CopyFrom", gmfTypedArrayCopyFrom},
+};
+
+static gmFunctionEntry s_numberArrayTypeLib[] =
+{
+  /*gm
+    \lib Float32Array Int32Array
+  */
+  /*gm
+    \function Sort
+    \brief Sort will sort the elements, in place
+    \param int descending optional (0)
+    \return null
+  */
+  {"Sort", gmfTypedArraySort},
+};
+
+static void gmBindTypedArrayType(gmMachine * a_machine, gmType a_type, bool a_number, gmRawIndex a_rawIndex,
+                                 gmOperatorFunction a_getInd, gmOperatorFunction a_setInd)
+{
+  a_machine->RegisterTypeLibrary(a_type, s_typedArrayTypeLib, sizeof(s_typedArrayTypeLib) / sizeof(s_typedArrayTypeLib[0]));
+  if(a_number)
+  {
+    a_machine->RegisterTypeLibrary(a_type, s_numberArrayTypeLib, sizeof(s_numberArrayTypeLib) / sizeof(s_numberArrayTypeLib[0]));
+  }
+#if GM_USE_INCGC
+  a_machine->RegisterUserCallbacks(a_type, NULL, gmGCDestructTypedArrayUserType);
+#else //GM_USE_INCGC
+  a_machine->RegisterUserCallbacks(a_type, NULL, gmGCTypedArrayUserType);
+#endif //GM_USE_INCGC
+  a_machine->RegisterTypeOperator(a_type, O_GETIND, NULL, a_getInd);
+  a_machine->RegisterTypeOperator(a_type, O_SETIND, NULL, a_setInd);
+  a_machine->RegisterTypeRawIndex(a_type, a_rawIndex);
+}
+
+void gmBindTypedArrayLib(gmMachine * a_machine)
+{
+  a_machine->RegisterLibrary(s_typedArrayLib, sizeof(s_typedArrayLib) / sizeof(s_typedArrayLib[0]));
+  GM_FLOAT32ARRAY.Set(a_machine, a_machine->CreateUserType("Float32Array"));
+  gmBindTypedArrayType(a_machine, GM_FLOAT32ARRAY.Get(a_machine), true, GM_RAWINDEX_FLOAT32, gmFloat32ArrayGetInd, gmFloat32ArraySetInd);
+  GM_INT32ARRAY.Set(a_machine, a_machine->CreateUserType("Int32Array"));
+  gmBindTypedArrayType(a_machine, GM_INT32ARRAY.Get(a_machine), true, GM_RAWINDEX_INT32, gmInt32ArrayGetInd, gmInt32ArraySetInd);
+#if GM_USE_VECTOR3_STACK
+  GM_VEC3ARRAY.Set(a_machine, a_machine->CreateUserType("Vec3Array"));
+  gmBindTypedArrayType(a_machine, GM_VEC3ARRAY.Get(a_machine), false, GM_RAWINDEX_VEC3, gmVec3ArrayGetInd, gmVec3ArraySetInd);
+#endif // GM_USE_VECTOR3_STACK
+}
+
+#endif // GM_TYPEDARRAY_LIB
@@ -0,0 +1,84 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#ifndef _GMTYPEDARRAYLIB_H_
+#define _GMTYPEDARRAYLIB_H_
+
+#include "gmConfig.h"
+#include "gmVariable.h"
+#include "gmUserObject.h"
+
+// Fwd decls
+class gmMachine;
+class gmLibType;
+
+#define GM_TYPEDARRAY_LIB 1
+
+#if GM_TYPEDARRAY_LIB
+
+extern gmLibType GM_FLOAT32ARRAY;
+extern gmLibType GM_INT32ARRAY;
+#if GM_USE_VECTOR3_STACK
+extern gmLibType GM_VEC3ARRAY;
+#endif // GM_USE_VECTOR3_STACK
+
+void gmBindTypedArrayLib(gmMachine * a_machine);
+
+/*!
+  \class gmTypedArray
+  \brief gmTypedArray holds the numbers of a Float32Array, Int32Array or Vec3Array packed, with no
+         type per element.  A Vec3Array holds x, y, z of each element in turn.  The interpreter indexes
+         the elements itself through the gmRawArray, see gmMachine::RegisterTypeRawIndex().
+*/
+class gmTypedArray : public gmRawArray
+{
+public:
+
+  enum Kind
+  {
+    FLOAT32,
+    INT32,
+    VEC3,
+  };
+
+  /// \brief Construct()
+  bool Construct(gmMachine * a_machine, Kind a_kind, int a_size);
+
+  /// \brief Destruct()
+  void Destruct(gmMachine * a_machine);
+
+  /// \brief Resize() keeps the elements that fit, new elements are zero.
+  bool Resize(gmMachine * a_machine, int a_size);
+
+  /// \brief Size() returns the number of elements.
+  GM_FORCEINLINE int Size() const { return m_size; }
+
+  /// \brief Width() returns the number of values per element, 3 for a Vec3Array.
+  GM_FORCEINLINE int Width() const { return (m_kind == VEC3) ? 3 : 1; }
+
+  GM_FORCEINLINE Kind GetKind() const { return m_kind; }
+  GM_FORCEINLINE float * GetFloats() { return (float *) m_data; }
+  GM_FORCEINLINE gmint32 * GetInts() { return (gmint32 *) m_data; }
+
+  // data
+  Kind m_kind;
+};
+
+
+/// \brief Create a typed array.  This must be put into a user object of the type for its kind.
+gmTypedArray * gmTypedArray_Create(gmMachine * a_machine, gmTypedArray::Kind a_kind, int a_size = 0);
+
+/// \brief gmTypedArray_GetType() returns the user type for arrays of a kind on a_machine.
+gmType gmTypedArray_GetType(gmMachine * a_machine, gmTypedArray::Kind a_kind);
+
+#endif // GM_TYPEDARRAY_LIB
+
+#endif // _GMTYPEDARRAYLIB_H_
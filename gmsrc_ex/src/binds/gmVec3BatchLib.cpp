@@ -0,0 +1,684 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#include "gmConfig.h"
+#include "gmVec3BatchLib.h"
+#include "gmTypedArrayLib.h"
+#include "gmThread.h"
+#include "gmMachine.h"
+#include "gmHelpers.h"
+
+#include <math.h>
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+// The SSE2 and AVX kernels are compiled for their instruction set function by function, whatever the compiler
+// flags, and picked at run time from what the cpu has.
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define GM_VEC3BATCH_X86 1
+#define GM_TARGET_SSE2
+#define GM_TARGET_AVX
+#include <intrin.h>
+#include <immintrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define GM_VEC3BATCH_X86 1
+#define GM_TARGET_SSE2 __attribute__((target("sse2")))
+#define GM_TARGET_AVX __attribute__((target("avx")))
+#include <immintrin.h>
+#else
+#define GM_VEC3BATCH_X86 0
+#endif
+
+//
+//
+// Implementation of vec3 batch binding
+//
+//
+
+#if GM_VEC3BATCH_LIB && GM_USE_VECTOR3_STACK
+
+#define GM_VEC3BATCH_MAX_PLANES 32
+
+/// \brief gmVec3Kernels is one instruction set's kernels over a_count vec3s packed x, y, z in a_xyz.
+struct gmVec3Kernels
+{
+  /// xyz = a_m[0..2] * x + a_m[3..5] * y + a_m[6..8] * z + a_m[9..11]
+  void (*m_transform)(float * a_xyz, int a_count, const float * a_m);
+  /// a_out = distance to a_p, squared unless a_sqrt
+  void (*m_distance)(const float * a_xyz, int a_count, const float * a_p, float * a_out, bool a_sqrt);
+  /// a_out = indices within sqrt(a_radius2) of a_p, returns how many
+  int (*m_withinRadius)(const float * a_xyz, int a_count, const float * a_p, float a_radius2, gmint32 * a_out);
+  /// a_out = indices in front of every plane, nx * x + ny * y + nz * z + d >= 0, returns how many.  At most GM_VEC3BATCH_MAX_PLANES.
+  int (*m_inPlanes)(const float * a_xyz, int a_count, const float * a_planes, int a_numPlanes, gmint32 * a_out);
+};
+
+
+//
+// scalar kernels, from vec3 a_start.  The SIMD kernels finish with these.
+//
+
+/// adds in the same order as the SIMD kernels, so every level gives the same floats
+static void gmScalarTransform(float * a_xyz, int a_start, int a_count, const float * a_m)
+{
+  for(int i = a_start; i < a_count; ++i)
+  {
+    float * v = a_xyz + i * 3;
+    const float x = v[0], y = v[1], z = v[2];
+    v[0] = (a_m[0] * x + a_m[3] * y) + (a_m[6] * z + a_m[9]);
+    v[1] = (a_m[1] * x + a_m[4] * y) + (a_m[7] * z + a_m[10]);
+    v[2] = (a_m[2] * x + a_m[5] * y) + (a_m[8] * z + a_m[11]);
+  }
+}
+
+static void gmScalarDistance(const float * a_xyz, int a_start, int a_count, const float * a_p, float * a_out, bool a_sqrt)
+{
+  for(int i = a_start; i < a_count; ++i)
+  {
+    const float * v = a_xyz + i * 3;
+    const float dx = v[0] - a_p[0], dy = v[1] - a_p[1], dz = v[2] - a_p[2];
+    const float d2 = dx * dx + dy * dy + dz * dz;
+    a_out[i] = a_sqrt ? sqrtf(d2) : d2;
+  }
+}
+
+static int gmScalarWithinRadius(const float * a_xyz, int a_start, int a_count, const float * a_p, float a_radius2, gmint32 * a_out)
+{
+  int found = 0;
+  for(int i = a_start; i < a_count; ++i)
+  {
+    const float * v = a_xyz + i * 3;
+    const float dx = v[0] - a_p[0], dy = v[1] - a_p[1], dz = v[2] - a_p[2];
+    if(dx * dx + dy * dy + dz * dz <= a_radius2) a_out[found++] = i;
+  }
+  return found;
+}
+
+static int gmScalarInPlanes(const float * a_xyz, int a_start, int a_count, const float * a_planes, int a_numPlanes, gmint32 * a_out)
+{
+  int found = 0;
+  for(int i = a_start; i < a_count; ++i)
+  {
+    const float * v = a_xyz + i * 3;
+    bool inside = true;
+    for(int p = 0; p < a_numPlanes && inside; ++p)
+    {
+      const float * plane = a_planes + p * 4;
+      inside = ((plane[0] * v[0] + plane[1] * v[1]) + (plane[2] * v[2] + plane[3]) >= 0.0f);
+    }
+    if(inside) a_out[found++] = i;
+  }
+  return found;
+}
+
+static void GM_CDECL gmScalarTransformAll(float * a_xyz, int a_count, const float * a_m) { gmScalarTransform(a_xyz, 0, a_count, a_m); }
+static void GM_CDECL gmScalarDistanceAll(const float * a_xyz, int a_count, const float * a_p, float * a_out, bool a_sqrt) { gmScalarDistance(a_xyz, 0, a_count, a_p, a_out, a_sqrt); }
+static int GM_CDECL gmScalarWithinRadiusAll(const float * a_xyz, int a_count, const float * a_p, float a_radius2, gmint32 * a_out) { return gmScalarWithinRadius(a_xyz, 0, a_count, a_p, a_radius2, a_out); }
+static int GM_CDECL gmScalarInPlanesAll(const float * a_xyz, int a_count, const float * a_planes, int a_numPlanes, gmint32 * a_out) { return gmScalarInPlanes(a_xyz, 0, a_count, a_planes, a_numPlanes, a_out); }
+
+static const gmVec3Kernels s_scalarKernels = { gmScalarTransformAll, gmScalarDistanceAll, gmScalarWithinRadiusAll, gmScalarInPlanesAll };
+
+
+#if GM_VEC3BATCH_X86
+
+//
+// SSE2 kernels, 4 vec3s at a time.  Three loads of x y z x, y z x y, z x y z are shuffled to x x x x, y y y y, z z z z.
+//
+
+static GM_TARGET_SSE2 inline void gmSSELoad(const float * a_xyz, __m128 &a_x, __m128 &a_y, __m128 &a_z)
+{
+  const __m128 m0 = _mm_loadu_ps(a_xyz);
+  const __m128 m1 = _mm_loadu_ps(a_xyz + 4);
+  const __m128 m2 = _mm_loadu_ps(a_xyz + 8);
+  const __m128 xy = _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 1, 3, 2));
+  const __m128 yz = _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 0, 2, 1));
+  a_x = _mm_shuffle_ps(m0, xy, _MM_SHUFFLE(2, 0, 3, 0));
+  a_y = _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+  a_z = _mm_shuffle_ps(yz, m2, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+static GM_TARGET_SSE2 inline void gmSSEStore(float * a_xyz, __m128 a_x, __m128 a_y, __m128 a_z)
+{
+  const __m128 xy = _mm_shuffle_ps(a_x, a_y, _MM_SHUFFLE(2, 0, 2, 0));
+  const __m128 yz = _mm_shuffle_ps(a_y, a_z, _MM_SHUFFLE(3, 1, 3, 1));
+  const __m128 zx = _mm_shuffle_ps(a_z, a_x, _MM_SHUFFLE(3, 1, 2, 0));
+  _mm_storeu_ps(a_xyz, _mm_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0)));
+  _mm_storeu_ps(a_xyz + 4, _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)));
+  _mm_storeu_ps(a_xyz + 8, _mm_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+static GM_TARGET_SSE2 inline __m128 gmSSEDistance2(const float * a_xyz, __m128 a_px, __m128 a_py, __m128 a_pz)
+{
+  __m128 x, y, z;
+  gmSSELoad(a_xyz, x, y, z);
+  x = _mm_sub_ps(x, a_px);
+  y = _mm_sub_ps(y, a_py);
+  z = _mm_sub_ps(z, a_pz);
+  return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+}
+
+static GM_TARGET_SSE2 void GM_CDECL gmSSETransformAll(float * a_xyz, int a_count, const float * a_m)
+{
+  const __m128 m0 = _mm_set1_ps(a_m[0]), m1 = _mm_set1_ps(a_m[1]), m2 = _mm_set1_ps(a_m[2]);
+  const __m128 m3 = _mm_set1_ps(a_m[3]), m4 = _mm_set1_ps(a_m[4]), m5 = _mm_set1_ps(a_m[5]);
+  const __m128 m6 = _mm_set1_ps(a_m[6]), m7 = _mm_set1_ps(a_m[7]), m8 = _mm_set1_ps(a_m[8]);
+  const __m128 m9 = _mm_set1_ps(a_m[9]), m10 = _mm_set1_ps(a_m[10]), m11 = _mm_set1_ps(a_m[11]);
+  int i = 0;
+  for(; i + 4 <= a_count; i += 4)
+  {
+    __m128 x, y, z;
+    gmSSELoad(a_xyz + i * 3, x, y, z);
+    const __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m3, y)), _mm_add_ps(_mm_mul_ps(m6, z), m9));
+    const __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m4, y)), _mm_add_ps(_mm_mul_ps(m7, z), m10));
+    const __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m5, y)), _mm_add_ps(_mm_mul_ps(m8, z), m11));
+    gmSSEStore(a_xyz + i * 3, rx, ry, rz);
+  }
+  gmScalarTransform(a_xyz, i, a_count, a_m);
+}
+
+static GM_TARGET_SSE2 void GM_CDECL gmSSEDistanceAll(const float * a_xyz, int a_count, const float * a_p, float * a_out, bool a_sqrt)
+{
+  const __m128 px = _mm_set1_ps(a_p[0]), py = _mm_set1_ps(a_p[1]), pz = _mm_set1_ps(a_p[2]);
+  int i = 0;
+  for(; i + 4 <= a_count; i += 4)
+  {
+    const __m128 d2 = gmSSEDistance2(a_xyz + i * 3, px, py, pz);
+    _mm_storeu_ps(a_out + i, a_sqrt ? _mm_sqrt_ps(d2) : d2);
+  }
+  gmScalarDistance(a_xyz, i, a_count, a_p, a_out, a_sqrt);
+}
+
+static GM_TARGET_SSE2 int GM_CDECL gmSSEWithinRadiusAll(const float * a_xyz, int a_count, const float * a_p, float a_radius2, gmint32 * a_out)
+{
+  const __m128 px = _mm_set1_ps(a_p[0]), py = _mm_set1_ps(a_p[1]), pz = _mm_set1_ps(a_p[2]);
+  const __m128 r2 = _mm_set1_ps(a_radius2);
+  int found = 0;
+  int i = 0;
+  for(; i + 4 <= a_count; i += 4)
+  {
+    const int mask = _mm_movemask_ps(_mm_cmple_ps(gmSSEDistance2(a_xyz + i * 3, px, py, pz), r2));
+    for(int b = 0; mask >> b; ++b)
+    {
+      a_out[found] = i + b;
+      found += (mask >> b) & 1;
+    }
+  }
+  return found + gmScalarWithinRadius(a_xyz, i, a_count, a_p, a_radius2, a_out + found);
+}
+
+static GM_TARGET_SSE2 int GM_CDECL gmSSEInPlanesAll(const float * a_xyz, int a_count, const float * a_planes, int a_numPlanes, gmint32 * a_out)
+{
+  const __m128 zero = _mm_setzero_ps();
+  __m128 planes[GM_VEC3BATCH_MAX_PLANES * 4];
+  for(int p = 0; p < a_numPlanes * 4; ++p) planes[p] = _mm_set1_ps(a_planes[p]);
+  int found = 0;
+  int i = 0;
+  for(; i + 4 <= a_count; i += 4)
+  {
+    __m128 x, y, z;
+    gmSSELoad(a_xyz + i * 3, x, y, z);
+    int mask = 0xf;
+    for(int p = 0; p < a_numPlanes && mask; ++p)
+    {
+      const __m128 * plane = planes + p * 4;
+      const __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(plane[0], x), _mm_mul_ps(plane[1], y)), _mm_add_ps(_mm_mul_ps(plane[2], z), plane[3]));
+      mask &= _mm_movemask_ps(_mm_cmpge_ps(d, zero));
+    }
+    for(int b = 0; mask >> b; ++b)
+    {
+      a_out[found] = i + b;
+      found += (mask >> b) & 1;
+    }
+  }
+  return found + gmScalarInPlanes(a_xyz, i, a_count, a_planes, a_numPlanes, a_out + found);
+}
+
+static const gmVec3Kernels s_sseKernels = { gmSSETransformAll, gmSSEDistanceAll, gmSSEWithinRadiusAll, gmSSEInPlanesAll };
+
+
+//
+// AVX kernels, 8 vec3s at a time.  The SSE2 shuffles work within each 128 bit lane, so the low lane loads vec3s 0 to 3
+// and the high lane 4 to 7.
+//
+
+static GM_TARGET_AVX inline void gmAVXLoad(const float * a_xyz, __m256 &a_x, __m256 &a_y, __m256 &a_z)
+{
+  const __m256 m0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(a_xyz)), _mm_loadu_ps(a_xyz + 12), 1);
+  const __m256 m1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(a_xyz + 4)), _mm_loadu_ps(a_xyz + 16), 1);
+  const __m256 m2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(a_xyz + 8)), _mm_loadu_ps(a_xyz + 20), 1);
+  const __m256 xy = _mm256_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 1, 3, 2));
+  const __m256 yz = _mm256_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 0, 2, 1));
+  a_x = _mm256_shuffle_ps(m0, xy, _MM_SHUFFLE(2, 0, 3, 0));
+  a_y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+  a_z = _mm256_shuffle_ps(yz, m2, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+static GM_TARGET_AVX inline void gmAVXStore(float * a_xyz, __m256 a_x, __m256 a_y, __m256 a_z)
+{
+  const __m256 xy = _mm256_shuffle_ps(a_x, a_y, _MM_SHUFFLE(2, 0, 2, 0));
+  const __m256 yz = _mm256_shuffle_ps(a_y, a_z, _MM_SHUFFLE(3, 1, 3, 1));
+  const __m256 zx = _mm256_shuffle_ps(a_z, a_x, _MM_SHUFFLE(3, 1, 2, 0));
+  const __m256 r0 = _mm256_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0));
+  const __m256 r1 = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+  const __m256 r2 = _mm256_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1));
+  _mm_storeu_ps(a_xyz, _mm256_castps256_ps128(r0));
+  _mm_storeu_ps(a_xyz + 4, _mm256_castps256_ps128(r1));
+  _mm_storeu_ps(a_xyz + 8, _mm256_castps256_ps128(r2));
+  _mm_storeu_ps(a_xyz + 12, _mm256_extractf128_ps(r0, 1));
+  _mm_storeu_ps(a_xyz + 16, _mm256_extractf128_ps(r1, 1));
+  _mm_storeu_ps(a_xyz + 20, _mm256_extractf128_ps(r2, 1));
+}
+
+static GM_TARGET_AVX inline __m256 gmAVXDistance2(const float * a_xyz, __m256 a_px, __m256 a_py, __m256 a_pz)
+{
+  __m256 x, y, z;
+  gmAVXLoad(a_xyz, x, y, z);
+  x = _mm256_sub_ps(x, a_px);
+  y = _mm256_sub_ps(y, a_py);
+  z = _mm256_sub_ps(z, a_pz);
+  return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z));
+}
+
+static GM_TARGET_AVX void GM_CDECL gmAVXTransformAll(float * a_xyz, int a_count, const float * a_m)
+{
+  const __m256 m0 = _mm256_set1_ps(a_m[0]), m1 = _mm256_set1_ps(a_m[1]), m2 = _mm256_set1_ps(a_m[2]);
+  const __m256 m3 = _mm256_set1_ps(a_m[3]), m4 = _mm256_set1_ps(a_m[4]), m5 = _mm256_set1_ps(a_m[5]);
+  const __m256 m6 = _mm256_set1_ps(a_m[6]), m7 = _mm256_set1_ps(a_m[7]), m8 = _mm256_set1_ps(a_m[8]);
+  const __m256 m9 = _mm256_set1_ps(a_m[9]), m10 = _mm256_set1_ps(a_m[10]), m11 = _mm256_set1_ps(a_m[11]);
+  int i = 0;
+  for(; i + 8 <= a_count; i += 8)
+  {
+    __m256 x, y, z;
+    gmAVXLoad(a_xyz + i * 3, x, y, z);
+    const __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, x), _mm256_mul_ps(m3, y)), _mm256_add_ps(_mm256_mul_ps(m6, z), m9));
+    const __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m1, x), _mm256_mul_ps(m4, y)), _mm256_add_ps(_mm256_mul_ps(m7, z), m10));
+    const __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m2, x), _mm256_mul_ps(m5, y)), _mm256_add_ps(_mm256_mul_ps(m8, z), m11));
+    gmAVXStore(a_xyz + i * 3, rx, ry, rz);
+  }
+  gmScalarTransform(a_xyz, i, a_count, a_m);
+}
+
+static GM_TARGET_AVX void GM_CDECL gmAVXDistanceAll(const float * a_xyz, int a_count, const float * a_p, float * a_out, bool a_sqrt)
+{
+  const __m256 px = _mm256_set1_ps(a_p[0]), py = _mm256_set1_ps(a_p[1]), pz = _mm256_set1_ps(a_p[2]);
+  int i = 0;
+  for(; i + 8 <= a_count; i += 8)
+  {
+    const __m256 d2 = gmAVXDistance2(a_xyz + i * 3, px, py, pz);
+    _mm256_storeu_ps(a_out + i, a_sqrt ? _mm256_sqrt_ps(d2) : d2);
+  }
+  gmScalarDistance(a_xyz, i, a_count, a_p, a_out, a_sqrt);
+}
+
+static GM_TARGET_AVX int GM_CDECL gmAVXWithinRadiusAll(const float * a_xyz, int a_count, const float * a_p, float a_radius2, gmint32 * a_out)
+{
+  const __m256 px = _mm256_set1_ps(a_p[0]), py = _mm256_set1_ps(a_p[1]), pz = _mm256_set1_ps(a_p[2]);
+  const __m256 r2 = _mm256_set1_ps(a_radius2);
+  int found = 0;
+  int i = 0;
+  for(; i + 8 <= a_count; i += 8)
+  {
+    const int mask = _mm256_movemask_ps(_mm256_cmp_ps(gmAVXDistance2(a_xyz + i * 3, px, py, pz), r2, _CMP_LE_OQ));
+    for(int b = 0; mask >> b; ++b)
+    {
+      a_out[found] = i + b;
+      found += (mask >> b) & 1;
+    }
+  }
+  return found + gmScalarWithinRadius(a_xyz, i, a_count, a_p, a_radius2, a_out + found);
+}
+
+static GM_TARGET_AVX int GM_CDECL gmAVXInPlanesAll(const float * a_xyz, int a_count, const float * a_planes, int a_numPlanes, gmint32 * a_out)
+{
+  const __m256 zero = _mm256_setzero_ps();
+  __m256 planes[GM_VEC3BATCH_MAX_PLANES * 4];
+  for(int p = 0; p < a_numPlanes * 4; ++p) planes[p] = _mm256_set1_ps(a_planes[p]);
+  int found = 0;
+  int i = 0;
+  for(; i + 8 <= a_count; i += 8)
+  {
+    __m256 x, y, z;
+    gmAVXLoad(a_xyz + i * 3, x, y, z);
+    int mask = 0xff;
+    for(int p = 0; p < a_numPlanes && mask; ++p)
+    {
+      const __m256 * plane = planes + p * 4;
+      const __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(plane[0], x), _mm256_mul_ps(plane[1], y)), _mm256_add_ps(_mm256_mul_ps(plane[2], z), plane[3]));
+      mask &= _mm256_movemask_ps(_mm256_cmp_ps(d, zero, _CMP_GE_OQ));
+    }
+    for(int b = 0; mask >> b; ++b)
+    {
+      a_out[found] = i + b;
+      found += (mask >> b) & 1;
+    }
+  }
+  return found + gmScalarInPlanes(a_xyz, i, a_count, a_planes, a_numPlanes, a_out + found);
+}
+
+static const gmVec3Kernels s_avxKernels = { gmAVXTransformAll, gmAVXDistanceAll, gmAVXWithinRadiusAll, gmAVXInPlanesAll };
+
+#endif // GM_VEC3BATCH_X86
+
+
+/// \brief gmCpuHas() returns true if the cpu, and for AVX the os, can run a level.
+static bool gmCpuHas(gmVec3BatchLevel a_level)
+{
+  if(a_level == GM_VEC3BATCH_SCALAR) return true;
+#if GM_VEC3BATCH_X86
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 1);
+  if(a_level == GM_VEC3BATCH_SSE2) return (info[3] & (1 << 26)) != 0;
+  // AVX also needs the os to save the ymm registers, osxsave and the xcr0 bits
+  if((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) return false;
+  return (_xgetbv(0) & 6) == 6;
+#else // _MSC_VER
+  __builtin_cpu_init();
+  if(a_level == GM_VEC3BATCH_SSE2) return __builtin_cpu_supports("sse2") != 0;
+  return __builtin_cpu_supports("avx") != 0;
+#endif // _MSC_VER
+#else // GM_VEC3BATCH_X86
+  return false;
+#endif // GM_VEC3BATCH_X86
+}
+
+static const gmVec3Kernels * s_kernels = &s_scalarKernels;
+static gmVec3BatchLevel s_level = GM_VEC3BATCH_SCALAR;
+static bool s_levelSet = false;
+static std::once_flag s_levelDefault;
+
+
+gmVec3BatchLevel gmVec3Batch_GetLevel()
+{
+  return s_level;
+}
+
+
+bool gmVec3Batch_SetLevel(gmVec3BatchLevel a_level)
+{
+  if(!gmCpuHas(a_level)) return false;
+  switch(a_level)
+  {
+#if GM_VEC3BATCH_X86
+    case GM_VEC3BATCH_SSE2 : s_kernels = &s_sseKernels; break;
+    case GM_VEC3BATCH_AVX : s_kernels = &s_avxKernels; break;
+#endif // GM_VEC3BATCH_X86
+    default : s_kernels = &s_scalarKernels; break;
+  }
+  s_level = a_level;
+  s_levelSet = true;
+  return true;
+}
+
+
+//
+// functions
+//
+
+/// \brief gmVec3Points is the points param, a Vec3Array used in place, or the vec3 values of a table copied out
+///        with their keys.  Other table values are skipped.
+struct gmVec3Points
+{
+  bool Get(gmThread * a_thread, int a_param)
+  {
+    m_table = NULL;
+    gmTypedArray * array = (gmTypedArray *) a_thread->ParamUserCheckType(a_param, GM_VEC3ARRAY.Get(a_thread));
+    if(array)
+    {
+      m_xyz = array->GetFloats();
+      m_count = array->Size();
+      return true;
+    }
+    if(a_thread->ParamType(a_param) != GM_TABLE) return false;
+
+    m_table = a_thread->ParamTable(a_param);
+    m_copy.reserve(m_table->Count() * 3);
+    m_keys.reserve(m_table->Count());
+    gmTableIterator it;
+    for(gmTableNode * node = m_table->GetFirst(it); node; node = m_table->GetNext(it))
+    {
+      if(node->m_value.m_type == GM_VEC3)
+      {
+        float v[3];
+        node->m_value.GetVector(v);
+        m_copy.insert(m_copy.end(), v, v + 3);
+        m_keys.push_back(node->m_key);
+      }
+    }
+    m_count = (int) m_keys.size();
+    m_xyz = (m_count) ? &m_copy[0] : NULL;
+    return true;
+  }
+
+  /// \brief PushIndices() pushes a_indices of points, an Int32Array for a Vec3Array, or a table of keys from 0.
+  void PushIndices(gmThread * a_thread, const gmint32 * a_indices, int a_count)
+  {
+    gmMachine * machine = a_thread->GetMachine();
+    if(m_table)
+    {
+      gmTableObject * keys = machine->AllocTableObject();
+      keys->Reserve(machine, a_count);
+      for(int i = 0; i < a_count; ++i) keys->Set(machine, i, m_keys[a_indices[i]]);
+      a_thread->PushTable(keys);
+      return;
+    }
+    gmTypedArray * indices = gmTypedArray_Create(machine, gmTypedArray::INT32, a_count);
+    if(a_count) memcpy(indices->GetInts(), a_indices, sizeof(gmint32) * a_count);
+    a_thread->PushNewUser(indices, GM_INT32ARRAY.Get(a_thread));
+  }
+
+  float * m_xyz;
+  int m_count;
+  gmTableObject * m_table;
+  std::vector<float> m_copy;
+  std::vector<gmVariable> m_keys;
+};
+
+#define GM_CHECK_VEC3POINTS_PARAM(VAR, PARAM) \
+  gmVec3Points VAR; \
+  if(!VAR.Get(a_thread, (PARAM))) \
+  { GM_EXCEPTION_MSG("expecting param %d as Vec3Array or table, got %s", (PARAM), a_thread->ParamTypeName(PARAM)); \
+    return GM_EXCEPTION; \
+  }
+
+static int GM_CDECL gmfVec3TransformAll(gmThread * a_thread) // points, x axis, y axis, z axis, translation
+{
+  GM_CHECK_NUM_PARAMS(4);
+  GM_CHECK_VEC3POINTS_PARAM(points, 0);
+  float m[12] = {};
+  for(int i = 0; i < 4; ++i)
+  {
+    if(i + 1 < a_thread->GetNumParams() && a_thread->ParamType(i + 1) != GM_NULL && !a_thread->Param(i + 1).GetVector(m + i * 3))
+    {
+      GM_EXCEPTION_MSG("expecting param %d as vec3, got %s", i + 1, a_thread->ParamTypeName(i + 1));
+      return GM_EXCEPTION;
+    }
+  }
+
+  s_kernels->m_transform(points.m_xyz, points.m_count, m);
+  if(points.m_table)
+  {
+    gmMachine * machine = a_thread->GetMachine();
+    for(int i = 0; i < points.m_count; ++i)
+    {
+      points.m_table->Set(machine, points.m_keys[i], gmVariable(points.m_xyz[i * 3], points.m_xyz[i * 3 + 1], points.m_xyz[i * 3 + 2]));
+    }
+  }
+  return GM_OK;
+}
+
+static int GM_CDECL gmfVec3DistanceAll(gmThread * a_thread) // points, point, out, return distances
+{
+  GM_CHECK_NUM_PARAMS(2);
+  GM_CHECK_VEC3POINTS_PARAM(points, 0);
+  GM_CHECK_VECTOR_PARAM(point, 1);
+  const float p[3] = { point.x, point.y, point.z };
+  gmMachine * machine = a_thread->GetMachine();
+
+  if(points.m_table)
+  {
+    std::vector<float> distances(points.m_count);
+    if(points.m_count) s_kernels->m_distance(points.m_xyz, points.m_count, p, &distances[0], true);
+    gmTableObject * result = machine->AllocTableObject();
+    result->Reserve(machine, points.m_count);
+    for(int i = 0; i < points.m_count; ++i) result->Set(machine, points.m_keys[i], gmVariable(distances[i]));
+    a_thread->PushTable(result);
+    return GM_OK;
+  }
+
+  // fill the out array if given, saving an allocation per call
+  gmTypedArray * out = (gmTypedArray *) a_thread->ParamUserCheckType(2, GM_FLOAT32ARRAY.Get(a_thread));
+  if(out)
+  {
+    out->Resize(machine, points.m_count);
+    s_kernels->m_distance(points.m_xyz, points.m_count, p, out->GetFloats(), true);
+    a_thread->Push(a_thread->Param(2));
+    return GM_OK;
+  }
+  out = gmTypedArray_Create(machine, gmTypedArray::FLOAT32, points.m_count);
+  s_kernels->m_distance(points.m_xyz, points.m_count, p, out->GetFloats(), true);
+  a_thread->PushNewUser(out, GM_FLOAT32ARRAY.Get(a_thread));
+  return GM_OK;
+}
+
+static int GM_CDECL gmfVec3NearestK(gmThread * a_thread) // points, point, k, return indices nearest first
+{
+  GM_CHECK_NUM_PARAMS(3);
+  GM_CHECK_VEC3POINTS_PARAM(points, 0);
+  GM_CHECK_VECTOR_PARAM(point, 1);
+  GM_CHECK_INT_PARAM(k, 2);
+  const float p[3] = { point.x, point.y, point.z };
+  if(k > points.m_count) k = points.m_count;
+  if(k < 0) k = 0;
+
+  std::vector<float> distances(points.m_count);
+  std::vector<gmint32> indices(points.m_count);
+  if(points.m_count) s_kernels->m_distance(points.m_xyz, points.m_count, p, &distances[0], false);
+  for(int i = 0; i < points.m_count; ++i) indices[i] = i;
+
+  struct Nearer
+  {
+    const float * m_distances;
+    bool operator()(gmint32 a_a, gmint32 a_b) const
+    {
+      return m_distances[a_a] < m_distances[a_b] || (m_distances[a_a] == m_distances[a_b] && a_a < a_b);
+    }
+  };
+  Nearer nearer = { (points.m_count) ? &distances[0] : NULL };
+  std::partial_sort(indices.begin(), indices.begin() + k, indices.end(), nearer);
+
+  points.PushIndices(a_thread, (k) ? &indices[0] : NULL, k);
+  return GM_OK;
+}
+
+static int GM_CDECL gmfVec3WithinRadius(gmThread * a_thread) // points, point, radius, return indices
+{
+  GM_CHECK_NUM_PARAMS(3);
+  GM_CHECK_VEC3POINTS_PARAM(points, 0);
+  GM_CHECK_VECTOR_PARAM(point, 1);
+  GM_CHECK_FLOAT_OR_INT_PARAM(radius, 2);
+  const float p[3] = { point.x, point.y, point.z };
+
+  std::vector<gmint32> indices(points.m_count + 1);
+  const int found = s_kernels->m_withinRadius(points.m_xyz, points.m_count, p, radius * radius, &indices[0]);
+  points.PushIndices(a_thread, &indices[0], (radius < 0.0f) ? 0 : found);
+  return GM_OK;
+}
+
+static int GM_CDECL gmfVec3InFrustum(gmThread * a_thread) // points, planes, return indices
+{
+  GM_CHECK_NUM_PARAMS(2);
+  GM_CHECK_VEC3POINTS_PARAM(points, 0);
+  gmTypedArray * planes = (gmTypedArray *) a_thread->ParamUserCheckType(1, GM_FLOAT32ARRAY.Get(a_thread));
+  if(!planes || (planes->Size() % 4) != 0 || planes->Size() > GM_VEC3BATCH_MAX_PLANES * 4)
+  {
+    GM_EXCEPTION_MSG("expecting param 1 as Float32Array of nx, ny, nz, d per plane, up to %d planes", GM_VEC3BATCH_MAX_PLANES);
+    return GM_EXCEPTION;
+  }
+
+  std::vector<gmint32> indices(points.m_count + 1);
+  const int found = s_kernels->m_inPlanes(points.m_xyz, points.m_count, planes->GetFloats(), planes->Size() / 4, &indices[0]);
+  points.PushIndices(a_thread, &indices[0], found);
+  return GM_OK;
+}
+
+// libs
+
+static gmFunctionEntry s_vec3BatchLib[] =
+{
+  /*gm
+    \lib gm
+  */
+  /*gm
+    \function Vec3TransformAll
+    \brief Vec3TransformAll will transform every vec3 in place, v = xaxis * v.x + yaxis * v.y + zaxis * v.z + translation
+    \param Vec3Array or table points, table values that are not vec3 are skipped
+    \param vec3 xaxis
+    \param vec3 yaxis
+    \param vec3 zaxis
+    \param vec3 translation optional (0,0,0)
+    \return null
+  */
+  {"Vec3TransformAll", gmfVec3TransformAll},
+  /*gm
+    \function Vec3DistanceAll
+    \brief Vec3DistanceAll will return the distance of every vec3 to a point
+    \param Vec3Array or table points
+    \param vec3 point
+    \param Float32Array out optional, resized and filled instead of a new array
+    \return Float32Array of distances, or a table of distances by key for a table of points
+  */
+  {"Vec3DistanceAll", gmfVec3DistanceAll},
+  /*gm
+    \function Vec3NearestK
+    \brief Vec3NearestK will return the k vec3s nearest to a point, nearest first
+    \param Vec3Array or table points
+    \param vec3 point
+    \param int k
+    \return Int32Array of indices, or a table of keys from 0 for a table of points
+  */
+  {"Vec3NearestK", gmfVec3NearestK},
+  /*gm
+    \function Vec3WithinRadius
+    \brief Vec3WithinRadius will return the vec3s within a radius of a point, in order
+    \param Vec3Array or table points
+    \param vec3 point
+    \param float radius
+    \return Int32Array of indices, or a table of keys from 0 for a table of points
+  */
+  {"Vec3WithinRadius", gmfVec3WithinRadius},
+  /*gm
+    \function Vec3InFrustum
+    \brief Vec3InFrustum will return the vec3s in front of every plane, nx * x + ny * y + nz * z + d >= 0, in order
+    \param Vec3Array or table points
+    \param Float32Array planes, nx, ny, nz, d for each plane, up to 32 planes
+    \return Int32Array of indices, or a table of keys from 0 for a table of points
+  */
+  {"Vec3InFrustum", gmfVec3InFrustum},
+};
+
+static void gmVec3BatchDefaultLevel()
+{
+  if(!s_levelSet)
+  {
+    gmVec3Batch_SetLevel(GM_VEC3BATCH_AVX) || gmVec3Batch_SetLevel(GM_VEC3BATCH_SSE2);
+  }
+}
+
+void gmBindVec3BatchLib(gmMachine * a_machine)
+{
+  GM_ASSERT(GM_VEC3ARRAY.Get(a_machine) != GM_NULL); // gmBindTypedArrayLib() first
+  // machines on other threads may be binding too, only the first picks the kernels
+  std::call_once(s_levelDefault, gmVec3BatchDefaultLevel);
+  a_machine->RegisterLibrary(s_vec3BatchLib, sizeof(s_vec3BatchLib) / sizeof(s_vec3BatchLib[0]));
+}
+
+#endif // GM_VEC3BATCH_LIB && GM_USE_VECTOR3_STACK
@@ -0,0 +1,46 @@
+/*
+    _____               __  ___          __            ____        _      __
+   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+                                               /___/             /_/
+
+  See Copyright Notice in gmMachine.h
+
+*/
+
+#ifndef _GMVEC3BATCHLIB_H_
+#define _GMVEC3BATCHLIB_H_
+
+#include "gmConfig.h"
+
+// Fwd decls
+class gmMachine;
+
+#define GM_VEC3BATCH_LIB 1
+
+#if GM_VEC3BATCH_LIB && GM_USE_VECTOR3_STACK
+
+/// \brief gmBindVec3BatchLib() binds functions that work on every vec3 of a Vec3Array or table in one call.
+///        The results are typed arrays, so bind it after gmBindTypedArrayLib().
+void gmBindVec3BatchLib(gmMachine * a_machine);
+
+/// \brief gmVec3BatchLevel is the instruction set the batch kernels use.
+enum gmVec3BatchLevel
+{
+  GM_VEC3BATCH_SCALAR,
+  GM_VEC3BATCH_SSE2,        ///< 4 vec3s at a time
+  GM_VEC3BATCH_AVX,         ///< 8 vec3s at a time
+};
+
+/// \brief gmVec3Batch_GetLevel() returns the kernels in use, the best the cpu runs unless set otherwise.
+gmVec3BatchLevel gmVec3Batch_GetLevel();
+
+/// \brief gmVec3Batch_SetLevel() picks the kernels for all machines, eg. to compare them.  Call it before
+///        machines are running on other threads.
+/// \return false if the cpu can not run a_level, the kernels are then unchanged.
+bool gmVec3Batch_SetLevel(gmVec3BatchLevel a_level);
+
+#endif // GM_VEC3BATCH_LIB && GM_USE_VECTOR3_STACK
+
+#endif // _GMVEC3BATCHLIB_H_
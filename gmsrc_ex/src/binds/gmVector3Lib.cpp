@@ -227,7 +227,7 @@ struct gmVector3Obj
 	static int GM_CDECL Dot(gmThread * a_thread)
 	{
 		GM_CHECK_NUM_PARAMS(1);
-		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3, otherVec, 0);
+		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3.Get(a_thread), otherVec, 0);
 		gmVector3* thisVec = (gmVector3*)a_thread->ThisUser_NoChecks();
 		a_thread->PushFloat( gmVector3::Dot(*thisVec, *otherVec) );
 
@@ -237,13 +237,13 @@ struct gmVector3Obj
 	static int GM_CDECL Cross(gmThread * a_thread)
 	{
 		GM_CHECK_NUM_PARAMS(1);
-		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3, otherVec, 0);
+		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3.Get(a_thread), otherVec, 0);
 		gmVector3* thisVec = (gmVector3*)a_thread->ThisUser_NoChecks();
 		gmVector3* newVec = Alloc(a_thread->GetMachine(), false);
 
 		gmVector3::Cross(*thisVec, *otherVec, *newVec);
 
-		a_thread->PushNewUser(newVec, GM_VECTOR3);
+		a_thread->PushNewUser(newVec, GM_VECTOR3.Get(a_thread));
 
 		return GM_OK;
 	}
@@ -251,7 +251,7 @@ struct gmVector3Obj
 	static int GM_CDECL RotateAxisAngle(gmThread * a_thread)
 	{
 		GM_CHECK_NUM_PARAMS(2);
-		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3, otherVec, 0);
+		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3.Get(a_thread), otherVec, 0);
 		gmVector3* thisVec = (gmVector3*)a_thread->ThisUser_NoChecks();
 
 		float angle = 0;
@@ -264,7 +264,7 @@ struct gmVector3Obj
 
 		gmVector3::RotateAxisAngle(*thisVec, *otherVec, angle, *newVec);
 
-		a_thread->PushNewUser(newVec, GM_VECTOR3);
+		a_thread->PushNewUser(newVec, GM_VECTOR3.Get(a_thread));
 
 		return GM_OK;
 	}
@@ -282,7 +282,7 @@ struct gmVector3Obj
 
 		gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
 		gmVector3::RotateAboutX(*thisVec, angle, *newVec);
-		a_thread->PushNewUser(newVec, GM_VECTOR3);
+		a_thread->PushNewUser(newVec, GM_VECTOR3.Get(a_thread));
 
 		return GM_OK;
 	}
@@ -300,7 +300,7 @@ struct gmVector3Obj
 
 		gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
 		gmVector3::RotateAboutY(*thisVec, angle, *newVec);
-		a_thread->PushNewUser(newVec, GM_VECTOR3);
+		a_thread->PushNewUser(newVec, GM_VECTOR3.Get(a_thread));
 
 		return GM_OK;
 	}
@@ -318,7 +318,7 @@ struct gmVector3Obj
 
 		gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
 		gmVector3::RotateAboutZ(*thisVec, angle, *newVec);
-		a_thread->PushNewUser(newVec, GM_VECTOR3);
+		a_thread->PushNewUser(newVec, GM_VECTOR3.Get(a_thread));
 
 		return GM_OK;
 	}
@@ -349,7 +349,7 @@ struct gmVector3Obj
 		gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
 		gmVector3::Normalize(*thisVec, *newVec);
 
-		a_thread->PushNewUser(newVec, GM_VECTOR3);
+		a_thread->PushNewUser(newVec, GM_VECTOR3.Get(a_thread));
 
 		return GM_OK;
 	}
@@ -360,7 +360,7 @@ struct gmVector3Obj
 
 		gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
 		*newVec = *thisVec;
-		a_thread->PushNewUser(newVec, GM_VECTOR3);
+		a_thread->PushNewUser(newVec, GM_VECTOR3.Get(a_thread));
 
 		return GM_OK;
 	}
@@ -369,9 +369,9 @@ struct gmVector3Obj
 	{
 		gmVector3* thisVec = (gmVector3*)a_thread->ThisUser_NoChecks();
 
-		if(a_thread->Param(0).m_type == GM_VECTOR3)
+		if(a_thread->Param(0).m_type == GM_VECTOR3.Get(a_thread))
 		{
-			GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3, otherVec, 0);
+			GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3.Get(a_thread), otherVec, 0);
 			*thisVec = *otherVec;
 		}
 		else
@@ -397,7 +397,7 @@ struct gmVector3Obj
 	static int GM_CDECL LerpToPoint(gmThread * a_thread)
 	{
 		GM_CHECK_NUM_PARAMS(2);
-		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3, otherVec, 0);
+		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3.Get(a_thread), otherVec, 0);
 		gmVector3* thisVec = (gmVector3*)a_thread->ThisUser_NoChecks();
 
 		float frac = 0;
@@ -409,7 +409,7 @@ struct gmVector3Obj
 		gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
 		gmVector3::LerpPoints(*thisVec, *otherVec, frac, *newVec);
 
-		a_thread->PushNewUser(newVec, GM_VECTOR3);
+		a_thread->PushNewUser(newVec, GM_VECTOR3.Get(a_thread));
 
 		return GM_OK;
 	}
@@ -417,7 +417,7 @@ struct gmVector3Obj
 	static int GM_CDECL SlerpToVector(gmThread * a_thread)
 	{
 		GM_CHECK_NUM_PARAMS(2);
-		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3, otherVec, 0);
+		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3.Get(a_thread), otherVec, 0);
 		gmVector3* thisVec = (gmVector3*)a_thread->ThisUser_NoChecks();
 
 		float frac = 0;
@@ -429,7 +429,7 @@ struct gmVector3Obj
 		gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
 		gmVector3::SlerpVectors(*thisVec, *otherVec, frac, *newVec);
 
-		a_thread->PushNewUser(newVec, GM_VECTOR3);
+		a_thread->PushNewUser(newVec, GM_VECTOR3.Get(a_thread));
 
 		return GM_OK;
 	}
@@ -437,7 +437,7 @@ struct gmVector3Obj
 	static int GM_CDECL ProjectFrom(gmThread * a_thread)
 	{
 		GM_CHECK_NUM_PARAMS(2);
-		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3, otherVec, 0);
+		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3.Get(a_thread), otherVec, 0);
 		gmVector3* thisVec = (gmVector3*)a_thread->ThisUser_NoChecks();
 
 		float time = 0;
@@ -449,7 +449,7 @@ struct gmVector3Obj
 		gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
 		gmVector3::Project(*thisVec, *otherVec, time, *newVec);
 
-		a_thread->PushNewUser(newVec, GM_VECTOR3);
+		a_thread->PushNewUser(newVec, GM_VECTOR3.Get(a_thread));
 
 		return GM_OK;
 	}
@@ -457,7 +457,7 @@ struct gmVector3Obj
 	static int GM_CDECL OpAdd(gmThread * a_thread, gmVariable * a_operands)
 	{
 		// Check types
-		if(a_operands[0].m_type != GM_VECTOR3 || a_operands[1].m_type != GM_VECTOR3)
+		if(a_operands[0].m_type != GM_VECTOR3.Get(a_thread) || a_operands[1].m_type != GM_VECTOR3.Get(a_thread))
 		{
 			a_operands[0].Nullify();
 			return GM_EXCEPTION;
@@ -469,7 +469,7 @@ struct gmVector3Obj
 
 		// Create new
 		gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
-		gmUserObject* newUserObj = a_thread->GetMachine()->AllocUserObject(newVec, GM_VECTOR3);
+		gmUserObject* newUserObj = a_thread->GetMachine()->AllocUserObject(newVec, GM_VECTOR3.Get(a_thread));
 		// Perform operation
 		gmVector3::Add(*vecObjA, *vecObjB, *newVec);
 
@@ -482,8 +482,8 @@ struct gmVector3Obj
 	static int GM_CDECL SetAdd(gmThread * a_thread)
 	{
 		GM_CHECK_NUM_PARAMS(2);
-		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3, a_vec1, 0);
-		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3, a_vec2, 1);
+		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3.Get(a_thread), a_vec1, 0);
+		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3.Get(a_thread), a_vec2, 1);
 
 		gmVector3* thisVec = (gmVector3*)a_thread->ThisUser_NoChecks();
 
@@ -497,7 +497,7 @@ struct gmVector3Obj
 	static int GM_CDECL Add(gmThread * a_thread)
 	{
 		GM_CHECK_NUM_PARAMS(1);
-		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3, a_vec1, 0);
+		GM_CHECK_USER_PARAM(gmVector3*, GM_VECTOR3.Get(a_thread), a_vec1, 0);
 
 		gmVector3* thisVec = (gmVector3*)a_thread->ThisUser_NoChecks();
 
@@ -510,7 +510,7 @@ struct gmVector3Obj
 	static int GM_CDECL OpSub(gmThread * a_thread, gmVariable * a_operands)
 	{
 		// Check types
-		if(a_operands[0].m_type != GM_VECTOR3 || a_operands[1].m_type != GM_VECTOR3)
+		if(a_operands[0].m_type != GM_VECTOR3.Get(a_thread) || a_operands[1].m_type != GM_VECTOR3.Get(a_thread))
 		{
 			a_operands[0].Nullify();
 			return GM_EXCEPTION;
@@ -522,7 +522,7 @@ struct gmVector3Obj
 
 		// Create new
 		gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
-		gmUserObject* newUserObj = a_thread->GetMachine()->AllocUserObject(newVec, GM_VECTOR3);
+		gmUserObject* newUserObj = a_thread->GetMachine()->AllocUserObject(newVec, GM_VECTOR3.Get(a_thread));
 		// Perform operation
 		gmVector3::Sub(*vecObjA, *vecObjB, *newVec);
 
@@ -534,7 +534,7 @@ struct gmVector3Obj
 	static int GM_CDECL OpMul(gmThread * a_thread, gmVariable * a_operands)
 	{
 		// Check types
-		if(a_operands[0].m_type == GM_VECTOR3 && a_operands[1].m_type == GM_VECTOR3)
+		if(a_operands[0].m_type == GM_VECTOR3.Get(a_thread) && a_operands[1].m_type == GM_VECTOR3.Get(a_thread))
 		{
 			// Get operands
 			gmVector3* vecObjA = (gmVector3*) ((gmUserObject*)GM_OBJECT(a_operands[0].m_value.m_ref))->m_user;
@@ -542,14 +542,14 @@ struct gmVector3Obj
 
 			// Create new
 			gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
-			gmUserObject* newUserObj = a_thread->GetMachine()->AllocUserObject(newVec, GM_VECTOR3);
+			gmUserObject* newUserObj = a_thread->GetMachine()->AllocUserObject(newVec, GM_VECTOR3.Get(a_thread));
 			// Perform operation
 			gmVector3::MulVector3(*vecObjA, *vecObjB, *newVec);
 
 			// Return result
 			a_operands[0].SetUser(newUserObj);
 		}
-		else if(a_operands[0].m_type == GM_VECTOR3 && (a_operands[1].m_type != GM_VECTOR3))
+		else if(a_operands[0].m_type == GM_VECTOR3.Get(a_thread) && (a_operands[1].m_type != GM_VECTOR3.Get(a_thread)))
 		{
 			// Get operands
 			gmVector3* vecObjA = (gmVector3*) ((gmUserObject*)GM_OBJECT(a_operands[0].m_value.m_ref))->m_user;
@@ -566,14 +566,14 @@ struct gmVector3Obj
 
 			// Create new
 			gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
-			gmUserObject* newUserObj = a_thread->GetMachine()->AllocUserObject(newVec, GM_VECTOR3);
+			gmUserObject* newUserObj = a_thread->GetMachine()->AllocUserObject(newVec, GM_VECTOR3.Get(a_thread));
 			// Perform operation
 			gmVector3::MulScalar(*vecObjA, scaleB, *newVec);
 
 			// Return result
 			a_operands[0].SetUser(newUserObj);
 		}
-		else if((a_operands[0].m_type != GM_VECTOR3) && a_operands[1].m_type == GM_VECTOR3)
+		else if((a_operands[0].m_type != GM_VECTOR3.Get(a_thread)) && a_operands[1].m_type == GM_VECTOR3.Get(a_thread))
 		{
 			// Get operands
 			float scaleA = 0.0f;
@@ -590,7 +590,7 @@ struct gmVector3Obj
 
 			// Create new
 			gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
-			gmUserObject* newUserObj = a_thread->GetMachine()->AllocUserObject(newVec, GM_VECTOR3);
+			gmUserObject* newUserObj = a_thread->GetMachine()->AllocUserObject(newVec, GM_VECTOR3.Get(a_thread));
 			// Perform operation
 			gmVector3::MulScalar(*vecObjB, scaleA, *newVec);
 
@@ -608,7 +608,7 @@ struct gmVector3Obj
 	static int GM_CDECL OpNeg(gmThread * a_thread, gmVariable * a_operands)
 	{
 		// Check types
-		if(a_operands[0].m_type != GM_VECTOR3)
+		if(a_operands[0].m_type != GM_VECTOR3.Get(a_thread))
 		{
 			a_operands[0].Nullify();
 			return GM_EXCEPTION;
@@ -619,7 +619,7 @@ struct gmVector3Obj
 
 		// Create new
 		gmVector3* newVec = Alloc(a_thread->GetMachine(),false);
-		gmUserObject* newUserObj = a_thread->GetMachine()->AllocUserObject(newVec, GM_VECTOR3);
+		gmUserObject* newUserObj = a_thread->GetMachine()->AllocUserObject(newVec, GM_VECTOR3.Get(a_thread));
 
 		// Perform operation
 		newVec->m_x = -vecObjA->m_x;
@@ -633,7 +633,7 @@ struct gmVector3Obj
 
 	static int GM_CDECL OpGetDot(gmThread * a_thread, gmVariable * a_operands)
 	{
-		GM_ASSERT(a_operands[0].m_type == GM_VECTOR3);
+		GM_ASSERT(a_operands[0].m_type == GM_VECTOR3.Get(a_thread));
 		gmVector3* thisVec = (gmVector3*) ((gmUserObject*)GM_OBJECT(a_operands[0].m_value.m_ref))->m_user;
 
 		GM_ASSERT(a_operands[1].m_type == GM_STRING);
@@ -667,7 +667,7 @@ struct gmVector3Obj
 
 	static int GM_CDECL OpSetDot(gmThread * a_thread, gmVariable * a_operands)
 	{
-		GM_ASSERT(a_operands[0].m_type == GM_VECTOR3);
+		GM_ASSERT(a_operands[0].m_type == GM_VECTOR3.Get(a_thread));
 		gmVector3* thisVec = (gmVector3*) ((gmUserObject*)GM_OBJECT(a_operands[0].m_value.m_ref))->m_user;
 
 		GM_ASSERT(a_operands[2].m_type == GM_STRING);
@@ -709,7 +709,7 @@ struct gmVector3Obj
 
 	static int GM_CDECL OpGetInd(gmThread * a_thread, gmVariable * a_operands)
 	{
-		GM_ASSERT(a_operands[0].m_type == GM_VECTOR3);
+		GM_ASSERT(a_operands[0].m_type == GM_VECTOR3.Get(a_thread));
 		gmVector3* thisVec = (gmVector3*) ((gmUserObject*)GM_OBJECT(a_operands[0].m_value.m_ref))->m_user;
 		if(a_operands[1].m_type == GM_INT)
 		{
@@ -723,7 +723,7 @@ struct gmVector3Obj
 
 	static int GM_CDECL OpSetInd(gmThread * a_thread, gmVariable * a_operands)
 	{
-		GM_ASSERT(a_operands[0].m_type == GM_VECTOR3);
+		GM_ASSERT(a_operands[0].m_type == GM_VECTOR3.Get(a_thread));
 		gmVector3* thisVec = (gmVector3*) ((gmUserObject*)GM_OBJECT(a_operands[0].m_value.m_ref))->m_user;
 		if(a_operands[1].m_type == GM_INT)
 		{
@@ -754,7 +754,7 @@ struct gmVector3Obj
 #if GM_BOOL_OP
 	static int GM_CDECL OpBool(gmThread * a_thread, gmVariable * a_operands)
 	{
-		GM_ASSERT(a_operands[0].m_type == GM_VECTOR3);
+		GM_ASSERT(a_operands[0].m_type == GM_VECTOR3.Get(a_thread));
 		gmVector3* thisVec = (gmVector3*) ((gmUserObject*)GM_OBJECT(a_operands[0].m_value.m_ref))->m_user;
 		if ((thisVec->m_x != 0 || thisVec->m_y != 0) && thisVec->m_z != 0)
 		{
@@ -770,7 +770,7 @@ struct gmVector3Obj
 
 	static int GM_CDECL OpNot(gmThread * a_thread, gmVariable * a_operands)
 	{
-		GM_ASSERT(a_operands[0].m_type == GM_VECTOR3);
+		GM_ASSERT(a_operands[0].m_type == GM_VECTOR3.Get(a_thread));
 		gmVector3* thisVec = (gmVector3*) ((gmUserObject*)GM_OBJECT(a_operands[0].m_value.m_ref))->m_user;
 		if ((thisVec->m_x != 0 || thisVec->m_y != 0) && thisVec->m_z != 0)
 		{
@@ -800,14 +800,14 @@ struct gmVector3Obj
 		{
 			gmGetFloatOrIntParamAsFloat(a_thread, 2, newVec->m_z);
 		}
-		a_thread->PushNewUser(newVec, GM_VECTOR3);
+		a_thread->PushNewUser(newVec, GM_VECTOR3.Get(a_thread));
 		return GM_OK;
 	}
 
 #if GM_USE_INCGC
 	static void GM_CDECL GCDestruct(gmMachine * a_machine, gmUserObject* a_object)
 	{
-		GM_ASSERT(a_object->m_userType == GM_VECTOR3);
+		GM_ASSERT(a_object->m_userType == GM_VECTOR3.Get(a_machine));
 		gmVector3* object = (gmVector3*)a_object->m_user;
 		Free(a_machine, object);
 	}
@@ -817,7 +817,7 @@ struct gmVector3Obj
 	// Garbage collect 'Garbage Collect' function
 	static void GM_CDECL Collect(gmMachine * a_machine, gmUserObject * a_object, gmuint32 a_mark)
 	{
-		GM_ASSERT(a_object->m_userType == GM_VECTOR3);
+		GM_ASSERT(a_object->m_userType == GM_VECTOR3.Get(a_machine));
 		gmVector3* object = (gmVector3*)a_object->m_user;
 		Free(a_machine, object);
 	}
@@ -834,7 +834,7 @@ struct gmVector3Obj
 	static gmVector3* Alloc(gmMachine* a_machine, bool a_clearToZero)
 	{
 		a_machine->AdjustKnownMemoryUsed(sizeof(gmVector3));
-		gmVector3* newObj = (gmVector3*)s_mem.Alloc(); //Allocate our type
+		gmVector3* newObj = (gmVector3*)a_machine->Sys_Alloc(sizeof(gmVector3)); //Allocate our type from the machine
 		if(a_clearToZero) //Optionally clear our members
 		{
 			newObj->m_x = 0.0f;
@@ -848,29 +848,19 @@ struct gmVector3Obj
 	static void Free(gmMachine* a_machine, gmVector3* a_obj)
 	{
 		a_machine->AdjustKnownMemoryUsed(-(int)sizeof(gmVector3));
-		s_mem.Free(a_obj);
+		a_machine->Sys_Free(a_obj);
 	}
-
-	// Only call when gmMachine is shutdown
-	static void FreeAllMemory()
-	{
-		s_mem.ResetAndFreeMemory();
-	}
-
-	// Static members
-	static gmMemFixed s_mem;                        ///< Memory for vector3s
 };
 
 // Static and Global instances
-gmMemFixed gmVector3Obj::s_mem(sizeof(gmVector3), 64);
-gmType GM_VECTOR3 = GM_NULL;
+gmLibType GM_VECTOR3;
 
 /// \brief Push a Vector3. (Eg. Use to return result).
 void gmVector3_Push(gmThread* a_thread, const float* a_vec)
 {
 	gmVector3* newVec = gmVector3Obj::Alloc(a_thread->GetMachine(), false);
 	*newVec = *(gmVector3*)a_vec;
-	a_thread->PushNewUser(newVec, GM_VECTOR3);
+	a_thread->PushNewUser(newVec, GM_VECTOR3.Get(a_thread));
 }
 
 /// \brief Create a Vector3 user object and fill it (Eg. use, to set as table member).
@@ -878,7 +868,7 @@ gmUserObject* gmVector3_Create(gmMachine* a_machine, const float* a_vec)
 {
 	gmVector3* newVec = gmVector3Obj::Alloc(a_machine, false);
 	*newVec = *(gmVector3*)a_vec;
-	return a_machine->AllocUserObject(newVec, GM_VECTOR3);
+	return a_machine->AllocUserObject(newVec, GM_VECTOR3.Get(a_machine));
 }
 
 // libs
@@ -1044,30 +1034,31 @@ void gmBindVector3Lib(gmMachine * a_machine)
 	a_machine->RegisterLibrary(s_vector3Lib, sizeof(s_vector3Lib) / sizeof(s_vector3Lib[0]));
 
 	// Register new user type
-	GM_VECTOR3 = a_machine->CreateUserType("Vector3");
+	gmType type = a_machine->CreateUserType("Vector3");
+	GM_VECTOR3.Set(a_machine, type);
 
 	// Operators
-	a_machine->RegisterTypeOperator(GM_VECTOR3, O_ADD, NULL, gmVector3Obj::OpAdd);
-	a_machine->RegisterTypeOperator(GM_VECTOR3, O_SUB, NULL, gmVector3Obj::OpSub);
-	a_machine->RegisterTypeOperator(GM_VECTOR3, O_MUL, NULL, gmVector3Obj::OpMul);
-	a_machine->RegisterTypeOperator(GM_VECTOR3, O_NEG, NULL, gmVector3Obj::OpNeg);
-	a_machine->RegisterTypeOperator(GM_VECTOR3, O_GETDOT, NULL, gmVector3Obj::OpGetDot);
-	a_machine->RegisterTypeOperator(GM_VECTOR3, O_SETDOT, NULL, gmVector3Obj::OpSetDot);
-	a_machine->RegisterTypeOperator(GM_VECTOR3, O_GETIND, NULL, gmVector3Obj::OpGetInd);
-	a_machine->RegisterTypeOperator(GM_VECTOR3, O_SETIND, NULL, gmVector3Obj::OpSetInd);
+	a_machine->RegisterTypeOperator(type, O_ADD, NULL, gmVector3Obj::OpAdd);
+	a_machine->RegisterTypeOperator(type, O_SUB, NULL, gmVector3Obj::OpSub);
+	a_machine->RegisterTypeOperator(type, O_MUL, NULL, gmVector3Obj::OpMul);
+	a_machine->RegisterTypeOperator(type, O_NEG, NULL, gmVector3Obj::OpNeg);
+	a_machine->RegisterTypeOperator(type, O_GETDOT, NULL, gmVector3Obj::OpGetDot);
+	a_machine->RegisterTypeOperator(type, O_SETDOT, NULL, gmVector3Obj::OpSetDot);
+	a_machine->RegisterTypeOperator(type, O_GETIND, NULL, gmVector3Obj::OpGetInd);
+	a_machine->RegisterTypeOperator(type, O_SETIND, NULL, gmVector3Obj::OpSetInd);
 #if GM_BOOL_OP
-	a_machine->RegisterTypeOperator(GM_VECTOR3, O_BOOL, NULL, gmVector3Obj::OpBool);
-	a_machine->RegisterTypeOperator(GM_VECTOR3, O_NOT, NULL, gmVector3Obj::OpNot);
+	a_machine->RegisterTypeOperator(type, O_BOOL, NULL, gmVector3Obj::OpBool);
+	a_machine->RegisterTypeOperator(type, O_NOT, NULL, gmVector3Obj::OpNot);
 #endif // GM_BOOL_OP
 
 	// Type Lib
-	a_machine->RegisterTypeLibrary(GM_VECTOR3, s_vector3TypeLib, sizeof(s_vector3TypeLib) / sizeof(s_vector3TypeLib[0]));
+	a_machine->RegisterTypeLibrary(type, s_vector3TypeLib, sizeof(s_vector3TypeLib) / sizeof(s_vector3TypeLib[0]));
 
 	// Register garbage collection for type
 #if GM_USE_INCGC
-	a_machine->RegisterUserCallbacks(GM_VECTOR3, NULL, gmVector3Obj::GCDestruct, gmVector3Obj::AsString); 
+	a_machine->RegisterUserCallbacks(type, NULL, gmVector3Obj::GCDestruct, gmVector3Obj::AsString); 
 #else //GM_USE_INCGC
-	a_machine->RegisterUserCallbacks(GM_VECTOR3, NULL, gmVector3Obj::Collect, gmVector3Obj::AsString); 
+	a_machine->RegisterUserCallbacks(type, NULL, gmVector3Obj::Collect, gmVector3Obj::AsString); 
 #endif //GM_USE_INCGC
 }
 
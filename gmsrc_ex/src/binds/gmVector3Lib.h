@@ -18,6 +18,7 @@
 class gmMachine;
 class gmThread;
 class gmUserObject;
+class gmLibType;
 
 // Bind the Vector3 Library.
 void gmBindVector3Lib(gmMachine * a_machine);
@@ -29,9 +30,9 @@ void gmVector3_Push(gmThread* a_thread, const float* a_vec);
 gmUserObject* gmVector3_Create(gmMachine* a_machine, const float* a_vec);
 
 // The Vector3 type Id.
-extern gmType GM_VECTOR3;
+extern gmLibType GM_VECTOR3;
 
 // Example of getting Vector3 from parameter
-// GM_CHECK_USER_PARAM(float*, GM_VECTOR3, vec1, 0);
+// GM_CHECK_USER_PARAM(float*, GM_VECTOR3.Get(a_thread), vec1, 0);
 
 #endif // _GMVECTOR3LIB_H_
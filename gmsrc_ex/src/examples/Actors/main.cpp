@@ -0,0 +1,97 @@
+//
+// main.cpp
+//
+// Actor pool scaling benchmark.  A fixed amount of script work is split
+// between 1, 2, 4, 8 and 16 actors, each a gmMachine on its own OS thread.
+// Workers send their partial sums to actor 0 which checks the total.
+//
+
+#include "gmThread.h"
+#include "gmMachine.h"
+#include "gmMathLib.h"
+#include "gmActor.h"
+
+#include <stdio.h>
+#include <chrono>
+#include <thread>
+
+
+#define TOTAL_WORK  (8 * 1000 * 1000)
+
+static const char * s_script =
+  "local work = function(a_from, a_to)\n"
+  "{\n"
+  "  local sum = 0;\n"
+  "  for(i = a_from; i < a_to; i = i + 1) { sum = sum + (i % 7); }\n"
+  "  return sum;\n"
+  "};\n"
+  "local id = actorId();\n"
+  "local count = actorCount();\n"
+  "local share = (TOTAL / count).Int();\n"
+  "local sum = work(id * share, (id + 1) * share);\n"
+  "if(id != 0)\n"
+  "{\n"
+  "  actorSend(0, sum);\n"
+  "  return;\n"
+  "}\n"
+  "for(n = 1; n < count; n = n + 1)\n"
+  "{\n"
+  "  sum = sum + actorReceive().data;\n"
+  "}\n"
+  "if(sum != EXPECT) { print(\"actor sum mismatch\", sum, EXPECT); }\n";
+
+
+static bool GM_CDECL InitActor(gmMachine * a_machine, int a_actorId, void * a_user)
+{
+  gmBindMathLib(a_machine);
+  a_machine->GetGlobals()->Set(a_machine, "TOTAL", gmVariable(TOTAL_WORK));
+  a_machine->GetGlobals()->Set(a_machine, "EXPECT", gmVariable(*(int *) a_user));
+
+  if(a_machine->ExecuteString(s_script, NULL, false) != 0)
+  {
+    bool first = true;
+    const char * msg;
+    while((msg = a_machine->GetLog().GetEntry(first)))
+    {
+      fprintf(stderr, "actor %d: %s", a_actorId, msg);
+    }
+    return false;
+  }
+  return true;
+}
+
+
+static double RunPool(int a_numActors, int a_expect)
+{
+  gmActorPool pool;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  pool.Start(a_numActors, InitActor, &a_expect, true);
+  pool.Join();
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+
+int main(int argc, char * argv[])
+{
+  printf("hardware threads %d, total work %d\n", (int) std::thread::hardware_concurrency(), TOTAL_WORK);
+  printf("actors   seconds   speedup\n");
+
+  int expect = 0;
+  for(int i = 0; i < TOTAL_WORK; ++i)
+  {
+    expect += i % 7;
+  }
+
+  double base = 0.0;
+  for(int numActors = 1; numActors <= 16; numActors *= 2)
+  {
+    double seconds = RunPool(numActors, expect);
+    if(numActors == 1)
+    {
+      base = seconds;
+    }
+    printf("%6d   %7.3f   %7.2f\n", numActors, seconds, base / seconds);
+  }
+  return 0;
+}
@@ -0,0 +1,99 @@
+//
+// main.cpp
+//
+// gmAsyncPool test through gmCall.  The host calls a global script function with
+// gmCall, the function awaits a job on a worker thread, so gmCall::End() returns
+// with the call blocked.  The thread must have a real id, be listed by
+// threadAllIds() and wake with the job's result once Update() finishes the job.
+// Prints "got 42" then "ok" and returns 0 on success.
+//
+
+#include "gmThread.h"
+#include "gmMachine.h"
+#include "gmCall.h"
+#include "gmAsync.h"
+
+#include <stdio.h>
+#include <chrono>
+
+
+static gmAsyncPool s_pool;
+
+struct DoubleJob : public gmAsyncJob
+{
+  int m_value;
+  DoubleJob(int a_value) : m_value(a_value) {}
+  virtual void Run() { m_value *= 2; }
+  virtual gmVariable Finish(gmMachine * a_machine) { return gmVariable(m_value); }
+};
+
+static int GM_CDECL gmfDouble(gmThread * a_thread)
+{
+  GM_CHECK_INT_PARAM(value, 0);
+  return s_pool.Await(a_thread, new DoubleJob(value));
+}
+
+static const char * s_script =
+  "global compute = function(a_value)\n"
+  "{\n"
+  "  global listed = false;\n"
+  "  foreach(id in threadAllIds()) { if(id == threadId()) { global listed = true; } }\n"
+  "  global result = double(a_value);\n"
+  "};\n";
+
+
+int main(int argc, char * argv[])
+{
+  s_pool.Start(2);
+
+  gmMachine machine;
+  machine.RegisterLibraryFunction("double", gmfDouble);
+  if(machine.ExecuteString(s_script, NULL, true) != 0)
+  {
+    printf("compile failed\n");
+    return 1;
+  }
+
+  gmCall call;
+  if(!call.BeginGlobalFunction(&machine, "compute"))
+  {
+    printf("no function\n");
+    return 1;
+  }
+  call.AddParamInt(21);
+  int state = call.End();
+  if(state != gmThread::BLOCKED || call.GetThreadId() == GM_INVALID_THREAD || machine.GetThread(call.GetThreadId()) == NULL)
+  {
+    printf("call did not block on a thread with an id\n");
+    return 1;
+  }
+
+  // run until the blocked call has finished
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  while(machine.GetThread(call.GetThreadId()))
+  {
+    s_pool.Update(&machine);
+    machine.Execute(1);
+    if(std::chrono::steady_clock::now() - start > std::chrono::seconds(5))
+    {
+      printf("timeout, the call stayed blocked\n");
+      return 1;
+    }
+  }
+  s_pool.Stop();
+
+  gmVariable result = machine.GetGlobals()->Get(&machine, "result");
+  gmVariable listed = machine.GetGlobals()->Get(&machine, "listed");
+  if(!result.IsInt() || !listed.IsInt() || listed.GetInt() == 0)
+  {
+    printf("wrong result\n");
+    return 1;
+  }
+  printf("got %d\n", result.GetInt());
+  if(result.GetInt() != 42)
+  {
+    return 1;
+  }
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,80 @@
+//
+// main.cpp
+//
+// gmBatchCall return value test.  A script function returns a new table and a
+// string for each of 20000 items, collecting garbage every 500 items, while the
+// batch keeps the earlier returns in a C++ buffer.  Every return is checked after
+// the batch.  Prints "ok" and returns 0 on success.
+//
+
+#include "gmThread.h"
+#include "gmMachine.h"
+#include "gmCall.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+
+#define NUM_ITEMS 20000
+#define GC_EVERY  500
+
+static const char * s_script =
+  "global make = function(a_index)\n"
+  "{\n"
+  "  if(a_index % GC_EVERY == 0) { sysCollectGarbage(true); }\n"
+  "  if(a_index % 2) { return \"item\" + a_index; }\n"
+  "  return table(index = a_index);\n"
+  "};\n";
+
+
+int main(int argc, char * argv[])
+{
+  gmMachine machine;
+  machine.GetGlobals()->Set(&machine, "GC_EVERY", gmVariable(GC_EVERY));
+  if(machine.ExecuteString(s_script, NULL, true) != 0)
+  {
+    printf("compile failed\n");
+    return 1;
+  }
+
+  std::vector<gmVariable> params(NUM_ITEMS);
+  std::vector<gmVariable> returns(NUM_ITEMS);
+  for(int i = 0; i < NUM_ITEMS; ++i)
+  {
+    params[i].SetInt(i);
+  }
+
+  gmBatchCall call;
+  if(!call.BeginGlobalFunction(&machine, "make"))
+  {
+    printf("no function\n");
+    return 1;
+  }
+  int failed = call.CallParams(&params[0], 1, NUM_ITEMS, &returns[0]);
+
+  // the collector must not have freed the returns of earlier items
+  int wrong = 0;
+  for(int i = 0; i < NUM_ITEMS; ++i)
+  {
+    char expected[32];
+    sprintf(expected, "item%d", i);
+    if(i % 2)
+    {
+      if(returns[i].m_type != GM_STRING || strcmp(returns[i].GetCStringSafe(), expected) != 0) ++wrong;
+    }
+    else
+    {
+      gmTableObject * table = returns[i].GetTableObjectSafe();
+      if(table == NULL || table->Get(&machine, "index").GetInt() != i) ++wrong;
+    }
+  }
+
+  if(failed || wrong)
+  {
+    printf("%d failed, %d wrong\n", failed, wrong);
+    return 1;
+  }
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,162 @@
+//
+// main.cpp
+//
+// gmbinder2 benchmark.  Two machines bind the same class, then a script on each reads
+// and writes its bound properties in a loop, mixed with a name from the extension table.
+// The property table is shared by the machines, so both must see the bound values.
+// Then bound methods of 0 to 6 arguments and an overloaded method are called in a loop.
+// Prints the ns per loop of each machine and the calls per second of each method, then
+// "ok" and returns 0 on success.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <typeinfo> // gmbinder2_functraits.h uses typeid
+
+#include "gmThread.h"
+#include "gmMachine.h"
+#include "gmbinder2.h"
+#include "gmbinder2_class.h"
+
+
+#define NUM_LOOPS 1000000
+#define NUM_CALLS 2000000
+
+struct Entity
+{
+  int m_a, m_b;
+  float m_x;
+  std::string m_name;
+  int m_bits;
+  Entity() : m_a(1), m_b(2), m_x(0.0f), m_name("entity"), m_bits(0) {}
+};
+
+struct Counter
+{
+  int m_sum;
+  Counter() : m_sum(0) {}
+  int Call0() { return ++m_sum; }
+  int Call1(int a) { return m_sum += a; }
+  int Call2(int a, float b) { return m_sum += a + (int) b; }
+  int Call3(int a, float b, Counter * c) { return m_sum += a + (int) b + (c ? 1 : 0); }
+  int Call4(int a, float b, Counter * c, bool d) { return m_sum += a + (int) b + d; }
+  int Call5(int a, float b, Counter * c, bool d, int e) { return m_sum += a + e; }
+  int Call6(int a, float b, Counter * c, bool d, int e, int f) { return m_sum += a + e + f; }
+  int OverInt(int a) { return 1; }
+  int OverFloat(float a) { return 2; }
+  int OverString(std::string a) { return 3; }
+  int OverTwo(int a, int b) { return 4; }
+};
+
+static const char * s_propertyScript =
+  "e = Entity(); e.extra = 3; sum = 0;\n"
+  "for(i = 0; i < count; i += 1) { e.x = e.x + 1.0; sum += e.a + e.b + e.extra; e.flag = true; }\n"
+  "global result = sum; global x = e.x; global flag = e.flag; global name = e.name;\n";
+
+
+static void BindEntity(gmMachine * a_machine)
+{
+  gmBind2::Class<Entity>("Entity", a_machine)
+    .constructor()
+    .var(&Entity::m_a, "a")
+    .var(&Entity::m_b, "b")
+    .var(&Entity::m_x, "x")
+    .var(&Entity::m_name, "name")
+    .var_bitfield(&Entity::m_bits, 1, "flag");
+}
+
+
+static void BindCounter(gmMachine * a_machine)
+{
+  gmBind2::Class<Counter>("Counter", a_machine)
+    .constructor()
+    .func(&Counter::Call0, "call0")
+    .func(&Counter::Call1, "call1")
+    .func(&Counter::Call2, "call2")
+    .func(&Counter::Call3, "call3")
+    .func(&Counter::Call4, "call4")
+    .func(&Counter::Call5, "call5")
+    .func(&Counter::Call6, "call6")
+    .func(&Counter::OverInt, "over")
+    .func(&Counter::OverFloat, "over")
+    .func(&Counter::OverString, "over")
+    .func(&Counter::OverTwo, "over");
+}
+
+
+static bool Run(gmMachine * a_machine, const char * a_name, const char * a_script, int a_count)
+{
+  a_machine->GetGlobals()->Set(a_machine, "count", gmVariable(a_count));
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  int errors = a_machine->ExecuteString(a_script, NULL, true);
+  double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+  if(errors)
+  {
+    bool first = true;
+    const char * entry;
+    while((entry = a_machine->GetLog().GetEntry(first)))
+    {
+      printf("%s", entry);
+    }
+    return false;
+  }
+  printf("%-12s %8.1f ns per loop %8.2f M per second\n", a_name, seconds * 1e9 / a_count, a_count / seconds / 1e6);
+  return true;
+}
+
+
+static bool RunCall(gmMachine * a_machine, const char * a_name, const char * a_call, int a_expect)
+{
+  char script[256];
+  sprintf(script, "o = Counter(); p = Counter(); sum = 0; for(i = 0; i < count; i += 1) { sum = %s; } global result = sum;", a_call);
+  return Run(a_machine, a_name, script, NUM_CALLS) &&
+         a_machine->GetGlobals()->Get(a_machine, "result").GetIntSafe() == a_expect;
+}
+
+
+static bool CheckProperties(gmMachine * a_machine)
+{
+  gmTableObject * globals = a_machine->GetGlobals();
+  gmVariable name = globals->Get(a_machine, "name");
+  return globals->Get(a_machine, "result").GetIntSafe() == NUM_LOOPS * 6 &&
+         globals->Get(a_machine, "x").GetFloatSafe() == (float) NUM_LOOPS &&
+         globals->Get(a_machine, "flag").GetIntSafe() == 1 &&
+         name.GetCStringSafe() && strcmp(name.GetCStringSafe(), "entity") == 0;
+}
+
+
+int main(int argc, char * argv[])
+{
+  gmMachine first;
+  BindEntity(&first);
+  gmMachine second;
+  BindEntity(&second);
+
+  if(!Run(&first, "properties", s_propertyScript, NUM_LOOPS) || !CheckProperties(&first) ||
+     !Run(&second, "properties 2", s_propertyScript, NUM_LOOPS) || !CheckProperties(&second))
+  {
+    printf("wrong property values\n");
+    return 1;
+  }
+
+  gmMachine calls;
+  BindCounter(&calls);
+  if(!RunCall(&calls, "0 arguments", "o.call0()", NUM_CALLS) ||
+     !RunCall(&calls, "1 argument", "o.call1(1)", NUM_CALLS) ||
+     !RunCall(&calls, "2 arguments", "o.call2(1, 2.0)", NUM_CALLS * 3) ||
+     !RunCall(&calls, "3 arguments", "o.call3(1, 2.0, p)", NUM_CALLS * 4) ||
+     !RunCall(&calls, "4 arguments", "o.call4(1, 2.0, p, true)", NUM_CALLS * 4) ||
+     !RunCall(&calls, "5 arguments", "o.call5(1, 2.0, p, true, 3)", NUM_CALLS * 4) ||
+     !RunCall(&calls, "6 arguments", "o.call6(1, 2.0, p, true, 3, 4)", NUM_CALLS * 8) ||
+     !RunCall(&calls, "overloaded", "o.over(\"x\")", 3) ||
+     !RunCall(&calls, "overloaded 2", "o.over(1, 2)", 4))
+  {
+    printf("wrong call results\n");
+    return 1;
+  }
+
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,137 @@
+//
+// main.cpp
+//
+// Multiple machine stress test.  8 OS threads each own a gmMachine and at the same time
+// compile scripts with CompileStringToFunction() and execute them.  Each thread binds
+// the array, typed array and Vector3 libs in its own order, so their user type ids
+// differ between machines.  Odd threads have their machines bound on a loader thread.
+// Machines are deleted and made again as the threads run, releasing the idle compilers
+// while other threads compile.
+// Prints "ok" and returns 0 on success.
+//
+
+#include "gmThread.h"
+#include "gmMachine.h"
+#include "gmArrayLib.h"
+#include "gmTypedArrayLib.h"
+#include "gmVector3Lib.h"
+
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+#define NUM_THREADS     8
+#define NUM_SCRIPTS     2000  // compiled and executed by each thread
+#define MACHINE_SCRIPTS 50    // scripts run by a machine before it is replaced
+
+static std::atomic<int> s_failures(0);
+
+
+static gmMachine * CreateMachine(int a_threadId)
+{
+  gmMachine * machine = new gmMachine;
+  switch(a_threadId % 3)
+  {
+    case 0 : gmBindArrayLib(machine); gmBindTypedArrayLib(machine); gmBindVector3Lib(machine); break;
+    case 1 : gmBindVector3Lib(machine); gmBindArrayLib(machine); gmBindTypedArrayLib(machine); break;
+    default : gmBindTypedArrayLib(machine); gmBindVector3Lib(machine); gmBindArrayLib(machine); break;
+  }
+  return machine;
+}
+
+
+static void Fail(gmMachine * a_machine, int a_threadId, int a_script, const char * a_what)
+{
+  fprintf(stderr, "thread %d script %d: %s\n", a_threadId, a_script, a_what);
+  bool first = true;
+  const char * msg;
+  while((msg = a_machine->GetLog().GetEntry(first)))
+  {
+    fprintf(stderr, "thread %d: %s", a_threadId, msg);
+  }
+  ++s_failures;
+}
+
+
+static void Run(int a_threadId)
+{
+  gmMachine * machine = NULL;
+  char script[512];
+
+  for(int i = 0; i < NUM_SCRIPTS; ++i)
+  {
+    if(i % MACHINE_SCRIPTS == 0)
+    {
+      delete machine;
+      if(a_threadId & 1)
+      {
+        std::thread loader([&machine, a_threadId]() { machine = CreateMachine(a_threadId); });
+        loader.join();
+      }
+      else
+      {
+        machine = CreateMachine(a_threadId);
+      }
+    }
+
+    // each script is different source, so every one is really compiled
+    sprintf(script,
+      "local a = array(2); a[0] = %d; a[1] = %d;\n"
+      "local f = Float32Array(4); f[3] = 0.5;\n"
+      "local v = Vector3(1.0, 2.0, 3.0);\n"
+      "local sum = 0; for(n = 0; n < 100; n += 1) { sum += n; }\n"
+      "global result = a[0] * 100000 + a[1] + sum;\n"
+      "global types = f[3] == 0.5 && v.z == 3.0 && typeName(a) == \"array\" && typeName(f) == \"Float32Array\";\n",
+      a_threadId, i);
+
+    int errors = 0;
+    gmFunctionObject * function = machine->CompileStringToFunction(script, &errors);
+    if(function == NULL || errors)
+    {
+      Fail(machine, a_threadId, i, "compile failed");
+      continue;
+    }
+    machine->ExecuteFunction(function, NULL, true);
+
+    gmVariable result = machine->GetGlobals()->Get(machine, "result");
+    gmVariable types = machine->GetGlobals()->Get(machine, "types");
+    if(!result.IsInt() || result.GetInt() != a_threadId * 100000 + i + 4950)
+    {
+      Fail(machine, a_threadId, i, "wrong result");
+    }
+    if(!types.IsInt() || types.GetInt() == 0)
+    {
+      Fail(machine, a_threadId, i, "wrong user type");
+    }
+
+    if(i % 10 == 0)
+    {
+      machine->CollectGarbage(true);
+    }
+  }
+  delete machine;
+}
+
+
+int main(int argc, char * argv[])
+{
+  std::vector<std::thread> threads;
+  for(int i = 0; i < NUM_THREADS; ++i)
+  {
+    threads.push_back(std::thread(Run, i));
+  }
+  for(int i = 0; i < NUM_THREADS; ++i)
+  {
+    threads[i].join();
+  }
+
+  if(s_failures)
+  {
+    printf("%d failures\n", (int) s_failures);
+    return 1;
+  }
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,125 @@
+//
+// main.cpp
+//
+// Scanner throughput benchmark.  The bundled scripts are joined and repeated into a
+// CORPUS_SIZE source, then the hand written gmScanner and the flex scanner in
+// ../ScannerDiff/gmScannerFlex.cpp each scan it NUM_PASSES times.  Prints the best
+// MB/s of each.  Pass script files to use them in place of the bundled ones, paths
+// are relative to this directory.
+//
+
+#include "gmConfig.h"
+#include "gmScanner.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+
+
+#define CORPUS_SIZE (1024 * 1024)
+#define NUM_PASSES  50
+
+// flex scanner, ../ScannerDiff/gmScannerFlex.cpp
+typedef struct yy_buffer_state * YY_BUFFER_STATE;
+YY_BUFFER_STATE gmflex_scan_string(const char * str);
+void gmflex_delete_buffer(YY_BUFFER_STATE b);
+int gmflexlex();
+extern GM_THREAD_LOCAL int gmflexlineno;
+
+static const char * s_scripts[] =
+{
+  "../../../scripts/Bomber.gm",
+  "../../../scripts/BomberRun.gm",
+  "../../../scripts/benchmarks.gm",
+  "../../../scripts/minesweeper.gm",
+  "../../../scripts/snake.gm",
+  "../../../scripts/gmDoc/gmdoc.gm",
+};
+
+
+static int ScanHand(const std::string &a_source)
+{
+  gmScanner scanner(a_source.c_str(), (int) a_source.size());
+  int tokens = 0;
+  while(scanner.Lex())
+  {
+    ++tokens;
+  }
+  return tokens;
+}
+
+
+static int ScanFlex(const std::string &a_source)
+{
+  gmflexlineno = 1;
+  YY_BUFFER_STATE buffer = gmflex_scan_string(a_source.c_str());
+  int tokens = 0;
+  while(gmflexlex())
+  {
+    ++tokens;
+  }
+  gmflex_delete_buffer(buffer);
+  return tokens;
+}
+
+
+static void Run(const char * a_name, int (*a_scan)(const std::string &), const std::string &a_source)
+{
+  double best = 0.0;
+  int tokens = 0;
+  for(int pass = 0; pass < NUM_PASSES; ++pass)
+  {
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    tokens = a_scan(a_source);
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    double rate = a_source.size() / seconds / (1024.0 * 1024.0);
+    if(rate > best)
+    {
+      best = rate;
+    }
+  }
+  printf("%-10s %9d tokens %8.1f MB/s\n", a_name, tokens, best);
+}
+
+
+int main(int argc, char * argv[])
+{
+  std::string scripts;
+  int numScripts = (argc > 1) ? argc - 1 : (int) (sizeof(s_scripts) / sizeof(s_scripts[0]));
+  for(int i = 0; i < numScripts; ++i)
+  {
+    const char * path = (argc > 1) ? argv[i + 1] : s_scripts[i];
+    FILE * fp = fopen(path, "rb");
+    if(fp == NULL)
+    {
+      printf("%s: could not read\n", path);
+      return 1;
+    }
+    char buffer[4096];
+    size_t read;
+    while((read = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+    {
+      scripts.append(buffer, read);
+    }
+    fclose(fp);
+    scripts += '\n';
+  }
+  scripts.resize(strlen(scripts.c_str()));
+  if(scripts.empty())
+  {
+    printf("no source\n");
+    return 1;
+  }
+
+  std::string corpus;
+  while(corpus.size() < CORPUS_SIZE)
+  {
+    corpus += scripts;
+  }
+  printf("%.1f MB of source\n", corpus.size() / (1024.0 * 1024.0));
+
+  Run("gmScanner", ScanHand, corpus);
+  Run("flex", ScanFlex, corpus);
+  return 0;
+}
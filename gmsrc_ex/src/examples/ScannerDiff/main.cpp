@@ -0,0 +1,153 @@
+//
+// main.cpp
+//
+// Scanner differential test.  The hand written gmScanner and the flex scanner in
+// gmScannerFlex.cpp, made from gm/gmScanner.l by gm/gmfrontend.bat, scan the bundled
+// scripts, a source of edge cases and random sources.  Both must give the same tokens,
+// token text and line numbers.  'inline' is KEYWORD_INLINE from gmScanner and an
+// IDENTIFIER from flex.
+// Pass script files to scan them in place of the bundled ones, paths are relative
+// to this directory.  Prints "ok" and returns 0 on success.
+//
+
+#include "gmConfig.h"
+#include "gmScanner.h"
+#include "gmParser.cpp.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+
+#define NUM_RANDOM    200000  // random sources
+#define RANDOM_LENGTH 40      // longest random source
+
+// flex scanner, gmScannerFlex.cpp
+typedef struct yy_buffer_state * YY_BUFFER_STATE;
+YY_BUFFER_STATE gmflex_scan_string(const char * str);
+void gmflex_delete_buffer(YY_BUFFER_STATE b);
+int gmflexlex();
+extern GM_THREAD_LOCAL char * gmflextext;
+extern GM_THREAD_LOCAL int gmflexlineno;
+
+static const char * s_scripts[] =
+{
+  "../../../scripts/Bomber.gm",
+  "../../../scripts/BomberRun.gm",
+  "../../../scripts/benchmarks.gm",
+  "../../../scripts/minesweeper.gm",
+  "../../../scripts/snake.gm",
+  "../../../scripts/gmDoc/gmdoc.gm",
+};
+
+static const char * s_edgeCases =
+  "1. .5 1.5e3 1e+ 2E-7f 3.f 0x 0x1F 0xg 0b 0b102 09 1..2 a.b.c\n"
+  "'a' '' '\\'' '\\\n' \"\" \"a\\\"b\" \"open\n\"\\\n\" `raw``quote` `open\n"
+  "/* comment\n over lines */ /**/ /*/ */ // line comment\n"
+  "\t \t\t    \r\n\v\f  a\t\tb    c\r\n\r\n        d\n\n\n\n\n\n\n\n\ne\n"
+  "identifier_with_digits_0123456789 _ __x x_ averyveryverylongidentifiername9\n"
+  "localx global_ if(a&&b||c){ a>>=1; b<<=2; c+=d-=e*=f/=g%=h&=i|=j^=k; } a>=b<=c==d!=e\n"
+  "inline global f = 1; inline  /* x\n */ global g; inline x; inline globalx; inline\n"
+  "@ # $ ? \x80\xff \\ and or for foreach function fork false in if";
+
+
+static int Diff(const std::string &a_source, const char * a_name)
+{
+  gmflexlineno = 1;
+  YY_BUFFER_STATE buffer = gmflex_scan_string(a_source.c_str());
+  gmScanner scanner(a_source.c_str());
+
+  int failed = 0;
+  for(int count = 0;; ++count)
+  {
+    int token = scanner.Lex();
+    int flexToken = gmflexlex();
+    bool same = (token == flexToken || (token == KEYWORD_INLINE && flexToken == IDENTIFIER)) &&
+                strcmp(scanner.GetText(), gmflextext) == 0;
+    if(!same || scanner.GetLine() != gmflexlineno)
+    {
+      printf("%s: token %d differs, '%s' %d line %d, flex '%s' %d line %d\n", a_name, count,
+             scanner.GetText(), token, scanner.GetLine(), gmflextext, flexToken, gmflexlineno);
+      failed = 1;
+      break;
+    }
+    if(token == 0)
+    {
+      break;
+    }
+  }
+
+  gmflex_delete_buffer(buffer);
+  return failed;
+}
+
+
+static bool ReadFile(const char * a_path, std::string &a_source)
+{
+  FILE * fp = fopen(a_path, "rb");
+  if(fp == NULL)
+  {
+    return false;
+  }
+  char buffer[4096];
+  size_t read;
+  while((read = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+  {
+    a_source.append(buffer, read);
+  }
+  fclose(fp);
+  // the scanners read up to the first NUL
+  a_source.resize(strlen(a_source.c_str()));
+  return true;
+}
+
+
+int main(int argc, char * argv[])
+{
+  int failures = 0;
+  int numScripts = (argc > 1) ? argc - 1 : (int) (sizeof(s_scripts) / sizeof(s_scripts[0]));
+  for(int i = 0; i < numScripts; ++i)
+  {
+    const char * path = (argc > 1) ? argv[i + 1] : s_scripts[i];
+    std::string source;
+    if(!ReadFile(path, source))
+    {
+      printf("%s: could not read\n", path);
+      ++failures;
+      continue;
+    }
+    failures += Diff(source, path);
+  }
+
+  failures += Diff(s_edgeCases, "edge cases");
+
+  // random sources from characters that start or end tokens
+  static const char characters[] = "abefgilnotxXeEF01239._ \t\n\r\v\f/*'\"`\\+-=<>&|!^%;{}()[],~:#@\x80\xff";
+  unsigned int seed = 1;
+  for(int i = 0; i < NUM_RANDOM && failures < 10; ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    int length = 1 + (seed >> 16) % RANDOM_LENGTH;
+    std::string source;
+    for(int c = 0; c < length; ++c)
+    {
+      seed = seed * 1103515245 + 12345;
+      source += characters[(seed >> 16) % (sizeof(characters) - 1)];
+    }
+    char name[32];
+    sprintf(name, "random %d", i);
+    if(Diff(source, name))
+    {
+      printf("  source [%s]\n", source.c_str());
+      ++failures;
+    }
+  }
+
+  if(failures)
+  {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("ok\n");
+  return 0;
+}
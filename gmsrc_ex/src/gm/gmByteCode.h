@@ -95,6 +95,13 @@ enum gmByteCode
 #if GM_USE_FORK
   BC_FORK,            // Fork
 #endif //GM_USE_FORK  
+
+	BC_TAILCALL,        // call op16 num parameters, reusing the current stack frame for script functions. always followed by BC_RETV
+
+	// vec3 components, other types are done as BC_GETDOT
+	BC_GETDOTX,         // tos '.' x opptr, push result
+	BC_GETDOTY,         // tos '.' y opptr, push result
+	BC_GETDOTZ,         // tos '.' z opptr, push result
 };
 
 #if GM_COMPILE_DEBUG
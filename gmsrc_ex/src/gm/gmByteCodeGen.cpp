@@ -88,6 +88,9 @@ void gmByteCodeGen::AdjustStack(gmByteCode a_instruction)
 	case BC_LINE : break;
 
 	case BC_GETDOT : m_tos += 0; break;
+	case BC_GETDOTX : m_tos += 0; break;
+	case BC_GETDOTY : m_tos += 0; break;
+	case BC_GETDOTZ : m_tos += 0; break;
 	case BC_SETDOT : m_tos -= 2; break;
 	case BC_GETIND : --m_tos; break;
 	case BC_SETIND : m_tos -= 3; break;
@@ -98,6 +101,7 @@ void gmByteCodeGen::AdjustStack(gmByteCode a_instruction)
 	case BC_BRZK : break;
 	case BC_BRNZK : break;
 	case BC_CALL : break;
+	case BC_TAILCALL : break;
 	case BC_RET : break;
 	case BC_RETV : break;
 	case BC_FOREACH : ++m_tos; break;
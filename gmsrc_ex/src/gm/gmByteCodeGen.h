@@ -36,6 +36,8 @@ public:
 	inline int GetMaxTos() const { return m_maxTos; }
 	inline int GetTos() const { return m_tos; }
 	inline void SetTos(int a_tos) { m_tos = a_tos; }
+	/// \brief RaiseMaxTos() makes room for a_tos stack entries, for code written without Emit().
+	inline void RaiseMaxTos(int a_tos) { if(a_tos > m_maxTos) m_maxTos = a_tos; }
 
 protected:
 
@@ -15,6 +15,9 @@ See Copyright Notice in gmMachine.h
 #include "gmArraySimple.h"
 #include "gmListDouble.h"
 
+#include <mutex>
+#include <vector>
+
 
 //static const char * s_tempVarName0 = "__t0"; // Currently not used
 static const char * s_tempVarName1 = "__t1";
@@ -57,6 +60,378 @@ static void gmSortDebugLines(gmArraySimple<gmLineInfo> &a_lineInfo)
 }
 
 
+
+/// \brief gmOperandSize returns the operand size of an instruction, -1 for an unknown instruction
+static int gmOperandSize(gmuint32 a_instruction)
+{
+	switch(a_instruction)
+	{
+		case BC_GETDOT :
+		case BC_GETDOTX :
+		case BC_GETDOTY :
+		case BC_GETDOTZ :
+		case BC_SETDOT :
+		case BC_BRA :
+		case BC_BRZ :
+		case BC_BRNZ :
+		case BC_BRZK :
+		case BC_BRNZK :
+		case BC_GETGLOBAL :
+		case BC_SETGLOBAL :
+		case BC_GETTHIS :
+		case BC_SETTHIS :
+		case BC_PUSHSTR :
+		case BC_PUSHFN : return sizeof(gmptr);
+#if GM_USE_FORK
+		case BC_FORK : return sizeof(gmptr);
+#endif //GM_USE_FORK
+		case BC_FOREACH :
+		case BC_PUSHINT : return sizeof(gmint);
+		case BC_PUSHFP : return sizeof(gmfloat);
+		case BC_CALL :
+		case BC_TAILCALL :
+		case BC_GETLOCAL :
+		case BC_SETLOCAL : return sizeof(gmuint32);
+		default : break;
+	}
+	return (a_instruction <= BC_GETDOTZ) ? 0 : -1;
+}
+
+
+
+/// \brief gmAllocateLocals renumbers the locals in a function's byte code so locals whose lifetimes do not
+///        overlap share a stack slot.  Parameters keep their slots, locals that may be read before they are
+///        written take the slots just above them so a call need only null those.
+///        On success a_readFirst, if given, is set to those local slots.
+/// \return the number of parameter and local slots, a_numSlots if the byte code was left as it was.
+static int gmAllocateLocals(gmuint8 * a_byteCode, int a_length, int a_numParams, int a_numSlots, gmArraySimple<int> * a_readFirst = NULL)
+{
+	if(a_numSlots <= a_numParams || a_numSlots > 0xffff || (a_length & 3)) return a_numSlots;
+
+	// find the instructions, at is the instruction starting at each word of byte code
+	gmArraySimple<int> offsets, at;
+	at.SetCount(a_length / 4 + 1);
+	for(gmuint w = 0; w < at.Count(); ++w) at[w] = -1;
+	int pos = 0;
+	while(pos < a_length)
+	{
+		int size = gmOperandSize(*((gmuint32 *) (a_byteCode + pos)));
+		if(size < 0) return a_numSlots;
+		at[pos / 4] = offsets.Count();
+		offsets.InsertLast(pos);
+		pos += sizeof(gmuint32) + size;
+	}
+	if(pos != a_length) return a_numSlots;
+	int numInstructions = offsets.Count();
+	at[a_length / 4] = numInstructions;
+
+	// basic blocks, first instruction of each and up to 2 successors
+	gmArraySimple<int> block, first, succ;
+	block.SetCount(numInstructions + 1);
+	for(int i = 0; i <= numInstructions; ++i) block[i] = 0;
+	block[0] = 1;
+	for(int i = 0; i < numInstructions; ++i)
+	{
+		gmuint8 * instruction = a_byteCode + offsets[i];
+		gmuint32 opcode = *((gmuint32 *) instruction);
+		if(opcode == BC_BRA || opcode == BC_BRZ || opcode == BC_BRNZ || opcode == BC_BRZK || opcode == BC_BRNZK
+#if GM_USE_FORK
+			|| opcode == BC_FORK
+#endif //GM_USE_FORK
+			)
+		{
+			gmptr target = *((gmptr *) (instruction + sizeof(gmuint32)));
+			if(target < 0 || target >= a_length || (target & 3) || at[(int) target / 4] < 0) return a_numSlots;
+			block[at[(int) target / 4]] = 1;
+			block[i + 1] = 1;
+		}
+		else if(opcode == BC_RET || opcode == BC_RETV)
+		{
+			block[i + 1] = 1;
+		}
+	}
+	int numBlocks = 0;
+	for(int i = 0; i < numInstructions; ++i)
+	{
+		if(block[i]) { first.InsertLast(i); ++numBlocks; }
+		block[i] = numBlocks - 1;
+	}
+	first.InsertLast(numInstructions);
+	block[numInstructions] = -1;
+	succ.SetCount(numBlocks * 2);
+	for(int b = 0; b < numBlocks; ++b)
+	{
+		gmuint8 * instruction = a_byteCode + offsets[first[b + 1] - 1];
+		gmuint32 opcode = *((gmuint32 *) instruction);
+		succ[b * 2] = (opcode == BC_RET || opcode == BC_RETV || opcode == BC_BRA) ? -1 : block[first[b + 1]];
+		succ[b * 2 + 1] = (opcode == BC_BRA || opcode == BC_BRZ || opcode == BC_BRNZ || opcode == BC_BRZK || opcode == BC_BRNZK
+#if GM_USE_FORK
+			|| opcode == BC_FORK
+#endif //GM_USE_FORK
+			) ? block[at[(int) *((gmptr *) (instruction + sizeof(gmuint32))) / 4]] : -1;
+	}
+
+	// local slot sets, read before written in a block (use), written (def), live on entry and exit
+	const int words = (a_numSlots + 31) / 32;
+#define GM_SET(S, I, V) (S)[(I) * words + ((V) >> 5)] |= (1u << ((V) & 31))
+#define GM_CLEAR(S, I, V) (S)[(I) * words + ((V) >> 5)] &= ~(1u << ((V) & 31))
+#define GM_TEST(S, I, V) ((S)[(I) * words + ((V) >> 5)] & (1u << ((V) & 31)))
+	gmArraySimple<gmuint32> use, def, in, out;
+	use.SetCount(numBlocks * words); def.SetCount(numBlocks * words);
+	in.SetCount(numBlocks * words); out.SetCount(numBlocks * words);
+	memset(use.GetData(), 0, sizeof(gmuint32) * use.Count());
+	memset(def.GetData(), 0, sizeof(gmuint32) * def.Count());
+	memset(in.GetData(), 0, sizeof(gmuint32) * in.Count());
+	memset(out.GetData(), 0, sizeof(gmuint32) * out.Count());
+	for(int b = 0; b < numBlocks; ++b)
+	{
+		for(int i = first[b]; i < first[b + 1]; ++i)
+		{
+			gmuint8 * instruction = a_byteCode + offsets[i];
+			gmuint32 opcode = *((gmuint32 *) instruction);
+			gmuint32 operand = (gmOperandSize(opcode) > 0) ? *((gmuint32 *) (instruction + sizeof(gmuint32))) : 0;
+			if(opcode == BC_GETLOCAL || opcode == BC_SETLOCAL)
+			{
+				if(operand >= (gmuint32) a_numSlots) return a_numSlots;
+				if(opcode == BC_GETLOCAL && !GM_TEST(def, b, operand)) GM_SET(use, b, operand);
+				if(opcode == BC_SETLOCAL) GM_SET(def, b, operand);
+			}
+			else if(opcode == BC_FOREACH)
+			{
+				// writes key and value only while looping, so they stay live through it
+				if((operand >> 16) >= (gmuint32) a_numSlots || (operand & 0xffff) >= (gmuint32) a_numSlots) return a_numSlots;
+			}
+		}
+	}
+	for(bool changed = true; changed;)
+	{
+		changed = false;
+		for(int b = numBlocks - 1; b >= 0; --b)
+		{
+			for(int w = 0; w < words; ++w)
+			{
+				gmuint32 o = 0;
+				if(succ[b * 2] >= 0) o |= in[succ[b * 2] * words + w];
+				if(succ[b * 2 + 1] >= 0) o |= in[succ[b * 2 + 1] * words + w];
+				gmuint32 n = use[b * words + w] | (o & ~def[b * words + w]);
+				out[b * words + w] = o;
+				if(n != in[b * words + w]) { in[b * words + w] = n; changed = true; }
+			}
+		}
+	}
+
+	// interference, a local written interferes with every local live after the write
+	gmArraySimple<gmuint32> edges, live;
+	edges.SetCount(a_numSlots * words);
+	live.SetCount(words);
+	memset(edges.GetData(), 0, sizeof(gmuint32) * edges.Count());
+	for(int b = 0; b < numBlocks; ++b)
+	{
+		for(int w = 0; w < words; ++w) live[w] = out[b * words + w];
+		for(int i = first[b + 1] - 1; i >= first[b]; --i)
+		{
+			gmuint8 * instruction = a_byteCode + offsets[i];
+			gmuint32 opcode = *((gmuint32 *) instruction);
+			gmuint32 operand = (gmOperandSize(opcode) > 0) ? *((gmuint32 *) (instruction + sizeof(gmuint32))) : 0;
+			if(opcode == BC_SETLOCAL)
+			{
+				for(int w = 0; w < words; ++w) edges[operand * words + w] |= live[w];
+				GM_CLEAR(live, 0, operand);
+			}
+			else if(opcode == BC_GETLOCAL)
+			{
+				GM_SET(live, 0, operand);
+			}
+			else if(opcode == BC_FOREACH)
+			{
+				gmuint32 key = operand >> 16, value = operand & 0xffff;
+				for(int w = 0; w < words; ++w) { edges[key * words + w] |= live[w]; edges[value * words + w] |= live[w]; }
+				GM_SET(edges, key, value);
+			}
+		}
+	}
+	// parameters and locals read before they are written are all set on entry
+	for(int w = 0; w < words; ++w) live[w] = in[w];
+	for(int v = 0; v < a_numParams; ++v) GM_SET(live, 0, v);
+	for(int v = 0; v < a_numSlots; ++v)
+	{
+		if(GM_TEST(live, 0, v))
+		{
+			for(int w = 0; w < words; ++w) edges[v * words + w] |= live[w];
+		}
+	}
+	for(int u = 0; u < a_numSlots; ++u)
+	{
+		for(int v = 0; v < a_numSlots; ++v)
+		{
+			if(GM_TEST(edges, u, v)) GM_SET(edges, v, u);
+		}
+	}
+
+	// give each local the lowest slot not taken by a local it interferes with.  locals read before they are
+	// written go first, they interfere with the parameters and each other so take the slots above them.
+	gmArraySimple<int> slot, taken, order;
+	slot.SetCount(a_numSlots);
+	taken.SetCount(a_numSlots);
+	for(int v = a_numParams; v < a_numSlots; ++v) { if(GM_TEST(in, 0, v)) order.InsertLast(v); }
+	int numReadFirst = order.Count();
+	for(int v = a_numParams; v < a_numSlots; ++v) { if(!GM_TEST(in, 0, v)) order.InsertLast(v); }
+	for(int v = 0; v < a_numSlots; ++v) slot[v] = (v < a_numParams) ? v : -1;
+	int numSlots = a_numParams;
+	for(gmuint o = 0; o < order.Count(); ++o)
+	{
+		int v = order[o];
+		for(int s = 0; s < a_numSlots; ++s) taken[s] = 0;
+		for(int u = 0; u < a_numSlots; ++u)
+		{
+			if(u != v && slot[u] >= 0 && GM_TEST(edges, u, v)) taken[slot[u]] = 1;
+		}
+		int s = 0;
+		while(taken[s]) ++s;
+		slot[v] = s;
+		if(s >= numSlots) numSlots = s + 1;
+	}
+	if(a_readFirst)
+	{
+		a_readFirst->Reset();
+		for(int o = 0; o < numReadFirst; ++o)
+		{
+			GM_ASSERT(slot[order[o]] == a_numParams + o);
+			a_readFirst->InsertLast(slot[order[o]]);
+		}
+	}
+#undef GM_SET
+#undef GM_CLEAR
+#undef GM_TEST
+
+	for(int i = 0; i < numInstructions; ++i)
+	{
+		gmuint8 * instruction = a_byteCode + offsets[i];
+		gmuint32 opcode = *((gmuint32 *) instruction);
+		gmuint32 * operand = (gmuint32 *) (instruction + sizeof(gmuint32));
+		if(opcode == BC_GETLOCAL || opcode == BC_SETLOCAL)
+		{
+			*operand = slot[*operand];
+		}
+		else if(opcode == BC_FOREACH)
+		{
+			*operand = (slot[*operand >> 16] << 16) | slot[*operand & 0xffff];
+		}
+	}
+	return numSlots;
+}
+
+
+
+#if GM_COMPILE_INLINE
+
+/// \brief gmIsBranch returns true for instructions with a branch address operand
+static bool gmIsBranch(gmuint32 a_instruction)
+{
+	return (a_instruction == BC_BRA || a_instruction == BC_BRZ || a_instruction == BC_BRNZ || a_instruction == BC_BRZK || a_instruction == BC_BRNZK);
+}
+
+
+
+/// \brief gmCanInline returns true if a function's byte code may be copied in place of a call to it.  It must
+///        be small, not use 'this' or fork, and only branch to its own instructions.
+static bool gmCanInline(const gmuint8 * a_byteCode, int a_length)
+{
+	if(a_length > GM_COMPILE_INLINE_SIZE || (a_length & 3)) return false;
+
+	gmuint8 instructions[GM_COMPILE_INLINE_SIZE / 4 + 1];
+	memset(instructions, 0, sizeof(instructions));
+	int pos = 0;
+	while(pos < a_length)
+	{
+		gmuint32 opcode = *((const gmuint32 *) (a_byteCode + pos));
+		int size = gmOperandSize(opcode);
+		if(size < 0 || opcode == BC_PUSHTHIS || opcode == BC_GETTHIS || opcode == BC_SETTHIS) return false;
+#if GM_USE_FORK
+		if(opcode == BC_FORK) return false;
+#endif //GM_USE_FORK
+		instructions[pos / 4] = 1;
+		pos += sizeof(gmuint32) + size;
+	}
+	if(pos != a_length) return false;
+
+	for(pos = 0; pos < a_length; pos += sizeof(gmuint32) + gmOperandSize(*((const gmuint32 *) (a_byteCode + pos))))
+	{
+		if(gmIsBranch(*((const gmuint32 *) (a_byteCode + pos))))
+		{
+			gmptr target = *((const gmptr *) (a_byteCode + pos + sizeof(gmuint32)));
+			if(target < 0 || target >= a_length || (target & 3) || !instructions[(int) target / 4]) return false;
+		}
+	}
+	return true;
+}
+
+
+
+/// \brief gmCountWrites returns how many times a tree writes a variable, not looking inside functions
+///        defined in it.  A declaration of the variable other than local counts as two writes.
+static int gmCountWrites(const gmCodeTreeNode * a_node, const char * a_symbol)
+{
+	int writes = 0;
+	for(; a_node; a_node = a_node->m_sibling)
+	{
+		if(a_node->m_type == CTNT_EXPRESSION && a_node->m_subType == CTNET_FUNCTION) continue;
+
+		const gmCodeTreeNode * written[2] = { NULL, NULL };
+		if(a_node->m_type == CTNT_EXPRESSION && a_node->m_subType == CTNET_OPERATION && a_node->m_subTypeType == CTNOT_ASSIGN)
+		{
+			written[0] = a_node->m_children[0];
+		}
+		else if(a_node->m_type == CTNT_STATEMENT && a_node->m_subType == CTNST_FOREACH)
+		{
+			written[0] = a_node->m_children[1];
+			written[1] = a_node->m_children[2];
+		}
+		else if(a_node->m_type == CTNT_STATEMENT && a_node->m_subType == CTNST_FORK)
+		{
+			written[0] = a_node->m_children[1];
+		}
+		else if(a_node->m_type == CTNT_DECLARATION && a_node->m_subType == CTNDT_VARIABLE && a_node->m_subTypeType != CTVT_LOCAL &&
+			strcmp(a_node->m_children[0]->m_data.m_string, a_symbol) == 0)
+		{
+			writes += 2;
+		}
+		for(int w = 0; w < 2; ++w)
+		{
+			if(written[w] && written[w]->m_type == CTNT_EXPRESSION && written[w]->m_subType == CTNET_IDENTIFIER &&
+				strcmp(written[w]->m_data.m_string, a_symbol) == 0)
+			{
+				++writes;
+			}
+		}
+
+		for(int c = 0; c < GMCODETREE_NUMCHILDREN; ++c)
+		{
+			writes += gmCountWrites(a_node->m_children[c], a_symbol);
+		}
+	}
+	return writes;
+}
+
+
+
+/// \brief gmHasFunction returns true if a tree defines a function
+static bool gmHasFunction(const gmCodeTreeNode * a_node)
+{
+	for(; a_node; a_node = a_node->m_sibling)
+	{
+		if(a_node->m_type == CTNT_EXPRESSION && a_node->m_subType == CTNET_FUNCTION) return true;
+		for(int c = 0; c < GMCODETREE_NUMCHILDREN; ++c)
+		{
+			if(gmHasFunction(a_node->m_children[c])) return true;
+		}
+	}
+	return false;
+}
+
+#endif // GM_COMPILE_INLINE
+
+
 /*!
 \class gmCodeGenPrivate
 \brief implementation of gmCodeGen
@@ -109,12 +484,19 @@ public:
 	bool GenExprIdentifier(const gmCodeTreeNode * a_node, gmByteCodeGen * a_byteCode);
 	bool GenExprCall(const gmCodeTreeNode * a_node, gmByteCodeGen * a_byteCode);
 	bool GenExprThis(const gmCodeTreeNode * a_node, gmByteCodeGen * a_byteCode);
+#if GM_COMPILE_INLINE
+	int AddInline(gmptr a_id, int a_numParams, const gmArraySimple<int> &a_readFirst);
+	void BindLocal(const char * a_symbol, const gmCodeTreeNode * a_assign, int a_inline);
+	int FindInline(const gmCodeTreeNode * a_call, bool &a_guard);
+	bool GenInlineCall(int a_inline, const gmCodeTreeNode * a_params, gmByteCodeGen * a_byteCode);
+#endif // GM_COMPILE_INLINE
 	
 	bool m_locked;
 	int m_errors;
 	gmLog * m_log;
 	gmCodeGenHooks * m_hooks;
 	bool m_debug;
+	int m_line;                           ///< line of the last BC_LINE emitted
 
 	// Variable
 	struct Variable
@@ -124,6 +506,30 @@ public:
 		const char * m_symbol;
 	};
 
+#if GM_COMPILE_INLINE
+	// InlineFunction, a small function that may be copied in place of calls to it
+	struct InlineFunction
+	{
+		gmptr m_id;
+		int m_numParams;
+		int m_numSlots;   // parameter and local slots
+		int m_maxTos;
+		int m_code;       // byte code in m_inlineCode
+		int m_length;
+		int m_readFirst;  // local slots read before written in m_inlineReadFirst
+		int m_numReadFirst;
+	};
+
+	// Binding, a variable assigned an inline function
+	struct Binding
+	{
+		const char * m_symbol;
+		int m_inline;     // index into m_inlineFunctions, -1 for none
+	};
+
+	static Binding * FindBinding(gmArraySimple<Binding> &a_bindings, const char * a_symbol);
+#endif // GM_COMPILE_INLINE
+
 	// FunctionState
 	class FunctionState : public gmListDoubleNode<FunctionState>
 	{
@@ -141,6 +547,12 @@ public:
 		gmArraySimple<Variable> m_variables;
 		int m_numLocals; // number of local variables including parameters.
 		gmByteCodeGen m_byteCode;
+		int m_lastCall; // address of the last BC_CALL emitted for a call expression, -1 for none
+#if GM_COMPILE_INLINE
+		const gmCodeTreeNode * m_body; // first statement
+		bool m_stackedReturn; // a return with values on the stack, ie. inside foreach or switch
+		gmArraySimple<Binding> m_bindings; // locals bound to inline functions
+#endif // GM_COMPILE_INLINE
 
 		// line number debug.
 		int m_currentLine;
@@ -168,6 +580,14 @@ public:
 	gmArraySimple<LoopInfo> m_loopStack;
 	gmArraySimple<Patch> m_patches;
 
+#if GM_COMPILE_INLINE
+	gmArraySimple<InlineFunction> m_inlineFunctions;
+	gmArraySimple<gmuint8> m_inlineCode;
+	gmArraySimple<int> m_inlineReadFirst;
+	gmArraySimple<Binding> m_inlineGlobals; // 'inline global' variables
+	int m_lastInline; // inline function of the last function expression, -1 for none
+#endif // GM_COMPILE_INLINE
+
 
 	// helper functions
 	FunctionState * PushFunction();
@@ -200,10 +620,49 @@ void GM_CDECL gmLineNumberCallback(int a_address, void * a_context)
 
 
 
+static GM_THREAD_LOCAL gmCodeGenPrivate * s_codeGen = NULL; // the calling thread's code generator, held until Unlock()
+static std::mutex s_codeGenMutex;
+static std::vector<gmCodeGenPrivate *> s_codeGenIdle;       // code generators no thread holds
+
 gmCodeGen& gmCodeGen::Get()
 {
-	static gmCodeGenPrivate codeGen;
-	return codeGen;
+	if(s_codeGen == NULL)
+	{
+		{
+			std::lock_guard<std::mutex> lock(s_codeGenMutex);
+			if(!s_codeGenIdle.empty())
+			{
+				s_codeGen = s_codeGenIdle.back();
+				s_codeGenIdle.pop_back();
+			}
+		}
+		if(s_codeGen == NULL)
+		{
+			s_codeGen = GM_NEW( gmCodeGenPrivate );
+		}
+	}
+	return *s_codeGen;
+}
+
+
+
+void gmCodeGen::Release()
+{
+	if(s_codeGen && s_codeGen->m_locked == false)
+	{
+		delete s_codeGen;
+		s_codeGen = NULL;
+	}
+
+	std::vector<gmCodeGenPrivate *> idle;
+	{
+		std::lock_guard<std::mutex> lock(s_codeGenMutex);
+		idle.swap(s_codeGenIdle);
+	}
+	for(size_t i = 0; i < idle.size(); ++i)
+	{
+		delete idle[i];
+	}
 }
 
 
@@ -221,9 +680,13 @@ gmCodeGenPrivate::gmCodeGenPrivate()
 	m_log = NULL;
 	m_hooks = NULL;
 	m_debug = false;
+	m_line = 0;
 
 	m_currentLoop = -1;
 	m_currentFunction = NULL;
+#if GM_COMPILE_INLINE
+	m_lastInline = -1;
+#endif // GM_COMPILE_INLINE
 }
 
 
@@ -244,6 +707,12 @@ void gmCodeGenPrivate::FreeMemory()
 		m_loopStack.ResetAndFreeMemory();
 		m_functionStack.RemoveAndDeleteAll();
 		m_patches.ResetAndFreeMemory();
+#if GM_COMPILE_INLINE
+		m_inlineFunctions.ResetAndFreeMemory();
+		m_inlineCode.ResetAndFreeMemory();
+		m_inlineReadFirst.ResetAndFreeMemory();
+		m_inlineGlobals.ResetAndFreeMemory();
+#endif // GM_COMPILE_INLINE
 	}
 }
 
@@ -259,6 +728,7 @@ int gmCodeGenPrivate::Lock(const gmCodeTreeNode * a_codeTree, gmCodeGenHooks * a
 	m_log = a_log;
 	m_hooks = a_hooks;
 	m_debug = a_debug;
+	m_line = 0;
 
 	GM_ASSERT(m_hooks != NULL);
 
@@ -267,12 +737,22 @@ int gmCodeGenPrivate::Lock(const gmCodeTreeNode * a_codeTree, gmCodeGenHooks * a
 	m_currentFunction = NULL;
 	m_loopStack.Reset();
 	m_patches.Reset();
+#if GM_COMPILE_INLINE
+	m_inlineFunctions.Reset();
+	m_inlineCode.Reset();
+	m_inlineReadFirst.Reset();
+	m_inlineGlobals.Reset();
+	m_lastInline = -1;
+#endif // GM_COMPILE_INLINE
 
 	// set up the stacks for the first procedure.
 	m_hooks->Begin(m_debug);
 
 	PushFunction();
 	GM_ASSERT(m_currentFunction);
+#if GM_COMPILE_INLINE
+	m_currentFunction->m_body = a_codeTree;
+#endif // GM_COMPILE_INLINE
 
 	// generate the byte code for the root procedure
 	if(!Generate(a_codeTree, &m_currentFunction->m_byteCode))
@@ -283,6 +763,17 @@ int gmCodeGenPrivate::Lock(const gmCodeTreeNode * a_codeTree, gmCodeGenHooks * a
 	{
 		m_currentFunction->m_byteCode.Emit(BC_RET);
 
+		// Share local slots, the debugger needs a slot per local
+		int numClearLocals = m_currentFunction->m_numLocals;
+		if(!m_debug && !m_hooks->SwapEndian())
+		{
+			gmArraySimple<int> readFirst;
+			for(int v = 0; v < m_currentFunction->m_numLocals; ++v) readFirst.InsertLast(v);
+			m_currentFunction->m_numLocals = gmAllocateLocals((gmuint8 *) m_currentFunction->m_byteCode.GetUnsafeData(),
+				m_currentFunction->m_byteCode.Tell(), 0, m_currentFunction->m_numLocals, &readFirst);
+			numClearLocals = readFirst.Count();
+		}
+
 		// Create a locals table
 		const char ** locals = NULL;
 		if(m_debug)
@@ -310,6 +801,7 @@ int gmCodeGenPrivate::Lock(const gmCodeTreeNode * a_codeTree, gmCodeGenHooks * a
 		info.m_byteCodeLength = m_currentFunction->m_byteCode.Tell();
 		info.m_numParams = 0;
 		info.m_numLocals = m_currentFunction->m_numLocals;
+		info.m_numClearLocals = numClearLocals;
 		info.m_symbols = locals;
 		info.m_maxStackSize = m_currentFunction->m_byteCode.GetMaxTos();
 		info.m_lineInfoCount = m_currentFunction->m_lineInfo.Count();
@@ -339,6 +831,14 @@ int gmCodeGenPrivate::Unlock()
 	m_currentLoop = -1;
 	m_loopStack.Reset();
 	m_patches.Reset();
+
+	// hand the code generator back, threads that compiled once do not keep one
+	if(s_codeGen == this)
+	{
+		s_codeGen = NULL;
+		std::lock_guard<std::mutex> lock(s_codeGenMutex);
+		s_codeGenIdle.push_back(this);
+	}
 	return 0;
 }
 
@@ -351,15 +851,14 @@ bool gmCodeGenPrivate::Generate(const gmCodeTreeNode * a_node, gmByteCodeGen * a
 	while(a_node)
 	{
 		// record line number
-		static int s_line = 0;
 		if(m_currentFunction) m_currentFunction->m_currentLine = a_node->m_lineNumber;
 
 		// if we are in debug, emit a BC_LINE instruction
-		if(m_debug && (s_line != a_node->m_lineNumber) && 
+		if(m_debug && (m_line != a_node->m_lineNumber) && 
 			!(a_node->m_type == CTNT_STATEMENT && a_node->m_subType == CTNST_COMPOUND))
 		{
 			a_byteCode->Emit(BC_LINE);
-			s_line = a_node->m_lineNumber;
+			m_line = a_node->m_lineNumber;
 		}
 
 		switch(a_node->m_type)
@@ -510,7 +1009,21 @@ bool gmCodeGenPrivate::GenDeclVariable(const gmCodeTreeNode * a_node, gmByteCode
 {
 	GM_ASSERT(a_node->m_type == CTNT_DECLARATION && a_node->m_subType == CTNDT_VARIABLE);
 	GM_ASSERT(m_currentFunction);
-	m_currentFunction->SetVariableType(a_node->m_children[0]->m_data.m_string, (gmCodeTreeVariableType) a_node->m_subTypeType);
+	const char * symbol = a_node->m_children[0]->m_data.m_string;
+	gmCodeTreeVariableType type = (gmCodeTreeVariableType) a_node->m_subTypeType;
+	if(type == CTVT_INLINE_GLOBAL)
+	{
+		type = CTVT_GLOBAL;
+#if GM_COMPILE_INLINE
+		if(FindBinding(m_inlineGlobals, symbol) == NULL)
+		{
+			Binding &binding = m_inlineGlobals.InsertLast();
+			binding.m_symbol = symbol;
+			binding.m_inline = -1;
+		}
+#endif // GM_COMPILE_INLINE
+	}
+	m_currentFunction->SetVariableType(symbol, type);
 	return true;
 }
 
@@ -525,6 +1038,10 @@ bool gmCodeGenPrivate::GenExprFunction(const gmCodeTreeNode * a_node, gmByteCode
 
 	// Create the function
 	PushFunction();
+#if GM_COMPILE_INLINE
+	int inlineFunction = -1;
+	m_currentFunction->m_body = (a_node->m_children[1]) ? a_node->m_children[1]->m_children[0] : NULL;
+#endif // GM_COMPILE_INLINE
 
 	// Get a debug function name as the name of the variable the function is assigned to
 	if(m_debug && a_node->m_parent && a_node->m_parent->m_type == CTNT_EXPRESSION && a_node->m_parent->m_subType == CTNET_OPERATION &&
@@ -576,6 +1093,20 @@ bool gmCodeGenPrivate::GenExprFunction(const gmCodeTreeNode * a_node, gmByteCode
 
 	if(res)
 	{
+		// Share local slots, the debugger needs a slot per local
+		int numClearLocals = m_currentFunction->m_numLocals - numParams;
+		if(!m_debug && !m_hooks->SwapEndian())
+		{
+			gmArraySimple<int> readFirst;
+			for(int v = numParams; v < m_currentFunction->m_numLocals; ++v) readFirst.InsertLast(v);
+			m_currentFunction->m_numLocals = gmAllocateLocals((gmuint8 *) m_currentFunction->m_byteCode.GetUnsafeData(),
+				m_currentFunction->m_byteCode.Tell(), numParams, m_currentFunction->m_numLocals, &readFirst);
+			numClearLocals = readFirst.Count();
+#if GM_COMPILE_INLINE
+			inlineFunction = AddInline(id, numParams, readFirst);
+#endif // GM_COMPILE_INLINE
+		}
+
 		// Create a locals table
 		const char ** locals = NULL;
 		if(m_debug)
@@ -604,6 +1135,7 @@ bool gmCodeGenPrivate::GenExprFunction(const gmCodeTreeNode * a_node, gmByteCode
 		info.m_byteCodeLength = m_currentFunction->m_byteCode.Tell();
 		info.m_numParams = numParams;
 		info.m_numLocals = m_currentFunction->m_numLocals - numParams;
+		info.m_numClearLocals = numClearLocals;
 		info.m_symbols = locals;
 		info.m_maxStackSize = m_currentFunction->m_byteCode.GetMaxTos();
 		info.m_lineInfoCount = m_currentFunction->m_lineInfo.Count();
@@ -615,6 +1147,9 @@ bool gmCodeGenPrivate::GenExprFunction(const gmCodeTreeNode * a_node, gmByteCode
 	}
 
 	PopFunction();
+#if GM_COMPILE_INLINE
+	m_lastInline = inlineFunction;
+#endif // GM_COMPILE_INLINE
 
 	return res;
 }
@@ -674,9 +1209,24 @@ bool gmCodeGenPrivate::GenStmtReturn(const gmCodeTreeNode * a_node, gmByteCodeGe
 {
 	GM_ASSERT(a_node->m_type == CTNT_STATEMENT && a_node->m_subType == CTNST_RETURN);
 
+#if GM_COMPILE_INLINE
+	if(a_byteCode->GetTos() != 0) m_currentFunction->m_stackedReturn = true;
+#endif // GM_COMPILE_INLINE
+
 	if(a_node->m_children[0])
 	{
 		if(!Generate(a_node->m_children[0], a_byteCode)) return false;
+
+		// return f(), if the call was the last instruction emitted, ie. not inlined, mark it as a tail call so a script
+		// callee can reuse this stack frame.  BC_RETV still follows for native callees.
+		const gmCodeTreeNode * expr = a_node->m_children[0];
+		unsigned int pos = a_byteCode->Tell();
+		if(expr->m_type == CTNT_EXPRESSION && expr->m_subType == CTNET_CALL && m_currentFunction->m_lastCall == (int) (pos - (sizeof(gmuint32) * 2)))
+		{
+			a_byteCode->Seek(pos - (sizeof(gmuint32) * 2));
+			*a_byteCode << (gmuint32) BC_TAILCALL;
+			a_byteCode->Seek(pos);
+		}
 		return a_byteCode->Emit(BC_RETV);
 	}
 	return a_byteCode->Emit(BC_RET);
@@ -1111,6 +1661,14 @@ bool gmCodeGenPrivate::GenExprOpDot(const gmCodeTreeNode * a_node, gmByteCodeGen
 	const gmCodeTreeNode * id = a_node->m_children[1];
 	if(id && id->m_type == CTNT_EXPRESSION && id->m_subType == CTNET_IDENTIFIER)
 	{
+#if GM_USE_VECTOR3_STACK
+		// .x .y .z read a vec3 component without going through its O_GETDOT operator
+		const char * member = id->m_data.m_string;
+		if(member[0] >= 'x' && member[0] <= 'z' && member[1] == '\0')
+		{
+			return a_byteCode->EmitPtr((gmByteCode) (BC_GETDOTX + (member[0] - 'x')), m_hooks->GetSymbolId(member));
+		}
+#endif // GM_USE_VECTOR3_STACK
 		return a_byteCode->EmitPtr(BC_GETDOT, m_hooks->GetSymbolId(a_node->m_children[1]->m_data.m_string));
 	}
 
@@ -1328,6 +1886,11 @@ bool gmCodeGenPrivate::GenExprOpAssign(const gmCodeTreeNode * a_node, gmByteCode
 	// Generate r-value
 	if(!Generate(a_node->m_children[1], a_byteCode)) return false;
 
+#if GM_COMPILE_INLINE
+	const gmCodeTreeNode * rValue = a_node->m_children[1];
+	int inlineFunction = (rValue->m_type == CTNT_EXPRESSION && rValue->m_subType == CTNET_FUNCTION) ? m_lastInline : -1;
+#endif // GM_COMPILE_INLINE
+
 	// complete assignment
 	if(type == 0)
 	{
@@ -1353,6 +1916,9 @@ bool gmCodeGenPrivate::GenExprOpAssign(const gmCodeTreeNode * a_node, gmByteCode
 		}
 		if(offset >= 0 && vtype == CTVT_LOCAL)
 		{
+#if GM_COMPILE_INLINE
+			if(inlineFunction >= 0) BindLocal(lValue->m_data.m_string, a_node, inlineFunction);
+#endif // GM_COMPILE_INLINE
 			return a_byteCode->Emit(BC_SETLOCAL, (gmuint32) offset);
 		}
 		else if(offset == -1)
@@ -1363,6 +1929,11 @@ bool gmCodeGenPrivate::GenExprOpAssign(const gmCodeTreeNode * a_node, gmByteCode
 			}
 			else if(vtype == CTVT_GLOBAL)
 			{
+#if GM_COMPILE_INLINE
+				// calls check the global is still this function, see GenExprCall()
+				Binding * binding = FindBinding(m_inlineGlobals, lValue->m_data.m_string);
+				if(binding) binding->m_inline = inlineFunction;
+#endif // GM_COMPILE_INLINE
 				return a_byteCode->EmitPtr(BC_SETGLOBAL, m_hooks->GetSymbolId(lValue->m_data.m_string));
 			}
 			if(m_log) m_log->LogEntry("internal error");
@@ -1370,6 +1941,9 @@ bool gmCodeGenPrivate::GenExprOpAssign(const gmCodeTreeNode * a_node, gmByteCode
 		}
 
 		offset = m_currentFunction->SetVariableType(lValue->m_data.m_string, CTVT_LOCAL);
+#if GM_COMPILE_INLINE
+		if(inlineFunction >= 0) BindLocal(lValue->m_data.m_string, a_node, inlineFunction);
+#endif // GM_COMPILE_INLINE
 		return a_byteCode->Emit(BC_SETLOCAL, (gmuint32) offset);
 	}
 	else
@@ -1487,6 +2061,32 @@ bool gmCodeGenPrivate::GenExprCall(const gmCodeTreeNode * a_node, gmByteCodeGen
 	// if callee is a dot function, push left side of dot as 'this'
 	const gmCodeTreeNode * callee = a_node->m_children[0];
 
+#if GM_COMPILE_INLINE
+	// copy a small function bound in this script in place of the call.  a global may be rebound at run
+	// time, so the copy is guarded by a check the global still holds the function, else it is called.
+	bool guard = false;
+	unsigned int inlineDone = 0;
+	int inlineFunction = FindInline(a_node, guard);
+	if(inlineFunction >= 0)
+	{
+		if(!guard)
+		{
+			return GenInlineCall(inlineFunction, a_node->m_children[1], a_byteCode);
+		}
+		a_byteCode->EmitPtr(BC_GETGLOBAL, m_hooks->GetSymbolId(callee->m_data.m_string));
+		a_byteCode->EmitPtr(BC_PUSHFN, m_inlineFunctions[inlineFunction].m_id);
+		a_byteCode->Emit(BC_OP_EQ);
+		unsigned int inlineCall = a_byteCode->Skip(SIZEOF_BC_BRA);
+		a_byteCode->SetTos(stackLevel);
+		if(!GenInlineCall(inlineFunction, a_node->m_children[1], a_byteCode)) return false;
+		inlineDone = a_byteCode->Skip(SIZEOF_BC_BRA);
+		unsigned int call = a_byteCode->Seek(inlineCall);
+		a_byteCode->EmitPtr(BC_BRZ, call);
+		a_byteCode->Seek(call);
+		a_byteCode->SetTos(stackLevel);
+	}
+#endif // GM_COMPILE_INLINE
+
 	if(callee->m_type == CTNT_EXPRESSION && callee->m_subType == CTNET_OPERATION && callee->m_subTypeType == CTNOT_DOT)
 	{
 		if(!Generate(callee->m_children[0], a_byteCode)) return false;
@@ -1542,11 +2142,21 @@ bool gmCodeGenPrivate::GenExprCall(const gmCodeTreeNode * a_node, gmByteCodeGen
 	}
 
 	// call
+	m_currentFunction->m_lastCall = a_byteCode->Tell();
 	a_byteCode->Emit(BC_CALL, (gmuint32) numParams);
 
 	// restore the stack level.
 	a_byteCode->SetTos(stackLevel + 1);
 
+#if GM_COMPILE_INLINE
+	if(guard)
+	{
+		unsigned int done = a_byteCode->Seek(inlineDone);
+		a_byteCode->EmitPtr(BC_BRA, done);
+		a_byteCode->Seek(done);
+	}
+#endif // GM_COMPILE_INLINE
+
 	return true;
 }
 
@@ -1560,10 +2170,225 @@ bool gmCodeGenPrivate::GenExprThis(const gmCodeTreeNode * a_node, gmByteCodeGen
 
 
 
+#if GM_COMPILE_INLINE
+
+int gmCodeGenPrivate::AddInline(gmptr a_id, int a_numParams, const gmArraySimple<int> &a_readFirst)
+{
+	const gmuint8 * byteCode = (const gmuint8 *) m_currentFunction->m_byteCode.GetUnsafeData();
+	int length = m_currentFunction->m_byteCode.Tell();
+	if(m_currentFunction->m_stackedReturn || !gmCanInline(byteCode, length)) return -1;
+
+	InlineFunction &function = m_inlineFunctions.InsertLast();
+	function.m_id = a_id;
+	function.m_numParams = a_numParams;
+	function.m_numSlots = m_currentFunction->m_numLocals;
+	function.m_maxTos = m_currentFunction->m_byteCode.GetMaxTos();
+	function.m_code = m_inlineCode.Count();
+	function.m_length = length;
+	function.m_readFirst = m_inlineReadFirst.Count();
+	function.m_numReadFirst = a_readFirst.Count();
+
+	m_inlineCode.SetCount(function.m_code + length);
+	memcpy(m_inlineCode.GetData() + function.m_code, byteCode, length);
+	for(gmuint v = 0; v < a_readFirst.Count(); ++v) m_inlineReadFirst.InsertLast(a_readFirst[v]);
+
+	return m_inlineFunctions.Count() - 1;
+}
+
+
+
+void gmCodeGenPrivate::BindLocal(const char * a_symbol, const gmCodeTreeNode * a_assign, int a_inline)
+{
+	// a statement of the function body, not nested, runs before the statements after it.  if it is the only
+	// write to the local, calls generated after it always call this function.
+	const gmCodeTreeNode * statement = a_assign;
+	while(statement->m_parent && statement->m_parent->m_sibling == statement)
+	{
+		statement = statement->m_parent;
+	}
+	if(statement != m_currentFunction->m_body || gmCountWrites(m_currentFunction->m_body, a_symbol) != 1) return;
+
+	Binding &binding = m_currentFunction->m_bindings.InsertLast();
+	binding.m_symbol = a_symbol;
+	binding.m_inline = a_inline;
+}
+
+
+
+int gmCodeGenPrivate::FindInline(const gmCodeTreeNode * a_call, bool &a_guard)
+{
+	const gmCodeTreeNode * callee = a_call->m_children[0];
+	if(a_call->m_children[2] || callee->m_type != CTNT_EXPRESSION || callee->m_subType != CTNET_IDENTIFIER ||
+		(callee->m_flags & gmCodeTreeNode::CTN_MEMBER) > 0)
+	{
+		return -1;
+	}
+
+	Binding * binding = NULL;
+	bool guard = false;
+	gmCodeTreeVariableType vtype;
+	int offset = m_currentFunction->GetVariableOffset(callee->m_data.m_string, vtype);
+	if(offset >= 0 && vtype == CTVT_LOCAL)
+	{
+		binding = FindBinding(m_currentFunction->m_bindings, callee->m_data.m_string);
+	}
+	else if(vtype == CTVT_GLOBAL)
+	{
+		// the guard evaluates the arguments twice, do not copy functions defined in them
+		if(gmHasFunction(a_call->m_children[1])) return -1;
+		binding = FindBinding(m_inlineGlobals, callee->m_data.m_string);
+		guard = true;
+	}
+
+	if(binding == NULL || binding->m_inline < 0) return -1;
+	if(m_currentFunction->m_numLocals + m_inlineFunctions[binding->m_inline].m_numSlots > 0xffff) return -1;
+	a_guard = guard;
+	return binding->m_inline;
+}
+
+
+
+bool gmCodeGenPrivate::GenInlineCall(int a_inline, const gmCodeTreeNode * a_params, gmByteCodeGen * a_byteCode)
+{
+	// copy, generating the arguments may add inline functions
+	InlineFunction function = m_inlineFunctions[a_inline];
+	int stackLevel = a_byteCode->GetTos();
+
+	// the function's parameters and locals get slots of their own
+	gmuint32 base = (gmuint32) m_currentFunction->m_numLocals;
+	m_currentFunction->m_numLocals += function.m_numSlots;
+
+	// arguments, extra arguments are evaluated and dropped
+	int numArgs = 0;
+	for(const gmCodeTreeNode * param = a_params; param; param = param->m_sibling, ++numArgs)
+	{
+		if(!Generate(param, a_byteCode, false)) return false;
+	}
+	for(int a = numArgs - 1; a >= 0; --a)
+	{
+		if(a < function.m_numParams) a_byteCode->Emit(BC_SETLOCAL, base + a);
+		else a_byteCode->Emit(BC_POP);
+	}
+
+	// missing parameters and locals read before they are written are null, as in a call
+	for(int p = numArgs; p < function.m_numParams; ++p)
+	{
+		a_byteCode->Emit(BC_PUSHNULL);
+		a_byteCode->Emit(BC_SETLOCAL, base + p);
+	}
+	for(int l = 0; l < function.m_numReadFirst; ++l)
+	{
+		a_byteCode->Emit(BC_PUSHNULL);
+		a_byteCode->Emit(BC_SETLOCAL, base + m_inlineReadFirst[function.m_readFirst + l]);
+	}
+
+	// find the instructions, a function ending in return x; drops the BC_RET after it if nothing branches there
+	const gmuint8 * byteCode = m_inlineCode.GetData() + function.m_code;
+	gmArraySimple<int> offsets, at, to;
+	at.SetCount(function.m_length / 4 + 1);
+	int pos = 0;
+	bool branchToLast = false;
+	while(pos < function.m_length)
+	{
+		gmuint32 opcode = *((const gmuint32 *) (byteCode + pos));
+		at[pos / 4] = offsets.Count();
+		offsets.InsertLast(pos);
+		pos += sizeof(gmuint32) + gmOperandSize(opcode);
+	}
+	int count = offsets.Count();
+	for(int i = 0; i < count; ++i)
+	{
+		const gmuint8 * instruction = byteCode + offsets[i];
+		if(gmIsBranch(*((const gmuint32 *) instruction)) && *((const gmptr *) (instruction + sizeof(gmuint32))) == offsets[count - 1])
+		{
+			branchToLast = true;
+		}
+	}
+	if(count > 1 && !branchToLast && *((const gmuint32 *) (byteCode + offsets[count - 1])) == BC_RET &&
+		*((const gmuint32 *) (byteCode + offsets[count - 2])) == BC_RETV)
+	{
+		--count;
+	}
+
+	// addresses of the copied instructions, returns become branches to the end
+	to.SetCount(count + 1);
+	gmuint32 address = a_byteCode->Tell();
+	for(int i = 0; i < count; ++i)
+	{
+		gmuint32 opcode = *((const gmuint32 *) (byteCode + offsets[i]));
+		to[i] = (int) address;
+		if(opcode == BC_RETV) address += (i == count - 1) ? 0 : SIZEOF_BC_BRA;
+		else if(opcode == BC_RET) address += sizeof(gmuint32) + ((i == count - 1) ? 0 : SIZEOF_BC_BRA);
+		else address += sizeof(gmuint32) + gmOperandSize(opcode);
+	}
+	to[count] = (int) address;
+
+	for(int i = 0; i < count; ++i)
+	{
+		const gmuint8 * instruction = byteCode + offsets[i];
+		const gmuint8 * operand = instruction + sizeof(gmuint32);
+		gmuint32 opcode = *((const gmuint32 *) instruction);
+
+		if(gmIsBranch(opcode))
+		{
+			*a_byteCode << opcode << (gmptr) to[at[(int) *((const gmptr *) operand) / 4]];
+		}
+		else if(opcode == BC_GETLOCAL || opcode == BC_SETLOCAL)
+		{
+			*a_byteCode << opcode << (*((const gmuint32 *) operand) + base);
+		}
+		else if(opcode == BC_FOREACH)
+		{
+			gmuint32 slots = *((const gmuint32 *) operand);
+			*a_byteCode << opcode << ((((slots >> 16) + base) << 16) | ((slots & 0xffff) + base));
+		}
+		else if(opcode == BC_TAILCALL)
+		{
+			*a_byteCode << (gmuint32) BC_CALL << *((const gmuint32 *) operand);
+		}
+		else if(opcode == BC_RET || opcode == BC_RETV)
+		{
+			if(opcode == BC_RET) *a_byteCode << (gmuint32) BC_PUSHNULL;
+			if(i != count - 1) *a_byteCode << (gmuint32) BC_BRA << (gmptr) to[count];
+		}
+		else
+		{
+			*a_byteCode << opcode;
+			a_byteCode->Write(operand, gmOperandSize(opcode));
+		}
+	}
+	GM_ASSERT(a_byteCode->Tell() == (unsigned int) to[count]);
+
+	// the result is left on the stack
+	a_byteCode->SetTos(stackLevel + 1);
+	a_byteCode->RaiseMaxTos(stackLevel + function.m_maxTos + 1);
+	return true;
+}
+
+
+
+gmCodeGenPrivate::Binding * gmCodeGenPrivate::FindBinding(gmArraySimple<Binding> &a_bindings, const char * a_symbol)
+{
+	for(gmuint b = 0; b < a_bindings.Count(); ++b)
+	{
+		if(strcmp(a_bindings[b].m_symbol, a_symbol) == 0) return &a_bindings[b];
+	}
+	return NULL;
+}
+
+#endif // GM_COMPILE_INLINE
+
+
+
 gmCodeGenPrivate::FunctionState::FunctionState()
 {
 	m_debugName = NULL;
 	m_numLocals = 0;
+	m_lastCall = -1;
+#if GM_COMPILE_INLINE
+	m_body = NULL;
+	m_stackedReturn = false;
+#endif // GM_COMPILE_INLINE
 	m_currentLine = 1;
 	m_byteCode.Reset(this);
 }
@@ -1575,6 +2400,12 @@ void gmCodeGenPrivate::FunctionState::Reset()
 	m_debugName = NULL;
 	m_variables.Reset();
 	m_numLocals = 0;
+	m_lastCall = -1;
+#if GM_COMPILE_INLINE
+	m_body = NULL;
+	m_stackedReturn = false;
+	m_bindings.Reset();
+#endif // GM_COMPILE_INLINE
 	m_currentLine = 1;
 	m_byteCode.Reset(this);
 	m_lineInfo.Reset();
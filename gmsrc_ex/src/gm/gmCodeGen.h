@@ -27,9 +27,12 @@ class gmCodeGen
 {
 public:
 
-	/// \brief Get() will return the singleton code generator.
+	/// \brief Get() will return the singleton code generator for the calling thread, taking an idle one if it holds none.
 	static gmCodeGen& Get();
 
+	/// \brief Release() will delete the calling thread's code generator if unlocked and all idle code generators.
+	static void Release();
+
 	/// \brief FreeMemory() will free all memory allocated by the code tree.  must be unlocked
 	virtual void FreeMemory() = 0;
 
@@ -33,6 +33,7 @@ struct gmFunctionInfo
 	int m_byteCodeLength;           //!< byte code length in bytes
 	int m_numParams;                //!< parameter count
 	int m_numLocals;                //!< local variable count (includes registers)
+	int m_numClearLocals;           //!< the first locals, that may be read before they are written, nulled on each call
 	int m_maxStackSize;             //!< required temporary storage
 
 	const char * m_debugName;       //!< name of variable function was assigned to... may be NULL
@@ -12,7 +12,13 @@ See Copyright Notice in gmMachine.h
 #include "gmConfig.h"
 #include "gmCodeTree.h"
 
-gmCodeTreeNode * g_codeTree = NULL;
+#include <mutex>
+#include <vector>
+
+GM_THREAD_LOCAL gmCodeTreeNode * g_codeTree = NULL;
+static GM_THREAD_LOCAL gmCodeTree * s_codeTree = NULL; // the calling thread's parser, held until Unlock()
+static std::mutex s_codeTreeMutex;
+static std::vector<gmCodeTree *> s_codeTreeIdle;       // parsers no thread holds
 
 
 
@@ -36,8 +42,44 @@ gmCodeTree::~gmCodeTree()
 
 gmCodeTree &gmCodeTree::Get()
 {
-	static gmCodeTree codeTree;
-	return codeTree;
+	if(s_codeTree == NULL)
+	{
+		{
+			std::lock_guard<std::mutex> lock(s_codeTreeMutex);
+			if(!s_codeTreeIdle.empty())
+			{
+				s_codeTree = s_codeTreeIdle.back();
+				s_codeTreeIdle.pop_back();
+			}
+		}
+		if(s_codeTree == NULL)
+		{
+			s_codeTree = GM_NEW( gmCodeTree );
+		}
+	}
+	return *s_codeTree;
+}
+
+
+
+void gmCodeTree::Release()
+{
+	if(s_codeTree && s_codeTree->m_locked == false)
+	{
+		gmCodeTree * codeTree = s_codeTree;
+		s_codeTree = NULL;
+		delete codeTree;
+	}
+
+	std::vector<gmCodeTree *> idle;
+	{
+		std::lock_guard<std::mutex> lock(s_codeTreeMutex);
+		idle.swap(s_codeTreeIdle);
+	}
+	for(size_t i = 0; i < idle.size(); ++i)
+	{
+		delete idle[i];
+	}
 }
 
 
@@ -63,13 +105,10 @@ int gmCodeTree::Lock(const char * a_script, gmLog * a_log)
 	//gmdebug = 1;
 	gmlineno = 1;
 
-	// create a scan buffer
-	YY_BUFFER_STATE buffer = gm_scan_string(a_script);
-	if(buffer)
-	{
-		m_errors = gmparse();
-		gm_delete_buffer(buffer);
-	}
+	gmScanner scanner(a_script);
+	gmScanner * previous = gmScanner::SetCurrent(&scanner);
+	m_errors = gmparse();
+	gmScanner::SetCurrent(previous);
 	return m_errors;
 }
 
@@ -82,6 +121,14 @@ int gmCodeTree::Unlock()
 	m_locked = false;
 	m_errors = 0;
 	m_log = NULL;
+
+	// hand the parser back, threads that compiled once do not keep one
+	if(s_codeTree == this)
+	{
+		s_codeTree = NULL;
+		std::lock_guard<std::mutex> lock(s_codeTreeMutex);
+		s_codeTreeIdle.push_back(this);
+	}
 	return 0;
 }
 
@@ -145,7 +192,7 @@ static void PrintRecursive(const gmCodeTreeNode * a_node, FILE * a_fp, bool a_fi
 {
 	if(a_node)
 	{
-		static int indent;
+		static GM_THREAD_LOCAL int indent;
 		int i;
 
 		if(a_firstCall)
@@ -24,7 +24,8 @@ See Copyright Notice in gmMachine.h
 struct gmCodeTreeNode;
 
 /// \class gmCodeTree
-/// \brief gmCodeTree is a singleton class for creating code trees.
+/// \brief gmCodeTree is a singleton class for creating code trees.  A thread holds its own parser from Get() until
+///        Unlock(), so machines on different threads may compile at the same time.  Unlocked parsers are pooled.
 class gmCodeTree
 {
 protected:
@@ -33,9 +34,12 @@ protected:
 public:
 	~gmCodeTree();
 
-	/// \brief Get() will return the singlton parser.
+	/// \brief Get() will return the singlton parser for the calling thread, taking an idle one if it holds none.
 	static gmCodeTree &Get();
 
+	/// \brief Release() will delete the calling thread's parser if unlocked and all idle parsers.
+	static void Release();
+
 	/// \brief FreeMemory() will free all memory allocated by the code tree.  must be unlocked
 	void FreeMemory();
 
@@ -110,6 +114,7 @@ enum gmCodeTreeVariableType
 	CTVT_LOCAL = 0,
 	CTVT_GLOBAL,
 	CTVT_MEMBER,
+	CTVT_INLINE_GLOBAL,   ///< 'inline global', a global whose function may be inlined at calls
 };
 
 
@@ -52,6 +52,8 @@ enum gmEndian
 // COMPILER CODE GENERATOR
 
 #define GM_COMPILE_PASS_THIS_ALWAYS 0         // set to 1 to pass current this to each function call
+#define GM_COMPILE_INLINE           1         // inline calls to small functions bound in the same script, when not compiling debug
+#define GM_COMPILE_INLINE_SIZE      160       // byte code size in bytes of the largest function inlined
 
 // RUNTIME THREAD
 
@@ -64,6 +66,7 @@ enum gmEndian
 #define GMMACHINE_GMCHECKDIVBYZERO  0         // Let GM operator check for divide by zero and possibly cause GM run time exception (rather than OS exception)
 #define GMMACHINE_NULL_VAR_CTOR     0         // Nullify gmVariable in constructor.  Not recommended for real-time / time critical applications.
 #define GMMACHINE_USERTYPEGROWBY    16        // allocate user types in chunks of this size
+#define GMMACHINE_MAXLIBTYPES       32        // most gmLibType globals, user types the bind libraries keep per machine
 #define GMMACHINE_OBJECTCHUNKSIZE   32        // default object chunk allocation size
 #define GMMACHINE_TBLCHUNKSIZE      32        // table object chunk allocation size
 #define GMMACHINE_STRINGCHUNKSIZE   128       // default object chunk allocation size
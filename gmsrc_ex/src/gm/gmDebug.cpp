@@ -150,6 +150,7 @@ static bool LineCallback(gmThread * a_thread)
 	}
 
 	a_thread->m_debugFlags = TF_BREAK;
+	a_thread->Sys_Promote(); // the debugger names the thread by id
 	const gmFunctionObject * fn = a_thread->GetFunctionObject();
 	gmDebuggerBreak(session, a_thread->GetId(), fn->GetSourceId(), fn->GetLine(a_thread->GetInstruction()));
 	return true;
@@ -162,6 +163,7 @@ static bool CallCallback(gmThread * a_thread)
 	if(a_thread->m_debugFlags & TF_STEPINTO)
 	{
 		a_thread->m_debugFlags = TF_BREAK;
+		a_thread->Sys_Promote();
 		const gmFunctionObject * fn = a_thread->GetFunctionObject();
 		gmDebuggerBreak(session, a_thread->GetId(), fn->GetSourceId(), fn->GetLine(a_thread->GetInstruction()));
 		return true;
@@ -193,6 +195,7 @@ static bool RetCallback(gmThread * a_thread)
 		((a_thread->m_debugFlags & TF_STEPOVER) && (a_thread->m_debugUser == a_thread->GetIntBase())))
 	{
 		a_thread->m_debugFlags = TF_BREAK;
+		a_thread->Sys_Promote();
 		const gmFunctionObject * fn = a_thread->GetFunctionObject();
 		gmDebuggerBreak(session, a_thread->GetId(), fn->GetSourceId(), fn->GetLine(a_thread->GetInstruction()));
 		return true;
@@ -210,15 +213,14 @@ static bool IsKilledCallback(gmThread * a_thread)
 	return (a_thread->m_debugFlags & TF_KILL) > 0;
 }
 
-static gmMachineCallback s_prevMachineCallback = NULL;
-static gmPrintCallback s_prevPrintCallback = NULL;
 bool GM_CDECL gmdMachineCallback(gmMachine * a_machine, gmMachineCommand a_command, const void * a_context)
 {
 	gmDebugSession * session = (gmDebugSession *) a_machine->m_debugUser;
 	const gmThread * thread = (const gmThread *) a_context;
 
 	// chain callback
-	if(s_prevMachineCallback) s_prevMachineCallback(a_machine, a_command, a_context);
+	gmMachineCallback prevCallback = session ? session->m_prevMachineCallback : gmMachine::s_machineCallback;
+	if(prevCallback) prevCallback(a_machine, a_command, a_context);
 
 	// do we have a debug session?
 	if(session == NULL) return false;
@@ -272,7 +274,8 @@ void GM_CDECL gmdPrintCallback(gmMachine * a_machine, const char * a_string)
 	gmDebugSession * session = (gmDebugSession *) a_machine->m_debugUser;
 
 	// chain callback
-	if(s_prevPrintCallback) s_prevPrintCallback(a_machine, a_string);
+	gmPrintCallback prevCallback = session ? session->m_prevPrintCallback : gmMachine::s_printCallback;
+	if(prevCallback) prevCallback(a_machine, a_string);
 
 	gmDebuggerMessage(session, a_string);
 }
@@ -286,6 +289,8 @@ gmDebugSession::gmDebugSession() :
 m_breaks(32)
 {
 	m_machine = NULL;
+	m_prevMachineCallback = NULL;
+	m_prevPrintCallback = NULL;
 }
 
 
@@ -396,11 +401,11 @@ bool gmDebugSession::OpenDebugSession(gmMachine * a_machine)
 	m_machine->m_isBroken = IsBrokenCallback;
 	m_machine->m_isKilled = IsKilledCallback;
 	m_machine->m_return = RetCallback;	
-	s_prevMachineCallback = a_machine->s_machineCallback;
-	s_prevPrintCallback = a_machine->s_printCallback;
+	m_prevMachineCallback = a_machine->GetMachineCallback();
+	m_prevPrintCallback = a_machine->GetPrintCallback();
 
-	a_machine->s_machineCallback = gmdMachineCallback;	
-	a_machine->s_printCallback = gmdPrintCallback;
+	a_machine->SetMachineCallback(gmdMachineCallback);
+	a_machine->SetPrintCallback(gmdPrintCallback);
 	return true;
 }
 
@@ -421,8 +426,9 @@ bool gmDebugSession::CloseDebugSession()
 		gmDebuggerQuit(this);
 
 		m_machine->m_debugUser = NULL;
-		m_machine->s_machineCallback = s_prevMachineCallback;
-		m_machine->s_printCallback = s_prevPrintCallback;
+		// leave the machine on the globals unless it had its own callbacks
+		m_machine->SetMachineCallback(m_prevMachineCallback != gmMachine::s_machineCallback ? m_prevMachineCallback : NULL);
+		m_machine->SetPrintCallback(m_prevPrintCallback != gmMachine::s_printCallback ? m_prevPrintCallback : NULL);
 
 		m_machine->m_line = NULL;
 		m_machine->m_call = NULL;
@@ -632,13 +638,23 @@ void gmMachineGetContext(gmDebugSession * a_session, int a_threadId, int a_callf
 				{
 					gmFunctionObject * fn = (gmFunctionObject *) GM_MOBJECT(thread->GetMachine(), fnVar->m_value.m_ref);
 
+					// note frames that were elided by tail calls into this frame
+					const char * fnName = fn->GetDebugName();
+					char nameBuff[buffSize];
+					if(frame->m_tailCalls)
+					{
+						_gmsnprintf(nameBuff, buffSize, "%s (%d tail call frames elided)", fnName, frame->m_tailCalls);
+						nameBuff[buffSize - 1] = '\0';
+						fnName = nameBuff;
+					}
+
 					// this
 					const char * thisType = thread->GetMachine()->GetTypeName(base[-2].m_type);
 					base[-2].AsString(thread->GetMachine(), buff, buffSize);
 					gmDebuggerContextCallFrame(
 						a_session, 
 						numFrames, 
-						fn->GetDebugName(), 
+						fnName, 
 						fn->GetSourceId(), 
 						fn->GetLine(ip), 
 						"this", 
@@ -731,6 +747,7 @@ static bool threadIter(gmThread * a_thread, void * a_context)
 			a_thread->GetMachine()->GetSourceCode(fn->GetSourceId(), source, sourceFile);
 		}
 
+		a_thread->Sys_Promote();
 		gmDebuggerThreadInfo(session, a_thread->GetId(), state, lineNum, funcName, sourceFile);
 	}
 	return true;
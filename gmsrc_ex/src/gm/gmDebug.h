@@ -15,6 +15,7 @@ See Copyright Notice in gmMachine.h
 #include "gmConfig.h"
 #include "gmStreamBuffer.h"
 #include "gmHash.h"
+#include "gmMachine.h"
 
 class gmMachine;
 class gmDebugSession;
@@ -69,6 +70,10 @@ public:
 	bool RemoveBreakPoint(const void * a_bp);
 	int GetBreakPointsForThread(int a_threadId, int *a_bpline, const int maxlines) ;
 
+	// machine callbacks in effect before the session hooked its machine, chained to
+	gmMachineCallback m_prevMachineCallback;
+	gmPrintCallback m_prevPrintCallback;
+
 private:
 
 	class BreakPoint : public gmHashNode<void *, BreakPoint>
@@ -13,6 +13,8 @@ See Copyright Notice in gmMachine.h
 #include "gmFunctionObject.h"
 #include "gmMachine.h"
 #include "gmThread.h"
+#include "gmLibHooks.h"
+#include "gmSourceEntry.h"
 
 int gmObjFunctor::operator()(gmThread *a_thread)
 {
@@ -29,14 +31,24 @@ gmFunctionObject::gmFunctionObject()
 	m_byteCodeLength = 0;
 	m_maxStackSize = 1; // return value
 	m_numLocals = 0;
+	m_numClearLocals = 0;
 	m_numParams = 0;
 	m_numParamsLocals = 0;
 	m_numReferences = 0;
 	m_references = NULL;
+	m_lazy = NULL;
+	m_lazyIndex = 0;
+	m_packed = NULL;
+	m_packedOffset = 0;
 }
 
 void gmFunctionObject::Destruct(gmMachine * a_machine)
 {
+	if(m_lazy)
+	{
+		m_lazy->Release();
+		m_lazy = NULL;
+	}
 	delete m_cFunctor;
 	m_cFunctor = 0;
 	if(m_references)
@@ -84,6 +96,18 @@ bool gmFunctionObject::Trace(gmMachine * a_machine, gmGarbageCollector* a_gc, co
 		++a_workDone;
 	}
 
+	// a stub references the functions its byte code will once bound
+	if(m_lazy && m_lazyIndex != GM_LIB_NO_FUNCTION)
+	{
+		gmuint32 reloc = 0;
+		gmFunctionObject * function;
+		while((function = m_lazy->GetFunctionReference(m_lazyIndex, reloc)) != NULL)
+		{
+			a_gc->GetNextObject(function);
+			++a_workDone;
+		}
+	}
+
 	++a_workDone;
 	return true;
 }
@@ -99,10 +123,72 @@ void gmFunctionObject::Mark(gmMachine * a_machine, gmuint32 a_mark)
 		gmObject * object = a_machine->GetGMObject(m_references[i]);
 		if(object->NeedsMark(a_mark)) object->Mark(a_machine, a_mark);
 	}
+
+	// a stub references the functions its byte code will once bound
+	if(m_lazy && m_lazyIndex != GM_LIB_NO_FUNCTION)
+	{
+		gmuint32 reloc = 0;
+		gmFunctionObject * function;
+		while((function = m_lazy->GetFunctionReference(m_lazyIndex, reloc)) != NULL)
+		{
+			if(function->NeedsMark(a_mark)) function->Mark(a_machine, a_mark);
+		}
+	}
 }
 #endif //GM_USE_INCGC
 
 
+void gmFunctionObject::Sys_Materialize()
+{
+	gmLibImage * lib = m_lazy;
+	gmMachine * machine = lib->m_machine;
+
+	// no collection while the byte code is half patched
+	bool gc = machine->IsGCEnabled();
+	machine->EnableGC(false);
+	m_lazy = NULL;
+	if(m_lazyIndex != GM_LIB_NO_FUNCTION)
+	{
+		lib->Bind(m_lazyIndex, NULL);
+	}
+	machine->EnableGC(gc);
+	lib->Release();
+}
+
+
+void gmFunctionObject::Swap(gmMachine * a_machine, gmFunctionObject * a_other)
+{
+	Materialize();
+	a_other->Materialize();
+
+#if GM_USE_INCGC
+	// both lose their references, write barrier them
+	gmGarbageCollector * gc = a_machine->GetGC();
+	if(!gc->IsOff())
+	{
+		int i;
+		for(i = 0; i < m_numReferences; ++i) { gc->WriteBarrier(a_machine->GetGMObject(m_references[i])); }
+		for(i = 0; i < a_other->m_numReferences; ++i) { gc->WriteBarrier(a_machine->GetGMObject(a_other->m_references[i])); }
+	}
+#endif //GM_USE_INCGC
+
+#define GM_SWAP(T, M) { T temp = M; M = a_other->M; a_other->M = temp; }
+	GM_SWAP(gmFunctionObjectDebugInfo *, m_debugInfo);
+	GM_SWAP(gmSourceEntry *, m_packed);
+	GM_SWAP(gmuint32, m_packedOffset);
+	GM_SWAP(void *, m_byteCode);
+	GM_SWAP(int, m_byteCodeLength);
+	GM_SWAP(int, m_maxStackSize);
+	GM_SWAP(int, m_numLocals);
+	GM_SWAP(int, m_numClearLocals);
+	GM_SWAP(int, m_numParams);
+	GM_SWAP(int, m_numParamsLocals);
+	GM_SWAP(int, m_numReferences);
+	GM_SWAP(gmptr *, m_references);
+#undef GM_SWAP
+}
+
+
 bool gmFunctionObject::Init(gmMachine * a_machine, bool a_debug, gmFunctionInfo &a_info, gmuint32 a_sourceId)
 {
 	// byte code
@@ -121,6 +207,7 @@ bool gmFunctionObject::Init(gmMachine * a_machine, bool a_debug, gmFunctionInfo
 	// stack info
 	m_maxStackSize = a_info.m_maxStackSize;
 	m_numLocals = a_info.m_numLocals;
+	m_numClearLocals = (a_info.m_numClearLocals >= 0 && a_info.m_numClearLocals < a_info.m_numLocals) ? a_info.m_numClearLocals : a_info.m_numLocals;
 	m_numParams = a_info.m_numParams;
 	m_numParamsLocals = a_info.m_numParams + a_info.m_numLocals;
 
@@ -148,6 +235,9 @@ bool gmFunctionObject::Init(gmMachine * a_machine, bool a_debug, gmFunctionInfo
 			switch(*(instruction32++))
 			{
 			case BC_GETDOT :
+			case BC_GETDOTX :
+			case BC_GETDOTY :
+			case BC_GETDOTZ :
 			case BC_SETDOT :
 			case BC_BRA :
 			case BC_BRZ :
@@ -158,11 +248,15 @@ bool gmFunctionObject::Init(gmMachine * a_machine, bool a_debug, gmFunctionInfo
 			case BC_SETGLOBAL :
 			case BC_GETTHIS :
 			case BC_SETTHIS : instruction += sizeof(gmptr); break;
+#if GM_USE_FORK
+			case BC_FORK : instruction += sizeof(gmptr); break;
+#endif //GM_USE_FORK
 			case BC_FOREACH :
 			case BC_PUSHINT : instruction += sizeof(gmint); break;
 			case BC_PUSHFP : instruction += sizeof(gmfloat); break;
 
 			case BC_CALL :
+			case BC_TAILCALL :
 			case BC_GETLOCAL :
 			case BC_SETLOCAL : instruction += sizeof(gmuint32); break;
 
@@ -196,52 +290,112 @@ bool gmFunctionObject::Init(gmMachine * a_machine, bool a_debug, gmFunctionInfo
 
 	// debug info
 	m_debugInfo = NULL;
+	m_packed = NULL;
 	if(a_debug)
 	{
-		m_debugInfo = (gmFunctionObjectDebugInfo *) a_machine->Sys_Alloc(sizeof(gmFunctionObjectDebugInfo));
-		memset(m_debugInfo, 0, sizeof(gmFunctionObjectDebugInfo));
-
-		// source code id
-		m_debugInfo->m_sourceId = a_sourceId;
-
-		// debug name
-		if(a_info.m_debugName)
+		if(a_machine->GetCompactDebugInfo())
 		{
-			int len = (int)strlen(a_info.m_debugName) + 1;
-			m_debugInfo->m_debugName = (char *) a_machine->Sys_Alloc(len);
-			memcpy(m_debugInfo->m_debugName, a_info.m_debugName, len);
+			// kept packed with the source until needed
+			m_packed = a_machine->Sys_GetSourceEntry(a_sourceId);
+			m_packedOffset = m_packed->AddFunction(a_info);
 		}
-
-		// symbols
-		if(a_info.m_symbols)
+		else
 		{
-			m_debugInfo->m_symbols = (char **) a_machine->Sys_Alloc(sizeof(char *) * m_numParamsLocals);
-			int i;
-			for(i = 0; i < m_numParamsLocals; ++i)
-			{
-				int len = (int)strlen(a_info.m_symbols[i]) + 1;
-				m_debugInfo->m_symbols[i] = (char *) a_machine->Sys_Alloc(len);
-				memcpy(m_debugInfo->m_symbols[i], a_info.m_symbols[i], len);
-			}
+			InitDebugInfo(a_machine, a_info, a_sourceId);
 		}
+	}
+
+	return true;
+}
+
+
+
+void gmFunctionObject::InitDebugInfo(gmMachine * a_machine, const gmFunctionInfo &a_info, gmuint32 a_sourceId)
+{
+	m_debugInfo = (gmFunctionObjectDebugInfo *) a_machine->Sys_Alloc(sizeof(gmFunctionObjectDebugInfo));
+	memset(m_debugInfo, 0, sizeof(gmFunctionObjectDebugInfo));
 
-		// line number debugging.
-		if(a_info.m_lineInfo)
+	// source code id
+	m_debugInfo->m_sourceId = a_sourceId;
+
+	// debug name
+	if(a_info.m_debugName)
+	{
+		int len = (int)strlen(a_info.m_debugName) + 1;
+		m_debugInfo->m_debugName = (char *) a_machine->Sys_Alloc(len);
+		memcpy(m_debugInfo->m_debugName, a_info.m_debugName, len);
+	}
+
+	// symbols
+	if(a_info.m_symbols)
+	{
+		m_debugInfo->m_symbols = (char **) a_machine->Sys_Alloc(sizeof(char *) * m_numParamsLocals);
+		int i;
+		for(i = 0; i < m_numParamsLocals; ++i)
 		{
-			// alloc and copy
-			m_debugInfo->m_lineInfo = (gmLineInfo *) a_machine->Sys_Alloc(sizeof(gmLineInfo) * a_info.m_lineInfoCount);
-			memcpy(m_debugInfo->m_lineInfo, a_info.m_lineInfo, sizeof(gmLineInfo) * a_info.m_lineInfoCount);
-			m_debugInfo->m_lineInfoCount = a_info.m_lineInfoCount;
+			int len = (int)strlen(a_info.m_symbols[i]) + 1;
+			m_debugInfo->m_symbols[i] = (char *) a_machine->Sys_Alloc(len);
+			memcpy(m_debugInfo->m_symbols[i], a_info.m_symbols[i], len);
 		}
 	}
 
-	return true;
+	// line number debugging.
+	if(a_info.m_lineInfo)
+	{
+		// alloc and copy
+		m_debugInfo->m_lineInfo = (gmLineInfo *) a_machine->Sys_Alloc(sizeof(gmLineInfo) * a_info.m_lineInfoCount);
+		memcpy(m_debugInfo->m_lineInfo, a_info.m_lineInfo, sizeof(gmLineInfo) * a_info.m_lineInfoCount);
+		m_debugInfo->m_lineInfoCount = a_info.m_lineInfoCount;
+	}
+}
+
+
+
+void gmFunctionObject::Sys_ExpandDebugInfo()
+{
+	gmSourceEntry * entry = m_packed;
+	m_packed = NULL;
+
+	gmFunctionInfo info;
+	gmArraySimple<const char *> symbols;
+	gmArraySimple<gmLineInfo> lineInfo;
+	entry->Unpack(m_packedOffset, info, symbols, lineInfo);
+	InitDebugInfo(entry->GetMachine(), info, entry->GetId());
+}
+
+
+
+void gmFunctionObject::GetInfo(gmFunctionInfo &a_info, gmArraySimple<const char *> &a_symbols, gmArraySimple<gmLineInfo> &a_lineInfo) const
+{
+	Materialize();
+	a_info.m_id = GetRef();
+	a_info.m_root = false;
+	a_info.m_byteCode = m_byteCode;
+	a_info.m_byteCodeLength = m_byteCodeLength;
+	a_info.m_numParams = m_numParams;
+	a_info.m_numLocals = m_numLocals;
+	a_info.m_numClearLocals = m_numClearLocals;
+	a_info.m_maxStackSize = m_maxStackSize;
+	if(m_packed)
+	{
+		m_packed->Unpack(m_packedOffset, a_info, a_symbols, a_lineInfo);
+		return;
+	}
+	a_info.m_debugName = (m_debugInfo) ? m_debugInfo->m_debugName : NULL;
+	a_info.m_symbols = (m_debugInfo) ? (const char **) m_debugInfo->m_symbols : NULL;
+	a_info.m_lineInfoCount = (m_debugInfo) ? m_debugInfo->m_lineInfoCount : 0;
+	a_info.m_lineInfo = (m_debugInfo) ? m_debugInfo->m_lineInfo : NULL;
 }
 
 
 
 int gmFunctionObject::GetLine(int a_address) const
 {
+	Materialize();
+	if(m_packed)
+	{
+		return m_packed->GetLine(m_packedOffset, a_address);
+	}
 	if(m_debugInfo && m_debugInfo->m_lineInfo)
 	{
 		int i;
@@ -263,6 +417,7 @@ int gmFunctionObject::GetLine(int a_address) const
 
 const void * gmFunctionObject::GetInstructionAtLine(int a_line) const
 {
+	ExpandDebugInfo();
 	if(m_debugInfo && m_debugInfo->m_lineInfo && m_byteCode)
 	{
 		// search for the first address using this line.
@@ -279,6 +434,7 @@ const void * gmFunctionObject::GetInstructionAtLine(int a_line) const
 
 const char * gmFunctionObject::GetSymbol(int a_offset, const char *a_default) const
 {
+	ExpandDebugInfo();
 	if(m_debugInfo && m_debugInfo->m_symbols && (a_offset >= 0) && (a_offset < m_numParamsLocals))
 	{
 		return m_debugInfo->m_symbols[a_offset];
@@ -288,6 +444,7 @@ const char * gmFunctionObject::GetSymbol(int a_offset, const char *a_default) co
 
 const char * gmFunctionObject::GetDebugName() const
 {
+	ExpandDebugInfo();
 	if(m_debugInfo && m_debugInfo->m_debugName)
 	{
 		return m_debugInfo->m_debugName;
@@ -301,6 +458,7 @@ const char * gmFunctionObject::GetDebugName() const
 
 int gmFunctionObject::GetFunctionSourceLine(int a_relativeLine)
 {
+	ExpandDebugInfo();
 	if(m_debugInfo && m_debugInfo->m_lineInfo)
 	{
 		if(a_relativeLine < 0 || a_relativeLine >= m_debugInfo->m_lineInfoCount)
@@ -313,6 +471,11 @@ int gmFunctionObject::GetFunctionSourceLine(int a_relativeLine)
 
 gmuint32 gmFunctionObject::GetSourceId() const
 {
+	Materialize();
+	if(m_packed)
+	{
+		return m_packed->GetId();
+	}
 	if(m_debugInfo)
 	{
 		return m_debugInfo->m_sourceId;
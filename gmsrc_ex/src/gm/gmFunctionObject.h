@@ -16,9 +16,12 @@ See Copyright Notice in gmMachine.h
 #include "gmVariable.h"
 #include "gmCodeGenHooks.h"
 #include "gmMem.h"
+#include "gmArraySimple.h"
 
 // fwd decls
 class gmThread;
+struct gmLibImage;
+class gmSourceEntry;
 
 enum gmCFunctionReturn
 {
@@ -71,6 +74,15 @@ public:
 	*/
 	bool Init(gmMachine * a_machine, bool a_debug, gmFunctionInfo &a_info, gmuint32 a_sourceId = 0);
 
+	/*!
+	\brief Materialize() decodes a function bound lazily from a lib, see gmLibHooks::BindLibImage().
+	       The inline getters below do not, the debug info getters do.
+	*/
+	inline void Materialize() const { if(m_lazy) const_cast<gmFunctionObject *>(this)->Sys_Materialize(); }
+
+	/// \brief Swap() exchanges the body, ie. byte code, stack sizes and debug info, of two script functions.
+	void Swap(gmMachine * a_machine, gmFunctionObject * a_other);
+
 	/*!
 	\brief GetMaxStackSize
 	\return the maximum stack growth not including parameters or locals
@@ -80,6 +92,9 @@ public:
 	/// \brief GetNumLocals
 	inline int GetNumLocals() const { return m_numLocals; }
 
+	/// \brief GetNumClearLocals() returns how many of the first locals a call nulls, the rest are written before they are read.
+	inline int GetNumClearLocals() const { return m_numClearLocals; }
+
 	/// \brief GetNumParams
 	inline int GetNumParams() const { return m_numParams; }
 
@@ -89,6 +104,13 @@ public:
 	/// \brief GetByteCode()
 	inline const void * GetByteCode() const { return m_byteCode; }
 
+	/// \brief GetByteCodeLength()
+	inline int GetByteCodeLength() const { return m_byteCodeLength; }
+
+	/// \brief GetInfo() fills out a_info as Init() would take it, pointing into this function.  Compact debug info
+	///        is unpacked into a_symbols and a_lineInfo, the function keeps it compact.
+	void GetInfo(gmFunctionInfo &a_info, gmArraySimple<const char *> &a_symbols, gmArraySimple<gmLineInfo> &a_lineInfo) const;
+
 	/// \brief GetDebugName()
 	const char * GetDebugName() const;
 
@@ -117,9 +139,17 @@ protected:
 	/// \brief Non-public constructor.  Create via gmMachine.
 	gmFunctionObject();
 	friend class gmMachine;
+	friend class gmLibHooks;
 
 private:
 
+	void Sys_Materialize();
+
+	/// \brief ExpandDebugInfo() unpacks debug info held compact in a gmSourceEntry, see gmMachine::SetCompactDebugInfo().
+	inline void ExpandDebugInfo() const { Materialize(); if(m_packed) const_cast<gmFunctionObject *>(this)->Sys_ExpandDebugInfo(); }
+	void Sys_ExpandDebugInfo();
+	void InitDebugInfo(gmMachine * a_machine, const gmFunctionInfo &a_info, gmuint32 a_sourceId);
+
 	/*!
 	\brief gmFunctionObjectDebugInfo stores debugging info for a debug build
 	*/
@@ -137,10 +167,15 @@ private:
 	int m_byteCodeLength;
 	int m_maxStackSize;
 	int m_numLocals;
+	int m_numClearLocals;
 	int m_numParams;
 	int m_numParamsLocals; //!< m_numLocals + m_numParams
 	int m_numReferences; //!< number of references within the byte code.
 	gmptr * m_references; //!< references from the byte code
+	gmLibImage * m_lazy; //!< lib this stub is still to be decoded from
+	gmuint32 m_lazyIndex; //!< function table entry in m_lazy
+	gmSourceEntry * m_packed; //!< source entry holding this function's debug info while it is compact
+	gmuint32 m_packedOffset; //!< debug info offset in m_packed
 };
 
 //
@@ -17,6 +17,22 @@ See Copyright Notice in gmMachine.h
 
 #define ID_func GM_MAKE_ID32('f','u','n','c')
 #define ID_gml0 GM_MAKE_ID32('g','m','l','0')
+#define ID_gml1 GM_MAKE_ID32('g','m','l','1')
+
+#define GM_LIB_ALIGN        8 // gml1 section and byte code alignment
+
+static void gmLibPad(gmStream &a_stream)
+{
+	static const gmuint8 zeros[GM_LIB_ALIGN] = {0};
+	unsigned int pos = a_stream.Tell();
+	if(pos % GM_LIB_ALIGN) a_stream.Write(zeros, GM_LIB_ALIGN - (pos % GM_LIB_ALIGN));
+}
+
+
+static inline gmuint32 gmLibAlign(gmuint32 a_pos)
+{
+	return (a_pos + (GM_LIB_ALIGN - 1)) & ~(GM_LIB_ALIGN - 1);
+}
 
 
 gmLibHooks::gmLibHooks(gmStream &a_stream, const char * a_source) :
@@ -40,24 +56,77 @@ bool gmLibHooks::Begin(bool a_debug)
 	m_functionId = 0;
 	m_functionStream.Reset();
 	m_functionStream.SetSwapEndianOnWrite(m_swapEndian);
+	m_tableStream.Reset();
 	return true;
 }
 
 
 bool gmLibHooks::AddFunction(gmFunctionInfo &a_info)
 {
-	// write the function into the stream
-	m_functionStream << (gmuint32) ID_func;
-	m_functionStream << (gmuint32) a_info.m_id;
-	m_functionStream << (gmuint32) ((a_info.m_root) ? 1 : 0);
-	m_functionStream << (gmuint32) a_info.m_numParams;
-	m_functionStream << (gmuint32) a_info.m_numLocals;
-	m_functionStream << (gmuint32) a_info.m_maxStackSize;
-	m_functionStream << (gmuint32) a_info.m_byteCodeLength;
+	// byte code
+	gmLibPad(m_functionStream);
+	gmuint32 byteCodeOffset = m_functionStream.Tell();
 	m_functionStream.Write(a_info.m_byteCode, a_info.m_byteCodeLength);
 
+	// relocations, found here once rather than by every load
+	gmuint32 relocOffset = m_functionStream.Tell(), numRelocs = 0;
+	union
+	{
+		const gmuint8 * instruction;
+		const gmuint32 * instruction32;
+	};
+	instruction = (const gmuint8 *) a_info.m_byteCode;
+	const gmuint8 * end = instruction + a_info.m_byteCodeLength;
+	while(instruction < end)
+	{
+		gmuint32 opcode = *(instruction32++);
+		if(m_swapEndian) opcode = (opcode >> 24) | ((opcode >> 8) & 0xff00) | ((opcode << 8) & 0xff0000) | (opcode << 24);
+		gmuint32 kind = 0;
+		switch(opcode)
+		{
+		case BC_BRA :
+		case BC_BRZ :
+		case BC_BRNZ :
+		case BC_BRZK :
+		case BC_BRNZK : instruction += sizeof(gmptr); continue;
+#if GM_USE_FORK
+		case BC_FORK : instruction += sizeof(gmptr); continue;
+#endif //GM_USE_FORK
+		case BC_FOREACH :
+		case BC_PUSHINT : instruction += sizeof(gmint); continue;
+		case BC_PUSHFP : instruction += sizeof(gmfloat); continue;
+
+		case BC_CALL :
+		case BC_TAILCALL :
+		case BC_GETLOCAL :
+		case BC_SETLOCAL : instruction += sizeof(gmuint32); continue;
+
+		case BC_GETDOT :
+		case BC_GETDOTX :
+		case BC_GETDOTY :
+		case BC_GETDOTZ :
+		case BC_SETDOT :
+		case BC_GETTHIS :
+		case BC_SETTHIS :
+		case BC_GETGLOBAL :
+		case BC_SETGLOBAL : kind = GM_LIB_RELOC_SYMBOL; break;
+		case BC_PUSHSTR : kind = GM_LIB_RELOC_STRING; break;
+		case BC_PUSHFN : kind = GM_LIB_RELOC_FUNCTION; break;
+
+		default : continue;
+		}
+		gmuint32 offset = (gmuint32) (instruction - (const gmuint8 *) a_info.m_byteCode);
+		m_functionStream << (gmuint32) ((offset << 2) | kind);
+		instruction += sizeof(gmptr);
+		++numRelocs;
+	}
+
+	// debug info
+	gmuint32 debugOffset = 0;
 	if(m_debug)
 	{
+		debugOffset = m_functionStream.Tell();
+
 		int numSymbols = a_info.m_numLocals + a_info.m_numParams, i;
 
 		// debug name
@@ -84,6 +153,19 @@ bool gmLibHooks::AddFunction(gmFunctionInfo &a_info)
 			}
 		}
 	}
+
+	// table entry, offsets are fixed up by End(), kept native endian until then
+	gmuint32 flags = (a_info.m_root) ? 1 : 0;
+	if(a_info.m_numClearLocals >= 0 && a_info.m_numClearLocals < a_info.m_numLocals && a_info.m_numClearLocals <= 0xffff)
+	{
+		flags |= 2 | ((gmuint32) a_info.m_numClearLocals << 16);
+	}
+	gmuint32 entry[] = 
+	{
+		(gmuint32) a_info.m_id, flags, (gmuint32) a_info.m_numParams, (gmuint32) a_info.m_numLocals, 
+		(gmuint32) a_info.m_maxStackSize, (gmuint32) a_info.m_byteCodeLength, byteCodeOffset, relocOffset, numRelocs, debugOffset
+	};
+	m_tableStream.Write(entry, sizeof(entry));
 	return true;
 }
 
@@ -92,52 +174,59 @@ bool gmLibHooks::End(int a_errors)
 {
 	if(a_errors == 0)
 	{
-		gmuint32 offsets[3] = {0}, offsetPos;
-
-		gmuint32 t = ID_gml0, t1 = 0;
-		*m_stream << t;
-		t = (m_debug) ? 1 : 0;
-		*m_stream << t;
+		const unsigned int entrySize = 10 * sizeof(gmuint32);
+		gmuint32 numFunctions = m_tableStream.GetSize() / entrySize;
+		gmuint32 header[8] = {0};
+		gmuint32 headerPos = m_stream->Tell(), i;
 
-		offsetPos = m_stream->Tell();
-		*m_stream << offsets[0] << offsets[1] << offsets[2];
+		header[0] = ID_gml1;
+		header[1] = (m_debug) ? 1 : 0;
+		for(i = 0; i < 8; ++i) *m_stream << header[i];
 
 		// write the string table
-		offsets[0] = m_stream->Tell();
-		t = m_symbolOffset;
-		*m_stream << t;
+		gmLibPad(*m_stream);
+		header[2] = m_stream->Tell() - headerPos;
+		header[3] = m_symbolOffset;
 		USymbol * symbol = m_symbols.GetLast();
 		while(m_symbols.IsValid(symbol))
 		{
 			m_stream->Write(symbol->m_string, (unsigned int)strlen(symbol->m_string) + 1);
 			symbol = m_symbols.GetPrev(symbol);
 		}
-		GM_ASSERT(m_stream->Tell() == m_symbolOffset + offsets[0] + sizeof(gmuint32));
+		GM_ASSERT(m_stream->Tell() - headerPos == header[2] + header[3]);
 
 		// write the source code
 		if(m_debug && m_source)
 		{
-			offsets[1] = m_stream->Tell();
-			t = (gmuint32)strlen(m_source) + 1;
-			t1 = 0;
-			*m_stream << t << t1;
-			m_stream->Write(m_source, t);
+			gmLibPad(*m_stream);
+			header[4] = m_stream->Tell() - headerPos;
+			header[5] = (gmuint32)strlen(m_source) + 1;
+			m_stream->Write(m_source, header[5]);
 		}
-		else
+
+		// write the function table then the functions it points into
+		gmLibPad(*m_stream);
+		header[6] = m_stream->Tell() - headerPos;
+		header[7] = numFunctions;
+		gmuint32 base = gmLibAlign(header[6] + numFunctions * entrySize);
+		const gmuint32 * entry = (const gmuint32 *) m_tableStream.GetData();
+		for(i = 0; i < numFunctions; ++i, entry += 10)
 		{
-			offsets[1] = 0;
+			*m_stream << entry[0] << entry[1] << entry[2] << entry[3] << entry[4] << entry[5];
+			*m_stream << (gmuint32) (base + entry[6]) << (gmuint32) (base + entry[7]) << entry[8];
+			*m_stream << (gmuint32) ((entry[9]) ? base + entry[9] : 0);
 		}
-
-		// write the functions
-		offsets[2] = m_stream->Tell();
-		t = m_functionId;
-		*m_stream << t;
+		gmLibPad(*m_stream);
+		GM_ASSERT(m_stream->Tell() - headerPos == base);
 		m_stream->Write(m_functionStream.GetData(), m_functionStream.GetSize());
 		m_functionStream.ResetAndFreeMemory();
+		m_tableStream.ResetAndFreeMemory();
 
-		// write the offsets
-		m_stream->Seek(offsetPos);
-		*m_stream << offsets[0] << offsets[1] << offsets[2];
+		// write the header
+		unsigned int endPos = m_stream->Tell();
+		m_stream->Seek(headerPos);
+		for(i = 0; i < 8; ++i) *m_stream << header[i];
+		m_stream->Seek(endPos);
 
 		return true;
 	}
@@ -230,6 +319,34 @@ struct gmlFunction
 
 gmFunctionObject * gmLibHooks::BindLib(gmMachine &a_machine, gmStream &a_stream, const char * a_filename)
 {
+	// 'gml1' libs are bound from memory in one piece
+	{
+		gmuint32 id = 0;
+		a_stream.Seek(0);
+		if(a_stream.Read(&id, sizeof(id)) == sizeof(id) && id == ID_gml1)
+		{
+			unsigned int size = a_stream.GetSize();
+			if(size == (unsigned int) gmStream::ILLEGAL_POS)
+			{
+				a_machine.GetLog().LogEntry("Error loading library");
+				return NULL;
+			}
+			gmFunctionObject * rootFunction = NULL;
+			char * image = GM_NEW( char[size] );
+			a_stream.Seek(0);
+			if(a_stream.Read(image, size) == size)
+			{
+				rootFunction = BindLibImage(a_machine, image, size, a_filename);
+			}
+			else
+			{
+				a_machine.GetLog().LogEntry("Error loading library");
+			}
+			delete[] image;
+			return rootFunction;
+		}
+	}
+
 	gmlHeader header;
 	gmlStrings strings;
 	gmlSource source;
@@ -313,16 +430,23 @@ gmFunctionObject * gmLibHooks::BindLib(gmMachine &a_machine, gmStream &a_stream,
 			case BC_BRZ :
 			case BC_BRNZ :
 			case BC_BRZK :
-			case BC_BRNZK :
-			case BC_FOREACH : instruction += sizeof(gmptr); break;
+			case BC_BRNZK : instruction += sizeof(gmptr); break;
+#if GM_USE_FORK
+			case BC_FORK : instruction += sizeof(gmptr); break;
+#endif //GM_USE_FORK
+			case BC_FOREACH :
 			case BC_PUSHINT : instruction += sizeof(gmint); break;
 			case BC_PUSHFP : instruction += sizeof(gmfloat); break;
 
 			case BC_CALL :
+			case BC_TAILCALL :
 			case BC_GETLOCAL :
 			case BC_SETLOCAL : instruction += sizeof(gmuint32); break;
 
 			case BC_GETDOT :
+			case BC_GETDOTX :
+			case BC_GETDOTY :
+			case BC_GETDOTZ :
 			case BC_SETDOT :
 			case BC_GETTHIS :
 			case BC_SETTHIS :
@@ -366,6 +490,7 @@ gmFunctionObject * gmLibHooks::BindLib(gmMachine &a_machine, gmStream &a_stream,
 		functionInfo.m_byteCodeLength = function.m_byteCodeLen;
 		functionInfo.m_numParams = function.m_numParams;
 		functionInfo.m_numLocals = function.m_numLocals;
+		functionInfo.m_numClearLocals = function.m_numLocals;
 		functionInfo.m_maxStackSize = function.m_maxStackSize;
 		functionInfo.m_symbols = NULL;
 		functionInfo.m_lineInfo = NULL;
@@ -441,3 +566,270 @@ done:
 	return functionObject;
 }
 
+
+// Check a function's byte code, relocations and debug info lie within the image, so binding it can not fail
+static bool gmLibCheckFunction(const gmlHeader1 * a_header, const gmuint8 * a_image, unsigned int a_size, const gmlFunction1 &a_function, bool a_debug)
+{
+	gmuint32 j;
+	if(a_function.m_id >= a_header->m_numFunctions) { return false; }
+	if(a_function.m_byteCodeOffset > a_size || a_function.m_byteCodeLen > a_size - a_function.m_byteCodeOffset) { return false; }
+	if(a_function.m_relocOffset > a_size || a_function.m_numRelocs > (a_size - a_function.m_relocOffset) / sizeof(gmuint32)) { return false; }
+
+	const gmuint32 * reloc = (const gmuint32 *) (a_image + a_function.m_relocOffset);
+	for(j = 0; j < a_function.m_numRelocs; ++j)
+	{
+		gmuint32 offset = reloc[j] >> 2;
+		if(offset + sizeof(gmptr) > a_function.m_byteCodeLen) { return false; }
+		gmptr reference = *((const gmptr *) (a_image + a_function.m_byteCodeOffset + offset));
+		switch(reloc[j] & 3)
+		{
+		case GM_LIB_RELOC_SYMBOL :
+		case GM_LIB_RELOC_STRING :
+			if(reference < 0 || reference >= (gmptr) a_header->m_stSize) { return false; }
+			break;
+		case GM_LIB_RELOC_FUNCTION :
+			if(reference < 0 || reference >= (gmptr) a_header->m_numFunctions) { return false; }
+			break;
+		default : return false;
+		}
+	}
+
+	if(a_debug && a_function.m_debugOffset)
+	{
+		gmuint32 numSymbols = a_function.m_numLocals + a_function.m_numParams;
+		if(a_function.m_debugOffset > a_size - 2 * sizeof(gmuint32)) { return false; }
+		const gmuint32 * info = (const gmuint32 *) (a_image + a_function.m_debugOffset);
+		if((a_size - a_function.m_debugOffset) / sizeof(gmuint32) < 2 + 2 * (gmuint64) info[1] + numSymbols) { return false; }
+		if(info[0] >= a_header->m_stSize) { return false; }
+	}
+	return true;
+}
+
+
+bool gmLibHooks::CheckLibImage(const void * a_image, unsigned int a_size)
+{
+	const gmuint8 * image = (const gmuint8 *) a_image;
+	const gmlHeader1 * header = (const gmlHeader1 *) a_image;
+
+	// Check the header and the sections lie within the image
+	if(a_size < sizeof(gmlHeader1) || header->m_id != ID_gml1) { return false; }
+	if(header->m_stSize == 0 || header->m_stOffset > a_size || header->m_stSize > a_size - header->m_stOffset) { return false; }
+	if(header->m_fnOffset > a_size || header->m_numFunctions > (a_size - header->m_fnOffset) / sizeof(gmlFunction1)) { return false; }
+	if(header->m_scOffset && (header->m_scOffset > a_size || header->m_scSize == 0 || header->m_scSize > a_size - header->m_scOffset)) { return false; }
+	if(image[header->m_stOffset + header->m_stSize - 1] != '\0') { return false; }
+	if(header->m_scOffset && image[header->m_scOffset + header->m_scSize - 1] != '\0') { return false; }
+
+	const gmlFunction1 * functions = (const gmlFunction1 *) (image + header->m_fnOffset);
+	for(gmuint32 i = 0; i < header->m_numFunctions; ++i)
+	{
+		if(!gmLibCheckFunction(header, image, a_size, functions[i], (header->m_flags & 1) != 0)) { return false; }
+	}
+	return true;
+}
+
+
+void gmLibImage::Bind(gmuint32 a_index, gmuint8 * a_byteCode)
+{
+	const gmlHeader1 * header = (const gmlHeader1 *) m_image;
+	const gmlFunction1 &function = ((const gmlFunction1 *) (m_image + header->m_fnOffset))[a_index];
+	const char * stringTable = (const char *) m_image + header->m_stOffset;
+	gmuint32 j;
+
+	// Patch a copy, or the image itself when it is ours as each function is only bound once
+	gmuint8 * byteCode = (gmuint8 *) m_image + function.m_byteCodeOffset;
+	if(a_byteCode)
+	{
+		memcpy(a_byteCode, byteCode, function.m_byteCodeLen);
+		byteCode = a_byteCode;
+	}
+
+	// Patch references through the relocation list
+	const gmuint32 * reloc = (const gmuint32 *) (m_image + function.m_relocOffset);
+	for(j = 0; j < function.m_numRelocs; ++j)
+	{
+		gmptr * reference = (gmptr *) (byteCode + (reloc[j] >> 2));
+		switch(reloc[j] & 3)
+		{
+		case GM_LIB_RELOC_SYMBOL :
+			*reference = m_machine->AllocPermanantStringObject(&stringTable[*reference])->GetRef();
+			break;
+		case GM_LIB_RELOC_STRING :
+			*reference = m_machine->AllocStringObject(&stringTable[*reference])->GetRef();
+			break;
+		default :
+			*reference = m_functionObjects[*reference]->GetRef();
+			break;
+		}
+	}
+
+	// Initialise our function object.
+	gmFunctionInfo functionInfo;
+	gmFunctionObject * currFunction = m_functionObjects[function.m_id];
+	functionInfo.m_id = currFunction->GetRef();
+	functionInfo.m_root = (function.m_flags & 1);
+	functionInfo.m_byteCode = byteCode;
+	functionInfo.m_byteCodeLength = function.m_byteCodeLen;
+	functionInfo.m_numParams = function.m_numParams;
+	functionInfo.m_numLocals = function.m_numLocals;
+	functionInfo.m_numClearLocals = (function.m_flags & 2) ? (int) (function.m_flags >> 16) : (int) function.m_numLocals;
+	functionInfo.m_maxStackSize = function.m_maxStackSize;
+	functionInfo.m_debugName = NULL;
+	functionInfo.m_symbols = NULL;
+	functionInfo.m_lineInfoCount = 0;
+	functionInfo.m_lineInfo = NULL;
+
+	// Debug info points straight into the image
+	if(m_debug && function.m_debugOffset)
+	{
+		gmuint32 numSymbols = function.m_numLocals + function.m_numParams;
+		const gmuint32 * info = (const gmuint32 *) (m_image + function.m_debugOffset);
+		functionInfo.m_debugName = &stringTable[info[0]];
+		functionInfo.m_lineInfoCount = info[1];
+		functionInfo.m_lineInfo = (const gmLineInfo *) (info + 2);
+		info += 2 + 2 * info[1];
+		for(j = 0; j < numSymbols; ++j)
+		{
+			m_symbols[j] = (info[j] < header->m_stSize) ? &stringTable[info[j]] : "";
+		}
+		functionInfo.m_symbols = m_symbols;
+	}
+
+	// AND FINALLY, INITIALISE OUR FUNCTION
+	currFunction->Init(m_machine, m_debug && m_machine->GetDebugMode(), functionInfo, m_sourceCodeId);
+}
+
+
+gmFunctionObject * gmLibImage::GetFunctionReference(gmuint32 a_index, gmuint32 &a_reloc) const
+{
+	const gmlHeader1 * header = (const gmlHeader1 *) m_image;
+	const gmlFunction1 &function = ((const gmlFunction1 *) (m_image + header->m_fnOffset))[a_index];
+	const gmuint32 * reloc = (const gmuint32 *) (m_image + function.m_relocOffset);
+
+	// the stub's byte code is not patched yet, so function references are still table indices
+	while(a_reloc < function.m_numRelocs)
+	{
+		gmuint32 entry = reloc[a_reloc++];
+		if((entry & 3) == GM_LIB_RELOC_FUNCTION)
+		{
+			return m_functionObjects[*((const gmptr *) (m_image + function.m_byteCodeOffset + (entry >> 2)))];
+		}
+	}
+	return NULL;
+}
+
+
+void gmLibImage::Release()
+{
+	GM_ASSERT(m_numLazy > 0);
+	if(--m_numLazy == 0)
+	{
+		delete[] (gmuint8 *) m_image;
+		delete[] m_functionObjects;
+		if(m_symbols) { delete[] m_symbols; }
+		delete this;
+	}
+}
+
+
+gmFunctionObject * gmLibHooks::BindLibImage(gmMachine &a_machine, const void * a_image, unsigned int a_size, const char * a_filename, bool a_lazy)
+{
+	const gmuint8 * image = (const gmuint8 *) a_image;
+	const gmlHeader1 * header = (const gmlHeader1 *) a_image;
+	const gmlFunction1 * functions;
+	gmFunctionObject * functionObject = NULL;
+	gmLibImage lib;
+	gmuint8 * byteCode = NULL;
+	bool error = true, debug;
+	gmuint32 i, maxByteCodeLen = 0, maxSymbols = 0;
+
+	memset(&lib, 0, sizeof(lib));
+
+	// Turn garbage collection off.
+	bool gc = a_machine.IsGCEnabled();
+	a_machine.EnableGC(false);
+
+	// Check the image, it is trusted beyond that
+	if(!CheckLibImage(a_image, a_size)) { goto done; }
+	debug = (header->m_flags & 1);
+	functions = (const gmlFunction1 *) (image + header->m_fnOffset);
+
+	for(i = 0; i < header->m_numFunctions; ++i)
+	{
+		const gmlFunction1 &function = functions[i];
+		if(function.m_byteCodeLen > maxByteCodeLen) maxByteCodeLen = function.m_byteCodeLen;
+		if(function.m_numParams + function.m_numLocals > maxSymbols) maxSymbols = function.m_numParams + function.m_numLocals;
+	}
+
+	// Read the source code 
+	if(header->m_scOffset && a_machine.GetDebugMode())
+	{
+		lib.m_sourceCodeId = a_machine.AddSourceCode((const char *) image + header->m_scOffset, a_filename);
+	}
+
+	// Allocate n function objects
+	lib.m_machine = &a_machine;
+	lib.m_image = image;
+	lib.m_numFunctions = header->m_numFunctions;
+	lib.m_debug = debug;
+	lib.m_functionObjects = GM_NEW( gmFunctionObject *[header->m_numFunctions + 1] );
+	for(i = 0; i < header->m_numFunctions; ++i)
+	{
+		lib.m_functionObjects[i] = a_machine.AllocFunctionObject();
+	}
+	if(debug) lib.m_symbols = GM_NEW( const char *[maxSymbols + 1] );
+
+	if(a_lazy && header->m_numFunctions)
+	{
+		// Each function is a stub holding a copy of the image until it is first called or inspected
+		gmLibImage * lazy = GM_NEW( gmLibImage(lib) );
+		gmuint8 * copy = GM_NEW( gmuint8[a_size] );
+		memcpy(copy, a_image, a_size);
+		lazy->m_image = copy;
+		lazy->m_numLazy = header->m_numFunctions;
+		lib.m_functionObjects = NULL;
+		lib.m_symbols = NULL;
+
+		for(i = 0; i < header->m_numFunctions; ++i)
+		{
+			lazy->m_functionObjects[i]->m_lazy = lazy;
+			lazy->m_functionObjects[i]->m_lazyIndex = GM_LIB_NO_FUNCTION;
+		}
+		for(i = 0; i < header->m_numFunctions; ++i)
+		{
+			lazy->m_functionObjects[functions[i].m_id]->m_lazyIndex = i;
+			if(functions[i].m_flags & 1)
+			{
+				functionObject = lazy->m_functionObjects[functions[i].m_id];
+			}
+		}
+	}
+	else
+	{
+		// Load each function through one buffer to patch byte code in.
+		byteCode = GM_NEW( gmuint8[maxByteCodeLen + sizeof(gmptr)] );
+		for(i = 0; i < header->m_numFunctions; ++i)
+		{
+			lib.Bind(i, byteCode);
+			if(functions[i].m_flags & 1)
+			{
+				functionObject = lib.m_functionObjects[functions[i].m_id];
+			}
+		}
+	}
+
+	error = false;
+
+done:
+
+	a_machine.EnableGC(gc);
+	if(lib.m_functionObjects) { delete[] lib.m_functionObjects; }
+	if(lib.m_symbols) { delete[] lib.m_symbols; }
+	if(byteCode) { delete[] byteCode; }
+
+	if(error)
+	{
+		a_machine.GetLog().LogEntry("Error loading library");
+		return NULL;
+	}
+	return functionObject;
+}
@@ -19,6 +19,66 @@ See Copyright Notice in gmMachine.h
 class gmMachine;
 class gmFunctionObject;
 
+#define GM_LIB_NO_FUNCTION 0xffffffff // lazy function without a function table entry
+
+/// \brief gmlHeader1 is the header of a 'gml1' lib, see the format below.
+struct gmlHeader1
+{
+	gmuint32 m_id;
+	gmuint32 m_flags;
+	gmuint32 m_stOffset;
+	gmuint32 m_stSize;
+	gmuint32 m_scOffset;
+	gmuint32 m_scSize;
+	gmuint32 m_fnOffset;
+	gmuint32 m_numFunctions;
+};
+
+/// \brief gmlFunction1 is a 'gml1' function table entry.
+struct gmlFunction1
+{
+	gmuint32 m_id;
+	gmuint32 m_flags;
+	gmuint32 m_numParams;
+	gmuint32 m_numLocals;
+	gmuint32 m_maxStackSize;
+	gmuint32 m_byteCodeLen;
+	gmuint32 m_byteCodeOffset;
+	gmuint32 m_relocOffset;
+	gmuint32 m_numRelocs;
+	gmuint32 m_debugOffset;
+};
+
+/// \brief gmlRelocation is the kind in the low 2 bits of a 'gml1' relocation.
+enum gmlRelocation
+{
+	GM_LIB_RELOC_SYMBOL = 0,
+	GM_LIB_RELOC_STRING,
+	GM_LIB_RELOC_FUNCTION,
+};
+
+/// \struct gmLibImage
+/// \brief gmLibImage is a 'gml1' lib being bound.  When bound lazily it is shared by the stub functions until
+///        each has been decoded or destructed.
+struct gmLibImage
+{
+	gmMachine * m_machine;
+	const gmuint8 * m_image;
+	gmuint32 m_numFunctions;
+	gmFunctionObject ** m_functionObjects; ///< indexed by function id
+	const char ** m_symbols; ///< scratch for debug symbol names
+	gmuint32 m_sourceCodeId;
+	gmuint32 m_numLazy; ///< stubs left, the image is freed at 0
+	bool m_debug;
+
+	/// \brief Bind() initialises the function for table entry a_index, patching a copy in a_byteCode, or in place if NULL.
+	void Bind(gmuint32 a_index, gmuint8 * a_byteCode);
+	/// \brief GetFunctionReference() returns the next function table entry a_index refers to, from relocation a_reloc on, or NULL.
+	gmFunctionObject * GetFunctionReference(gmuint32 a_index, gmuint32 &a_reloc) const;
+	/// \brief Release() is called by each stub as it is decoded or destructed.
+	void Release();
+};
+
 /// \class gmLibHooks
 /// \brief gmLibHooks is a compiler hook class that allows compiling to a lib for disk storage.
 class gmLibHooks : public gmCodeGenHooks
@@ -40,6 +100,14 @@ public:
 	/// \brief BindLib will bind the lib to the machine, and return the root function for executing.
 	static gmFunctionObject * BindLib(gmMachine &a_machine, gmStream &a_stream, const char * a_filename);
 
+	/// \brief CheckLibImage will check a 'gml1' lib's sections, byte code relocations and debug info lie within the image.
+	static bool CheckLibImage(const void * a_image, unsigned int a_size);
+
+	/// \brief BindLibImage will bind a 'gml1' lib held in memory, eg. a mapped file, without copying it first.
+	///        The image is only read during the call.
+	/// \param a_lazy leaves each function a stub, decoded from a copy of the image on its first call or inspection.
+	static gmFunctionObject * BindLibImage(gmMachine &a_machine, const void * a_image, unsigned int a_size, const char * a_filename, bool a_lazy = false);
+
 private:
 
 	class USymbol : public gmListDoubleNode<USymbol>
@@ -57,14 +125,57 @@ private:
 	const char * m_source;
 	gmuint32 m_symbolOffset;
 	gmuint32 m_functionId;
-	gmStreamBufferDynamic m_functionStream;
+	gmStreamBufferDynamic m_functionStream; ///< function byte code, relocations and debug info
+	gmStreamBufferDynamic m_tableStream; ///< function table entries, offsets relative to m_functionStream
 	gmListDouble<USymbol> m_symbols;
 	gmMemChain m_allocator;
 };
 
 /*
 
-Library file format for .gmlib files (gm library files) (native endian)
+Library file format 'gml1' for .gmlib files (gm library files) (native endian)
+
+Every section starts on an 8 byte boundary.  Byte code is stored exactly as compiled with string table
+offsets and function ids in its operands, the relocation list says where they are so the loader patches
+a copy without decoding instructions.  A lib may be bound straight from memory, or lazily
+function by function, see BindLibImage().
+
+// header
+
+'gml1'                      [4 bytes]
+flags                       [4 bytes]  // 0x01 - debug lib
+string_table_offset         [4 bytes]  // relative to start of lib
+string_table_size           [4 bytes]  // 0 terminated strings
+source_code_offset          [4 bytes]  // 0 for not there
+source_code_size            [4 bytes]  // including terminator
+function_table_offset       [4 bytes]
+num_functions               [4 bytes]
+
+function_table[]             // num_functions entries
+{
+function_id               [4 bytes] // BC_PUSHFN operands reference this id
+flags                     [4 bytes] // 0x01 - is root, 0x02 - only the first (flags >> 16) locals are read before they are written
+num_params                [4 bytes]
+num_locals                [4 bytes]
+max_stack_size            [4 bytes]
+byte_code_length          [4 bytes]
+byte_code_offset          [4 bytes] // relative to start of lib, 8 byte aligned
+relocation_offset         [4 bytes]
+num_relocations           [4 bytes]
+debug_offset              [4 bytes] // 0 for a non debug lib
+}
+
+relocation                  [4 bytes] // (byte code offset << 2) | kind, kind 0 - symbol, 1 - string, 2 - function id
+
+debug_info
+{
+debug_name_offset         [4 bytes]
+line_info_count           [4 bytes]
+line_info[]               [8 bytes] // byte code address, line number
+symbol_name_offsets[]     [4 bytes] * (num_params + num_locals) (~0) on no offset
+}
+
+Library file format 'gml0', still loaded by BindLib()
 
 // header
 
@@ -25,6 +25,7 @@ See Copyright Notice in gmMachine.h
 #include "gmCrc.h"
 #include "gmStream.h"
 #include "gmLibHooks.h"
+#include "gmSourceEntry.h"
 
 
 #if GM_USE_INCGC
@@ -68,39 +69,6 @@ private:
 	gmuint32 m_sourceId;
 };
 
-//
-//
-// Implementation of gmSourceEntry, used for storing source code in debug mode
-//
-//
-
-class gmSourceEntry : public gmListDoubleNode<gmSourceEntry>
-{
-public:
-
-	gmSourceEntry(const char * a_source, const char * a_filename)
-	{
-		int slen = (int)strlen(a_source);
-		int flen = (int)strlen(a_filename);
-		m_id = gmCrc32String(a_source);
-
-		m_source = GM_NEW( char[slen + flen + 2] );
-		memcpy(m_source, a_source, slen + 1);
-		m_filename = m_source + slen + 1;
-		memcpy(m_filename, a_filename, flen + 1);
-	}
-
-	~gmSourceEntry()
-	{
-		if(m_source) 
-			delete[] m_source;
-	}
-
-	gmuint32 m_id;
-	char * m_source;
-	char * m_filename;
-};
-
 //
 //
 // Implementation of gmBlock, gmSignal, gmBlocklist for thread blocking 
@@ -150,13 +118,14 @@ void GM_CDECL gmMachine::ScanRootsCallBack(gmMachine* a_machine, gmGarbageCollec
 	gmThread * tit;
 
 	// call the gc callback
-	if(s_machineCallback) s_machineCallback(a_machine, MC_COLLECT_GARBAGE, NULL);
+	gmMachineCallback machineCallback = a_machine->GetMachineCallback();
+	if(machineCallback) machineCallback(a_machine, MC_COLLECT_GARBAGE, NULL);
 
 	// iterate cpp owned gmObjects
-	gmHash<gmObject*, ObjHashNode>::Iterator cgmoIt;
-	for(cgmoIt = a_machine->m_cppOwnedGMObjs.First(); cgmoIt; ++cgmoIt)
+	gmObject * const * roots = a_machine->m_roots.GetObjects();
+	for(gmuint i = a_machine->m_roots.GetCount(); i--;)
 	{
-		gmObject* curObj = cgmoIt->m_obj;
+		gmObject* curObj = roots[i];
 		a_gc->GetNextObject(curObj);
 	}
 
@@ -165,6 +134,9 @@ void GM_CDECL gmMachine::ScanRootsCallBack(gmMachine* a_machine, gmGarbageCollec
 	for(tit = a_machine->m_blockedThreads.GetFirst(); a_machine->m_blockedThreads.IsValid(tit); tit = a_machine->m_blockedThreads.GetNext(tit)) tit->GCScanRoots(a_machine, a_gc);
 	for(tit = a_machine->m_sleepingThreads.GetFirst(); a_machine->m_sleepingThreads.IsValid(tit); tit = a_machine->m_sleepingThreads.GetNext(tit)) tit->GCScanRoots(a_machine, a_gc);
 	for(tit = a_machine->m_exceptionThreads.GetFirst(); a_machine->m_exceptionThreads.IsValid(tit); tit = a_machine->m_exceptionThreads.GetNext(tit)) tit->GCScanRoots(a_machine, a_gc);
+	for(tit = a_machine->m_callThreads.GetFirst(); a_machine->m_callThreads.IsValid(tit); tit = a_machine->m_callThreads.GetNext(tit)) tit->GCScanRoots(a_machine, a_gc);
+	for(tit = a_machine->m_killedThreads.GetFirst(); a_machine->m_killedThreads.IsValid(tit); tit = a_machine->m_killedThreads.GetNext(tit)) tit->Sys_SetStale();
+	for(tit = a_machine->m_idleCallThreads.GetFirst(); a_machine->m_idleCallThreads.IsValid(tit); tit = a_machine->m_idleCallThreads.GetNext(tit)) tit->Sys_SetStale();
 
 	// iterate over global variables and mark
 	if(a_machine->m_global)
@@ -235,8 +207,14 @@ m_cppOwnedGMObjs(GMMACHINE_CPPOWNEDGMOBJHASHSIZE)
 	m_statsGCWarnings = 0;
 
 	m_debug = false;
+	m_compactDebugInfo = false;
 	m_debugUser = NULL;
 
+	m_machineCallback = NULL;
+	m_printCallback = NULL;
+	m_userBreakCallback = NULL;
+	m_executeFileCallback = NULL;
+
 	m_gcEnabled = true;
 
 	m_global = AllocTableObject(); // Alloc global table
@@ -311,6 +289,8 @@ void gmMachine::ResetAndFreeMemory()
 	m_exceptionThreads.RemoveAll();
 	m_killedThreads.RemoveAndDeleteAll();
 	m_deletedThreads.RemoveAndDeleteAll();
+	m_callThreads.RemoveAndDeleteAll();
+	m_idleCallThreads.RemoveAndDeleteAll();
 	m_threads.RemoveAndDeleteAll();
 	m_threadId = 0;
 	m_time = 0;
@@ -320,6 +300,7 @@ void gmMachine::ResetAndFreeMemory()
 
 	// CPP owned gmObjects
 	m_cppOwnedGMObjs.RemoveAll();
+	m_roots.RemoveAll();
 
 	// memory allocators (make sure we arent leaking memory)
 
@@ -342,6 +323,7 @@ void gmMachine::ResetAndFreeMemory()
 	m_fixedSet.ResetAndFreeMemory();
 
 	m_debug = false;
+	m_compactDebugInfo = false;
 	m_debugUser = NULL;
 	m_source.RemoveAndDeleteAll();
 
@@ -351,8 +333,8 @@ void gmMachine::ResetAndFreeMemory()
 	// compiler
 	m_log.ResetAndFreeMemory();
 #if !GMMACHINE_REMOVECOMPILER
-	gmCodeTree::Get().FreeMemory();
-	gmCodeGen::Get().FreeMemory();
+	gmCodeTree::Release();
+	gmCodeGen::Release();
 #endif //GMMACHINE_REMOVECOMPILER
 
 	// garbage collection
@@ -379,6 +361,7 @@ void gmMachine::Init()
 	ResetDefaultTypes();
 	m_blocks.RemoveAll();
 	m_cppOwnedGMObjs.RemoveAll();
+	m_roots.RemoveAll();
 	m_time = 0;
 
 	m_debug = false;
@@ -543,6 +526,16 @@ const char * gmMachine::GetTypeName(gmType a_type)
 	return "";
 }
 
+pfnExecuteFileImpl gmMachine::GetExecuteFileCallback() const
+{
+	return m_executeFileCallback ? m_executeFileCallback : gmImportExecuteFile;
+}
+
+void gmMachine::RegisterTypeRawIndex(gmType a_type, gmRawIndex a_rawIndex)
+{
+	m_types[a_type].m_rawIndex = (gmuint8) a_rawIndex;
+}
+
 #if GM_USER_FOREACH
 bool gmMachine::RegisterTypeIterator(gmType a_type, gmTypeIteratorCallback a_callback)
 {
@@ -770,6 +763,12 @@ gmFunctionObject * gmMachine::BindLibToFunction(gmStream &a_stream, const char *
 }
 
 
+gmFunctionObject * gmMachine::BindLibToFunction(const void * a_image, unsigned int a_size, const char * a_filename, bool a_lazy)
+{
+	return gmLibHooks::BindLibImage(*this, a_image, a_size, a_filename, a_lazy);
+}
+
+
 gmThread * gmMachine::CreateThread(const gmVariable &a_this, const gmVariable &a_function, int * a_threadId)
 {
 	gmThread * thread = CreateThread(a_threadId);
@@ -783,9 +782,10 @@ gmThread * gmMachine::CreateThread(const gmVariable &a_this, const gmVariable &a
 void gmMachine::Sys_SignalCreateThread(gmThread * a_thread)
 {
 	// Send create thread message
-	if(s_machineCallback)
+	gmMachineCallback machineCallback = GetMachineCallback();
+	if(machineCallback)
 	{
-		s_machineCallback(this, MC_THREAD_CREATE, a_thread);
+		machineCallback(this, MC_THREAD_CREATE, a_thread);
 	}
 }
 
@@ -836,6 +836,59 @@ gmThread * gmMachine::CreateThread(int * a_threadId, gmuint8 a_priority)
 
 
 
+gmThread * gmMachine::Sys_AcquireCallThread()
+{
+	gmThread * thread = m_idleCallThreads.RemoveFirst();
+	if(thread == NULL)
+	{
+		thread = GM_NEW( gmThread(this) );
+	}
+	thread->Sys_SetCallContext(true);
+	thread->Sys_SetState(gmThread::RUNNING);
+	thread->Sys_SetStartTime(m_time);
+	thread->SetPriority(0);
+	m_callThreads.InsertLast(thread);
+	return thread;
+}
+
+
+
+void gmMachine::Sys_ReleaseCallThread(gmThread * a_thread)
+{
+	if(a_thread->GetState() == gmThread::RUNNING)
+	{
+		// yielded, Execute() carries on with it
+		m_callThreads.Remove(a_thread);
+		Sys_PromoteCallThread(a_thread);
+		m_runningThreads.InsertLast(a_thread);
+		if(m_nextThreadValid && !m_runningThreads.IsValid(m_nextThread))
+		{
+			m_nextThread = a_thread;
+		}
+	}
+	else if(a_thread->IsCallContext())
+	{
+		GM_ASSERT(a_thread->GetState() == gmThread::KILLED);
+		m_idleCallThreads.InsertFirst(a_thread);
+	}
+	// else it was promoted and left with Sys_SwitchState()
+}
+
+
+
+void gmMachine::Sys_PromoteCallThread(gmThread * a_thread)
+{
+	if(a_thread->IsCallContext())
+	{
+		a_thread->Sys_SetCallContext(false);
+		a_thread->Sys_SetId(GetThreadId());
+		m_threads.Insert(a_thread);
+		Sys_SignalCreateThread(a_thread);
+	}
+}
+
+
+
 gmThread * gmMachine::GetThread(int a_threadId)
 {
 	return m_threads.Find(a_threadId);
@@ -900,6 +953,41 @@ bool gmMachine::Signal(const gmVariable &a_signal, int a_dstThreadId, int a_srcT
 }
 
 
+bool gmMachine::SignalResult(const gmVariable &a_signal, const gmVariable &a_result, int a_threadId)
+{
+	gmThread * thread = GetThread(a_threadId);
+	if(thread == NULL || thread->GetState() != gmThread::BLOCKED)
+	{
+		return false;
+	}
+
+	gmBlock * block = thread->Sys_GetBlocks();
+	while(block)
+	{
+		if(block->m_block.m_type == a_signal.m_type && block->m_block.m_value.m_ref == a_signal.m_value.m_ref)
+		{
+#if GM_USE_ENDON
+			if(block->m_endOn) return false;
+#endif //GM_USE_ENDON
+#if GM_USE_INCGC
+			// the block list keeps its own copy of the key, only the pushed value changes
+			if(block->m_block.IsReference())
+			{
+				GetGC()->WriteBarrier(GM_MOBJECT(this, block->m_block.m_value.m_ref));
+			}
+#endif //GM_USE_INCGC
+			block->m_block = a_result;
+			block->m_signalled = true;
+			block->m_srcThreadId = GM_INVALID_THREAD;
+			thread->Sys_SetState(gmThread::SYS_PENDING);
+			return true;
+		}
+		block = block->m_nextBlock;
+	}
+	return false;
+}
+
+
 #if GM_USE_ENDON
 int gmMachine::Sys_Block(gmThread * a_thread, int m_numBlocks, const gmVariable * a_blocks, bool a_endon)
 #else //GM_USE_ENDON
@@ -1011,6 +1099,13 @@ void gmMachine::ForEachThread(gmThreadIteratorCallback a_callback, void * a_cont
 {
 	gmListDouble<gmThread>::Iterator it;
 
+	for(it = m_callThreads.First(); it;)
+	{
+		gmThread * thread = it.Resolve();
+		++it;
+		if(!a_callback(thread, a_context)) return;
+	}
+
 	for(it = m_runningThreads.First(); it;)
 	{
 		gmThread * thread = it.Resolve();
@@ -1071,6 +1166,17 @@ void gmMachine::Sys_SwitchState(gmThread * a_thread, int a_to)
 	case gmThread::EXCEPTION : m_exceptionThreads.Remove(a_thread); break;
 	default : GM_ASSERT(0); break;
 	}
+	if(a_thread->IsCallContext())
+	{
+		if(a_to == gmThread::KILLED)
+		{
+			// the call finished, gmCall pools the thread again with Sys_ReleaseCallThread()
+			a_thread->Sys_SetState(gmThread::KILLED);
+			a_thread->Sys_Reset(0);
+			return;
+		}
+		Sys_PromoteCallThread(a_thread);
+	}
 	switch(a_to)
 	{
 	case gmThread::RUNNING : m_runningThreads.InsertLast(a_thread); break;
@@ -1101,9 +1207,10 @@ void gmMachine::Sys_SwitchState(gmThread * a_thread, int a_to)
 			a_thread->Sys_SetState(gmThread::KILLED);
 
 			// send destroy thread message
-			if(s_machineCallback)
+			gmMachineCallback machineCallback = GetMachineCallback();
+			if(machineCallback)
 			{
-				s_machineCallback(this, MC_THREAD_DESTROY, a_thread);
+				machineCallback(this, MC_THREAD_DESTROY, a_thread);
 			}
 
 #if(GM_USE_SYNC)
@@ -1416,14 +1523,14 @@ bool gmMachine::CollectGarbage(bool a_forceFullCollect)
 		if(++m_mark == GM_MARK_PERSIST) m_mark = GM_MARK_START + 1;
 
 		// call the gc callback
-		if(s_machineCallback) s_machineCallback(this, MC_COLLECT_GARBAGE, (void *) &m_mark);
+		gmMachineCallback machineCallback = GetMachineCallback();
+		if(machineCallback) machineCallback(this, MC_COLLECT_GARBAGE, (void *) &m_mark);
 
 		// iterate cpp owned gmObjects
-		gmHash<gmObject*, ObjHashNode>::Iterator cgmoIt;
-		for(cgmoIt = a_machine->m_cppOwnedGMObjs.First(); cgmoIt; ++cgmoIt)
+		gmObject * const * roots = m_roots.GetObjects();
+		for(gmuint i = m_roots.GetCount(); i--;)
 		{
-			gmObject* curObj = cgmoIt->m_obj;
-			curObj->Mark(a_machine, mark);
+			roots[i]->Mark(this, m_mark);
 		}
 
 		// iterate over all threads and mark the stacks.
@@ -1431,6 +1538,9 @@ bool gmMachine::CollectGarbage(bool a_forceFullCollect)
 		for(tit = m_blockedThreads.GetFirst(); m_blockedThreads.IsValid(tit); tit = m_blockedThreads.GetNext(tit)) tit->Mark(m_mark);
 		for(tit = m_sleepingThreads.GetFirst(); m_sleepingThreads.IsValid(tit); tit = m_sleepingThreads.GetNext(tit)) tit->Mark(m_mark);
 		for(tit = m_exceptionThreads.GetFirst(); m_exceptionThreads.IsValid(tit); tit = m_exceptionThreads.GetNext(tit)) tit->Mark(m_mark);
+		for(tit = m_callThreads.GetFirst(); m_callThreads.IsValid(tit); tit = m_callThreads.GetNext(tit)) tit->Mark(m_mark);
+		for(tit = m_killedThreads.GetFirst(); m_killedThreads.IsValid(tit); tit = m_killedThreads.GetNext(tit)) tit->Sys_SetStale();
+		for(tit = m_idleCallThreads.GetFirst(); m_idleCallThreads.IsValid(tit); tit = m_idleCallThreads.GetNext(tit)) tit->Sys_SetStale();
 
 		// iterate over global variables and mark
 		m_global->Mark(this, m_mark);
@@ -1500,6 +1610,7 @@ unsigned int gmMachine::GetSystemMemUsed() const
 	total += m_memUserObj.GetSystemMemUsed();
 	total += m_memStackFrames.GetSystemMemUsed();
 	total += m_fixedSet.GetSystemMemUsed();
+	total += m_roots.GetMemoryUsage();
 
 	// threads
 	gmThread * tit;
@@ -1508,6 +1619,8 @@ unsigned int gmMachine::GetSystemMemUsed() const
 	for(tit = m_sleepingThreads.GetFirst(); m_sleepingThreads.IsValid(tit); tit = m_sleepingThreads.GetNext(tit)) total += tit->GetSystemMemUsed();
 	for(tit = m_killedThreads.GetFirst(); m_killedThreads.IsValid(tit); tit = m_killedThreads.GetNext(tit)) total += tit->GetSystemMemUsed();
 	for(tit = m_exceptionThreads.GetFirst(); m_exceptionThreads.IsValid(tit); tit = m_exceptionThreads.GetNext(tit)) total += tit->GetSystemMemUsed();
+	for(tit = m_callThreads.GetFirst(); m_callThreads.IsValid(tit); tit = m_callThreads.GetNext(tit)) total += tit->GetSystemMemUsed();
+	for(tit = m_idleCallThreads.GetFirst(); m_idleCallThreads.IsValid(tit); tit = m_idleCallThreads.GetNext(tit)) total += tit->GetSystemMemUsed();
 
 	return total;
 }
@@ -1632,6 +1745,7 @@ gmUserObject * gmMachine::AllocUserObject(void * a_user, int a_userType)
 #endif //GM_USE_INCGC
 
 	newUserObj->m_userType = a_userType;
+	newUserObj->m_rawIndex = m_types[a_userType].m_rawIndex;
 	newUserObj->m_user = a_user;
 	m_currentMemoryUsage += sizeof(gmUserObject);
 	return newUserObj;
@@ -1725,6 +1839,7 @@ void gmMachine::Type::Init()
 	m_asString = NULL;
 	m_dbgInfo = NULL;
 	m_ParentType = GM_NULL;
+	m_rawIndex = GM_RAWINDEX_NONE;
 #if GM_USE_INCGC
 	m_gcDestruct = NULL;
 	m_gcTrace = NULL;
@@ -1758,6 +1873,10 @@ void gmMachine::ResetDefaultTypes()
 
 	// init the basic types
 	m_types.SetCount(GM_USER);
+	for(i = 0; i < GMMACHINE_MAXLIBTYPES; ++i)
+	{
+		m_libTypes[i] = GM_NULL;
+	}
 	// Alloc type table
 	for(i=0; i<m_types.Count(); ++i)
 	{
@@ -1846,19 +1965,8 @@ gmuint32 gmMachine::AddSourceCode(const char * a_source, const char * a_filename
 		// calculate the id.
 		id = gmCrc32String(a_source);
 
-		// see if we already have the source.
-		gmSourceEntry * entry = m_source.GetFirst();
-		while(m_source.IsValid(entry))
-		{
-			if(entry->m_id == id)
-			{
-				return id;
-			}
-			entry = m_source.GetNext(entry);
-		}
-
-		// we dont have it, add it
-		m_source.InsertFirst( GM_NEW( gmSourceEntry(a_source, a_filename) ) );
+		// add the source if we dont have it, compact functions may have added the entry first
+		Sys_GetSourceEntry(id)->SetSource(a_source, a_filename);
 	}
 	return id;
 }
@@ -1872,10 +1980,14 @@ bool gmMachine::GetSourceCode(gmuint32 a_id, const char * &a_source, const char
 		gmSourceEntry * entry = m_source.GetFirst();
 		while(m_source.IsValid(entry))
 		{
-			if(entry->m_id == a_id)
+			if(entry->GetId() == a_id)
 			{
-				a_source = entry->m_source;
-				a_filename = entry->m_filename;
+				if(!entry->HasSource())
+				{
+					return false;
+				}
+				a_source = entry->GetSource();
+				a_filename = entry->GetFilename();
 				return true;
 			}
 			entry = m_source.GetNext(entry);
@@ -1886,6 +1998,25 @@ bool gmMachine::GetSourceCode(gmuint32 a_id, const char * &a_source, const char
 
 
 
+gmSourceEntry * gmMachine::Sys_GetSourceEntry(gmuint32 a_id)
+{
+	gmSourceEntry * entry = m_source.GetFirst();
+	while(m_source.IsValid(entry))
+	{
+		if(entry->GetId() == a_id)
+		{
+			return entry;
+		}
+		entry = m_source.GetNext(entry);
+	}
+
+	entry = GM_NEW( gmSourceEntry(this, a_id, m_compactDebugInfo) );
+	m_source.InsertFirst(entry);
+	return entry;
+}
+
+
+
 #if GM_USE_INCGC
 const void * gmMachine::GetInstructionAtBreakPoint(gmuint32 a_sourceId, int a_line)
 {
@@ -1935,6 +2066,7 @@ void gmMachine::AddCPPOwnedGMObject(gmObject * a_obj)
 
 	ObjHashNode * newNode = (ObjHashNode *)Sys_Alloc( sizeof(ObjHashNode) );
 	newNode->m_obj = a_obj;
+	newNode->m_handle = AddRoot(a_obj);
 	m_cppOwnedGMObjs.Insert(newNode);
 }
 
@@ -1950,10 +2082,26 @@ void gmMachine::RemoveCPPOwnedGMObject(gmObject * a_obj)
 	if( foundNode )
 	{
 		m_cppOwnedGMObjs.Remove(foundNode);
+		RemoveRoot(foundNode->m_handle);
 		Sys_Free(foundNode);
+	}
+}
+
+
+gmRootHandle gmMachine::AddRoot(gmObject * a_obj)
+{
+	GM_ASSERT(a_obj);
+	return m_roots.Add(a_obj);
+}
+
 
+void gmMachine::RemoveRoot(gmRootHandle a_handle)
+{
+	gmObject * obj = m_roots.Remove(a_handle);
+	if( obj )
+	{
 		// Apply write barrier for this logical LHS
-		m_gc->WriteBarrier(a_obj);
+		m_gc->WriteBarrier(obj);
 	}
 }
 
@@ -2134,6 +2282,16 @@ const char *gmMachine::ReverseLookup(const char *a_string, const gmVariable &_va
 }
 
 
+// only written as the gmLibType globals are constructed, before any machine runs
+static int s_numLibTypes = 0;
+
+gmLibType::gmLibType()
+{
+	GM_ASSERT(s_numLibTypes < GMMACHINE_MAXLIBTYPES);
+	m_slot = s_numLibTypes++;
+}
+
+
 DisableGCInScope::DisableGCInScope(gmMachine *a_machine) 
 : m_machine(a_machine)
 , m_OldGCState(true)
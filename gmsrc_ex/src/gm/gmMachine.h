@@ -54,9 +54,11 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gmTableObject.h"
 #include "gmOperators.h"
 #include "gmFunctionObject.h"
+#include "gmUserObject.h"
 #include "gmHash.h"
 #include "gmArraySimple.h"
 #include "gmIncGC.h"
+#include "gmRootTable.h"
 
 #define GM_VERSION "1.26"
 
@@ -102,6 +104,7 @@ typedef void (GM_CDECL *gmAsStringCallback)(gmUserObject * a_userObj, char * a_b
 typedef void (GM_CDECL *gmPrintCallback)(gmMachine * a_machine, const char * a_string);
 typedef bool (GM_CDECL *gmThreadIteratorCallback)(gmThread * a_thread, void * a_context);
 typedef bool (GM_CDECL *gmUserBreakCallback)(gmThread * a_thread);
+typedef int (*pfnExecuteFileImpl)(gmThread *a_thread, const char *a_filename, gmVariable &a_this); // see import()
 
 // the following callbacks return true if the thread is to yield after completion of the callback.
 typedef bool (GM_CDECL *gmDebugLineCallback)(gmThread * a_thread);
@@ -188,6 +191,19 @@ public:
 	static gmPrintCallback s_printCallback; ///< global print callback
 	static gmUserBreakCallback s_userBreakCallback; ///< global execution break callback
 
+	/// \brief Set*Callback() will override the global callbacks for this machine only, NULL to use the global again.
+	///        Use these rather than the statics when machines run on separate OS threads.
+	inline void SetMachineCallback(gmMachineCallback a_callback) { m_machineCallback = a_callback; }
+	inline void SetPrintCallback(gmPrintCallback a_callback) { m_printCallback = a_callback; }
+	inline void SetUserBreakCallback(gmUserBreakCallback a_callback) { m_userBreakCallback = a_callback; }
+	inline void SetExecuteFileCallback(pfnExecuteFileImpl a_callback) { m_executeFileCallback = a_callback; }
+
+	/// \brief Get*Callback() return the callback in effect for this machine, may be NULL.
+	inline gmMachineCallback GetMachineCallback() const { return m_machineCallback ? m_machineCallback : s_machineCallback; }
+	inline gmPrintCallback GetPrintCallback() const { return m_printCallback ? m_printCallback : s_printCallback; }
+	inline gmUserBreakCallback GetUserBreakCallback() const { return m_userBreakCallback ? m_userBreakCallback : s_userBreakCallback; }
+	pfnExecuteFileImpl GetExecuteFileCallback() const;
+
 	//
 	//
 	// Registry
@@ -223,6 +239,7 @@ public:
 	}
 
 	/// \brief CreateUserType() will create a new user type such that you may bind your own operator functions etc.
+	///        Ids are per machine, the bind libraries keep theirs in gmLibType globals (GM_ARRAY etc).
 	/// \return the new user type.
 	gmType CreateUserType(const char * a_name);
 
@@ -237,6 +254,12 @@ public:
 	/// \param a_nativeFunction
 	bool RegisterTypeOperator(gmType a_type, gmOperator a_operator, gmFunctionObject * a_function, gmOperatorFunction a_nativeFunction = NULL, gmFunctionEntry *a_entry = NULL);
 
+	/// \brief RegisterTypeRawIndex() lets the interpreter get and set the elements of a user type at int indices itself,
+	///        rather than through its O_GETIND and O_SETIND operators.  The user object's native object must begin
+	///        with a gmRawArray.  Other indices and values, and indices out of range, still go to the operators.
+	///        Register it before allocating objects of the type, each object keeps the raw index it was made with.
+	void RegisterTypeRawIndex(gmType a_type, gmRawIndex a_rawIndex);
+
 #if GM_USER_FOREACH
   /// \brief RegisterTypeIterator() will let you assign a callback
   /// \param a_type User type identifier
@@ -313,6 +336,11 @@ public:
 	/// \return Root function from Lib or NULL if failed
 	gmFunctionObject * BindLibToFunction(gmStream &a_stream, const char * a_filename = NULL);
 
+	/// \brief BindLibToFunction() Bind a precompiled library held in memory, eg. a mapped file, without copying it.
+	/// \param a_image is the lib, only read during the call
+	/// \param a_lazy binds each function on first use from a copy of the image, see gmLibHooks::BindLibImage()
+	gmFunctionObject * BindLibToFunction(const void * a_image, unsigned int a_size, const char * a_filename = NULL, bool a_lazy = false);
+
 	/// \brief GetLog() will get the compile and runtime log of the last script compiled. log any runtime errors from
 	///        linked c functions to this log.
 	inline gmLog &GetLog() { return m_log; }
@@ -325,6 +353,18 @@ public:
 	gmThread * CreateThread(const gmVariable &a_this, const gmVariable &a_function, int * a_threadId = NULL);
 	gmThread * CreateThread(int * a_threadId = NULL, gmuint8 a_priority = 0);
 
+	/// \brief Sys_AcquireCallThread() returns a pooled thread to run a synchronous call on, see gmCall.  The thread has no id,
+	///        is in no thread list and sends no create or destroy callbacks, unless the call blocks, sleeps, yields,
+	///        raises an exception or asks for its id, which promotes it to an ordinary thread.
+	gmThread * Sys_AcquireCallThread();
+
+	/// \brief Sys_ReleaseCallThread() ends a call made on Sys_AcquireCallThread(), pooling the thread if the call
+	///        finished, or moving it to the running threads if the call yielded.
+	void Sys_ReleaseCallThread(gmThread * a_thread);
+
+	/// \brief Sys_PromoteCallThread() gives a call thread an id and makes it an ordinary thread.
+	void Sys_PromoteCallThread(gmThread * a_thread);
+
 	/// \brief GetThread() will return the thread given a thread id.
 	/// \return NULL on error.
 	gmThread * GetThread(int a_threadId);
@@ -337,6 +377,11 @@ public:
 	/// \return true if the signal fired, false otherwise
 	bool Signal(const gmVariable &a_signal, int a_dstThreadId, int a_srcThreadId);
 
+	/// \brief SignalResult() will unblock a_threadId if it is blocked on a_signal, the thread resumes with a_result
+	///        returned from its blocking call in place of a_signal.  Used by natives that block on work done elsewhere.
+	/// \return true if the thread was unblocked, false if it no longer waits on a_signal
+	bool SignalResult(const gmVariable &a_signal, const gmVariable &a_result, int a_threadId);
+
 	/// \brief Sys_Block() will add a block to a thread.
 	/// \return the index of the block that was signalled, or -1 if the blocks were added and the thread is to enter a blocked state.
 #if GM_USE_ENDON
@@ -348,7 +393,7 @@ public:
 	/// \brief KillThread()
 	void KillThread(int a_threadId);
 
-	/// \brief ForEachThread()
+	/// \brief ForEachThread() calls a_callback for each live thread, including threads running a synchronous call.
 	void ForEachThread(gmThreadIteratorCallback a_callback, void * a_context);
 
 	/// \brief Sys_SwitchState() will change the executing state of a thread.  if a_to is gmThread::KILLED, the thread
@@ -527,6 +572,14 @@ public:
 	/// \brief GetDebugMode()
 	inline bool GetDebugMode() const { return m_debug; }
 
+	/// \brief SetCompactDebugInfo() will, in debug mode, keep source code compressed and the debug info of functions
+	///        compiled from then on packed by source id, see gmSourceEntry.  Either is expanded only when line
+	///        lookups past the line number, a stack trace or the debugger need it.  Exceptions keep file and line.
+	inline void SetCompactDebugInfo(bool a_compact) { m_compactDebugInfo = a_compact; }
+
+	/// \brief GetCompactDebugInfo()
+	inline bool GetCompactDebugInfo() const { return m_compactDebugInfo; }
+
 	/// \brief AddSourceCode() will add source code to the machine, and return a unique id.
 	///        This is used when debug mode is set so the remote debugger can retrieve source as needed
 	///        for debugging.
@@ -559,6 +612,7 @@ public:
 	inline gmStackFrame * Sys_AllocStackFrame() { return (gmStackFrame *) m_memStackFrames.Alloc(); }
 	inline void Sys_FreeStackFrame(gmStackFrame * a_frame) { m_memStackFrames.Free(a_frame); }
 	void Sys_FreeUniqueString(const char * a_string);
+	gmSourceEntry * Sys_GetSourceEntry(gmuint32 a_id);
 	inline void * Sys_Alloc(int a_size);
 	inline void Sys_Free(void * a_mem) { m_fixedSet.Free(a_mem); }
 
@@ -576,6 +630,8 @@ public:
 #endif //GM_USE_INCGC
 
 	inline int GetNumThreads() const				  { return m_threads.Count(); }
+	/// \brief HasRunningThreads() returns true if the next Execute() has work that is not sleeping or blocked.
+	inline bool HasRunningThreads() const			  { return !m_runningThreads.IsEmpty(); }
 
 	inline int GetStatsGCNumFullCollects()          { return m_statsGCFullCollect; }
 	inline int GetStatsGCNumIncCollects()           { return m_statsGCIncCollect; }
@@ -583,6 +639,13 @@ public:
 	/// \brief Is GC actually running a cycle
 	bool IsGCRunning();
 
+	/// \brief AddRoot() keeps a_obj from being collected until the returned handle is removed.
+	gmRootHandle AddRoot(gmObject * a_obj);
+	/// \brief RemoveRoot() releases a handle from AddRoot(), a removed handle is ignored.
+	void RemoveRoot(gmRootHandle a_handle);
+	/// \brief GetRoot() returns the object of a handle from AddRoot(), NULL once it is removed.
+	inline gmObject * GetRoot(gmRootHandle a_handle) const { return m_roots.Get(a_handle); }
+
 	/// \brief Add a CPP owned gmObject so machine knows about it to handle GC.
 	void AddCPPOwnedGMObject(gmObject * a_obj);
 	/// \brief Remove a CPP owned gmObject.
@@ -600,6 +663,8 @@ protected:
 	gmListDouble<gmThread> m_killedThreads;
 	gmListDouble<gmThread> m_exceptionThreads;      ///< dead threads, hanging around for debugging
 	gmListDouble<gmThread> m_deletedThreads;		// threads to be deleted at the end of the update
+	gmListDouble<gmThread> m_callThreads;           ///< threads running a synchronous call, see Sys_AcquireCallThread()
+	gmListDouble<gmThread> m_idleCallThreads;       ///< pooled call threads
 	gmHash<int, gmThread> m_threads;
 	int GetThreadId();
 	gmuint32 m_time;                                ///< machine time in milliseconds. (gives us 50 days)
@@ -659,11 +724,14 @@ protected:
 #endif //GM_USER_FOREACH
 
 		gmType				m_ParentType;
+		gmuint8 m_rawIndex;                           ///< gmRawIndex, see RegisterTypeRawIndex()
 
 		void Init();
 	};
 
 	gmArraySimple<Type> m_types;                   ///< Variable types
+	gmType m_libTypes[GMMACHINE_MAXLIBTYPES];      ///< user types of the bind libraries, see gmLibType
+	friend class gmLibType;
 #if GM_USE_INCGC
 #if !GC_KEEP_PERSISTANT_SEPARATE
 	gmArraySimple<gmObject*> m_permanantStrings;
@@ -680,12 +748,21 @@ protected:
 	{
 	public:
 		gmObject * m_obj;
+		gmRootHandle m_handle;
 		const gmObject * GetKey() const { return m_obj; }
 	};
-	gmHash<gmObject*, ObjHashNode> m_cppOwnedGMObjs; ///< cpp owned gmObjects
+	gmHash<gmObject*, ObjHashNode> m_cppOwnedGMObjs; ///< cpp owned gmObjects, by object
+	gmRootTable m_roots; ///< every cpp owned gmObject
+
+	// Callback overrides, NULL to use the globals
+	gmMachineCallback m_machineCallback;
+	gmPrintCallback m_printCallback;
+	gmUserBreakCallback m_userBreakCallback;
+	pfnExecuteFileImpl m_executeFileCallback;
 
 	// Debugging
 	bool m_debug;
+	bool m_compactDebugInfo;
 	gmListDouble<gmSourceEntry> m_source;
 	gmLog m_log;
 };
@@ -755,6 +832,26 @@ inline void * gmMachine::Sys_Alloc(int a_size)
 	return m_fixedSet.Alloc(a_size); 
 }
 
+/// \class gmLibType
+/// \brief gmLibType holds a user type a bind library creates on each machine it is bound to.  Ids are per machine, so
+///        machines may bind in any order, and a machine may be bound on one OS thread and run on another.  Declare
+///        them as globals, each takes a slot on every machine as the process starts.
+class gmLibType
+{
+public:
+	gmLibType();
+
+	/// \brief Get() returns the type on a_machine, GM_NULL if the library is not bound to it.
+	inline gmType Get(const gmMachine * a_machine) const { return a_machine->m_libTypes[m_slot]; }
+	inline gmType Get(const gmThread * a_thread) const;
+
+	/// \brief Set() keeps the type the library created on a_machine.
+	inline void Set(gmMachine * a_machine, gmType a_type) const { a_machine->m_libTypes[m_slot] = a_type; }
+
+private:
+	int m_slot;
+};
+
 class DisableGCInScope
 {
 public:
@@ -252,6 +252,7 @@ static int GM_CDECL gmThreadTime(gmThread * a_thread)
 
 static int GM_CDECL gmThreadId(gmThread * a_thread) // return thread id
 {
+	a_thread->Sys_Promote(); // an id is only given when asked for
 	a_thread->PushInt(a_thread->GetId());
 	return GM_OK;  
 }
@@ -262,6 +263,7 @@ static bool gmThreadIdIter(gmThread * a_thread, void * a_context)
 {
 	gmTableObject* table = (gmTableObject*)a_context;
 	gmVariable threadId;
+	a_thread->Sys_Promote(); // a listed call context keeps its id
 	threadId.SetInt(a_thread->GetId());
 	table->Set(a_thread->GetMachine(), table->Count(), threadId);
 	return true;
@@ -290,6 +292,7 @@ static int GM_CDECL gmKillThread(gmThread * a_thread) // thread id
 	GM_INT_PARAM(id, 0, GM_INVALID_THREAD); // 1 optional param, default is this thread
 
 	// Kill this thread
+	a_thread->Sys_Promote();
 	if( (id == GM_INVALID_THREAD) || (id == a_thread->GetId()) )
 	{
 		return GM_SYS_KILL;  // Kill this thread
@@ -424,7 +427,7 @@ static int GM_CDECL gmUnitTest(gmThread * a_thread)
 	return GM_OK;
 }
 
-static gmType s_gmStateUserType = GM_NULL;
+static gmLibType s_gmStateUserType;
 
 struct gmStateUserType
 {
@@ -440,7 +443,7 @@ static int GM_CDECL gmSetState(gmThread * a_thread) // fp, params
 	GM_CHECK_FUNCTION_PARAM(function, 0);
 
 	// make sure we have our state type.
-	GM_ASSERT(s_gmStateUserType != GM_NULL); 
+	GM_ASSERT(s_gmStateUserType.Get(a_thread) != GM_NULL); 
 
 	// save off the parameters to the new state
 	gmVariable thisVar = *a_thread->GetThis();
@@ -454,7 +457,7 @@ static int GM_CDECL gmSetState(gmThread * a_thread) // fp, params
 	// get the current state
 	gmVariable newStateVariable;
 	gmVariable * currentStateVariable = a_thread->GetBottom();
-	if(currentStateVariable->m_type == s_gmStateUserType)
+	if(currentStateVariable->m_type == s_gmStateUserType.Get(a_thread))
 	{
 		gmUserObject * userObj = (gmUserObject *) GM_OBJECT(currentStateVariable->m_value.m_ref);
 		gmStateUserType * currentState = (gmStateUserType *) userObj->m_user;
@@ -482,10 +485,11 @@ static int GM_CDECL gmSetState(gmThread * a_thread) // fp, params
 		state->m_lastState = NULL;
 
 		// create a new state variable
-		newStateVariable.SetUser(a_thread->GetMachine()->AllocUserObject(state, s_gmStateUserType));
+		newStateVariable.SetUser(a_thread->GetMachine()->AllocUserObject(state, s_gmStateUserType.Get(a_thread)));
 	}
 
 	// reset the stack. and push new state
+	a_thread->Sys_Promote(); // the thread runs on in its new state
 	int user = a_thread->m_user;
 	a_thread->Sys_Reset(a_thread->GetId());
 	a_thread->m_user = user;
@@ -510,7 +514,7 @@ static int GM_CDECL gmSetStateOnThread(gmThread * a_thread) // (threadid, fp, pa
 	GM_CHECK_FUNCTION_PARAM(function, 1);
 
 	// make sure we have our state type.
-	GM_ASSERT(s_gmStateUserType != GM_NULL); 
+	GM_ASSERT(s_gmStateUserType.Get(a_thread) != GM_NULL); 
 
 	// get the target thread
 	gmThread * thread = a_thread->GetMachine()->GetThread(threadId);
@@ -529,7 +533,7 @@ static int GM_CDECL gmSetStateOnThread(gmThread * a_thread) // (threadid, fp, pa
 	gmVariable newStateVariable;
 	gmVariable thisVar = *thread->GetThis();
 	gmVariable * currentStateVariable = thread->GetBottom();
-	if(currentStateVariable->m_type == s_gmStateUserType)
+	if(currentStateVariable->m_type == s_gmStateUserType.Get(a_thread))
 	{
 		gmUserObject * userObj = (gmUserObject *) GM_OBJECT(currentStateVariable->m_value.m_ref);
 		gmStateUserType * currentState = (gmStateUserType *) userObj->m_user;
@@ -557,7 +561,7 @@ static int GM_CDECL gmSetStateOnThread(gmThread * a_thread) // (threadid, fp, pa
 		state->m_lastState = NULL;
 
 		// create a new state variable
-		newStateVariable.SetUser(a_thread->GetMachine()->AllocUserObject(state, s_gmStateUserType));
+		newStateVariable.SetUser(a_thread->GetMachine()->AllocUserObject(state, s_gmStateUserType.Get(a_thread)));
 	}
 
 	// reset the stack. and push new state
@@ -588,7 +592,7 @@ static int GM_CDECL gmSetStateOnThread(gmThread * a_thread) // (threadid, fp, pa
 
 static int GM_CDECL gmGetState(gmThread * a_thread) // return var
 {
-	GM_ASSERT(s_gmStateUserType != GM_NULL); 
+	GM_ASSERT(s_gmStateUserType.Get(a_thread) != GM_NULL); 
 
 	gmThread * testThread = a_thread;
 
@@ -605,7 +609,7 @@ static int GM_CDECL gmGetState(gmThread * a_thread) // return var
 	}
 
 	gmVariable * currentStateVariable = testThread->GetBottom();
-	if(currentStateVariable->m_type == s_gmStateUserType)
+	if(currentStateVariable->m_type == s_gmStateUserType.Get(a_thread))
 	{
 		gmUserObject * userObj = (gmUserObject *) GM_OBJECT(currentStateVariable->m_value.m_ref);
 		gmStateUserType * currentState = (gmStateUserType *) userObj->m_user;
@@ -617,7 +621,7 @@ static int GM_CDECL gmGetState(gmThread * a_thread) // return var
 
 static int GM_CDECL gmGetLastState(gmThread * a_thread) // return var
 {
-	GM_ASSERT(s_gmStateUserType != GM_NULL); 
+	GM_ASSERT(s_gmStateUserType.Get(a_thread) != GM_NULL); 
 
 	gmThread * testThread = a_thread;
 
@@ -634,7 +638,7 @@ static int GM_CDECL gmGetLastState(gmThread * a_thread) // return var
 	}
 
 	gmVariable * currentStateVariable = testThread->GetBottom();
-	if(currentStateVariable->m_type == s_gmStateUserType)
+	if(currentStateVariable->m_type == s_gmStateUserType.Get(a_thread))
 	{
 		gmUserObject * userObj = (gmUserObject *) GM_OBJECT(currentStateVariable->m_value.m_ref);
 		gmStateUserType * currentState = (gmStateUserType *) userObj->m_user;
@@ -653,10 +657,10 @@ static int GM_CDECL gmSetExitState(gmThread * a_thread) // function
 	GM_CHECK_NUM_PARAMS(1);
 	GM_CHECK_FUNCTION_PARAM(function, 0);
 
-	GM_ASSERT(s_gmStateUserType != GM_NULL); 
+	GM_ASSERT(s_gmStateUserType.Get(a_thread) != GM_NULL); 
 
 	gmVariable * currentStateVariable = a_thread->GetBottom();
-	if(currentStateVariable->m_type == s_gmStateUserType)
+	if(currentStateVariable->m_type == s_gmStateUserType.Get(a_thread))
 	{
 		gmUserObject * userObj = (gmUserObject *) GM_OBJECT(currentStateVariable->m_value.m_ref);
 		gmStateUserType * currentState = (gmStateUserType *) userObj->m_user;
@@ -671,6 +675,7 @@ static int GM_CDECL gmSignal(gmThread * a_thread) // var, dest thread id
 {
 	GM_CHECK_NUM_PARAMS(1);
 	GM_INT_PARAM(dstThreadId, 1, GM_INVALID_THREAD);
+	a_thread->Sys_Promote(); // the signalled threads are given our id
 	a_thread->GetMachine()->Signal(a_thread->Param(0), dstThreadId, a_thread->GetId());
 	return GM_OK;  
 }
@@ -703,6 +708,7 @@ static int GM_CDECL gmSyncThread(gmThread * a_thread)
 {
 	GM_CHECK_NUM_PARAMS(1);
 	GM_CHECK_INT_PARAM(threadId,0);
+	a_thread->Sys_Promote();
 	if(threadId == a_thread->GetId())
 	{
 		return GM_OK;
@@ -853,45 +859,98 @@ static int GM_CDECL gmTableRandom(gmThread * a_thread)
 	return GM_OK;
 }
 
+/// \brief TableSortItem is an item of tableSort, the variable it is sorted by and its place before the sort.
+struct TableSortItem
+{
+	gmVariable m_sortBy;
+	int m_index;
+};
+
+/// \brief TableSorter orders null, then ints and floats by value, then strings, then other types by their
+///        string form.  With a sort function it calls that on one reused call context instead.
 class TableSorter
 {
 public:
-	bool operator()(const gmVariable &_var1, const gmVariable &_var2)
+	bool operator()(const TableSortItem &_item1, const TableSortItem &_item2) const
 	{
+		const gmVariable &var1 = _item1.m_sortBy;
+		const gmVariable &var2 = _item2.m_sortBy;
 		if(m_SortFunc)
 		{
-			int retVal = 0;
+			// after an exception every compare is false, the sort finishes quickly and is thrown away
+			if(*m_Failed) return false;
 
-			gmCall call;
-			if(call.BeginFunction(m_Machine,m_SortFunc))
+			gmVariable params[2] = { var1, var2 };
+			gmVariable retVal;
+			if(m_Call->CallParams(params, 2, 1, &retVal) != 0 || m_Call->GetNumUnfinished() != 0)
 			{
-				call.AddParam(_var1);
-				call.AddParam(_var2);
-				call.End();
-
-
-				call.GetReturnedInt(retVal);
+				*m_Failed = true;
+				return false;
 			}
-			return retVal < 0;
+			if(retVal.m_type == GM_FLOAT) return retVal.m_value.m_float < 0.0f;
+			return retVal.m_type == GM_INT && retVal.m_value.m_int < 0;
 		}
-		else
+
+		const int rank1 = Rank(var1.m_type);
+		const int rank2 = Rank(var2.m_type);
+		if(rank1 != rank2)
 		{
-			enum { BufferSize = 256 };
-			char buffer1[BufferSize] = {};
-			char buffer2[BufferSize] = {};
+			return rank1 < rank2;
+		}
+		switch(rank1)
+		{
+		case RANK_NUMBER:
+			{
+				if(var1.m_type == GM_INT && var2.m_type == GM_INT)
+				{
+					return var1.m_value.m_int < var2.m_value.m_int;
+				}
+				const float num1 = (var1.m_type == GM_INT) ? (float)var1.m_value.m_int : var1.m_value.m_float;
+				const float num2 = (var2.m_type == GM_INT) ? (float)var2.m_value.m_int : var2.m_value.m_float;
+				return num1 < num2;
+			}
+		case RANK_STRING:
+			{
+				// strings are interned, an equal string is the same object
+				if(var1.m_value.m_ref == var2.m_value.m_ref) return false;
+				return strcmp(var1.GetCStringSafe(), var2.GetCStringSafe()) < 0;
+			}
+		case RANK_OTHER:
+			{
+				enum { BufferSize = 256 };
+				char buffer1[BufferSize] = {};
+				char buffer2[BufferSize] = {};
 
-			const char *buf1 = _var1.AsString(m_Machine,buffer1,BufferSize);
-			const char *buf2 = _var2.AsString(m_Machine,buffer2,BufferSize);
+				const char *buf1 = var1.AsString(m_Machine,buffer1,BufferSize);
+				const char *buf2 = var2.AsString(m_Machine,buffer2,BufferSize);
 
-			return strcmp(buf1, buf2) < 0;
+				return strcmp(buf1, buf2) < 0;
+			}
 		}
+		return false;
 	}
 
-	TableSorter(gmMachine *_machine, gmFunctionObject *_sortfunc) 
-		: m_Machine(_machine), m_SortFunc(_sortfunc) {}
+	TableSorter(gmMachine *_machine, gmFunctionObject *_sortfunc, gmBatchCall *_call, bool *_failed) 
+		: m_Machine(_machine), m_SortFunc(_sortfunc), m_Call(_call), m_Failed(_failed) {}
 private:
+	enum { RANK_NULL, RANK_NUMBER, RANK_STRING, RANK_OTHER };
+
+	static int Rank(gmType _type)
+	{
+		switch(_type)
+		{
+		case GM_NULL: return RANK_NULL;
+		case GM_INT:
+		case GM_FLOAT: return RANK_NUMBER;
+		case GM_STRING: return RANK_STRING;
+		default: return RANK_OTHER;
+		}
+	}
+
 	gmMachine			*m_Machine;
 	gmFunctionObject	*m_SortFunc;
+	gmBatchCall			*m_Call;
+	bool				*m_Failed;
 
 	TableSorter();
 };
@@ -902,34 +961,112 @@ static int GM_CDECL gmTableSort(gmThread * a_thread)
 	GM_CHECK_TABLE_PARAM(table, 0);
 	GM_STRING_PARAM(sortby,1,"value");
 	GM_FUNCTION_PARAM(sortFunc,2,0);
+	GM_INT_PARAM(stable,3,0);
 
-	typedef std::vector<gmVariable> Vars;
+	gmMachine * machine = a_thread->GetMachine();
 
-	if(_gmstricmp(sortby,"value") && _gmstricmp(sortby,"key"))
+	// sort by key, by value, or by a field path into the value such as "row.field"
+	const bool bByKey = !_gmstricmp(sortby,"key");
+	std::vector<gmVariable> path;
+	if(!bByKey && _gmstricmp(sortby,"value"))
 	{
-		GM_EXCEPTION_MSG("expected 'key' or 'value' as param 1");
-		return GM_EXCEPTION;
-	}
+		if(!strncmp(sortby,"value.",6))
+		{
+			sortby += 6;
+		}
+
+		// room for a string per field, then the result and sort by tables past the slack space
+		int numFields = 1;
+		const char * dot;
+		for(dot = strchr(sortby, '.'); dot; dot = strchr(dot + 1, '.')) ++numFields;
+		if(!a_thread->Touch(numFields + 3))
+		{
+			GM_EXCEPTION_MSG("field path too long");
+			return GM_EXCEPTION;
+		}
 
-	const bool bByValue = !_gmstricmp(sortby,"value");
+		const char * field = sortby;
+		for(;;)
+		{
+			const char * end = strchr(field, '.');
+			const int len = end ? (int)(end - field) : (int)strlen(field);
+			if(len == 0)
+			{
+				GM_EXCEPTION_MSG("expected 'key', 'value' or a field path as param 1");
+				return GM_EXCEPTION;
+			}
+			gmStringObject * fieldName = machine->AllocStringObject(std::string(field, len).c_str());
+			a_thread->PushString(fieldName); // keep the field name
+			path.push_back(gmVariable(GM_STRING, fieldName->GetRef()));
+			if(!end) break;
+			field = end + 1;
+		}
+	}
 
-	DisableGCInScope gcEn(a_thread->GetMachine());
+	// fill the result before sorting, so the garbage collector sees every item while a sort function runs
+	const int count = table->Count();
+	gmTableObject *sorted = machine->AllocTableObject();
+	sorted->Reserve(machine, count);
+	a_thread->PushTable(sorted);
+	gmTableObject *sortByTable = NULL;
+	if(sortFunc && !path.empty())
+	{
+		sortByTable = machine->AllocTableObject();
+		sortByTable->Reserve(machine, count);
+		a_thread->PushTable(sortByTable);
+	}
 
-	Vars vars;
+	std::vector<gmVariable> vars(count);
+	std::vector<TableSortItem> items(count);
+	int i = 0;
 	gmTableIterator tIt;
 	gmTableNode *pNode = table->GetFirst(tIt);
 	while(pNode)
 	{
-		vars.push_back(bByValue ? pNode->m_value : pNode->m_key);		
+		vars[i] = bByKey ? pNode->m_key : pNode->m_value;
+		sorted->Set(machine,i,vars[i]);
+
+		gmVariable sortBy = vars[i];
+		for(size_t f = 0; f < path.size(); ++f)
+		{
+			gmTableObject * row = sortBy.GetTableObjectSafe();
+			sortBy = row ? row->Get(path[f]) : gmVariable::s_null;
+		}
+		if(sortByTable)
+		{
+			sortByTable->Set(machine,i,sortBy);
+		}
+		items[i].m_sortBy = sortBy;
+		items[i].m_index = i;
+
 		pNode = table->GetNext(tIt);
+		++i;
 	}
 
-	std::sort(vars.begin(), vars.end(), TableSorter(a_thread->GetMachine(),sortFunc));
+	gmBatchCall call;
+	bool failed = false;
+	if(sortFunc)
+	{
+		call.BeginFunction(machine, sortFunc);
+	}
+	// a sort function always sorts stably, merge sort stays in bounds whatever order the function gives
+	TableSorter sorter(machine, sortFunc, &call, &failed);
+	if(stable || sortFunc)
+	{
+		std::stable_sort(items.begin(), items.end(), sorter);
+	}
+	else
+	{
+		std::sort(items.begin(), items.end(), sorter);
+	}
+	if(failed)
+	{
+		return GM_EXCEPTION;
+	}
 
-	gmTableObject *sorted = a_thread->GetMachine()->AllocTableObject();
-	for(int i = 0; i < (int)vars.size(); ++i)
+	for(i = 0; i < count; ++i)
 	{
-		sorted->Set(a_thread->GetMachine(),i,vars[i]);
+		sorted->Set(machine,i,vars[items[i].m_index]);
 	}
 	a_thread->PushTable(sorted);
 	return GM_OK;
@@ -990,9 +1127,10 @@ static int GM_CDECL gmPrint(gmThread * a_thread)
 	// print the string
 	if(str)
 	{
-		if(gmMachine::s_printCallback)
+		gmPrintCallback printCallback = a_thread->GetMachine()->GetPrintCallback();
+		if(printCallback)
 		{
-			gmMachine::s_printCallback(a_thread->GetMachine(), str);
+			printCallback(a_thread->GetMachine(), str);
 		}
 		a_thread->GetMachine()->Sys_Free(str);
 	}
@@ -1277,7 +1415,8 @@ static int GM_CDECL gmfImport(gmThread * a_thread)
 
 	//////////////////////////////////////////////////////////////////////////
 
-	if(!gmImportExecuteFile)
+	pfnExecuteFileImpl executeFile = pM->GetExecuteFileCallback();
+	if(!executeFile)
 	{
 		GM_EXCEPTION_MSG("No Callback provided for executing files!");
 		return GM_EXCEPTION;
@@ -1288,7 +1427,7 @@ static int GM_CDECL gmfImport(gmThread * a_thread)
 	gmTableObject *NewModule = pM->AllocTableObject();
 	gmVariable moduleVar(NewModule);
 	ModulesTable->Set(pM,slower.c_str(),moduleVar);
-	if(gmImportExecuteFile(a_thread,slower.c_str(),moduleVar)==GM_OK)
+	if(executeFile(a_thread,slower.c_str(),moduleVar)==GM_OK)
 	{
 		a_thread->PushTable(NewModule);
 		return GM_OK;
@@ -1658,8 +1797,12 @@ static gmFunctionEntry s_binding[] =
 	{"tableRandom", gmTableRandom},
 	/*gm
 	\function tableSort
-	\brief sort an indexed table
+	\brief tableSort returns a table of the values, or keys, of a table indexed from 0 in sorted order.
+	       Without a sort function null sorts first, then numbers, then strings, then other types by their string form.
 	\param table
+	\param string sortby optional ("value"), "key", "value" or a field path into each value such as "row.field"
+	\param function sortfunc optional, sortfunc(a, b) returns < 0 if a goes before b, given what is sorted by
+	\param int stable optional (0), keep the order of equal items.  Always stable with a sort function.
 	*/
 	{"tableSort", gmTableSort},
 	/*gm
@@ -1699,12 +1842,12 @@ static gmFunctionEntry s_binding[] =
 void gmMachineLib(gmMachine * a_machine)
 {
 	// create the state type
-	s_gmStateUserType = a_machine->CreateUserType("gmState");
+	s_gmStateUserType.Set(a_machine, a_machine->CreateUserType("gmState"));
 
 #if GM_USE_INCGC
-	a_machine->RegisterUserCallbacks(s_gmStateUserType, gmGCTraceStateUserType, gmGCDestructStateUserType);
+	a_machine->RegisterUserCallbacks(s_gmStateUserType.Get(a_machine), gmGCTraceStateUserType, gmGCDestructStateUserType);
 #else //GM_USE_INCGC
-	a_machine->RegisterUserCallbacks(s_gmStateUserType, gmMarkStateUserType, gmGCStateUserType);
+	a_machine->RegisterUserCallbacks(s_gmStateUserType.Get(a_machine), gmMarkStateUserType, gmGCStateUserType);
 #endif //GM_USE_INCGC
 
 	// default lib
@@ -12,6 +12,8 @@ See Copyright Notice in gmMachine.h
 #ifndef _GMMACHINELIB_H_
 #define _GMMACHINELIB_H_
 
+#include "gmMachine.h"
+
 class gmThread;
 class gmMachine;
 struct gmVariable;
@@ -20,8 +22,7 @@ struct gmVariable;
 
 void gmMachineLib(gmMachine * a_machine);
 
-typedef int (*pfnExecuteFileImpl)(gmThread *a_thread, const char *a_filename, gmVariable &a_this);
-
+/// \brief gmImportExecuteFile is the global import() file loader, see gmMachine::SetExecuteFileCallback()
 extern pfnExecuteFileImpl gmImportExecuteFile;
 
 #endif // _GMMACHINELIB_H_
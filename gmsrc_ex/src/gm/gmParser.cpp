@@ -1,66 +1,77 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/*  A Bison parser, made from gmparser.y with Bison version GNU Bison version 1.24
-  */
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
 
-#define YYBISON 1  /* Identify Bison output.  */
-
-#define yyparse gmparse
-#define yylex gmlex
-#define yyerror gmerror
-#define yylval gmlval
-#define yychar gmchar
-#define yydebug gmdebug
-#define yynerrs gmnerrs
-#define	KEYWORD_LOCAL	258
-#define	KEYWORD_GLOBAL	259
-#define	KEYWORD_MEMBER	260
-#define	KEYWORD_AND	261
-#define	KEYWORD_OR	262
-#define	KEYWORD_IF	263
-#define	KEYWORD_ELSE	264
-#define	KEYWORD_WHILE	265
-#define	KEYWORD_FOR	266
-#define	KEYWORD_FOREACH	267
-#define	KEYWORD_IN	268
-#define	KEYWORD_BREAK	269
-#define	KEYWORD_CONTINUE	270
-#define	KEYWORD_NULL	271
-#define	KEYWORD_DOWHILE	272
-#define	KEYWORD_RETURN	273
-#define	KEYWORD_FUNCTION	274
-#define	KEYWORD_TABLE	275
-#define	KEYWORD_THIS	276
-#define	KEYWORD_TRUE	277
-#define	KEYWORD_FALSE	278
-#define	KEYWORD_FORK	279
-#define	KEYWORD_SWITCH	280
-#define	KEYWORD_CASE	281
-#define	KEYWORD_DEFAULT	282
-#define	IDENTIFIER	283
-#define	CONSTANT_HEX	284
-#define	CONSTANT_BINARY	285
-#define	CONSTANT_INT	286
-#define	CONSTANT_CHAR	287
-#define	CONSTANT_FLOAT	288
-#define	CONSTANT_STRING	289
-#define	SYMBOL_ASGN_BSR	290
-#define	SYMBOL_ASGN_BSL	291
-#define	SYMBOL_ASGN_ADD	292
-#define	SYMBOL_ASGN_MINUS	293
-#define	SYMBOL_ASGN_TIMES	294
-#define	SYMBOL_ASGN_DIVIDE	295
-#define	SYMBOL_ASGN_REM	296
-#define	SYMBOL_ASGN_BAND	297
-#define	SYMBOL_ASGN_BOR	298
-#define	SYMBOL_ASGN_BXOR	299
-#define	SYMBOL_RIGHT_SHIFT	300
-#define	SYMBOL_LEFT_SHIFT	301
-#define	SYMBOL_LTE	302
-#define	SYMBOL_GTE	303
-#define	SYMBOL_EQ	304
-#define	SYMBOL_NEQ	305
-#define	TOKEN_ERROR	306
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 2
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         gmparse
+#define yylex           gmlex
+#define yyerror         gmerror
+#define yydebug         gmdebug
+#define yynerrs         gmnerrs
+
+/* First part of user prologue.  */
 
 
 #define YYPARSER
@@ -68,12 +79,11 @@
 #include "gmCodeTree.h"
 #define YYSTYPE gmCodeTreeNode *
 
-extern gmCodeTreeNode * g_codeTree;
+extern GM_THREAD_LOCAL gmCodeTreeNode * g_codeTree;
 
 #define GM_BISON_DEBUG
 #ifdef GM_BISON_DEBUG
 #define YYDEBUG 1
-#define YYERROR_VERBOSE
 #endif // GM_BISON_DEBUG
 
 //
@@ -119,1763 +129,2632 @@ gmCodeTreeNode * CreateAsignExpression(int a_subTypeType, gmCodeTreeNode * a_lef
 }
 
 
-#ifndef YYLTYPE
-typedef
-  struct yyltype
-    {
-      int timestamp;
-      int first_line;
-      int first_column;
-      int last_line;
-      int last_column;
-      char *text;
-   }
-  yyltype;
 
-#define YYLTYPE yyltype
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "gmParser.cpp.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_KEYWORD_LOCAL = 3,              /* KEYWORD_LOCAL  */
+  YYSYMBOL_KEYWORD_GLOBAL = 4,             /* KEYWORD_GLOBAL  */
+  YYSYMBOL_KEYWORD_MEMBER = 5,             /* KEYWORD_MEMBER  */
+  YYSYMBOL_KEYWORD_INLINE = 6,             /* KEYWORD_INLINE  */
+  YYSYMBOL_KEYWORD_AND = 7,                /* KEYWORD_AND  */
+  YYSYMBOL_KEYWORD_OR = 8,                 /* KEYWORD_OR  */
+  YYSYMBOL_KEYWORD_IF = 9,                 /* KEYWORD_IF  */
+  YYSYMBOL_KEYWORD_ELSE = 10,              /* KEYWORD_ELSE  */
+  YYSYMBOL_KEYWORD_WHILE = 11,             /* KEYWORD_WHILE  */
+  YYSYMBOL_KEYWORD_FOR = 12,               /* KEYWORD_FOR  */
+  YYSYMBOL_KEYWORD_FOREACH = 13,           /* KEYWORD_FOREACH  */
+  YYSYMBOL_KEYWORD_IN = 14,                /* KEYWORD_IN  */
+  YYSYMBOL_KEYWORD_BREAK = 15,             /* KEYWORD_BREAK  */
+  YYSYMBOL_KEYWORD_CONTINUE = 16,          /* KEYWORD_CONTINUE  */
+  YYSYMBOL_KEYWORD_NULL = 17,              /* KEYWORD_NULL  */
+  YYSYMBOL_KEYWORD_DOWHILE = 18,           /* KEYWORD_DOWHILE  */
+  YYSYMBOL_KEYWORD_RETURN = 19,            /* KEYWORD_RETURN  */
+  YYSYMBOL_KEYWORD_FUNCTION = 20,          /* KEYWORD_FUNCTION  */
+  YYSYMBOL_KEYWORD_TABLE = 21,             /* KEYWORD_TABLE  */
+  YYSYMBOL_KEYWORD_THIS = 22,              /* KEYWORD_THIS  */
+  YYSYMBOL_KEYWORD_TRUE = 23,              /* KEYWORD_TRUE  */
+  YYSYMBOL_KEYWORD_FALSE = 24,             /* KEYWORD_FALSE  */
+  YYSYMBOL_KEYWORD_FORK = 25,              /* KEYWORD_FORK  */
+  YYSYMBOL_KEYWORD_SWITCH = 26,            /* KEYWORD_SWITCH  */
+  YYSYMBOL_KEYWORD_CASE = 27,              /* KEYWORD_CASE  */
+  YYSYMBOL_KEYWORD_DEFAULT = 28,           /* KEYWORD_DEFAULT  */
+  YYSYMBOL_IDENTIFIER = 29,                /* IDENTIFIER  */
+  YYSYMBOL_CONSTANT_HEX = 30,              /* CONSTANT_HEX  */
+  YYSYMBOL_CONSTANT_BINARY = 31,           /* CONSTANT_BINARY  */
+  YYSYMBOL_CONSTANT_INT = 32,              /* CONSTANT_INT  */
+  YYSYMBOL_CONSTANT_CHAR = 33,             /* CONSTANT_CHAR  */
+  YYSYMBOL_CONSTANT_FLOAT = 34,            /* CONSTANT_FLOAT  */
+  YYSYMBOL_CONSTANT_STRING = 35,           /* CONSTANT_STRING  */
+  YYSYMBOL_SYMBOL_ASGN_BSR = 36,           /* SYMBOL_ASGN_BSR  */
+  YYSYMBOL_SYMBOL_ASGN_BSL = 37,           /* SYMBOL_ASGN_BSL  */
+  YYSYMBOL_SYMBOL_ASGN_ADD = 38,           /* SYMBOL_ASGN_ADD  */
+  YYSYMBOL_SYMBOL_ASGN_MINUS = 39,         /* SYMBOL_ASGN_MINUS  */
+  YYSYMBOL_SYMBOL_ASGN_TIMES = 40,         /* SYMBOL_ASGN_TIMES  */
+  YYSYMBOL_SYMBOL_ASGN_DIVIDE = 41,        /* SYMBOL_ASGN_DIVIDE  */
+  YYSYMBOL_SYMBOL_ASGN_REM = 42,           /* SYMBOL_ASGN_REM  */
+  YYSYMBOL_SYMBOL_ASGN_BAND = 43,          /* SYMBOL_ASGN_BAND  */
+  YYSYMBOL_SYMBOL_ASGN_BOR = 44,           /* SYMBOL_ASGN_BOR  */
+  YYSYMBOL_SYMBOL_ASGN_BXOR = 45,          /* SYMBOL_ASGN_BXOR  */
+  YYSYMBOL_SYMBOL_RIGHT_SHIFT = 46,        /* SYMBOL_RIGHT_SHIFT  */
+  YYSYMBOL_SYMBOL_LEFT_SHIFT = 47,         /* SYMBOL_LEFT_SHIFT  */
+  YYSYMBOL_SYMBOL_LTE = 48,                /* SYMBOL_LTE  */
+  YYSYMBOL_SYMBOL_GTE = 49,                /* SYMBOL_GTE  */
+  YYSYMBOL_SYMBOL_EQ = 50,                 /* SYMBOL_EQ  */
+  YYSYMBOL_SYMBOL_NEQ = 51,                /* SYMBOL_NEQ  */
+  YYSYMBOL_TOKEN_ERROR = 52,               /* TOKEN_ERROR  */
+  YYSYMBOL_53_ = 53,                       /* '{'  */
+  YYSYMBOL_54_ = 54,                       /* '}'  */
+  YYSYMBOL_55_ = 55,                       /* ';'  */
+  YYSYMBOL_56_ = 56,                       /* '='  */
+  YYSYMBOL_57_ = 57,                       /* '('  */
+  YYSYMBOL_58_ = 58,                       /* ')'  */
+  YYSYMBOL_59_ = 59,                       /* ':'  */
+  YYSYMBOL_60_ = 60,                       /* '['  */
+  YYSYMBOL_61_ = 61,                       /* ']'  */
+  YYSYMBOL_62_ = 62,                       /* '.'  */
+  YYSYMBOL_63_ = 63,                       /* '|'  */
+  YYSYMBOL_64_ = 64,                       /* '^'  */
+  YYSYMBOL_65_ = 65,                       /* '&'  */
+  YYSYMBOL_66_ = 66,                       /* '<'  */
+  YYSYMBOL_67_ = 67,                       /* '>'  */
+  YYSYMBOL_68_ = 68,                       /* '+'  */
+  YYSYMBOL_69_ = 69,                       /* '-'  */
+  YYSYMBOL_70_ = 70,                       /* '*'  */
+  YYSYMBOL_71_ = 71,                       /* '/'  */
+  YYSYMBOL_72_ = 72,                       /* '%'  */
+  YYSYMBOL_73_ = 73,                       /* '~'  */
+  YYSYMBOL_74_ = 74,                       /* '!'  */
+  YYSYMBOL_75_ = 75,                       /* ','  */
+  YYSYMBOL_YYACCEPT = 76,                  /* $accept  */
+  YYSYMBOL_program = 77,                   /* program  */
+  YYSYMBOL_statement_list = 78,            /* statement_list  */
+  YYSYMBOL_statement = 79,                 /* statement  */
+  YYSYMBOL_compound_statement = 80,        /* compound_statement  */
+  YYSYMBOL_var_statement = 81,             /* var_statement  */
+  YYSYMBOL_var_type = 82,                  /* var_type  */
+  YYSYMBOL_expression_statement = 83,      /* expression_statement  */
+  YYSYMBOL_selection_statement = 84,       /* selection_statement  */
+  YYSYMBOL_case_selection_statement = 85,  /* case_selection_statement  */
+  YYSYMBOL_case_selection_statement_list = 86, /* case_selection_statement_list  */
+  YYSYMBOL_postfix_case_expression = 87,   /* postfix_case_expression  */
+  YYSYMBOL_case_expression = 88,           /* case_expression  */
+  YYSYMBOL_iteration_statement = 89,       /* iteration_statement  */
+  YYSYMBOL_jump_statement = 90,            /* jump_statement  */
+  YYSYMBOL_assignment_expression = 91,     /* assignment_expression  */
+  YYSYMBOL_constant_expression_statement = 92, /* constant_expression_statement  */
+  YYSYMBOL_constant_expression = 93,       /* constant_expression  */
+  YYSYMBOL_logical_or_expression = 94,     /* logical_or_expression  */
+  YYSYMBOL_logical_and_expression = 95,    /* logical_and_expression  */
+  YYSYMBOL_inclusive_or_expression = 96,   /* inclusive_or_expression  */
+  YYSYMBOL_exclusive_or_expression = 97,   /* exclusive_or_expression  */
+  YYSYMBOL_and_expression = 98,            /* and_expression  */
+  YYSYMBOL_equality_expression = 99,       /* equality_expression  */
+  YYSYMBOL_relational_expression = 100,    /* relational_expression  */
+  YYSYMBOL_shift_expression = 101,         /* shift_expression  */
+  YYSYMBOL_additive_expression = 102,      /* additive_expression  */
+  YYSYMBOL_multiplicative_expression = 103, /* multiplicative_expression  */
+  YYSYMBOL_unary_expression = 104,         /* unary_expression  */
+  YYSYMBOL_unary_operator = 105,           /* unary_operator  */
+  YYSYMBOL_postfix_expression = 106,       /* postfix_expression  */
+  YYSYMBOL_argument_expression_list = 107, /* argument_expression_list  */
+  YYSYMBOL_table_constructor = 108,        /* table_constructor  */
+  YYSYMBOL_function_constructor = 109,     /* function_constructor  */
+  YYSYMBOL_field_list = 110,               /* field_list  */
+  YYSYMBOL_field = 111,                    /* field  */
+  YYSYMBOL_constant_field_index = 112,     /* constant_field_index  */
+  YYSYMBOL_parameter_list = 113,           /* parameter_list  */
+  YYSYMBOL_parameter = 114,                /* parameter  */
+  YYSYMBOL_primary_expression = 115,       /* primary_expression  */
+  YYSYMBOL_identifier = 116,               /* identifier  */
+  YYSYMBOL_constant = 117,                 /* constant  */
+  YYSYMBOL_constant_string_list = 118      /* constant_string_list  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
 #endif
 
-#ifndef YYSTYPE
-#define YYSTYPE int
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
-#include <stdio.h>
 
-#ifndef __cplusplus
-#ifndef __STDC__
-#define const
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
 #endif
 
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
 
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
 
-#define	YYFINAL		265
-#define	YYFLAG		-32768
-#define	YYNTBASE	75
-
-#define YYTRANSLATE(x) ((unsigned)(x) <= 306 ? yytranslate[x] : 117)
-
-static const char yytranslate[] = {     0,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,    73,     2,     2,     2,    71,    64,     2,    56,
-    57,    69,    67,    74,    68,    61,    70,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,    58,    54,    65,
-    55,    66,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-    59,     2,    60,    63,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,    52,    62,    53,    72,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     1,     2,     3,     4,     5,
-     6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
-    16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-    26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-    36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-    46,    47,    48,    49,    50,    51
-};
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
 
-#if YYDEBUG != 0
-static const short yyprhs[] = {     0,
-     0,     2,     4,     7,     9,    11,    13,    15,    17,    20,
-    24,    28,    34,    36,    38,    40,    42,    45,    51,    59,
-    67,    71,    74,    82,    86,    91,    95,    97,   100,   102,
-   107,   111,   113,   116,   118,   120,   126,   132,   139,   147,
-   155,   165,   168,   171,   174,   178,   180,   184,   188,   192,
-   196,   200,   204,   208,   212,   216,   220,   224,   226,   229,
-   231,   233,   237,   239,   243,   245,   249,   251,   255,   257,
-   261,   263,   267,   271,   273,   277,   281,   285,   289,   291,
-   295,   299,   301,   305,   309,   311,   315,   319,   323,   325,
-   328,   330,   332,   334,   336,   338,   343,   347,   352,   358,
-   365,   369,   371,   375,   379,   384,   387,   391,   396,   402,
-   407,   409,   413,   415,   419,   425,   427,   429,   433,   435,
-   439,   441,   444,   446,   448,   450,   452,   456,   458,   460,
-   462,   464,   466,   468,   470,   472,   474,   476,   478
-};
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
 
-static const short yyrhs[] = {    76,
-     0,    77,     0,    76,    77,     0,    81,     0,    79,     0,
-    82,     0,    87,     0,    88,     0,    52,    53,     0,    52,
-    76,    53,     0,    80,   114,    54,     0,    80,   114,    55,
-    91,    54,     0,     3,     0,     4,     0,     5,     0,    54,
-     0,    89,    54,     0,     8,    56,    91,    57,    78,     0,
-     8,    56,    91,    57,    78,     9,    78,     0,     8,    56,
-    91,    57,    78,     9,    82,     0,    24,   114,    78,     0,
-    24,    78,     0,    25,    56,    91,    57,    52,    84,    53,
-     0,    26,    85,    58,     0,    26,    85,    58,    78,     0,
-    27,    58,    78,     0,    83,     0,    84,    83,     0,    86,
-     0,    85,    59,    91,    60,     0,    85,    61,   114,     0,
-   114,     0,    61,   114,     0,    21,     0,   115,     0,    10,
-    56,    91,    57,    78,     0,    17,    56,    91,    57,    78,
-     0,    11,    56,    81,    90,    57,    78,     0,    11,    56,
-    81,    90,    89,    57,    78,     0,    12,    56,   114,    13,
-    91,    57,    78,     0,    12,    56,   114,     6,   114,    13,
-    91,    57,    78,     0,    15,    54,     0,    14,    54,     0,
-    18,    54,     0,    18,    91,    54,     0,    92,     0,   104,
-    55,    92,     0,   104,    35,    92,     0,   104,    36,    92,
-     0,   104,    37,    92,     0,   104,    38,    92,     0,   104,
-    39,    92,     0,   104,    40,    92,     0,   104,    41,    92,
-     0,   104,    42,    92,     0,   104,    43,    92,     0,   104,
-    44,    92,     0,    54,     0,    91,    54,     0,    92,     0,
-    93,     0,    92,     7,    93,     0,    94,     0,    93,     6,
-    94,     0,    95,     0,    94,    62,    95,     0,    96,     0,
-    95,    63,    96,     0,    97,     0,    96,    64,    97,     0,
-    98,     0,    97,    49,    98,     0,    97,    50,    98,     0,
-    99,     0,    98,    65,    99,     0,    98,    66,    99,     0,
-    98,    47,    99,     0,    98,    48,    99,     0,   100,     0,
-    99,    46,   100,     0,    99,    45,   100,     0,   101,     0,
-   100,    67,   101,     0,   100,    68,   101,     0,   102,     0,
-   101,    69,   102,     0,   101,    70,   102,     0,   101,    71,
-   102,     0,   104,     0,   103,   102,     0,    67,     0,    68,
-     0,    72,     0,    73,     0,   113,     0,   104,    59,    91,
-    60,     0,   104,    56,    57,     0,   104,    56,   105,    57,
-     0,   104,    58,   114,    56,    57,     0,   104,    58,   114,
-    56,   105,    57,     0,   104,    61,   114,     0,    91,     0,
-   105,    74,    91,     0,    20,    56,    57,     0,    20,    56,
-   108,    57,     0,    52,    53,     0,    52,   108,    53,     0,
-    52,   108,    74,    53,     0,    19,    56,   111,    57,    78,
-     0,    19,    56,    57,    78,     0,   109,     0,   108,    74,
-   109,     0,    91,     0,   114,    55,    91,     0,    59,   110,
-    60,    55,    91,     0,    31,     0,   112,     0,   111,    74,
-   112,     0,   114,     0,   114,    55,    91,     0,   114,     0,
-    61,   114,     0,    21,     0,   115,     0,   106,     0,   107,
-     0,    56,    91,    57,     0,    28,     0,    29,     0,    30,
-     0,    31,     0,    22,     0,    23,     0,    32,     0,    33,
-     0,   116,     0,    16,     0,    34,     0,   116,    34,     0
-};
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
 
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
 #endif
 
-#if YYDEBUG != 0
-static const short yyrline[] = { 0,
-   126,   133,   137,   144,   148,   152,   156,   160,   167,   171,
-   179,   184,   193,   197,   201,   207,   211,   218,   224,   231,
-   238,   244,   249,   258,   264,   271,   279,   283,   290,   294,
-   298,   305,   309,   314,   318,   327,   333,   339,   346,   354,
-   361,   372,   376,   380,   384,   392,   400,   404,   408,   412,
-   416,   420,   424,   428,   432,   436,   440,   448,   452,   459,
-   466,   470,   477,   481,   488,   492,   500,   504,   512,   516,
-   524,   528,   532,   539,   543,   547,   551,   555,   562,   566,
-   571,   579,   583,   588,   596,   600,   605,   610,   618,   622,
-   631,   635,   639,   643,   650,   654,   658,   663,   669,   675,
-   682,   689,   693,   700,   704,   709,   713,   718,   726,   732,
-   740,   744,   751,   755,   759,   766,   775,   779,   786,   791,
-   800,   804,   809,   813,   817,   821,   825,   832,   841,   846,
-   851,   856,   861,   866,   912,   917,   921,   929,   943
-};
 
-static const char * const yytname[] = {   "$","error","$undefined.","KEYWORD_LOCAL",
-"KEYWORD_GLOBAL","KEYWORD_MEMBER","KEYWORD_AND","KEYWORD_OR","KEYWORD_IF","KEYWORD_ELSE",
-"KEYWORD_WHILE","KEYWORD_FOR","KEYWORD_FOREACH","KEYWORD_IN","KEYWORD_BREAK",
-"KEYWORD_CONTINUE","KEYWORD_NULL","KEYWORD_DOWHILE","KEYWORD_RETURN","KEYWORD_FUNCTION",
-"KEYWORD_TABLE","KEYWORD_THIS","KEYWORD_TRUE","KEYWORD_FALSE","KEYWORD_FORK",
-"KEYWORD_SWITCH","KEYWORD_CASE","KEYWORD_DEFAULT","IDENTIFIER","CONSTANT_HEX",
-"CONSTANT_BINARY","CONSTANT_INT","CONSTANT_CHAR","CONSTANT_FLOAT","CONSTANT_STRING",
-"SYMBOL_ASGN_BSR","SYMBOL_ASGN_BSL","SYMBOL_ASGN_ADD","SYMBOL_ASGN_MINUS","SYMBOL_ASGN_TIMES",
-"SYMBOL_ASGN_DIVIDE","SYMBOL_ASGN_REM","SYMBOL_ASGN_BAND","SYMBOL_ASGN_BOR",
-"SYMBOL_ASGN_BXOR","SYMBOL_RIGHT_SHIFT","SYMBOL_LEFT_SHIFT","SYMBOL_LTE","SYMBOL_GTE",
-"SYMBOL_EQ","SYMBOL_NEQ","TOKEN_ERROR","'{'","'}'","';'","'='","'('","')'","':'",
-"'['","']'","'.'","'|'","'^'","'&'","'<'","'>'","'+'","'-'","'*'","'/'","'%'",
-"'~'","'!'","','","program","statement_list","statement","compound_statement",
-"var_statement","var_type","expression_statement","selection_statement","case_selection_statement",
-"case_selection_statement_list","postfix_case_expression","case_expression",
-"iteration_statement","jump_statement","assignment_expression","constant_expression_statement",
-"constant_expression","logical_or_expression","logical_and_expression","inclusive_or_expression",
-"exclusive_or_expression","and_expression","equality_expression","relational_expression",
-"shift_expression","additive_expression","multiplicative_expression","unary_expression",
-"unary_operator","postfix_expression","argument_expression_list","table_constructor",
-"function_constructor","field_list","field","constant_field_index","parameter_list",
-"parameter","primary_expression","identifier","constant","constant_string_list",
-""
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* 1 */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
 };
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
 #endif
 
-static const short yyr1[] = {     0,
-    75,    76,    76,    77,    77,    77,    77,    77,    78,    78,
-    79,    79,    80,    80,    80,    81,    81,    82,    82,    82,
-    82,    82,    82,    83,    83,    83,    84,    84,    85,    85,
-    85,    86,    86,    86,    86,    87,    87,    87,    87,    87,
-    87,    88,    88,    88,    88,    89,    89,    89,    89,    89,
-    89,    89,    89,    89,    89,    89,    89,    90,    90,    91,
-    92,    92,    93,    93,    94,    94,    95,    95,    96,    96,
-    97,    97,    97,    98,    98,    98,    98,    98,    99,    99,
-    99,   100,   100,   100,   101,   101,   101,   101,   102,   102,
-   103,   103,   103,   103,   104,   104,   104,   104,   104,   104,
-   104,   105,   105,   106,   106,   106,   106,   106,   107,   107,
-   108,   108,   109,   109,   109,   110,   111,   111,   112,   112,
-   113,   113,   113,   113,   113,   113,   113,   114,   115,   115,
-   115,   115,   115,   115,   115,   115,   115,   116,   116
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  91
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1067
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  76
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  43
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  141
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  267
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   307
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    74,     2,     2,     2,    72,    65,     2,
+      57,    58,    70,    68,    75,    69,    62,    71,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    59,    55,
+      66,    56,    67,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    60,     2,    61,    64,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    53,    63,    54,    73,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52
 };
 
-static const short yyr2[] = {     0,
-     1,     1,     2,     1,     1,     1,     1,     1,     2,     3,
-     3,     5,     1,     1,     1,     1,     2,     5,     7,     7,
-     3,     2,     7,     3,     4,     3,     1,     2,     1,     4,
-     3,     1,     2,     1,     1,     5,     5,     6,     7,     7,
-     9,     2,     2,     2,     3,     1,     3,     3,     3,     3,
-     3,     3,     3,     3,     3,     3,     3,     1,     2,     1,
-     1,     3,     1,     3,     1,     3,     1,     3,     1,     3,
-     1,     3,     3,     1,     3,     3,     3,     3,     1,     3,
-     3,     1,     3,     3,     1,     3,     3,     3,     1,     2,
-     1,     1,     1,     1,     1,     4,     3,     4,     5,     6,
-     3,     1,     3,     3,     4,     2,     3,     4,     5,     4,
-     1,     3,     1,     3,     5,     1,     1,     3,     1,     3,
-     1,     2,     1,     1,     1,     1,     3,     1,     1,     1,
-     1,     1,     1,     1,     1,     1,     1,     1,     2
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   130,   130,   137,   141,   148,   152,   156,   160,   164,
+     171,   175,   183,   188,   197,   201,   205,   209,   215,   219,
+     226,   232,   239,   246,   252,   257,   267,   273,   279,   287,
+     291,   298,   302,   306,   313,   317,   322,   326,   335,   341,
+     347,   354,   362,   369,   380,   384,   388,   392,   400,   408,
+     412,   416,   420,   424,   428,   432,   436,   440,   444,   448,
+     456,   460,   467,   474,   478,   485,   489,   496,   500,   508,
+     512,   520,   524,   532,   536,   540,   547,   551,   555,   559,
+     563,   570,   574,   579,   587,   591,   596,   604,   608,   613,
+     618,   626,   630,   639,   643,   647,   651,   658,   662,   666,
+     671,   677,   683,   690,   697,   701,   708,   712,   717,   721,
+     726,   734,   740,   748,   752,   759,   763,   767,   775,   783,
+     787,   794,   799,   808,   812,   817,   821,   825,   829,   833,
+     840,   849,   854,   859,   864,   869,   874,   920,   925,   929,
+     937,   951
 };
+#endif
 
-static const short yydefact[] = {     0,
-    13,    14,    15,     0,     0,     0,     0,     0,     0,   137,
-     0,     0,     0,     0,   123,   132,   133,     0,     0,   128,
-   129,   130,   131,   134,   135,   138,     0,    16,     0,     0,
-    91,    92,    93,    94,     1,     2,     5,     0,     4,     6,
-     7,     8,     0,    46,    61,    63,    65,    67,    69,    71,
-    74,    79,    82,    85,     0,    89,   125,   126,    95,   121,
-   124,   136,     0,     0,     0,     0,    43,    42,     0,    44,
-     0,    60,    89,     0,     0,     0,    22,     0,     0,   106,
-     0,   113,     0,   111,   121,     0,   122,     3,     0,    17,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,    90,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,   139,     0,     0,     0,     0,     0,
-    45,     0,     0,   117,   119,   104,     0,     9,     0,    21,
-     0,   116,     0,   107,     0,     0,   127,    11,     0,    62,
-    64,    66,    68,    70,    72,    73,    77,    78,    75,    76,
-    81,    80,    83,    84,    86,    87,    88,    48,    49,    50,
-    51,    52,    53,    54,    55,    56,    57,    47,    97,   102,
-     0,     0,     0,   101,     0,     0,    58,     0,     0,     0,
-     0,     0,   110,     0,     0,     0,   105,     0,    10,     0,
-     0,   108,   112,   114,     0,    98,     0,     0,    96,    18,
-    36,     0,     0,    59,     0,     0,    37,   109,   118,   120,
-     0,     0,    12,   103,    99,     0,     0,    38,     0,     0,
-     0,     0,     0,    27,     0,   115,   100,    19,    20,    39,
-     0,    40,    34,     0,     0,    29,    32,    35,     0,    23,
-    28,     0,    33,    24,     0,     0,    26,    41,    25,     0,
-    31,    30,     0,     0,     0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "KEYWORD_LOCAL",
+  "KEYWORD_GLOBAL", "KEYWORD_MEMBER", "KEYWORD_INLINE", "KEYWORD_AND",
+  "KEYWORD_OR", "KEYWORD_IF", "KEYWORD_ELSE", "KEYWORD_WHILE",
+  "KEYWORD_FOR", "KEYWORD_FOREACH", "KEYWORD_IN", "KEYWORD_BREAK",
+  "KEYWORD_CONTINUE", "KEYWORD_NULL", "KEYWORD_DOWHILE", "KEYWORD_RETURN",
+  "KEYWORD_FUNCTION", "KEYWORD_TABLE", "KEYWORD_THIS", "KEYWORD_TRUE",
+  "KEYWORD_FALSE", "KEYWORD_FORK", "KEYWORD_SWITCH", "KEYWORD_CASE",
+  "KEYWORD_DEFAULT", "IDENTIFIER", "CONSTANT_HEX", "CONSTANT_BINARY",
+  "CONSTANT_INT", "CONSTANT_CHAR", "CONSTANT_FLOAT", "CONSTANT_STRING",
+  "SYMBOL_ASGN_BSR", "SYMBOL_ASGN_BSL", "SYMBOL_ASGN_ADD",
+  "SYMBOL_ASGN_MINUS", "SYMBOL_ASGN_TIMES", "SYMBOL_ASGN_DIVIDE",
+  "SYMBOL_ASGN_REM", "SYMBOL_ASGN_BAND", "SYMBOL_ASGN_BOR",
+  "SYMBOL_ASGN_BXOR", "SYMBOL_RIGHT_SHIFT", "SYMBOL_LEFT_SHIFT",
+  "SYMBOL_LTE", "SYMBOL_GTE", "SYMBOL_EQ", "SYMBOL_NEQ", "TOKEN_ERROR",
+  "'{'", "'}'", "';'", "'='", "'('", "')'", "':'", "'['", "']'", "'.'",
+  "'|'", "'^'", "'&'", "'<'", "'>'", "'+'", "'-'", "'*'", "'/'", "'%'",
+  "'~'", "'!'", "','", "$accept", "program", "statement_list", "statement",
+  "compound_statement", "var_statement", "var_type",
+  "expression_statement", "selection_statement",
+  "case_selection_statement", "case_selection_statement_list",
+  "postfix_case_expression", "case_expression", "iteration_statement",
+  "jump_statement", "assignment_expression",
+  "constant_expression_statement", "constant_expression",
+  "logical_or_expression", "logical_and_expression",
+  "inclusive_or_expression", "exclusive_or_expression", "and_expression",
+  "equality_expression", "relational_expression", "shift_expression",
+  "additive_expression", "multiplicative_expression", "unary_expression",
+  "unary_operator", "postfix_expression", "argument_expression_list",
+  "table_constructor", "function_constructor", "field_list", "field",
+  "constant_field_index", "parameter_list", "parameter",
+  "primary_expression", "identifier", "constant", "constant_string_list", YY_NULLPTR
 };
 
-static const short yydefgoto[] = {   263,
-    35,    36,    77,    37,    38,    39,    40,   234,   235,   245,
-   246,    41,    42,    43,   188,    82,    72,    45,    46,    47,
-    48,    49,    50,    51,    52,    53,    54,    55,    73,   181,
-    57,    58,    83,    84,   143,   133,   134,    59,    60,    61,
-    62
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-146)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     388,  -146,  -146,  -146,    24,   -22,    -2,     7,    17,   -35,
+      37,  -146,    36,   608,    40,    41,  -146,  -146,  -146,   -11,
+      51,  -146,  -146,  -146,  -146,  -146,  -146,  -146,   443,  -146,
+     993,    84,  -146,  -146,  -146,  -146,   115,   388,  -146,  -146,
+      84,  -146,  -146,  -146,  -146,    62,   113,   128,    75,    77,
+      74,   -10,    -1,    21,    11,   -27,  -146,   993,   124,  -146,
+    -146,  -146,  -146,  -146,   107,  -146,   993,   993,   663,    84,
+    -146,  -146,   993,  -146,    89,   113,    16,   -26,   498,   244,
+    -146,    93,   993,  -146,   116,  -146,   -48,  -146,    91,    92,
+    -146,  -146,  -146,    27,  -146,   993,   993,   993,   993,   993,
+     993,   993,   993,   993,   993,   993,   993,   993,   993,   993,
+     993,   993,   993,  -146,   993,   993,   993,   993,   993,   993,
+     993,   993,   993,   993,   993,   718,    84,   993,    84,  -146,
+      96,    98,   773,     1,    99,  -146,    93,   -46,  -146,   102,
+    -146,   -42,  -146,   316,  -146,   101,  -146,    88,  -146,   553,
+     993,  -146,  -146,   993,   128,    75,    77,    74,   -10,    -1,
+      -1,    21,    21,    21,    21,    11,    11,   -27,   -27,  -146,
+    -146,  -146,   113,   113,   113,   113,   113,   113,   113,   113,
+     113,   113,   113,  -146,  -146,   -39,   114,   109,  -146,    93,
+      93,  -146,   828,   117,    84,   993,    93,  -146,    93,    84,
+     993,  -146,   883,  -146,   121,   119,  -146,  -146,  -146,   122,
+    -146,   993,   938,  -146,   169,  -146,    93,   127,  -146,   175,
+     132,  -146,  -146,  -146,  -146,    57,   993,  -146,  -146,  -146,
+     -37,     5,  -146,    93,   993,    93,    72,   133,  -146,   -17,
+    -146,  -146,  -146,  -146,  -146,   137,  -146,  -146,    84,   -36,
+    -146,  -146,  -146,    93,  -146,  -146,    93,  -146,    93,   993,
+      84,  -146,  -146,  -146,   130,  -146,  -146
 };
 
-static const short yypact[] = {   374,
--32768,-32768,-32768,   -52,   -47,   -41,    -6,    11,    31,-32768,
-    16,   594,    45,    52,-32768,-32768,-32768,   -16,    54,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,   429,-32768,   979,    12,
--32768,-32768,-32768,-32768,   374,-32768,-32768,    12,-32768,-32768,
--32768,-32768,    60,    37,   109,    56,    68,    69,    42,   -24,
-    48,    28,    18,-32768,   979,   246,-32768,-32768,-32768,-32768,
--32768,    98,   979,   979,   649,    12,-32768,-32768,   979,-32768,
-    81,    37,    15,   -22,   484,   242,-32768,    84,   979,-32768,
-   107,-32768,   -37,-32768,    86,    82,-32768,-32768,    43,-32768,
-   979,   979,   979,   979,   979,   979,   979,   979,   979,   979,
-   979,   979,   979,   979,   979,   979,   979,   979,-32768,   979,
-   979,   979,   979,   979,   979,   979,   979,   979,   979,   979,
-   704,    12,   979,    12,-32768,    87,    88,   759,     5,    89,
--32768,    84,   -18,-32768,    92,-32768,   -14,-32768,   308,-32768,
-    91,-32768,    83,-32768,   539,   979,-32768,-32768,   979,   109,
-    56,    68,    69,    42,   -24,   -24,    48,    48,    48,    48,
-    28,    28,    18,    18,-32768,-32768,-32768,    37,    37,    37,
-    37,    37,    37,    37,    37,    37,    37,    37,-32768,-32768,
-   -10,    94,    93,-32768,    84,    84,-32768,   814,    97,    12,
-   979,    84,-32768,    84,    12,   979,-32768,   869,-32768,   100,
-    99,-32768,-32768,-32768,   103,-32768,   979,   924,-32768,   149,
--32768,    84,   102,-32768,   147,   104,-32768,-32768,-32768,-32768,
-    73,   979,-32768,-32768,-32768,    -8,    38,-32768,    84,   979,
-    84,    -2,   105,-32768,   -19,-32768,-32768,-32768,-32768,-32768,
-   108,-32768,-32768,    12,    19,-32768,-32768,-32768,    84,-32768,
--32768,    84,-32768,    84,   979,    12,-32768,-32768,-32768,   106,
--32768,-32768,   167,   168,-32768
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       0,    14,    15,    17,     0,     0,     0,     0,     0,     0,
+       0,   139,     0,     0,     0,     0,   125,   134,   135,     0,
+       0,   130,   131,   132,   133,   136,   137,   140,     0,    18,
+       0,     0,    93,    94,    95,    96,     0,     2,     3,     6,
+       0,     5,     7,     8,     9,     0,    48,    63,    65,    67,
+      69,    71,    73,    76,    81,    84,    87,     0,    91,   127,
+     128,    97,   123,   126,   138,    16,     0,     0,     0,     0,
+      45,    44,     0,    46,     0,    62,    91,     0,     0,     0,
+      24,     0,     0,   108,     0,   115,     0,   113,   123,     0,
+     124,     1,     4,     0,    19,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    92,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   141,
+       0,     0,     0,     0,     0,    47,     0,     0,   119,   121,
+     106,     0,    10,     0,    23,     0,   118,     0,   109,     0,
+       0,   129,    12,     0,    64,    66,    68,    70,    72,    74,
+      75,    79,    80,    77,    78,    83,    82,    85,    86,    88,
+      89,    90,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    49,    99,   104,     0,     0,     0,   103,     0,
+       0,    60,     0,     0,     0,     0,     0,   112,     0,     0,
+       0,   107,     0,    11,     0,     0,   110,   114,   116,     0,
+     100,     0,     0,    98,    20,    38,     0,     0,    61,     0,
+       0,    39,   111,   120,   122,     0,     0,    13,   105,   101,
+       0,     0,    40,     0,     0,     0,     0,     0,    29,     0,
+     117,   102,    21,    22,    41,     0,    42,    36,     0,     0,
+      31,    34,    37,     0,    25,    30,     0,    35,    26,     0,
+       0,    28,    43,    27,     0,    33,    32
 };
 
-static const short yypgoto[] = {-32768,
-    95,   -34,   -30,-32768,-32768,   110,   -58,   -65,-32768,-32768,
--32768,-32768,-32768,   -15,-32768,   -12,    10,    85,    80,    90,
-   111,    79,     7,   -17,     4,     8,   -53,-32768,     3,   -31,
--32768,-32768,   112,  -140,-32768,-32768,    -9,-32768,    -5,   -54,
--32768
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -146,  -146,   118,   -32,   -80,  -146,  -146,   134,   -31,   -34,
+    -146,  -146,  -146,  -146,  -146,    12,  -146,   -13,     9,   108,
+     110,   111,   112,   120,   -14,   -53,   -16,    -9,   -50,  -146,
+       2,    -5,  -146,  -146,   131,  -145,  -146,  -146,    13,  -146,
+      -6,   -25,  -146
 };
 
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
+{
+       0,    36,    37,    38,    80,    39,    40,    41,    42,   238,
+     239,   249,   250,    43,    44,    45,   192,    85,    75,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      76,   185,    59,    60,    86,    87,   147,   137,   138,    61,
+      62,    63,    64
+};
 
-#define	YYLAST		1052
-
-
-static const short yytable[] = {    71,
-    88,   109,    56,    63,   203,    20,   232,   233,    64,    44,
-   190,    20,    78,    10,    65,   144,    86,   191,   243,    16,
-    17,    85,    98,    99,    87,    20,    21,    22,    23,    24,
-    25,    26,    89,   250,   132,    76,   145,    56,   194,    20,
-   100,   101,   197,    91,    44,     4,   206,   140,   237,    66,
-   126,   127,   165,   166,   167,   195,   130,   203,   244,   198,
-   129,    18,    19,   207,    67,   207,   141,    56,   135,    85,
-   121,    69,   122,   123,    44,   124,   254,   255,    56,   256,
-   157,   158,   159,   160,    68,    44,   106,   107,   108,    76,
-    96,    97,   102,   103,   104,   105,   148,   149,   232,   233,
-    74,   193,   155,   156,    88,   161,   162,    75,   180,    79,
-   183,   163,   164,    90,    92,   189,   182,    93,   184,   168,
-   169,   170,   171,   172,   173,   174,   175,   176,   177,   178,
-    94,   125,    95,   204,   131,    76,   205,   142,   147,    85,
-   146,    56,   201,   185,   186,   192,   196,   200,    44,   208,
-   214,   221,   209,   222,   210,   211,   223,   227,   229,   230,
-   231,   217,   249,   218,   252,   262,   264,   265,   239,   251,
-   139,   151,   213,   154,   128,   150,   226,   248,   216,     0,
-     0,   228,   152,   220,   215,   219,   137,     0,     0,   135,
-    56,     0,    85,     0,   224,   180,   238,    44,   240,     0,
-   242,     0,     0,     0,   153,     0,     0,     0,     0,   236,
-     0,     0,     0,     0,     0,     0,     0,   241,   257,     0,
-     0,   258,     0,   259,     0,     0,   247,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,   253,     0,
-     0,     0,   260,     0,     1,     2,     3,     0,     0,     4,
-   261,     5,     6,     7,     0,     8,     9,    10,    11,    12,
-    13,    14,    15,    16,    17,    18,    19,     0,     0,    20,
-    21,    22,    23,    24,    25,    26,     0,     0,     0,     0,
-   110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
-     0,     0,     0,    27,   138,    28,     0,    29,     0,     0,
-   120,   121,    30,   122,   123,     0,   124,     0,    31,    32,
-     1,     2,     3,    33,    34,     4,     0,     5,     6,     7,
-     0,     8,     9,    10,    11,    12,    13,    14,    15,    16,
-    17,    18,    19,     0,     0,    20,    21,    22,    23,    24,
-    25,    26,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,    27,
-   199,    28,     0,    29,     0,     0,     0,     0,    30,     0,
-     0,     0,     0,     0,    31,    32,     1,     2,     3,    33,
-    34,     4,     0,     5,     6,     7,     0,     8,     9,    10,
-    11,    12,    13,    14,    15,    16,    17,    18,    19,     0,
-     0,    20,    21,    22,    23,    24,    25,    26,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,    27,     0,    28,     0,    29,
-     0,     0,     0,     0,    30,     0,     0,     0,     0,     0,
-    31,    32,     0,     0,    10,    33,    34,    13,    14,    15,
-    16,    17,     0,     0,     0,     0,    20,    21,    22,    23,
-    24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    27,    80,     0,     0,    29,     0,     0,    81,     0,    30,
-     0,     0,     0,     0,     0,    31,    32,     0,     0,    10,
-    33,    34,    13,    14,    15,    16,    17,     0,     0,     0,
-     0,    20,    21,    22,    23,    24,    25,    26,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,    27,     0,     0,     0,    29,
-   136,     0,    81,     0,    30,     0,     0,     0,     0,     0,
-    31,    32,     0,     0,    10,    33,    34,    13,    14,    15,
-    16,    17,     0,     0,     0,     0,    20,    21,    22,    23,
-    24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    27,   202,     0,     0,    29,     0,     0,    81,     0,    30,
-     0,     0,     0,     0,     0,    31,    32,     0,     0,    10,
-    33,    34,    13,    14,    15,    16,    17,     0,     0,     0,
-     0,    20,    21,    22,    23,    24,    25,    26,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,    27,     0,    70,     0,    29,
-     0,     0,     0,     0,    30,     0,     0,     0,     0,     0,
-    31,    32,     0,     0,    10,    33,    34,    13,    14,    15,
-    16,    17,     0,     0,     0,     0,    20,    21,    22,    23,
-    24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    27,     0,    28,     0,    29,     0,     0,     0,     0,    30,
-     0,     0,     0,     0,     0,    31,    32,     0,     0,    10,
-    33,    34,    13,    14,    15,    16,    17,     0,     0,     0,
-     0,    20,    21,    22,    23,    24,    25,    26,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,    27,     0,     0,     0,    29,
-   179,     0,     0,     0,    30,     0,     0,     0,     0,     0,
-    31,    32,     0,     0,    10,    33,    34,    13,    14,    15,
-    16,    17,     0,     0,     0,     0,    20,    21,    22,    23,
-    24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    27,     0,   187,     0,    29,     0,     0,     0,     0,    30,
-     0,     0,     0,     0,     0,    31,    32,     0,     0,    10,
-    33,    34,    13,    14,    15,    16,    17,     0,     0,     0,
-     0,    20,    21,    22,    23,    24,    25,    26,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,    27,     0,     0,     0,    29,
-   212,     0,     0,     0,    30,     0,     0,     0,     0,     0,
-    31,    32,     0,     0,    10,    33,    34,    13,    14,    15,
-    16,    17,     0,     0,     0,     0,    20,    21,    22,    23,
-    24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    27,     0,     0,     0,    29,     0,     0,    81,     0,    30,
-     0,     0,     0,     0,     0,    31,    32,     0,     0,    10,
-    33,    34,    13,    14,    15,    16,    17,     0,     0,     0,
-     0,    20,    21,    22,    23,    24,    25,    26,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,    27,     0,     0,     0,    29,
-   225,     0,     0,     0,    30,     0,     0,     0,     0,     0,
-    31,    32,     0,     0,    10,    33,    34,    13,    14,    15,
-    16,    17,     0,     0,     0,     0,    20,    21,    22,    23,
-    24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    27,     0,     0,     0,    29,     0,     0,     0,     0,    30,
-     0,     0,     0,     0,     0,    31,    32,     0,     0,     0,
-    33,    34
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      74,   144,    58,    21,   207,    92,   148,   113,   194,    46,
+     236,   237,   198,    81,     5,   195,   201,    89,    21,   210,
+      70,   241,    88,   258,   259,    90,   260,   149,    65,   199,
+      19,    20,   136,   202,    93,    66,   211,   254,   211,    58,
+     100,   101,    79,   110,   111,   112,    46,   102,   103,   161,
+     162,   163,   164,   130,   131,    67,   197,   207,    79,   134,
+     169,   170,   171,   133,    68,   104,   105,   106,   107,   145,
+      58,   139,    88,   125,    69,   126,   127,    46,   128,   108,
+     109,    58,   152,   153,   236,   237,   159,   160,    46,    11,
+     165,   166,    71,    72,   247,    17,    18,    77,    78,   167,
+     168,    21,    22,    23,    24,    25,    26,    27,    82,   214,
+     215,    92,   184,    21,   187,    91,   221,    94,   222,   193,
+     186,    95,   188,   172,   173,   174,   175,   176,   177,   178,
+     179,   180,   181,   182,   248,    96,   232,   208,    97,    99,
+     209,    98,   129,    88,   135,    58,    79,   150,   146,   205,
+     151,   242,    46,   244,   189,   246,   190,   196,   200,   204,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     213,   212,   218,   261,   225,   226,   262,   227,   263,   231,
+     124,   125,   220,   126,   127,   233,   128,   224,   219,   234,
+     235,   266,   253,   139,    58,   256,    88,   143,   228,   184,
+     243,    46,   132,   154,   217,   255,   155,   230,   156,   141,
+     157,   252,   223,   240,     0,     0,     0,     0,     0,   158,
+       0,   245,     0,     0,     0,     0,     0,     0,     0,     0,
+     251,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   257,     0,     0,     0,   264,     1,     2,     3,
+       4,     0,     0,     5,   265,     6,     7,     8,     0,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,     0,     0,    21,    22,    23,    24,    25,    26,    27,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    28,   142,    29,
+       0,    30,     0,     0,     0,     0,    31,     0,     0,     0,
+       0,     0,    32,    33,     0,     0,     0,    34,    35,     1,
+       2,     3,     4,     0,     0,     5,     0,     6,     7,     8,
+       0,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,     0,     0,    21,    22,    23,    24,    25,
+      26,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    28,
+     203,    29,     0,    30,     0,     0,     0,     0,    31,     0,
+       0,     0,     0,     0,    32,    33,     0,     0,     0,    34,
+      35,     1,     2,     3,     4,     0,     0,     5,     0,     6,
+       7,     8,     0,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,     0,     0,    21,    22,    23,
+      24,    25,    26,    27,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    28,     0,    29,     0,    30,     0,     0,     0,     0,
+      31,     0,     0,     0,     0,     0,    32,    33,     0,     0,
+      11,    34,    35,    14,    15,    16,    17,    18,     0,     0,
+       0,     0,    21,    22,    23,    24,    25,    26,    27,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    28,    83,     0,     0,
+      30,     0,     0,    84,     0,    31,     0,     0,     0,     0,
+       0,    32,    33,     0,     0,    11,    34,    35,    14,    15,
+      16,    17,    18,     0,     0,     0,     0,    21,    22,    23,
+      24,    25,    26,    27,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    28,     0,     0,     0,    30,   140,     0,    84,     0,
+      31,     0,     0,     0,     0,     0,    32,    33,     0,     0,
+      11,    34,    35,    14,    15,    16,    17,    18,     0,     0,
+       0,     0,    21,    22,    23,    24,    25,    26,    27,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    28,   206,     0,     0,
+      30,     0,     0,    84,     0,    31,     0,     0,     0,     0,
+       0,    32,    33,     0,     0,    11,    34,    35,    14,    15,
+      16,    17,    18,     0,     0,     0,     0,    21,    22,    23,
+      24,    25,    26,    27,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    28,     0,    73,     0,    30,     0,     0,     0,     0,
+      31,     0,     0,     0,     0,     0,    32,    33,     0,     0,
+      11,    34,    35,    14,    15,    16,    17,    18,     0,     0,
+       0,     0,    21,    22,    23,    24,    25,    26,    27,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    28,     0,    29,     0,
+      30,     0,     0,     0,     0,    31,     0,     0,     0,     0,
+       0,    32,    33,     0,     0,    11,    34,    35,    14,    15,
+      16,    17,    18,     0,     0,     0,     0,    21,    22,    23,
+      24,    25,    26,    27,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    28,     0,     0,     0,    30,   183,     0,     0,     0,
+      31,     0,     0,     0,     0,     0,    32,    33,     0,     0,
+      11,    34,    35,    14,    15,    16,    17,    18,     0,     0,
+       0,     0,    21,    22,    23,    24,    25,    26,    27,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    28,     0,   191,     0,
+      30,     0,     0,     0,     0,    31,     0,     0,     0,     0,
+       0,    32,    33,     0,     0,    11,    34,    35,    14,    15,
+      16,    17,    18,     0,     0,     0,     0,    21,    22,    23,
+      24,    25,    26,    27,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    28,     0,     0,     0,    30,   216,     0,     0,     0,
+      31,     0,     0,     0,     0,     0,    32,    33,     0,     0,
+      11,    34,    35,    14,    15,    16,    17,    18,     0,     0,
+       0,     0,    21,    22,    23,    24,    25,    26,    27,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    28,     0,     0,     0,
+      30,     0,     0,    84,     0,    31,     0,     0,     0,     0,
+       0,    32,    33,     0,     0,    11,    34,    35,    14,    15,
+      16,    17,    18,     0,     0,     0,     0,    21,    22,    23,
+      24,    25,    26,    27,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    28,     0,     0,     0,    30,   229,     0,     0,     0,
+      31,     0,     0,     0,     0,     0,    32,    33,     0,     0,
+      11,    34,    35,    14,    15,    16,    17,    18,     0,     0,
+       0,     0,    21,    22,    23,    24,    25,    26,    27,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    28,     0,     0,     0,
+      30,     0,     0,     0,     0,    31,     0,     0,     0,     0,
+       0,    32,    33,     0,     0,     0,    34,    35
 };
 
-static const short yycheck[] = {    12,
-    35,    55,     0,    56,   145,    28,    26,    27,    56,     0,
-     6,    28,    18,    16,    56,    53,    29,    13,    21,    22,
-    23,    27,    47,    48,    30,    28,    29,    30,    31,    32,
-    33,    34,    38,    53,    57,    52,    74,    35,    57,    28,
-    65,    66,    57,     7,    35,     8,    57,    78,    57,    56,
-    63,    64,   106,   107,   108,    74,    69,   198,    61,    74,
-    66,    24,    25,    74,    54,    74,    79,    65,    74,    75,
-    56,    56,    58,    59,    65,    61,    58,    59,    76,    61,
-    98,    99,   100,   101,    54,    76,    69,    70,    71,    52,
-    49,    50,    45,    46,    67,    68,    54,    55,    26,    27,
-    56,   132,    96,    97,   139,   102,   103,    56,   121,    56,
-   123,   104,   105,    54,     6,   128,   122,    62,   124,   110,
-   111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
-    63,    34,    64,   146,    54,    52,   149,    31,    57,   145,
-    55,   139,    60,    57,    57,    57,    55,    57,   139,    56,
-    54,    52,    60,    55,   185,   186,    54,     9,    57,    13,
-    57,   192,    58,   194,    57,    60,     0,     0,   227,   235,
-    76,    92,   188,    95,    65,    91,   208,   232,   191,    -1,
-    -1,   212,    93,   196,   190,   195,    75,    -1,    -1,   195,
-   188,    -1,   198,    -1,   207,   208,   227,   188,   229,    -1,
-   231,    -1,    -1,    -1,    94,    -1,    -1,    -1,    -1,   222,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,   230,   249,    -1,
-    -1,   252,    -1,   254,    -1,    -1,   232,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   244,    -1,
-    -1,    -1,   255,    -1,     3,     4,     5,    -1,    -1,     8,
-   256,    10,    11,    12,    -1,    14,    15,    16,    17,    18,
-    19,    20,    21,    22,    23,    24,    25,    -1,    -1,    28,
-    29,    30,    31,    32,    33,    34,    -1,    -1,    -1,    -1,
-    35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-    -1,    -1,    -1,    52,    53,    54,    -1,    56,    -1,    -1,
-    55,    56,    61,    58,    59,    -1,    61,    -1,    67,    68,
-     3,     4,     5,    72,    73,     8,    -1,    10,    11,    12,
-    -1,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-    23,    24,    25,    -1,    -1,    28,    29,    30,    31,    32,
-    33,    34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    52,
-    53,    54,    -1,    56,    -1,    -1,    -1,    -1,    61,    -1,
-    -1,    -1,    -1,    -1,    67,    68,     3,     4,     5,    72,
-    73,     8,    -1,    10,    11,    12,    -1,    14,    15,    16,
-    17,    18,    19,    20,    21,    22,    23,    24,    25,    -1,
-    -1,    28,    29,    30,    31,    32,    33,    34,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    52,    -1,    54,    -1,    56,
-    -1,    -1,    -1,    -1,    61,    -1,    -1,    -1,    -1,    -1,
-    67,    68,    -1,    -1,    16,    72,    73,    19,    20,    21,
-    22,    23,    -1,    -1,    -1,    -1,    28,    29,    30,    31,
-    32,    33,    34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    52,    53,    -1,    -1,    56,    -1,    -1,    59,    -1,    61,
-    -1,    -1,    -1,    -1,    -1,    67,    68,    -1,    -1,    16,
-    72,    73,    19,    20,    21,    22,    23,    -1,    -1,    -1,
-    -1,    28,    29,    30,    31,    32,    33,    34,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    52,    -1,    -1,    -1,    56,
-    57,    -1,    59,    -1,    61,    -1,    -1,    -1,    -1,    -1,
-    67,    68,    -1,    -1,    16,    72,    73,    19,    20,    21,
-    22,    23,    -1,    -1,    -1,    -1,    28,    29,    30,    31,
-    32,    33,    34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    52,    53,    -1,    -1,    56,    -1,    -1,    59,    -1,    61,
-    -1,    -1,    -1,    -1,    -1,    67,    68,    -1,    -1,    16,
-    72,    73,    19,    20,    21,    22,    23,    -1,    -1,    -1,
-    -1,    28,    29,    30,    31,    32,    33,    34,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    52,    -1,    54,    -1,    56,
-    -1,    -1,    -1,    -1,    61,    -1,    -1,    -1,    -1,    -1,
-    67,    68,    -1,    -1,    16,    72,    73,    19,    20,    21,
-    22,    23,    -1,    -1,    -1,    -1,    28,    29,    30,    31,
-    32,    33,    34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    52,    -1,    54,    -1,    56,    -1,    -1,    -1,    -1,    61,
-    -1,    -1,    -1,    -1,    -1,    67,    68,    -1,    -1,    16,
-    72,    73,    19,    20,    21,    22,    23,    -1,    -1,    -1,
-    -1,    28,    29,    30,    31,    32,    33,    34,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    52,    -1,    -1,    -1,    56,
-    57,    -1,    -1,    -1,    61,    -1,    -1,    -1,    -1,    -1,
-    67,    68,    -1,    -1,    16,    72,    73,    19,    20,    21,
-    22,    23,    -1,    -1,    -1,    -1,    28,    29,    30,    31,
-    32,    33,    34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    52,    -1,    54,    -1,    56,    -1,    -1,    -1,    -1,    61,
-    -1,    -1,    -1,    -1,    -1,    67,    68,    -1,    -1,    16,
-    72,    73,    19,    20,    21,    22,    23,    -1,    -1,    -1,
-    -1,    28,    29,    30,    31,    32,    33,    34,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    52,    -1,    -1,    -1,    56,
-    57,    -1,    -1,    -1,    61,    -1,    -1,    -1,    -1,    -1,
-    67,    68,    -1,    -1,    16,    72,    73,    19,    20,    21,
-    22,    23,    -1,    -1,    -1,    -1,    28,    29,    30,    31,
-    32,    33,    34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    52,    -1,    -1,    -1,    56,    -1,    -1,    59,    -1,    61,
-    -1,    -1,    -1,    -1,    -1,    67,    68,    -1,    -1,    16,
-    72,    73,    19,    20,    21,    22,    23,    -1,    -1,    -1,
-    -1,    28,    29,    30,    31,    32,    33,    34,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    52,    -1,    -1,    -1,    56,
-    57,    -1,    -1,    -1,    61,    -1,    -1,    -1,    -1,    -1,
-    67,    68,    -1,    -1,    16,    72,    73,    19,    20,    21,
-    22,    23,    -1,    -1,    -1,    -1,    28,    29,    30,    31,
-    32,    33,    34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    52,    -1,    -1,    -1,    56,    -1,    -1,    -1,    -1,    61,
-    -1,    -1,    -1,    -1,    -1,    67,    68,    -1,    -1,    -1,
-    72,    73
+static const yytype_int16 yycheck[] =
+{
+      13,    81,     0,    29,   149,    37,    54,    57,     7,     0,
+      27,    28,    58,    19,     9,    14,    58,    30,    29,    58,
+      55,    58,    28,    59,    60,    31,    62,    75,     4,    75,
+      25,    26,    58,    75,    40,    57,    75,    54,    75,    37,
+      50,    51,    53,    70,    71,    72,    37,    48,    49,   102,
+     103,   104,   105,    66,    67,    57,   136,   202,    53,    72,
+     110,   111,   112,    69,    57,    66,    67,    46,    47,    82,
+      68,    77,    78,    57,    57,    59,    60,    68,    62,    68,
+      69,    79,    55,    56,    27,    28,   100,   101,    79,    17,
+     106,   107,    55,    57,    22,    23,    24,    57,    57,   108,
+     109,    29,    30,    31,    32,    33,    34,    35,    57,   189,
+     190,   143,   125,    29,   127,     0,   196,    55,   198,   132,
+     126,     8,   128,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,    62,     7,   216,   150,    63,    65,
+     153,    64,    35,   149,    55,   143,    53,    56,    32,    61,
+      58,   231,   143,   233,    58,   235,    58,    58,    56,    58,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      61,    57,    55,   253,    53,    56,   256,    55,   258,    10,
+      56,    57,   195,    59,    60,    58,    62,   200,   194,    14,
+      58,    61,    59,   199,   192,    58,   202,    79,   211,   212,
+     231,   192,    68,    95,   192,   239,    96,   212,    97,    78,
+      98,   236,   199,   226,    -1,    -1,    -1,    -1,    -1,    99,
+      -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     236,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   248,    -1,    -1,    -1,   259,     3,     4,     5,
+       6,    -1,    -1,     9,   260,    11,    12,    13,    -1,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    -1,    -1,    29,    30,    31,    32,    33,    34,    35,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,
+      -1,    57,    -1,    -1,    -1,    -1,    62,    -1,    -1,    -1,
+      -1,    -1,    68,    69,    -1,    -1,    -1,    73,    74,     3,
+       4,     5,     6,    -1,    -1,     9,    -1,    11,    12,    13,
+      -1,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    -1,    -1,    29,    30,    31,    32,    33,
+      34,    35,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    53,
+      54,    55,    -1,    57,    -1,    -1,    -1,    -1,    62,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    -1,    -1,    -1,    73,
+      74,     3,     4,     5,     6,    -1,    -1,     9,    -1,    11,
+      12,    13,    -1,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    -1,    -1,    29,    30,    31,
+      32,    33,    34,    35,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    -1,    55,    -1,    57,    -1,    -1,    -1,    -1,
+      62,    -1,    -1,    -1,    -1,    -1,    68,    69,    -1,    -1,
+      17,    73,    74,    20,    21,    22,    23,    24,    -1,    -1,
+      -1,    -1,    29,    30,    31,    32,    33,    34,    35,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    -1,    -1,
+      57,    -1,    -1,    60,    -1,    62,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    -1,    -1,    17,    73,    74,    20,    21,
+      22,    23,    24,    -1,    -1,    -1,    -1,    29,    30,    31,
+      32,    33,    34,    35,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    -1,    -1,    -1,    57,    58,    -1,    60,    -1,
+      62,    -1,    -1,    -1,    -1,    -1,    68,    69,    -1,    -1,
+      17,    73,    74,    20,    21,    22,    23,    24,    -1,    -1,
+      -1,    -1,    29,    30,    31,    32,    33,    34,    35,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    -1,    -1,
+      57,    -1,    -1,    60,    -1,    62,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    -1,    -1,    17,    73,    74,    20,    21,
+      22,    23,    24,    -1,    -1,    -1,    -1,    29,    30,    31,
+      32,    33,    34,    35,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    -1,    55,    -1,    57,    -1,    -1,    -1,    -1,
+      62,    -1,    -1,    -1,    -1,    -1,    68,    69,    -1,    -1,
+      17,    73,    74,    20,    21,    22,    23,    24,    -1,    -1,
+      -1,    -1,    29,    30,    31,    32,    33,    34,    35,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    -1,    55,    -1,
+      57,    -1,    -1,    -1,    -1,    62,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    -1,    -1,    17,    73,    74,    20,    21,
+      22,    23,    24,    -1,    -1,    -1,    -1,    29,    30,    31,
+      32,    33,    34,    35,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    -1,    -1,    -1,    57,    58,    -1,    -1,    -1,
+      62,    -1,    -1,    -1,    -1,    -1,    68,    69,    -1,    -1,
+      17,    73,    74,    20,    21,    22,    23,    24,    -1,    -1,
+      -1,    -1,    29,    30,    31,    32,    33,    34,    35,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    -1,    55,    -1,
+      57,    -1,    -1,    -1,    -1,    62,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    -1,    -1,    17,    73,    74,    20,    21,
+      22,    23,    24,    -1,    -1,    -1,    -1,    29,    30,    31,
+      32,    33,    34,    35,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    -1,    -1,    -1,    57,    58,    -1,    -1,    -1,
+      62,    -1,    -1,    -1,    -1,    -1,    68,    69,    -1,    -1,
+      17,    73,    74,    20,    21,    22,    23,    24,    -1,    -1,
+      -1,    -1,    29,    30,    31,    32,    33,    34,    35,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    -1,    -1,    -1,
+      57,    -1,    -1,    60,    -1,    62,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    -1,    -1,    17,    73,    74,    20,    21,
+      22,    23,    24,    -1,    -1,    -1,    -1,    29,    30,    31,
+      32,    33,    34,    35,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    -1,    -1,    -1,    57,    58,    -1,    -1,    -1,
+      62,    -1,    -1,    -1,    -1,    -1,    68,    69,    -1,    -1,
+      17,    73,    74,    20,    21,    22,    23,    24,    -1,    -1,
+      -1,    -1,    29,    30,    31,    32,    33,    34,    35,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    -1,    -1,    -1,
+      57,    -1,    -1,    -1,    -1,    62,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    -1,    -1,    -1,    73,    74
 };
-/* -*-C-*-  Note some compilers choke on comments on `#line' lines.  */
 
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,     3,     4,     5,     6,     9,    11,    12,    13,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    29,    30,    31,    32,    33,    34,    35,    53,    55,
+      57,    62,    68,    69,    73,    74,    77,    78,    79,    81,
+      82,    83,    84,    89,    90,    91,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   108,
+     109,   115,   116,   117,   118,     4,    57,    57,    57,    57,
+      55,    55,    57,    55,    93,    94,   106,    57,    57,    53,
+      80,   116,    57,    54,    60,    93,   110,   111,   116,    93,
+     116,     0,    79,   116,    55,     8,     7,    63,    64,    65,
+      50,    51,    48,    49,    66,    67,    46,    47,    68,    69,
+      70,    71,    72,   104,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    56,    57,    59,    60,    62,    35,
+      93,    93,    83,   116,    93,    55,    58,   113,   114,   116,
+      58,   110,    54,    78,    80,    93,    32,   112,    54,    75,
+      56,    58,    55,    56,    95,    96,    97,    98,    99,   100,
+     100,   101,   101,   101,   101,   102,   102,   103,   103,   104,
+     104,   104,    94,    94,    94,    94,    94,    94,    94,    94,
+      94,    94,    94,    58,    93,   107,   116,    93,   116,    58,
+      58,    55,    92,    93,     7,    14,    58,    80,    58,    75,
+      56,    58,    75,    54,    58,    61,    54,   111,    93,    93,
+      58,    75,    57,    61,    80,    80,    58,    91,    55,   116,
+      93,    80,    80,   114,    93,    53,    56,    55,    93,    58,
+     107,    10,    80,    58,    14,    58,    27,    28,    85,    86,
+      93,    58,    80,    84,    80,    93,    80,    22,    62,    87,
+      88,   116,   117,    59,    54,    85,    58,   116,    59,    60,
+      62,    80,    80,    80,    93,   116,    61
+};
 
-/* Skeleton output parser for bison,
-   Copyright (C) 1984, 1989, 1990 Free Software Foundation, Inc.
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    76,    77,    78,    78,    79,    79,    79,    79,    79,
+      80,    80,    81,    81,    82,    82,    82,    82,    83,    83,
+      84,    84,    84,    84,    84,    84,    85,    85,    85,    86,
+      86,    87,    87,    87,    88,    88,    88,    88,    89,    89,
+      89,    89,    89,    89,    90,    90,    90,    90,    91,    91,
+      91,    91,    91,    91,    91,    91,    91,    91,    91,    91,
+      92,    92,    93,    94,    94,    95,    95,    96,    96,    97,
+      97,    98,    98,    99,    99,    99,   100,   100,   100,   100,
+     100,   101,   101,   101,   102,   102,   102,   103,   103,   103,
+     103,   104,   104,   105,   105,   105,   105,   106,   106,   106,
+     106,   106,   106,   106,   107,   107,   108,   108,   108,   108,
+     108,   109,   109,   110,   110,   111,   111,   111,   112,   113,
+     113,   114,   114,   115,   115,   115,   115,   115,   115,   115,
+     116,   117,   117,   117,   117,   117,   117,   117,   117,   117,
+     118,   118
+};
 
-   This program is free software; you can redistribute it and/or modify
-   it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     2,     1,     1,     1,     1,     1,
+       2,     3,     3,     5,     1,     1,     2,     1,     1,     2,
+       5,     7,     7,     3,     2,     7,     3,     4,     3,     1,
+       2,     1,     4,     3,     1,     2,     1,     1,     5,     5,
+       6,     7,     7,     9,     2,     2,     2,     3,     1,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       1,     2,     1,     1,     3,     1,     3,     1,     3,     1,
+       3,     1,     3,     1,     3,     3,     1,     3,     3,     3,
+       3,     1,     3,     3,     1,     3,     3,     1,     3,     3,
+       3,     1,     2,     1,     1,     1,     1,     1,     4,     3,
+       4,     5,     6,     3,     1,     3,     3,     4,     2,     3,
+       4,     5,     4,     1,     3,     1,     3,     5,     1,     1,
+       3,     1,     3,     1,     2,     1,     1,     1,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     2
+};
 
-   This program is distributed in the hope that it will be useful,
-   but WITHOUT ANY WARRANTY; without even the implied warranty of
-   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-   GNU General Public License for more details.
 
-   You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.  */
-
-/* As a special exception, when this file is copied by Bison into a
-   Bison output file, you may use that output file without restriction.
-   This special exception was added by the Free Software Foundation
-   in version 1.24 of Bison.  */
-
-#ifndef alloca
-#ifdef __GNUC__
-#define alloca __builtin_alloca
-#else /* not GNU C.  */
-#if (!defined (__STDC__) && defined (sparc)) || defined (__sparc__) || defined (__sparc) || defined (__sgi)
-#include <alloca.h>
-#else /* not sparc */
-#if defined (MSDOS) && !defined (__TURBOC__)
-#include <malloc.h>
-#else /* not MSDOS, or __TURBOC__ */
-#if defined(_AIX)
-#include <malloc.h>
- #pragma alloca
-#else /* not MSDOS, __TURBOC__, or _AIX */
-#ifdef __hpux
-#ifdef __cplusplus
-extern "C" {
-void *alloca (unsigned int);
-};
-#else /* not __cplusplus */
-void *alloca ();
-#endif /* not __cplusplus */
-#endif /* __hpux */
-#endif /* not _AIX */
-#endif /* not MSDOS, or __TURBOC__ */
-#endif /* not sparc.  */
-#endif /* not GNU C.  */
-#endif /* alloca not defined.  */
-
-/* This is the parser code that is written into each bison parser
-  when the %semantic_parser declaration is not specified in the grammar.
-  It was written by Richard Stallman by simplifying the hairy parser
-  used when %semantic_parser is specified.  */
-
-/* Note: there must be only one dollar sign in this file.
-   It is replaced by the list of actions, each action
-   as one case of the switch.  */
+enum { YYENOMEM = -2 };
 
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         -2
-#define YYEOF           0
-#define YYACCEPT        return(0)
-#define YYABORT         return(1)
-#define YYERROR         goto yyerrlab1
-/* Like YYERROR except do call yyerror.
-   This remains here temporarily to ease the
-   transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
-#define YYFAIL          goto yyerrlab
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
 #define YYRECOVERING()  (!!yyerrstatus)
-#define YYBACKUP(token, value) \
-do                                                              \
-  if (yychar == YYEMPTY && yylen == 1)                          \
-    { yychar = (token), yylval = (value);                       \
-      yychar1 = YYTRANSLATE (yychar);                           \
-      YYPOPSTACK;                                               \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    { yyerror ("syntax error: cannot back up"); YYERROR; }      \
-while (0)
-
-#define YYTERROR        1
-#define YYERRCODE       256
-
-#ifndef YYPURE
-#define YYLEX           yylex()
-#endif
 
-#ifdef YYPURE
-#ifdef YYLSP_NEEDED
-#ifdef YYLEX_PARAM
-#define YYLEX           yylex(&yylval, &yylloc, YYLEX_PARAM)
-#else
-#define YYLEX           yylex(&yylval, &yylloc)
-#endif
-#else /* not YYLSP_NEEDED */
-#ifdef YYLEX_PARAM
-#define YYLEX           yylex(&yylval, YYLEX_PARAM)
-#else
-#define YYLEX           yylex(&yylval)
-#endif
-#endif /* not YYLSP_NEEDED */
-#endif
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
 
-/* If nonreentrant, generate the variables here */
 
-#ifndef YYPURE
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-int     yychar;                 /*  the lookahead symbol                */
-YYSTYPE yylval;                 /*  the semantic value of the           */
-                                /*  lookahead symbol                    */
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-#ifdef YYLSP_NEEDED
-YYLTYPE yylloc;                 /*  location data for the lookahead     */
-                                /*  symbol                              */
-#endif
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
 
-int yynerrs;                    /*  number of parse errors so far       */
-#endif  /* not YYPURE */
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
 
-#if YYDEBUG != 0
-int yydebug;                    /*  nonzero means print parse trace     */
-/* Since this is uninitialized, it does not stop multiple parsers
-   from coexisting.  */
-#endif
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
-/*  YYINITDEPTH indicates the initial size of the parser's stacks       */
 
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
 #ifndef YYINITDEPTH
-#define YYINITDEPTH 200
+# define YYINITDEPTH 200
 #endif
 
-/*  YYMAXDEPTH is the maximum size the stacks can grow to
-    (effective only if the built-in stack extension method is used).  */
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
 
-#if YYMAXDEPTH == 0
-#undef YYMAXDEPTH
-#endif
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
 
 #ifndef YYMAXDEPTH
-#define YYMAXDEPTH 10000
+# define YYMAXDEPTH 10000
 #endif
 
-/* Prevent warning if -Wstrict-prototypes.  */
-#ifdef __GNUC__
-int yyparse (void);
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
+/* Return the length of YYSTR.  */
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
+{
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
+}
+# endif
 #endif
-
-#if __GNUC__ > 1                /* GNU C and GNU C++ define this.  */
-#define __yy_memcpy(FROM,TO,COUNT)      __builtin_memcpy(TO,FROM,COUNT)
-#else                           /* not GNU C or C++ */
-#ifndef __cplusplus
-
-/* This is the most reliable way to avoid incompatibilities
-   in available built-in functions on various systems.  */
-static void
-__yy_memcpy (from, to, count)
-     char *from;
-     char *to;
-     int count;
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
 {
-  register char *f = from;
-  register char *t = to;
-  register int i = count;
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+static int
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                       \
+      case N:                               \
+        yyformat = S;                       \
+        break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
+
+  if (*yymsg_alloc < yysize)
+    {
+      *yymsg_alloc = 2 * yysize;
+      if (! (yysize <= *yymsg_alloc
+             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
+        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
+      return -1;
+    }
 
-  while (i-- > 0)
-    *t++ = *f++;
+  /* Avoid sprintf, as that infringes on the user's name space.
+     Don't have undefined behavior even if the translation
+     produced a string with the wrong number of "%s"s.  */
+  {
+    char *yyp = *yymsg;
+    int yyi = 0;
+    while ((*yyp = *yyformat) != '\0')
+      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+        {
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+          yyformat += 2;
+        }
+      else
+        {
+          ++yyp;
+          ++yyformat;
+        }
+  }
+  return 0;
 }
 
-#else /* __cplusplus */
 
-/* This is the most reliable way to avoid incompatibilities
-   in available built-in functions on various systems.  */
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
 static void
-__yy_memcpy (char *from, char *to, int count)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  register char *f = from;
-  register char *t = to;
-  register int i = count;
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-  while (i-- > 0)
-    *t++ = *f++;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
-#endif
-#endif
-
 
 
-/* The user can define YYPARSE_PARAM as the name of an argument to be passed
-   into yyparse.  The argument should have type void *.
-   It should actually point to an object.
-   Grammar actions can access the variable by casting it
-   to the proper pointer type.  */
 
-#ifdef YYPARSE_PARAM
-#define YYPARSE_PARAM_DECL void *YYPARSE_PARAM;
-#else
-#define YYPARSE_PARAM
-#define YYPARSE_PARAM_DECL
-#endif
+
+
+/*----------.
+| yyparse.  |
+`----------*/
 
 int
-yyparse(YYPARSE_PARAM)
-     YYPARSE_PARAM_DECL
+yyparse (void)
 {
-  register int yystate;
-  register int yyn;
-  register short *yyssp;
-  register YYSTYPE *yyvsp;
-  int yyerrstatus;      /*  number of tokens to shift before error messages enabled */
-  int yychar1 = 0;              /*  lookahead token as an internal (translated) token number */
+/* Lookahead token kind.  */
+int yychar;
 
-  short yyssa[YYINITDEPTH];     /*  the state stack                     */
-  YYSTYPE yyvsa[YYINITDEPTH];   /*  the semantic value stack            */
 
-  short *yyss = yyssa;          /*  refer to the stacks thru separate pointers */
-  YYSTYPE *yyvs = yyvsa;        /*  to allow yyoverflow to reallocate them elsewhere */
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
-#ifdef YYLSP_NEEDED
-  YYLTYPE yylsa[YYINITDEPTH];   /*  the location stack                  */
-  YYLTYPE *yyls = yylsa;
-  YYLTYPE *yylsp;
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
 
-#define YYPOPSTACK   (yyvsp--, yyssp--, yylsp--)
-#else
-#define YYPOPSTACK   (yyvsp--, yyssp--)
-#endif
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
-  int yystacksize = YYINITDEPTH;
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-#ifdef YYPURE
-  int yychar;
-  YYSTYPE yylval;
-  int yynerrs;
-#ifdef YYLSP_NEEDED
-  YYLTYPE yylloc;
-#endif
-#endif
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-  YYSTYPE yyval;                /*  the variable used to return         */
-                                /*  semantic values from the action     */
-                                /*  routines                            */
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-  int yylen;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-#if YYDEBUG != 0
-  if (yydebug)
-    fprintf(stderr, "Starting parse\n");
-#endif
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;             /* Cause a token to be read.  */
+  /* Buffer for error messages, and its allocated size.  */
+  char yymsgbuf[128];
+  char *yymsg = yymsgbuf;
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
-  yyssp = yyss - 1;
-  yyvsp = yyvs;
-#ifdef YYLSP_NEEDED
-  yylsp = yyls;
-#endif
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
 
-/* Push a new state, which is found in  yystate  .  */
-/* In all cases, when you get here, the value and location stacks
-   have just been pushed. so pushing a state here evens the stacks.  */
-yynewstate:
+  YYDPRINTF ((stderr, "Starting parse\n"));
 
-  *++yyssp = (short) yystate;
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
-  if (yyssp >= yyss + yystacksize - 1)
-    {
-      /* Give user a chance to reallocate the stack */
-      /* Use copies of these so that the &'s don't force the real ones into memory. */
-      YYSTYPE *yyvs1 = yyvs;
-      short *yyss1 = yyss;
-#ifdef YYLSP_NEEDED
-      YYLTYPE *yyls1 = yyls;
-#endif
+  goto yysetstate;
 
-      /* Get the current used size of the three stacks, in elements.  */
-      int size =(int)( yyssp - yyss + 1); // _GD_ cast for 64bit build
-
-#ifdef yyoverflow
-      /* Each stack pointer address is followed by the size of
-         the data in use in that stack, in bytes.  */
-#ifdef YYLSP_NEEDED
-      /* This used to be a conditional around just the two extra args,
-         but that might be undefined if yyoverflow is a macro.  */
-      yyoverflow("parser stack overflow",
-                 &yyss1, size * sizeof (*yyssp),
-                 &yyvs1, size * sizeof (*yyvsp),
-                 &yyls1, size * sizeof (*yylsp),
-                 &yystacksize);
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
 #else
-      yyoverflow("parser stack overflow",
-                 &yyss1, size * sizeof (*yyssp),
-                 &yyvs1, size * sizeof (*yyvsp),
-                 &yystacksize);
-#endif
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-      yyss = yyss1; yyvs = yyvs1;
-#ifdef YYLSP_NEEDED
-      yyls = yyls1;
-#endif
-#else /* no yyoverflow */
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
-      if (yystacksize >= YYMAXDEPTH)
-        {
-          yyerror("parser stack overflow");
-          return 2;
-        }
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
       yystacksize *= 2;
-      if (yystacksize > YYMAXDEPTH)
+      if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
-      yyss = (short *) alloca (yystacksize * sizeof (*yyssp));
-      __yy_memcpy ((char *)yyss1, (char *)yyss, size * sizeof (*yyssp));
-      yyvs = (YYSTYPE *) alloca (yystacksize * sizeof (*yyvsp));
-      __yy_memcpy ((char *)yyvs1, (char *)yyvs, size * sizeof (*yyvsp));
-#ifdef YYLSP_NEEDED
-      yyls = (YYLTYPE *) alloca (yystacksize * sizeof (*yylsp));
-      __yy_memcpy ((char *)yyls1, (char *)yyls, size * sizeof (*yylsp));
-#endif
-#endif /* no yyoverflow */
 
-      yyssp = yyss + size - 1;
-      yyvsp = yyvs + size - 1;
-#ifdef YYLSP_NEEDED
-      yylsp = yyls + size - 1;
-#endif
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
 
-#if YYDEBUG != 0
-      if (yydebug)
-        fprintf(stderr, "Stack size increased to %d\n", yystacksize);
-#endif
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
-      if (yyssp >= yyss + yystacksize - 1)
+      if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-#if YYDEBUG != 0
-  if (yydebug)
-    fprintf(stderr, "Entering state %d\n", yystate);
-#endif
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
   goto yybackup;
- yybackup:
 
-/* Do appropriate processing given the current state.  */
-/* Read a lookahead token if we need one and don't already have one.  */
-/* yyresume: */
 
-  /* First try to decide what to do without reference to lookahead token.  */
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
 
+  /* First try to decide what to do without reference to lookahead token.  */
   yyn = yypact[yystate];
-  if (yyn == YYFLAG)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* yychar is either YYEMPTY or YYEOF
-     or a valid token in external form.  */
-
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-#if YYDEBUG != 0
-      if (yydebug)
-        fprintf(stderr, "Reading a token: ");
-#endif
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval);
     }
 
-  /* Convert token to internal form (in yychar1) for indexing tables with */
-
-  if (yychar <= 0)              /* This means end of input. */
+  if (yychar <= YYEOF)
     {
-      yychar1 = 0;
-      yychar = YYEOF;           /* Don't call YYLEX any more */
-
-#if YYDEBUG != 0
-      if (yydebug)
-        fprintf(stderr, "Now at end of input.\n");
-#endif
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
     }
   else
     {
-      yychar1 = YYTRANSLATE(yychar);
-
-#if YYDEBUG != 0
-      if (yydebug)
-        {
-          fprintf (stderr, "Next token is %d (%s", yychar, yytname[yychar1]);
-          /* Give the individual parser a way to print the precise meaning
-             of a token, for further debugging info.  */
-#ifdef YYPRINT
-          YYPRINT (stderr, yychar, yylval);
-#endif
-          fprintf (stderr, ")\n");
-        }
-#endif
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
     }
 
-  yyn += yychar1;
-  if (yyn < 0 || yyn > YYLAST || yycheck[yyn] != yychar1)
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
     goto yydefault;
-
   yyn = yytable[yyn];
-
-  /* yyn is what to do for this token type in this state.
-     Negative => reduce, -yyn is rule number.
-     Positive => shift, yyn is new state.
-       New state is final state => don't bother to shift,
-       just return success.
-     0, or most negative number => error.  */
-
-  if (yyn < 0)
+  if (yyn <= 0)
     {
-      if (yyn == YYFLAG)
+      if (yytable_value_is_error (yyn))
         goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
-  else if (yyn == 0)
-    goto yyerrlab;
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
 
   /* Shift the lookahead token.  */
-
-#if YYDEBUG != 0
-  if (yydebug)
-    fprintf(stderr, "Shifting token %d (%s), ", yychar, yytname[yychar1]);
-#endif
-
-  /* Discard the token being shifted unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
-
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
-#ifdef YYLSP_NEEDED
-  *++yylsp = yylloc;
-#endif
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
-  /* count tokens shifted since error; after three, turn off error status.  */
-  if (yyerrstatus) yyerrstatus--;
-
-  yystate = yyn;
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
-/* Do the default action for the current state.  */
-yydefault:
 
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
   yyn = yydefact[yystate];
   if (yyn == 0)
     goto yyerrlab;
+  goto yyreduce;
 
-/* Do a reduction.  yyn is the number of a rule to reduce with.  */
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
 yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
-  if (yylen > 0)
-    yyval = yyvsp[1-yylen]; /* implement default value of the action */
 
-#if YYDEBUG != 0
-  if (yydebug)
-    {
-      int i;
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
 
-      fprintf (stderr, "Reducing via rule %d (line %d), ",
-               yyn, yyrline[yyn]);
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
 
-      /* Print the symbols being reduced, and their result.  */
-      for (i = yyprhs[yyn]; yyrhs[i] > 0; i++)
-        fprintf (stderr, "%s ", yytname[yyrhs[i]]);
-      fprintf (stderr, " -> %s\n", yytname[yyr1[yyn]]);
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* program: statement_list  */
+    {
+      g_codeTree = yyvsp[0];
     }
-#endif
+    break;
 
+  case 3: /* statement_list: statement  */
+    {
+      yyval = yyvsp[0];
+    }
+    break;
 
-  switch (yyn) {
+  case 4: /* statement_list: statement_list statement  */
+    {
+      ATTACH(yyval, yyvsp[-1], yyvsp[0]);
+    }
+    break;
 
-case 1:
-{
-      g_codeTree = yyvsp[0];
-    ;
-    break;}
-case 2:
-{
-      yyval = yyvsp[0];
-    ;
-    break;}
-case 3:
-{
-      ATTACH(yyval, yyvsp[-1], yyvsp[0]);
-    ;
-    break;}
-case 4:
-{
+  case 5: /* statement: expression_statement  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 5:
-{
+    }
+    break;
+
+  case 6: /* statement: var_statement  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 6:
-{
+    }
+    break;
+
+  case 7: /* statement: selection_statement  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 7:
-{
+    }
+    break;
+
+  case 8: /* statement: iteration_statement  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 8:
-{
+    }
+    break;
+
+  case 9: /* statement: jump_statement  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 9:
-{
+    }
+    break;
+
+  case 10: /* compound_statement: '{' '}'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_COMPOUND, gmlineno);
-    ;
-    break;}
-case 10:
-{
+    }
+    break;
+
+  case 11: /* compound_statement: '{' statement_list '}'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_COMPOUND, gmlineno);
       yyval->SetChild(0, yyvsp[-1]);
-    ;
-    break;}
-case 11:
-{
+    }
+    break;
+
+  case 12: /* var_statement: var_type identifier ';'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_DECLARATION, CTNDT_VARIABLE, gmlineno, (gmptr) yyvsp[-2]);
       yyval->SetChild(0, yyvsp[-1]);
-    ;
-    break;}
-case 12:
-{
+    }
+    break;
+
+  case 13: /* var_statement: var_type identifier '=' constant_expression ';'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_DECLARATION, CTNDT_VARIABLE, gmlineno, (gmptr) yyvsp[-4]);
       yyval->SetChild(0, yyvsp[-3]);
       ATTACH(yyval, yyval, CreateOperation(CTNOT_ASSIGN, yyvsp[-3], yyvsp[-1]));
-    ;
-    break;}
-case 13:
-{
+    }
+    break;
+
+  case 14: /* var_type: KEYWORD_LOCAL  */
+    {
       yyval = (YYSTYPE) CTVT_LOCAL;
-    ;
-    break;}
-case 14:
-{
+    }
+    break;
+
+  case 15: /* var_type: KEYWORD_GLOBAL  */
+    {
       yyval = (YYSTYPE) CTVT_GLOBAL;
-    ;
-    break;}
-case 15:
-{
+    }
+    break;
+
+  case 16: /* var_type: KEYWORD_INLINE KEYWORD_GLOBAL  */
+    {
+      yyval = (YYSTYPE) CTVT_INLINE_GLOBAL;
+    }
+    break;
+
+  case 17: /* var_type: KEYWORD_MEMBER  */
+    {
       yyval = (YYSTYPE) CTVT_MEMBER;
-    ;
-    break;}
-case 16:
-{
+    }
+    break;
+
+  case 18: /* expression_statement: ';'  */
+    {
       yyval = NULL;
-    ;
-    break;}
-case 17:
-{
+    }
+    break;
+
+  case 19: /* expression_statement: assignment_expression ';'  */
+    {
       yyval = yyvsp[-1];
-    ;
-    break;}
-case 18:
-{
+    }
+    break;
+
+  case 20: /* selection_statement: KEYWORD_IF '(' constant_expression ')' compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_IF, (yyvsp[-2]) ? yyvsp[-2]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[-2]);
       yyval->SetChild(1, yyvsp[0]);
-    ;
-    break;}
-case 19:
-{
+    }
+    break;
+
+  case 21: /* selection_statement: KEYWORD_IF '(' constant_expression ')' compound_statement KEYWORD_ELSE compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_IF, (yyvsp[-4]) ? yyvsp[-4]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[-4]);
       yyval->SetChild(1, yyvsp[-2]);
       yyval->SetChild(2, yyvsp[0]);
-    ;
-    break;}
-case 20:
-{
+    }
+    break;
+
+  case 22: /* selection_statement: KEYWORD_IF '(' constant_expression ')' compound_statement KEYWORD_ELSE selection_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_IF, (yyvsp[-4]) ? yyvsp[-4]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[-4]);
       yyval->SetChild(1, yyvsp[-2]);
       yyval->SetChild(2, yyvsp[0]);
-    ;
-    break;}
-case 21:
-{
+    }
+    break;
+
+  case 23: /* selection_statement: KEYWORD_FORK identifier compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_FORK, (yyvsp[-1]) ? yyvsp[-1]->m_lineNumber : gmlineno );
       yyval->SetChild(0, yyvsp[0] );
       yyval->SetChild(1, yyvsp[-1] );
-    ;
-    break;}
-case 22:
-{
+    }
+    break;
+
+  case 24: /* selection_statement: KEYWORD_FORK compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_FORK, (yyvsp[0]) ? yyvsp[0]->m_lineNumber : gmlineno );
       yyval->SetChild(0, yyvsp[0] );
-    ;
-    break;}
-case 23:
-{
+    }
+    break;
+
+  case 25: /* selection_statement: KEYWORD_SWITCH '(' constant_expression ')' '{' case_selection_statement_list '}'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_SWITCH, (yyvsp[-4]) ? yyvsp[-4]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[-4]);
       yyval->SetChild(1, yyvsp[-1]);
-    ;
-    break;}
-case 24:
-{
+    }
+    break;
+
+  case 26: /* case_selection_statement: KEYWORD_CASE postfix_case_expression ':'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_CASE, (yyvsp[-1]) ? yyvsp[-1]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[-1]);
-    ;
-    break;}
-case 25:
-{
+    }
+    break;
+
+  case 27: /* case_selection_statement: KEYWORD_CASE postfix_case_expression ':' compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_CASE, (yyvsp[-2]) ? yyvsp[-2]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[-2]);
       yyval->SetChild(1, yyvsp[0]);
-    ;
-    break;}
-case 26:
-{
+    }
+    break;
+
+  case 28: /* case_selection_statement: KEYWORD_DEFAULT ':' compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_DEFAULT, (yyvsp[0]) ? yyvsp[0]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[0]);
-    ;
-    break;}
-case 27:
-{
+    }
+    break;
+
+  case 29: /* case_selection_statement_list: case_selection_statement  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 28:
-{
+    }
+    break;
+
+  case 30: /* case_selection_statement_list: case_selection_statement_list case_selection_statement  */
+    {
       ATTACH(yyval, yyvsp[-1], yyvsp[0]);
-    ;
-    break;}
-case 29:
-{
+    }
+    break;
+
+  case 31: /* postfix_case_expression: case_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 30:
-{
+    }
+    break;
+
+  case 32: /* postfix_case_expression: postfix_case_expression '[' constant_expression ']'  */
+    {
       yyval = CreateOperation(CTNOT_ARRAY_INDEX, yyvsp[-3], yyvsp[-1]);
-    ;
-    break;}
-case 31:
-{
+    }
+    break;
+
+  case 33: /* postfix_case_expression: postfix_case_expression '.' identifier  */
+    {
       yyval = CreateOperation(CTNOT_DOT, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 32:
-{
+    }
+    break;
+
+  case 34: /* case_expression: identifier  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 33:
-{
+    }
+    break;
+
+  case 35: /* case_expression: '.' identifier  */
+    {
       yyval = yyvsp[0];
       yyval->m_flags |= gmCodeTreeNode::CTN_MEMBER;
-    ;
-    break;}
-case 34:
-{
+    }
+    break;
+
+  case 36: /* case_expression: KEYWORD_THIS  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_THIS, gmlineno);
-    ;
-    break;}
-case 35:
-{
+    }
+    break;
+
+  case 37: /* case_expression: constant  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 36:
-{
+    }
+    break;
+
+  case 38: /* iteration_statement: KEYWORD_WHILE '(' constant_expression ')' compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_WHILE, (yyvsp[-2]) ? yyvsp[-2]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[-2]);
       yyval->SetChild(1, yyvsp[0]);
-    ;
-    break;}
-case 37:
-{
+    }
+    break;
+
+  case 39: /* iteration_statement: KEYWORD_DOWHILE '(' constant_expression ')' compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_DOWHILE, (yyvsp[-2]) ? yyvsp[-2]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[-2]);
       yyval->SetChild(1, yyvsp[0]);
-    ;
-    break;}
-case 38:
-{
+    }
+    break;
+
+  case 40: /* iteration_statement: KEYWORD_FOR '(' expression_statement constant_expression_statement ')' compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_FOR, (yyvsp[-3]) ? yyvsp[-3]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[-3]);
       yyval->SetChild(1, yyvsp[-2]);
       yyval->SetChild(3, yyvsp[0]);
-    ;
-    break;}
-case 39:
-{
+    }
+    break;
+
+  case 41: /* iteration_statement: KEYWORD_FOR '(' expression_statement constant_expression_statement assignment_expression ')' compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_FOR, (yyvsp[-4]) ? yyvsp[-4]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[-4]);
       yyval->SetChild(1, yyvsp[-3]);
       yyval->SetChild(2, yyvsp[-2]);
       yyval->SetChild(3, yyvsp[0]);
-    ;
-    break;}
-case 40:
-{
+    }
+    break;
+
+  case 42: /* iteration_statement: KEYWORD_FOREACH '(' identifier KEYWORD_IN constant_expression ')' compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_FOREACH, (yyvsp[-2]) ? yyvsp[-2]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[-2]);
       yyval->SetChild(1, yyvsp[-4]);
       yyval->SetChild(3, yyvsp[0]);
-    ;
-    break;}
-case 41:
-{
+    }
+    break;
+
+  case 43: /* iteration_statement: KEYWORD_FOREACH '(' identifier KEYWORD_AND identifier KEYWORD_IN constant_expression ')' compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_FOREACH, (yyvsp[-2]) ? yyvsp[-2]->m_lineNumber : gmlineno);
       yyval->SetChild(0, yyvsp[-2]);
       yyval->SetChild(1, yyvsp[-4]);
       yyval->SetChild(2, yyvsp[-6]);
       yyval->SetChild(3, yyvsp[0]);
-    ;
-    break;}
-case 42:
-{
+    }
+    break;
+
+  case 44: /* jump_statement: KEYWORD_CONTINUE ';'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_CONTINUE, gmlineno);
-    ;
-    break;}
-case 43:
-{
+    }
+    break;
+
+  case 45: /* jump_statement: KEYWORD_BREAK ';'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_BREAK, gmlineno);
-    ;
-    break;}
-case 44:
-{
+    }
+    break;
+
+  case 46: /* jump_statement: KEYWORD_RETURN ';'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_RETURN, gmlineno);
-    ;
-    break;}
-case 45:
-{
+    }
+    break;
+
+  case 47: /* jump_statement: KEYWORD_RETURN constant_expression ';'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_STATEMENT, CTNST_RETURN, gmlineno);
       yyval->SetChild(0, yyvsp[-1]);
-    ;
-    break;}
-case 46:
-{
+    }
+    break;
+
+  case 48: /* assignment_expression: logical_or_expression  */
+    {
       yyval = yyvsp[0];
       if(yyval)
       {
         yyval->m_flags |= gmCodeTreeNode::CTN_POP;
       }
-    ;
-    break;}
-case 47:
-{
+    }
+    break;
+
+  case 49: /* assignment_expression: postfix_expression '=' logical_or_expression  */
+    {
       yyval = CreateOperation(CTNOT_ASSIGN, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 48:
-{
+    }
+    break;
+
+  case 50: /* assignment_expression: postfix_expression SYMBOL_ASGN_BSR logical_or_expression  */
+    {
       yyval = CreateAsignExpression(CTNOT_SHIFT_RIGHT, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 49:
-{
+    }
+    break;
+
+  case 51: /* assignment_expression: postfix_expression SYMBOL_ASGN_BSL logical_or_expression  */
+    {
       yyval = CreateAsignExpression(CTNOT_SHIFT_LEFT, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 50:
-{
+    }
+    break;
+
+  case 52: /* assignment_expression: postfix_expression SYMBOL_ASGN_ADD logical_or_expression  */
+    {
       yyval = CreateAsignExpression(CTNOT_ADD, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 51:
-{
+    }
+    break;
+
+  case 53: /* assignment_expression: postfix_expression SYMBOL_ASGN_MINUS logical_or_expression  */
+    {
       yyval = CreateAsignExpression(CTNOT_MINUS, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 52:
-{
+    }
+    break;
+
+  case 54: /* assignment_expression: postfix_expression SYMBOL_ASGN_TIMES logical_or_expression  */
+    {
       yyval = CreateAsignExpression(CTNOT_TIMES, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 53:
-{
+    }
+    break;
+
+  case 55: /* assignment_expression: postfix_expression SYMBOL_ASGN_DIVIDE logical_or_expression  */
+    {
       yyval = CreateAsignExpression(CTNOT_DIVIDE, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 54:
-{
+    }
+    break;
+
+  case 56: /* assignment_expression: postfix_expression SYMBOL_ASGN_REM logical_or_expression  */
+    {
       yyval = CreateAsignExpression(CTNOT_REM, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 55:
-{
+    }
+    break;
+
+  case 57: /* assignment_expression: postfix_expression SYMBOL_ASGN_BAND logical_or_expression  */
+    {
       yyval = CreateAsignExpression(CTNOT_BIT_AND, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 56:
-{
+    }
+    break;
+
+  case 58: /* assignment_expression: postfix_expression SYMBOL_ASGN_BOR logical_or_expression  */
+    {
       yyval = CreateAsignExpression(CTNOT_BIT_OR, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 57:
-{
+    }
+    break;
+
+  case 59: /* assignment_expression: postfix_expression SYMBOL_ASGN_BXOR logical_or_expression  */
+    {
       yyval = CreateAsignExpression(CTNOT_BIT_XOR, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 58:
-{
+    }
+    break;
+
+  case 60: /* constant_expression_statement: ';'  */
+    {
       yyval = NULL;
-    ;
-    break;}
-case 59:
-{
+    }
+    break;
+
+  case 61: /* constant_expression_statement: constant_expression ';'  */
+    {
       yyval = yyvsp[-1];
-    ;
-    break;}
-case 60:
-{
+    }
+    break;
+
+  case 62: /* constant_expression: logical_or_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 61:
-{
+    }
+    break;
+
+  case 63: /* logical_or_expression: logical_and_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 62:
-{
+    }
+    break;
+
+  case 64: /* logical_or_expression: logical_or_expression KEYWORD_OR logical_and_expression  */
+    {
       yyval = CreateOperation(CTNOT_OR, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 63:
-{
+    }
+    break;
+
+  case 65: /* logical_and_expression: inclusive_or_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 64:
-{
+    }
+    break;
+
+  case 66: /* logical_and_expression: logical_and_expression KEYWORD_AND inclusive_or_expression  */
+    {
       yyval = CreateOperation(CTNOT_AND, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 65:
-{
+    }
+    break;
+
+  case 67: /* inclusive_or_expression: exclusive_or_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 66:
-{
+    }
+    break;
+
+  case 68: /* inclusive_or_expression: inclusive_or_expression '|' exclusive_or_expression  */
+    {
       yyval = CreateOperation(CTNOT_BIT_OR, yyvsp[-2], yyvsp[0]);
       yyval->ConstantFold();
-    ;
-    break;}
-case 67:
-{
+    }
+    break;
+
+  case 69: /* exclusive_or_expression: and_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 68:
-{
+    }
+    break;
+
+  case 70: /* exclusive_or_expression: exclusive_or_expression '^' and_expression  */
+    {
       yyval = CreateOperation(CTNOT_BIT_XOR, yyvsp[-2], yyvsp[0]);
       yyval->ConstantFold();
-    ;
-    break;}
-case 69:
-{
+    }
+    break;
+
+  case 71: /* and_expression: equality_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 70:
-{
+    }
+    break;
+
+  case 72: /* and_expression: and_expression '&' equality_expression  */
+    {
       yyval = CreateOperation(CTNOT_BIT_AND, yyvsp[-2], yyvsp[0]);
       yyval->ConstantFold();
-    ;
-    break;}
-case 71:
-{
+    }
+    break;
+
+  case 73: /* equality_expression: relational_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 72:
-{
+    }
+    break;
+
+  case 74: /* equality_expression: equality_expression SYMBOL_EQ relational_expression  */
+    {
       yyval = CreateOperation(CTNOT_EQ, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 73:
-{
+    }
+    break;
+
+  case 75: /* equality_expression: equality_expression SYMBOL_NEQ relational_expression  */
+    {
       yyval = CreateOperation(CTNOT_NEQ, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 74:
-{
+    }
+    break;
+
+  case 76: /* relational_expression: shift_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 75:
-{
+    }
+    break;
+
+  case 77: /* relational_expression: relational_expression '<' shift_expression  */
+    {
       yyval = CreateOperation(CTNOT_LT, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 76:
-{
+    }
+    break;
+
+  case 78: /* relational_expression: relational_expression '>' shift_expression  */
+    {
       yyval = CreateOperation(CTNOT_GT, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 77:
-{
+    }
+    break;
+
+  case 79: /* relational_expression: relational_expression SYMBOL_LTE shift_expression  */
+    {
       yyval = CreateOperation(CTNOT_LTE, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 78:
-{
+    }
+    break;
+
+  case 80: /* relational_expression: relational_expression SYMBOL_GTE shift_expression  */
+    {
       yyval = CreateOperation(CTNOT_GTE, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 79:
-{
+    }
+    break;
+
+  case 81: /* shift_expression: additive_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 80:
-{
+    }
+    break;
+
+  case 82: /* shift_expression: shift_expression SYMBOL_LEFT_SHIFT additive_expression  */
+    {
       yyval = CreateOperation(CTNOT_SHIFT_LEFT, yyvsp[-2], yyvsp[0]);
       yyval->ConstantFold();
-    ;
-    break;}
-case 81:
-{
+    }
+    break;
+
+  case 83: /* shift_expression: shift_expression SYMBOL_RIGHT_SHIFT additive_expression  */
+    {
       yyval = CreateOperation(CTNOT_SHIFT_RIGHT, yyvsp[-2], yyvsp[0]);
       yyval->ConstantFold();
-    ;
-    break;}
-case 82:
-{
+    }
+    break;
+
+  case 84: /* additive_expression: multiplicative_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 83:
-{
+    }
+    break;
+
+  case 85: /* additive_expression: additive_expression '+' multiplicative_expression  */
+    {
       yyval = CreateOperation(CTNOT_ADD, yyvsp[-2], yyvsp[0]);
       yyval->ConstantFold();
-    ;
-    break;}
-case 84:
-{
+    }
+    break;
+
+  case 86: /* additive_expression: additive_expression '-' multiplicative_expression  */
+    {
       yyval = CreateOperation(CTNOT_MINUS, yyvsp[-2], yyvsp[0]);
       yyval->ConstantFold();
-    ;
-    break;}
-case 85:
-{
+    }
+    break;
+
+  case 87: /* multiplicative_expression: unary_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 86:
-{
+    }
+    break;
+
+  case 88: /* multiplicative_expression: multiplicative_expression '*' unary_expression  */
+    {
       yyval = CreateOperation(CTNOT_TIMES, yyvsp[-2], yyvsp[0]);
       yyval->ConstantFold();
-    ;
-    break;}
-case 87:
-{
+    }
+    break;
+
+  case 89: /* multiplicative_expression: multiplicative_expression '/' unary_expression  */
+    {
       yyval = CreateOperation(CTNOT_DIVIDE, yyvsp[-2], yyvsp[0]);
       yyval->ConstantFold();
-    ;
-    break;}
-case 88:
-{
+    }
+    break;
+
+  case 90: /* multiplicative_expression: multiplicative_expression '%' unary_expression  */
+    {
       yyval = CreateOperation(CTNOT_REM, yyvsp[-2], yyvsp[0]);
       yyval->ConstantFold();
-    ;
-    break;}
-case 89:
-{
+    }
+    break;
+
+  case 91: /* unary_expression: postfix_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 90:
-{
+    }
+    break;
+
+  case 92: /* unary_expression: unary_operator unary_expression  */
+    {
       yyval = yyvsp[-1];
       yyval->SetChild(0, yyvsp[0]);
       yyval->ConstantFold();
-    ;
-    break;}
-case 91:
-{
+    }
+    break;
+
+  case 93: /* unary_operator: '+'  */
+    {
       yyval = CreateOperation(CTNOT_UNARY_PLUS);
-    ;
-    break;}
-case 92:
-{
+    }
+    break;
+
+  case 94: /* unary_operator: '-'  */
+    {
       yyval = CreateOperation(CTNOT_UNARY_MINUS);
-    ;
-    break;}
-case 93:
-{
+    }
+    break;
+
+  case 95: /* unary_operator: '~'  */
+    {
       yyval = CreateOperation(CTNOT_UNARY_COMPLEMENT);
-    ;
-    break;}
-case 94:
-{
+    }
+    break;
+
+  case 96: /* unary_operator: '!'  */
+    {
       yyval = CreateOperation(CTNOT_UNARY_NOT);
-    ;
-    break;}
-case 95:
-{
+    }
+    break;
+
+  case 97: /* postfix_expression: primary_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 96:
-{
+    }
+    break;
+
+  case 98: /* postfix_expression: postfix_expression '[' constant_expression ']'  */
+    {
       yyval = CreateOperation(CTNOT_ARRAY_INDEX, yyvsp[-3], yyvsp[-1]);
-    ;
-    break;}
-case 97:
-{
+    }
+    break;
+
+  case 99: /* postfix_expression: postfix_expression '(' ')'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CALL, gmlineno);
       yyval->SetChild(0, yyvsp[-2]);
-    ;
-    break;}
-case 98:
-{
+    }
+    break;
+
+  case 100: /* postfix_expression: postfix_expression '(' argument_expression_list ')'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CALL, gmlineno);
       yyval->SetChild(0, yyvsp[-3]);
       yyval->SetChild(1, yyvsp[-1]);
-    ;
-    break;}
-case 99:
-{
+    }
+    break;
+
+  case 101: /* postfix_expression: postfix_expression ':' identifier '(' ')'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CALL, gmlineno);
       yyval->SetChild(0, yyvsp[-2]);
       yyval->SetChild(2, yyvsp[-4]);
-    ;
-    break;}
-case 100:
-{
+    }
+    break;
+
+  case 102: /* postfix_expression: postfix_expression ':' identifier '(' argument_expression_list ')'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CALL, gmlineno);
       yyval->SetChild(0, yyvsp[-3]);
       yyval->SetChild(1, yyvsp[-1]);
       yyval->SetChild(2, yyvsp[-5]);
-    ;
-    break;}
-case 101:
-{
+    }
+    break;
+
+  case 103: /* postfix_expression: postfix_expression '.' identifier  */
+    {
       yyval = CreateOperation(CTNOT_DOT, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 102:
-{
+    }
+    break;
+
+  case 104: /* argument_expression_list: constant_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 103:
-{
+    }
+    break;
+
+  case 105: /* argument_expression_list: argument_expression_list ',' constant_expression  */
+    {
       ATTACH(yyval, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 104:
-{
+    }
+    break;
+
+  case 106: /* table_constructor: KEYWORD_TABLE '(' ')'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_TABLE, gmlineno);
-    ;
-    break;}
-case 105:
-{
+    }
+    break;
+
+  case 107: /* table_constructor: KEYWORD_TABLE '(' field_list ')'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_TABLE, gmlineno);
       yyval->SetChild(0, yyvsp[-1]);
-    ;
-    break;}
-case 106:
-{
+    }
+    break;
+
+  case 108: /* table_constructor: '{' '}'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_TABLE, gmlineno);
-    ;
-    break;}
-case 107:
-{
+    }
+    break;
+
+  case 109: /* table_constructor: '{' field_list '}'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_TABLE, gmlineno);
       yyval->SetChild(0, yyvsp[-1]);
-    ;
-    break;}
-case 108:
-{
+    }
+    break;
+
+  case 110: /* table_constructor: '{' field_list ',' '}'  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_TABLE, gmlineno);
       yyval->SetChild(0, yyvsp[-2]);
-    ;
-    break;}
-case 109:
-{
+    }
+    break;
+
+  case 111: /* function_constructor: KEYWORD_FUNCTION '(' parameter_list ')' compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_FUNCTION, gmlineno);
       yyval->SetChild(0, yyvsp[-2]);
       yyval->SetChild(1, yyvsp[0]);
-    ;
-    break;}
-case 110:
-{
+    }
+    break;
+
+  case 112: /* function_constructor: KEYWORD_FUNCTION '(' ')' compound_statement  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_FUNCTION, gmlineno);
       yyval->SetChild(1, yyvsp[0]);
-    ;
-    break;}
-case 111:
-{
+    }
+    break;
+
+  case 113: /* field_list: field  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 112:
-{
+    }
+    break;
+
+  case 114: /* field_list: field_list ',' field  */
+    {
       ATTACH(yyval, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 113:
-{
+    }
+    break;
+
+  case 115: /* field: constant_expression  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 114:
-{
+    }
+    break;
+
+  case 116: /* field: identifier '=' constant_expression  */
+    {
       yyval = CreateOperation(CTNOT_ASSIGN_FIELD, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 115:
-{
+    }
+    break;
+
+  case 117: /* field: '[' constant_field_index ']' '=' constant_expression  */
+        {
 	  yyval = CreateOperation(CTNOT_ASSIGN_INDEX, yyvsp[-3], yyvsp[0]);
-	;
-    break;}
-case 116:
-{
+	}
+    break;
+
+  case 118: /* constant_field_index: CONSTANT_INT  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CONSTANT, gmlineno, CTNCT_INT);
       yyval->m_data.m_iValue = atoi(gmtext);
-    ;
-    break;}
-case 117:
-{
+    }
+    break;
+
+  case 119: /* parameter_list: parameter  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 118:
-{
+    }
+    break;
+
+  case 120: /* parameter_list: parameter_list ',' parameter  */
+    {
       ATTACH(yyval, yyvsp[-2], yyvsp[0]);
-    ;
-    break;}
-case 119:
-{
+    }
+    break;
+
+  case 121: /* parameter: identifier  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_DECLARATION, CTNDT_PARAMETER, gmlineno);
       yyval->SetChild(0, yyvsp[0]);
-    ;
-    break;}
-case 120:
-{
+    }
+    break;
+
+  case 122: /* parameter: identifier '=' constant_expression  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_DECLARATION, CTNDT_PARAMETER, gmlineno);
       yyval->SetChild(0, yyvsp[-2]);
       yyval->SetChild(1, yyvsp[0]);
-    ;
-    break;}
-case 121:
-{
+    }
+    break;
+
+  case 123: /* primary_expression: identifier  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 122:
-{
+    }
+    break;
+
+  case 124: /* primary_expression: '.' identifier  */
+    {
       yyval = yyvsp[0];
       yyval->m_flags |= gmCodeTreeNode::CTN_MEMBER;
-    ;
-    break;}
-case 123:
-{
+    }
+    break;
+
+  case 125: /* primary_expression: KEYWORD_THIS  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_THIS, gmlineno);
-    ;
-    break;}
-case 124:
-{
+    }
+    break;
+
+  case 126: /* primary_expression: constant  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 125:
-{
+    }
+    break;
+
+  case 127: /* primary_expression: table_constructor  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 126:
-{
+    }
+    break;
+
+  case 128: /* primary_expression: function_constructor  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 127:
-{
+    }
+    break;
+
+  case 129: /* primary_expression: '(' constant_expression ')'  */
+    {
       yyval = yyvsp[-1];
-    ;
-    break;}
-case 128:
-{
+    }
+    break;
+
+  case 130: /* identifier: IDENTIFIER  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_IDENTIFIER, gmlineno);
       yyval->m_data.m_string = (char *) gmCodeTree::Get().Alloc((int)strlen(gmtext) + 1);
       strcpy(yyval->m_data.m_string, gmtext);
-    ;
-    break;}
-case 129:
-{
+    }
+    break;
+
+  case 131: /* constant: CONSTANT_HEX  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CONSTANT, gmlineno, CTNCT_INT);
       yyval->m_data.m_iValue = strtoul(gmtext + 2, NULL, 16);
-    ;
-    break;}
-case 130:
-{
+    }
+    break;
+
+  case 132: /* constant: CONSTANT_BINARY  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CONSTANT, gmlineno, CTNCT_INT);
       yyval->m_data.m_iValue = strtoul(gmtext + 2, NULL, 2);
-    ;
-    break;}
-case 131:
-{
+    }
+    break;
+
+  case 133: /* constant: CONSTANT_INT  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CONSTANT, gmlineno, CTNCT_INT);
       yyval->m_data.m_iValue = atoi(gmtext);
-    ;
-    break;}
-case 132:
-{
+    }
+    break;
+
+  case 134: /* constant: KEYWORD_TRUE  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CONSTANT, gmlineno, CTNCT_INT);
       yyval->m_data.m_iValue = 1;
-    ;
-    break;}
-case 133:
-{
+    }
+    break;
+
+  case 135: /* constant: KEYWORD_FALSE  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CONSTANT, gmlineno, CTNCT_INT);
       yyval->m_data.m_iValue = 0;
-    ;
-    break;}
-case 134:
-{
+    }
+    break;
+
+  case 136: /* constant: CONSTANT_CHAR  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CONSTANT, gmlineno, CTNCT_INT);
 
       char * c = (char *) gmCodeTree::Get().Alloc((int)strlen(gmtext) + 1);
@@ -1919,27 +2798,31 @@ case 134:
       if(shr > 4 && gmCodeTree::Get().GetLog()) gmCodeTree::Get().GetLog()->LogEntry("truncated char, line %d", gmlineno);
 
       yyval->m_data.m_iValue = result;
-    ;
-    break;}
-case 135:
-{
+    }
+    break;
+
+  case 137: /* constant: CONSTANT_FLOAT  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CONSTANT, gmlineno, CTNCT_FLOAT);
       yyval->m_data.m_fValue = (float) atof(gmtext);
-    ;
-    break;}
-case 136:
-{
+    }
+    break;
+
+  case 138: /* constant: constant_string_list  */
+    {
       yyval = yyvsp[0];
-    ;
-    break;}
-case 137:
-{
+    }
+    break;
+
+  case 139: /* constant: KEYWORD_NULL  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CONSTANT, gmlineno, CTNCT_NULL);
       yyval->m_data.m_iValue = 0;
-    ;
-    break;}
-case 138:
-{
+    }
+    break;
+
+  case 140: /* constant_string_list: CONSTANT_STRING  */
+    {
       yyval = gmCodeTreeNode::Create(CTNT_EXPRESSION, CTNET_CONSTANT, gmlineno, CTNCT_STRING);
       yyval->m_data.m_string = (char *) gmCodeTree::Get().Alloc((int)strlen(gmtext) + 1);
       strcpy(yyval->m_data.m_string, gmtext);
@@ -1951,10 +2834,11 @@ case 138:
       {
         gmProcessSingleQuoteString(yyval->m_data.m_string);
       }
-    ;
-    break;}
-case 139:
-{
+    }
+    break;
+
+  case 141: /* constant_string_list: constant_string_list CONSTANT_STRING  */
+    {
       yyval = yyvsp[-1];
       int alen = (int)strlen(yyval->m_data.m_string);
       int blen = (int)strlen(gmtext);
@@ -1974,210 +2858,235 @@ case 139:
         }
         yyval->m_data.m_string = str;
       }
-    ;
-    break;}
-}
-   /* the action file gets copied in in place of this dollarsign */
-
-
-  yyvsp -= yylen;
-  yyssp -= yylen;
-#ifdef YYLSP_NEEDED
-  yylsp -= yylen;
-#endif
-
-#if YYDEBUG != 0
-  if (yydebug)
-    {
-      short *ssp1 = yyss - 1;
-      fprintf (stderr, "state stack now");
-      while (ssp1 != yyssp)
-        fprintf (stderr, " %d", *++ssp1);
-      fprintf (stderr, "\n");
     }
-#endif
+    break;
 
-  *++yyvsp = yyval;
 
-#ifdef YYLSP_NEEDED
-  yylsp++;
-  if (yylen == 0)
-    {
-      yylsp->first_line = yylloc.first_line;
-      yylsp->first_column = yylloc.first_column;
-      yylsp->last_line = (yylsp-1)->last_line;
-      yylsp->last_column = (yylsp-1)->last_column;
-      yylsp->text = 0;
-    }
-  else
-    {
-      yylsp->last_line = (yylsp+yylen-1)->last_line;
-      yylsp->last_column = (yylsp+yylen-1)->last_column;
-    }
-#endif
 
-  /* Now "shift" the result of the reduction.
-     Determine what state that goes to,
-     based on the state we popped back to
-     and the rule number reduced by.  */
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
 
-  yyn = yyr1[yyn];
+  *++yyvsp = yyval;
 
-  yystate = yypgoto[yyn - YYNTBASE] + *yyssp;
-  if (yystate >= 0 && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTBASE];
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
-yyerrlab:   /* here on detecting error */
 
-  if (! yyerrstatus)
-    /* If not already recovering from an error, report this error.  */
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
     {
       ++yynerrs;
+      {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
+        char const *yymsgp = YY_("syntax error");
+        int yysyntax_error_status;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+        if (yysyntax_error_status == 0)
+          yymsgp = yymsg;
+        else if (yysyntax_error_status == -1)
+          {
+            if (yymsg != yymsgbuf)
+              YYSTACK_FREE (yymsg);
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
+              {
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
+              }
+            else
+              {
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
+              }
+          }
+        yyerror (yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
+      }
+    }
 
-#ifdef YYERROR_VERBOSE
-      yyn = yypact[yystate];
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
 
-      if (yyn > YYFLAG && yyn < YYLAST)
+      if (yychar <= YYEOF)
         {
-          int size = 0;
-          char *msg;
-          int x, count;
-
-          count = 0;
-          /* Start X at -yyn if nec to avoid negative indexes in yycheck.  */
-          for (x = (yyn < 0 ? -yyn : 0);
-               x < (int)(sizeof(yytname) / sizeof(char *)); x++) //_GD_
-            if (yycheck[x + yyn] == x)
-              size += (int)strlen(yytname[x]) + 15, count++; // _GD_ add cast for 64bit build
-          //_GD_ msg = (char *) malloc(size + 15);
-          msg = GM_NEW( char [size + 15] );
-          if (msg != 0)
-            {
-              strcpy(msg, "parse error");
-
-              if (count < 5)
-                {
-                  count = 0;
-                  for (x = (yyn < 0 ? -yyn : 0);
-                       x < (int)(sizeof(yytname) / sizeof(char *)); x++)
-                    if (yycheck[x + yyn] == x)
-                      {
-                        strcat(msg, count == 0 ? ", expecting `" : " or `");
-                        strcat(msg, yytname[x]);
-                        strcat(msg, "'");
-                        count++;
-                      }
-                }
-              yyerror(msg);
-              //_GD_ free(msg);
-              delete [] msg;
-            }
-          else
-            yyerror ("parse error; also virtual memory exceeded");
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
         }
       else
-#endif /* YYERROR_VERBOSE */
-        yyerror("parse error");
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
   goto yyerrlab1;
-yyerrlab1:   /* here on error raised explicitly by an action */
 
-  if (yyerrstatus == 3)
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
     {
-      /* if just tried and failed to reuse lookahead token after an error, discard it.  */
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
-      /* return failure if at end of input */
-      if (yychar == YYEOF)
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
         YYABORT;
 
-#if YYDEBUG != 0
-      if (yydebug)
-        fprintf(stderr, "Discarding token %d (%s).\n", yychar, yytname[yychar1]);
-#endif
 
-      yychar = YYEMPTY;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
     }
 
-  /* Else will try to reuse lookahead token
-     after shifting the error token.  */
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
-  yyerrstatus = 3;              /* Each real token shifted decrements this */
 
-  goto yyerrhandle;
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
-yyerrdefault:  /* current state does not do anything special for the error token. */
+  yystate = yyn;
+  goto yynewstate;
 
-#if 0
-  /* This is wrong; only states that explicitly want error tokens
-     should shift them.  */
-  yyn = yydefact[yystate];  /* If its default is to accept any token, ok.  Otherwise pop it.*/
-  if (yyn) goto yydefault;
-#endif
 
-yyerrpop:   /* pop the current state because it cannot handle the error token */
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
 
-  if (yyssp == yyss) YYABORT;
-  yyvsp--;
-  yystate = *--yyssp;
-#ifdef YYLSP_NEEDED
-  yylsp--;
-#endif
 
-#if YYDEBUG != 0
-  if (yydebug)
-    {
-      short *ssp1 = yyss - 1;
-      fprintf (stderr, "Error: state stack now");
-      while (ssp1 != yyssp)
-        fprintf (stderr, " %d", *++ssp1);
-      fprintf (stderr, "\n");
-    }
-#endif
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
 
-yyerrhandle:
 
-  yyn = yypact[yystate];
-  if (yyn == YYFLAG)
-    goto yyerrdefault;
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
 
-  yyn += YYTERROR;
-  if (yyn < 0 || yyn > YYLAST || yycheck[yyn] != YYTERROR)
-    goto yyerrdefault;
 
-  yyn = yytable[yyn];
-  if (yyn < 0)
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
     {
-      if (yyn == YYFLAG)
-        goto yyerrpop;
-      yyn = -yyn;
-      goto yyreduce;
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
     }
-  else if (yyn == 0)
-    goto yyerrpop;
-
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
-#if YYDEBUG != 0
-  if (yydebug)
-    fprintf(stderr, "Shifting error token, ");
-#endif
-
-  *++yyvsp = yylval;
-#ifdef YYLSP_NEEDED
-  *++yylsp = yylloc;
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
 #endif
-
-  yystate = yyn;
-  goto yynewstate;
+  if (yymsg != yymsgbuf)
+    YYSTACK_FREE (yymsg);
+  return yyresult;
 }
 
 
+
 #include <stdio.h>
 
 
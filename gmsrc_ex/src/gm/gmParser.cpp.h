@@ -1,55 +1,124 @@
-#ifndef YYSTYPE
-#define YYSTYPE int
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_GM_GMPARSER_CPP_H_INCLUDED
+# define YY_GM_GMPARSER_CPP_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int gmdebug;
 #endif
-#define	KEYWORD_LOCAL	258
-#define	KEYWORD_GLOBAL	259
-#define	KEYWORD_MEMBER	260
-#define	KEYWORD_AND	261
-#define	KEYWORD_OR	262
-#define	KEYWORD_IF	263
-#define	KEYWORD_ELSE	264
-#define	KEYWORD_WHILE	265
-#define	KEYWORD_FOR	266
-#define	KEYWORD_FOREACH	267
-#define	KEYWORD_IN	268
-#define	KEYWORD_BREAK	269
-#define	KEYWORD_CONTINUE	270
-#define	KEYWORD_NULL	271
-#define	KEYWORD_DOWHILE	272
-#define	KEYWORD_RETURN	273
-#define	KEYWORD_FUNCTION	274
-#define	KEYWORD_TABLE	275
-#define	KEYWORD_THIS	276
-#define	KEYWORD_TRUE	277
-#define	KEYWORD_FALSE	278
-#define	KEYWORD_FORK	279
-#define	KEYWORD_SWITCH	280
-#define	KEYWORD_CASE	281
-#define	KEYWORD_DEFAULT	282
-#define	IDENTIFIER	283
-#define	CONSTANT_HEX	284
-#define	CONSTANT_BINARY	285
-#define	CONSTANT_INT	286
-#define	CONSTANT_CHAR	287
-#define	CONSTANT_FLOAT	288
-#define	CONSTANT_STRING	289
-#define	SYMBOL_ASGN_BSR	290
-#define	SYMBOL_ASGN_BSL	291
-#define	SYMBOL_ASGN_ADD	292
-#define	SYMBOL_ASGN_MINUS	293
-#define	SYMBOL_ASGN_TIMES	294
-#define	SYMBOL_ASGN_DIVIDE	295
-#define	SYMBOL_ASGN_REM	296
-#define	SYMBOL_ASGN_BAND	297
-#define	SYMBOL_ASGN_BOR	298
-#define	SYMBOL_ASGN_BXOR	299
-#define	SYMBOL_RIGHT_SHIFT	300
-#define	SYMBOL_LEFT_SHIFT	301
-#define	SYMBOL_LTE	302
-#define	SYMBOL_GTE	303
-#define	SYMBOL_EQ	304
-#define	SYMBOL_NEQ	305
-#define	TOKEN_ERROR	306
-
-
-extern YYSTYPE gmlval;
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    KEYWORD_LOCAL = 258,           /* KEYWORD_LOCAL  */
+    KEYWORD_GLOBAL = 259,          /* KEYWORD_GLOBAL  */
+    KEYWORD_MEMBER = 260,          /* KEYWORD_MEMBER  */
+    KEYWORD_INLINE = 261,          /* KEYWORD_INLINE  */
+    KEYWORD_AND = 262,             /* KEYWORD_AND  */
+    KEYWORD_OR = 263,              /* KEYWORD_OR  */
+    KEYWORD_IF = 264,              /* KEYWORD_IF  */
+    KEYWORD_ELSE = 265,            /* KEYWORD_ELSE  */
+    KEYWORD_WHILE = 266,           /* KEYWORD_WHILE  */
+    KEYWORD_FOR = 267,             /* KEYWORD_FOR  */
+    KEYWORD_FOREACH = 268,         /* KEYWORD_FOREACH  */
+    KEYWORD_IN = 269,              /* KEYWORD_IN  */
+    KEYWORD_BREAK = 270,           /* KEYWORD_BREAK  */
+    KEYWORD_CONTINUE = 271,        /* KEYWORD_CONTINUE  */
+    KEYWORD_NULL = 272,            /* KEYWORD_NULL  */
+    KEYWORD_DOWHILE = 273,         /* KEYWORD_DOWHILE  */
+    KEYWORD_RETURN = 274,          /* KEYWORD_RETURN  */
+    KEYWORD_FUNCTION = 275,        /* KEYWORD_FUNCTION  */
+    KEYWORD_TABLE = 276,           /* KEYWORD_TABLE  */
+    KEYWORD_THIS = 277,            /* KEYWORD_THIS  */
+    KEYWORD_TRUE = 278,            /* KEYWORD_TRUE  */
+    KEYWORD_FALSE = 279,           /* KEYWORD_FALSE  */
+    KEYWORD_FORK = 280,            /* KEYWORD_FORK  */
+    KEYWORD_SWITCH = 281,          /* KEYWORD_SWITCH  */
+    KEYWORD_CASE = 282,            /* KEYWORD_CASE  */
+    KEYWORD_DEFAULT = 283,         /* KEYWORD_DEFAULT  */
+    IDENTIFIER = 284,              /* IDENTIFIER  */
+    CONSTANT_HEX = 285,            /* CONSTANT_HEX  */
+    CONSTANT_BINARY = 286,         /* CONSTANT_BINARY  */
+    CONSTANT_INT = 287,            /* CONSTANT_INT  */
+    CONSTANT_CHAR = 288,           /* CONSTANT_CHAR  */
+    CONSTANT_FLOAT = 289,          /* CONSTANT_FLOAT  */
+    CONSTANT_STRING = 290,         /* CONSTANT_STRING  */
+    SYMBOL_ASGN_BSR = 291,         /* SYMBOL_ASGN_BSR  */
+    SYMBOL_ASGN_BSL = 292,         /* SYMBOL_ASGN_BSL  */
+    SYMBOL_ASGN_ADD = 293,         /* SYMBOL_ASGN_ADD  */
+    SYMBOL_ASGN_MINUS = 294,       /* SYMBOL_ASGN_MINUS  */
+    SYMBOL_ASGN_TIMES = 295,       /* SYMBOL_ASGN_TIMES  */
+    SYMBOL_ASGN_DIVIDE = 296,      /* SYMBOL_ASGN_DIVIDE  */
+    SYMBOL_ASGN_REM = 297,         /* SYMBOL_ASGN_REM  */
+    SYMBOL_ASGN_BAND = 298,        /* SYMBOL_ASGN_BAND  */
+    SYMBOL_ASGN_BOR = 299,         /* SYMBOL_ASGN_BOR  */
+    SYMBOL_ASGN_BXOR = 300,        /* SYMBOL_ASGN_BXOR  */
+    SYMBOL_RIGHT_SHIFT = 301,      /* SYMBOL_RIGHT_SHIFT  */
+    SYMBOL_LEFT_SHIFT = 302,       /* SYMBOL_LEFT_SHIFT  */
+    SYMBOL_LTE = 303,              /* SYMBOL_LTE  */
+    SYMBOL_GTE = 304,              /* SYMBOL_GTE  */
+    SYMBOL_EQ = 305,               /* SYMBOL_EQ  */
+    SYMBOL_NEQ = 306,              /* SYMBOL_NEQ  */
+    TOKEN_ERROR = 307              /* TOKEN_ERROR  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+typedef int YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+
+int gmparse (void);
+
+
+#endif /* !YY_GM_GMPARSER_CPP_H_INCLUDED  */
@@ -16,12 +16,11 @@
 #include "gmCodeTree.h"
 #define YYSTYPE gmCodeTreeNode *
 
-extern gmCodeTreeNode * g_codeTree;
+extern GM_THREAD_LOCAL gmCodeTreeNode * g_codeTree;
 
 #define GM_BISON_DEBUG
 #ifdef GM_BISON_DEBUG
 #define YYDEBUG 1
-#define YYERROR_VERBOSE
 #endif // GM_BISON_DEBUG
 
 //
@@ -68,9 +67,15 @@ gmCodeTreeNode * CreateAsignExpression(int a_subTypeType, gmCodeTreeNode * a_lef
 
 %}
 
+// The parser keeps its state on the stack of gmparse(), so each OS thread can parse at the same time.
+// gmlex() takes the token value by pointer, see gmScanner.h, no token has a value.
+%define api.pure full
+%define parse.error verbose
+
 %token KEYWORD_LOCAL
 %token KEYWORD_GLOBAL
 %token KEYWORD_MEMBER
+%token KEYWORD_INLINE
 %token KEYWORD_AND
 %token KEYWORD_OR
 %token KEYWORD_IF
@@ -99,7 +104,6 @@ gmCodeTreeNode * CreateAsignExpression(int a_subTypeType, gmCodeTreeNode * a_lef
 %token CONSTANT_INT
 %token CONSTANT_CHAR
 %token CONSTANT_FLOAT
-%token CONSTANT_FLOAT
 %token CONSTANT_STRING
 %token SYMBOL_ASGN_BSR
 %token SYMBOL_ASGN_BSL
@@ -178,12 +182,12 @@ compound_statement
 var_statement
   : var_type identifier ';'
     {
-      $$ = gmCodeTreeNode::Create(CTNT_DECLARATION, CTNDT_VARIABLE, gmlineno, (int) $1);
+      $$ = gmCodeTreeNode::Create(CTNT_DECLARATION, CTNDT_VARIABLE, gmlineno, (gmptr) $1);
       $$->SetChild(0, $2);
     }
   | var_type identifier '=' constant_expression ';'
     {
-      $$ = gmCodeTreeNode::Create(CTNT_DECLARATION, CTNDT_VARIABLE, gmlineno, (int) $1);
+      $$ = gmCodeTreeNode::Create(CTNT_DECLARATION, CTNDT_VARIABLE, gmlineno, (gmptr) $1);
       $$->SetChild(0, $2);
       ATTACH($$, $$, CreateOperation(CTNOT_ASSIGN, $2, $4));
     }
@@ -198,6 +202,10 @@ var_type
     {
       $$ = (YYSTYPE) CTVT_GLOBAL;
     }
+  | KEYWORD_INLINE KEYWORD_GLOBAL
+    {
+      $$ = (YYSTYPE) CTVT_INLINE_GLOBAL;
+    }
   | KEYWORD_MEMBER
     {
       $$ = (YYSTYPE) CTVT_MEMBER;
@@ -0,0 +1,125 @@
+/*
+_____               __  ___          __            ____        _      __
+/ ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+/ (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+\___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+/___/             /_/
+
+See Copyright Notice in gmMachine.h
+
+*/
+
+#ifndef _GMROOTTABLE_H_
+#define _GMROOTTABLE_H_
+
+#include "gmConfig.h"
+#include "gmArraySimple.h"
+
+class gmObject;
+
+/// \brief gmRootHandle names an object held by a gmRootTable, the slot in the low 32 bits and its
+///        generation in the high 32 bits.  0 is no handle.
+typedef gmuint64 gmRootHandle;
+
+/// \class gmRootTable
+/// \brief gmRootTable holds objects owned by native code, as handles.  Add(), Remove() and Get() are
+///        constant time, a removed handle is recognised by its slot generation and gets NULL.  The
+///        objects are kept packed, for the garbage collector to walk as one array.
+class gmRootTable
+{
+public:
+
+	gmRootTable() : m_freeSlot(NULL_SLOT) {}
+
+	/// \brief Add() returns a handle holding a_obj.
+	inline gmRootHandle Add(gmObject * a_obj)
+	{
+		gmuint32 slot = m_freeSlot;
+		if(slot != NULL_SLOT)
+		{
+			m_freeSlot = m_slots[slot].m_index;
+		}
+		else
+		{
+			slot = m_slots.Count();
+			Slot &newSlot = m_slots.InsertLast();
+			newSlot.m_generation = 1;
+		}
+		m_slots[slot].m_index = m_objects.Count();
+		m_objects.InsertLast(a_obj);
+		m_objectSlots.InsertLast(slot);
+		return ((gmRootHandle) m_slots[slot].m_generation << 32) | slot;
+	}
+
+	/// \brief Remove() releases a handle.
+	/// \return the object it held, NULL if the handle was already removed.
+	inline gmObject * Remove(gmRootHandle a_handle)
+	{
+		Slot * slot = Find(a_handle);
+		if(!slot) return NULL;
+
+		// move the last object into the hole
+		gmuint32 index = slot->m_index;
+		gmObject * obj = m_objects[index];
+		gmuint32 last = m_objects.Count() - 1;
+		m_objects[index] = m_objects[last];
+		m_objectSlots[index] = m_objectSlots[last];
+		m_slots[m_objectSlots[index]].m_index = index;
+		m_objects.SetCount(last);
+		m_objectSlots.SetCount(last);
+
+		if(++slot->m_generation == 0) slot->m_generation = 1;
+		slot->m_index = m_freeSlot;
+		m_freeSlot = (gmuint32) a_handle;
+		return obj;
+	}
+
+	/// \brief Get() returns the object of a handle, NULL if the handle was removed.
+	inline gmObject * Get(gmRootHandle a_handle) const
+	{
+		const Slot * slot = Find(a_handle);
+		return slot ? m_objects[slot->m_index] : NULL;
+	}
+
+	/// \brief RemoveAll() releases every handle.
+	void RemoveAll()
+	{
+		while(m_objects.Count())
+		{
+			gmuint32 slot = m_objectSlots[m_objects.Count() - 1];
+			Remove(((gmRootHandle) m_slots[slot].m_generation << 32) | slot);
+		}
+	}
+
+	/// \brief GetObjects() returns the held objects, GetCount() of them.
+	inline gmObject * const * GetObjects() const { return m_objects.GetData(); }
+	inline gmuint GetCount() const { return m_objects.Count(); }
+
+	/// \brief GetMemoryUsage() returns the bytes used by the table.
+	inline unsigned int GetMemoryUsage() const { return m_objects.Count() * (sizeof(gmObject *) + sizeof(gmuint32)) + m_slots.Count() * sizeof(Slot); }
+
+private:
+
+	enum { NULL_SLOT = 0xffffffff };
+
+	struct Slot
+	{
+		gmuint32 m_generation;
+		gmuint32 m_index;                     ///< into m_objects, the next free slot when free
+	};
+
+	inline Slot * Find(gmRootHandle a_handle)
+	{
+		gmuint32 slot = (gmuint32) a_handle;
+		if(slot >= m_slots.Count() || m_slots[slot].m_generation != (gmuint32) (a_handle >> 32)) return NULL;
+		return &m_slots[slot];
+	}
+	inline const Slot * Find(gmRootHandle a_handle) const { return const_cast<gmRootTable *>(this)->Find(a_handle); }
+
+	gmArraySimple<gmObject *> m_objects;    ///< packed, the roots to scan
+	gmArraySimple<gmuint32> m_objectSlots;  ///< slot of each object
+	gmArraySimple<Slot> m_slots;
+	gmuint32 m_freeSlot;
+};
+
+#endif // _GMROOTTABLE_H_
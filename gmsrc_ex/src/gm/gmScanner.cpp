@@ -1,2144 +1,486 @@
-#define yy_create_buffer gm_create_buffer
-#define yy_delete_buffer gm_delete_buffer
-#define yy_scan_buffer gm_scan_buffer
-#define yy_scan_string gm_scan_string
-#define yy_scan_bytes gm_scan_bytes
-#define yy_flex_debug gm_flex_debug
-#define yy_init_buffer gm_init_buffer
-#define yy_flush_buffer gm_flush_buffer
-#define yy_load_buffer_state gm_load_buffer_state
-#define yy_switch_to_buffer gm_switch_to_buffer
-#define yyin gmin
-#define yyleng gmleng
-#define yylex gmlex
-#define yyout gmout
-#define yyrestart gmrestart
-#define yytext gmtext
-#define yylineno gmlineno
-#define yywrap gmwrap
-
-#line 21 "gmScanner.cpp"
-/* A lexical scanner generated by flex */
-
-/* Scanner skeleton version:
- * $Header: /home/daffy/u0/vern/flex/RCS/flex.skl,v 2.85 95/04/24 10:48:47 vern Exp $
- */
-
-#define FLEX_SCANNER
-#define YY_FLEX_MAJOR_VERSION 2
-#define YY_FLEX_MINOR_VERSION 5
-#define YY_NEVER_INTERACTIVE 1
-
-#include <stdio.h>
-#include <errno.h>
-
-
-#ifdef __cplusplus
-
-#include <stdlib.h>
-
-/* Use prototypes in function declarations. */
-#define YY_USE_PROTOS
-
-/* The "const" storage-class-modifier is valid. */
-#define YY_USE_CONST
-
-#else /* ! __cplusplus */
-
-#if __STDC__
-
-#define YY_USE_PROTOS
-#define YY_USE_CONST
-
-#endif   /* __STDC__ */
-#endif   /* ! __cplusplus */
-
-#ifdef __TURBOC__
- #pragma warn -rch
- #pragma warn -use
-#include <io.h>
-#include <stdlib.h>
-#define YY_USE_CONST
-#define YY_USE_PROTOS
-#endif
-
-#ifdef YY_USE_CONST
-#define yyconst const
-#else
-#define yyconst
-#endif
-
-
-#ifdef YY_USE_PROTOS
-#define YY_PROTO(proto) proto
-#else
-#define YY_PROTO(proto) ()
-#endif
-
-/* Returned upon end-of-file. */
-#define YY_NULL 0
-
-/* Promotes a possibly negative, possibly signed char to an unsigned
- * integer for use as an array index.  If the signed char is negative,
- * we want to instead treat it as an 8-bit unsigned char, hence the
- * double cast.
- */
-#define YY_SC_TO_UI(c) ((unsigned int) (unsigned char) c)
-
-/* Enter a start condition.  This macro really ought to take a parameter,
- * but we do it the disgusting crufty way forced on us by the ()-less
- * definition of BEGIN.
- */
-#define BEGIN yy_start = 1 + 2 *
-
-/* Translate the current start state into a value that can be later handed
- * to BEGIN to return to the state.  The YYSTATE alias is for lex
- * compatibility.
- */
-#define YY_START ((yy_start - 1) / 2)
-#define YYSTATE YY_START
-
-/* Action number for EOF rule of a given start state. */
-#define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
-
-/* Special action meaning "start processing a new file". */
-#define YY_NEW_FILE yyrestart( yyin )
-
-#define YY_END_OF_BUFFER_CHAR 0
-
-/* Size of default input buffer. */
-#define YY_BUF_SIZE 16384
-
-typedef struct yy_buffer_state *YY_BUFFER_STATE;
-
-extern int yyleng;
-extern FILE *yyin, *yyout;
-
-#define EOB_ACT_CONTINUE_SCAN 0
-#define EOB_ACT_END_OF_FILE 1
-#define EOB_ACT_LAST_MATCH 2
-
-/* The funky do-while in the following #define is used to turn the definition
- * int a single C statement (which needs a semi-colon terminator).  This
- * avoids problems with code like:
- *
- *    if ( condition_holds )
- *    yyless( 5 );
- * else
- *    do_something_else();
- *
- * Prior to using the do-while the compiler would get upset at the
- * "else" because it interpreted the "if" statement as being all
- * done when it reached the ';' after the yyless() call.
- */
-
-/* Return all but the first 'n' matched characters back to the input stream. */
-
-#define yyless(n) \
-   do \
-      { \
-      /* Undo effects of setting up yytext. */ \
-      *yy_cp = yy_hold_char; \
-      yy_c_buf_p = yy_cp = yy_bp + n - YY_MORE_ADJ; \
-      YY_DO_BEFORE_ACTION; /* set up yytext again */ \
-      } \
-   while ( 0 )
-
-#define unput(c) yyunput( c, yytext_ptr )
-
-/* The following is because we cannot portably get our hands on size_t
- * (without autoconf's help, which isn't available because we want
- * flex-generated scanners to compile on their own).
- */
-typedef unsigned int yy_size_t;
-
-
-struct yy_buffer_state
-   {
-   FILE *yy_input_file;
-
-   char *yy_ch_buf;     /* input buffer */
-   char *yy_buf_pos;    /* current position in input buffer */
-
-   /* Size of input buffer in bytes, not including room for EOB
-    * characters.
-    */
-   yy_size_t yy_buf_size;
-
-   /* Number of characters read into yy_ch_buf, not including EOB
-    * characters.
-    */
-   int yy_n_chars;
-
-   /* Whether we "own" the buffer - i.e., we know we created it,
-    * and can realloc() it to grow it, and should free() it to
-    * delete it.
-    */
-   int yy_is_our_buffer;
-
-   /* Whether this is an "interactive" input source; if so, and
-    * if we're using stdio for input, then we want to use getc()
-    * instead of fread(), to make sure we stop fetching input after
-    * each newline.
-    */
-   int yy_is_interactive;
-
-   /* Whether we're considered to be at the beginning of a line.
-    * If so, '^' rules will be active on the next match, otherwise
-    * not.
-    */
-   int yy_at_bol;
-
-   /* Whether to try to fill the input buffer when we reach the
-    * end of it.
-    */
-   int yy_fill_buffer;
-
-   int yy_buffer_status;
-#define YY_BUFFER_NEW 0
-#define YY_BUFFER_NORMAL 1
-   /* When an EOF's been seen but there's still some text to process
-    * then we mark the buffer as YY_EOF_PENDING, to indicate that we
-    * shouldn't try reading from the input source any more.  We might
-    * still have a bunch of tokens to match, though, because of
-    * possible backing-up.
-    *
-    * When we actually see the EOF, we change the status to "new"
-    * (via yyrestart()), so that the user can continue scanning by
-    * just pointing yyin at a new input file.
-    */
-#define YY_BUFFER_EOF_PENDING 2
-   };
-
-static YY_BUFFER_STATE yy_current_buffer = 0;
-
-/* We provide macros for accessing buffer states in case in the
- * future we want to put the buffer states in a more general
- * "scanner state".
- */
-#define YY_CURRENT_BUFFER yy_current_buffer
-
-
-/* yy_hold_char holds the character lost when yytext is formed. */
-static char yy_hold_char;
-
-static int yy_n_chars;     /* number of characters read into yy_ch_buf */
-
-
-int yyleng;
-
-/* Points to current character in buffer. */
-static char *yy_c_buf_p = (char *) 0;
-static int yy_init = 1;    /* whether we need to initialize */
-static int yy_start = 0;   /* start state number */
-
-/* Flag which is used to allow yywrap()'s to do buffer switches
- * instead of setting up a fresh yyin.  A bit of a hack ...
- */
-static int yy_did_buffer_switch_on_eof;
-
-void yyrestart YY_PROTO(( FILE *input_file ));
-
-void yy_switch_to_buffer YY_PROTO(( YY_BUFFER_STATE new_buffer ));
-void yy_load_buffer_state YY_PROTO(( void ));
-YY_BUFFER_STATE yy_create_buffer YY_PROTO(( FILE *file, int size ));
-void yy_delete_buffer YY_PROTO(( YY_BUFFER_STATE b ));
-void yy_init_buffer YY_PROTO(( YY_BUFFER_STATE b, FILE *file ));
-void yy_flush_buffer YY_PROTO(( YY_BUFFER_STATE b ));
-#define YY_FLUSH_BUFFER yy_flush_buffer( yy_current_buffer )
-
-YY_BUFFER_STATE yy_scan_buffer YY_PROTO(( char *base, yy_size_t size ));
-YY_BUFFER_STATE yy_scan_string YY_PROTO(( yyconst char *str ));
-YY_BUFFER_STATE yy_scan_bytes YY_PROTO(( yyconst char *bytes, int len ));
-
-static void *yy_flex_alloc YY_PROTO(( yy_size_t ));
-static void *yy_flex_realloc YY_PROTO(( void *, yy_size_t ));
-static void yy_flex_free YY_PROTO(( void * ));
-
-#define yy_new_buffer yy_create_buffer
-
-#define yy_set_interactive(is_interactive) \
-   { \
-   if ( ! yy_current_buffer ) \
-      yy_current_buffer = yy_create_buffer( yyin, YY_BUF_SIZE ); \
-   yy_current_buffer->yy_is_interactive = is_interactive; \
-   }
-
-#define yy_set_bol(at_bol) \
-   { \
-   if ( ! yy_current_buffer ) \
-      yy_current_buffer = yy_create_buffer( yyin, YY_BUF_SIZE ); \
-   yy_current_buffer->yy_at_bol = at_bol; \
-   }
-
-#define YY_AT_BOL() (yy_current_buffer->yy_at_bol)
-
-
-#define YY_USES_REJECT
-typedef unsigned char YY_CHAR;
-FILE *yyin = (FILE *) 0, *yyout = (FILE *) 0;
-typedef int yy_state_type;
-extern int yylineno;
-int yylineno = 1;
-extern char *yytext;
-#define yytext_ptr yytext
-
-static yy_state_type yy_get_previous_state YY_PROTO(( void ));
-static yy_state_type yy_try_NUL_trans YY_PROTO(( yy_state_type current_state ));
-static int yy_get_next_buffer YY_PROTO(( void ));
-static void yy_fatal_error YY_PROTO(( yyconst char msg[] ));
-
-/* Done after the current pattern has been matched and before the
- * corresponding action - sets up yytext.
- */
-#define YY_DO_BEFORE_ACTION \
-   yytext_ptr = yy_bp; \
-	yyleng = (int) (yy_cp - yy_bp); \
-   yy_hold_char = *yy_cp; \
-   *yy_cp = '\0'; \
-   yy_c_buf_p = yy_cp;
-
-#define YY_NUM_RULES 82
-#define YY_END_OF_BUFFER 83
-static yyconst short int yy_acclist[302] =
-    {   0,
-       83,   81,   82,   80,   81,   82,   80,   82,   66,   81,
-       82,   81,   82,   71,   81,   82,   74,   81,   82,   81,
-       82,   61,   81,   82,   62,   81,   82,   69,   81,   82,
-       68,   81,   82,   59,   81,   82,   67,   81,   82,   65,
-       81,   82,   70,   81,   82,   31,   81,   82,   31,   81,
-       82,   78,   79,   81,   82,   56,   81,   82,   72,   81,
-       82,   60,   81,   82,   73,   81,   82,   28,   81,   82,
-       63,   81,   82,   64,   81,   82,   76,   81,   82,   81,
-       82,   28,   81,   82,   28,   81,   82,   28,   81,   82,
-       28,   81,   82,   28,   81,   82,   28,   81,   82,   28,
-
-       81,   82,   28,   81,   82,   28,   81,   82,   28,   81,
-       82,   28,   81,   82,   28,   81,   82,   28,   81,   82,
-       28,   81,   82,   28,   81,   82,   28,   81,   82,   57,
-       81,   82,   75,   81,   82,   58,   81,   82,   77,   81,
-       82,   55,   36,   46,   38,   47,   44,   42,   43,   34,
-        1,    2,   45,   35,   31,   51,   52,   54,   53,   50,
-       28,   49,   37,   28,   28,   28,   28,   28,   28,   28,
-       28,   28,   28,   28,    8,   28,   13,   28,   28,   28,
-       28,    7,   28,   28,   28,   28,   28,   28,   28,   48,
-       39,   32,   34,    2,   34,   35,   35,   30,   33,   29,
-
-       41,   40,    6,   28,   28,   28,   28,   28,   28,   28,
-       28,   11,   28,   28,   28,   28,   28,   28,   28,   28,
-       28,   28,   28,   28,   34,   34,   35,   35,   33,   28,
-       26,   28,   28,   28,   28,    9,   28,   28,   28,   24,
-       28,   28,   28,   28,   28,   17,   28,   28,   28,   28,
-       21,   28,   22,   28,   28,   34,   35,   15,   28,   28,
-       28,   28,   23,   28,   28,   28,   28,    3,   28,   28,
-       28,   28,   20,   28,   10,   28,   28,   28,   28,   28,
-       28,    4,   28,    5,   28,   18,   28,   25,   28,   28,
-       27,   28,   14,   28,   12,   28,   28,   16,   28,   19,
-
-       28
-    } ;
-
-static yyconst short int yy_accept[201] =
-    {   0,
-        1,    1,    1,    2,    4,    7,    9,   12,   14,   17,
-       20,   22,   25,   28,   31,   34,   37,   40,   43,   46,
-       49,   52,   56,   59,   62,   65,   68,   71,   74,   77,
-       80,   82,   85,   88,   91,   94,   97,  100,  103,  106,
-      109,  112,  115,  118,  121,  124,  127,  130,  133,  136,
-      139,  142,  143,  143,  144,  144,  145,  146,  147,  147,
-      147,  148,  149,  150,  151,  152,  153,  154,  155,  156,
-      156,  156,  156,  157,  158,  159,  160,  161,  162,  163,
-      163,  164,  165,  166,  167,  168,  169,  170,  171,  172,
-      173,  174,  175,  177,  179,  180,  181,  182,  184,  185,
-
-      186,  187,  188,  189,  190,  191,  192,  193,  193,  194,
-      195,  197,  197,  198,  199,  199,  200,  201,  202,  203,
-      205,  206,  207,  208,  209,  210,  211,  212,  214,  215,
-      216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
-      225,  226,  226,  228,  228,  229,  230,  231,  233,  234,
-      235,  236,  238,  239,  240,  242,  243,  244,  245,  246,
-      248,  249,  250,  251,  253,  255,  256,  256,  258,  260,
-      261,  262,  263,  265,  266,  267,  268,  270,  271,  272,
-      273,  275,  277,  278,  279,  280,  281,  282,  284,  286,
-      288,  290,  291,  293,  295,  297,  298,  300,  302,  302
-
-    } ;
-
-static yyconst int yy_ec[256] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
-        2,    2,    2,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    2,    4,    5,    1,    1,    6,    7,    8,    9,
-       10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
-       19,   19,   19,   19,   19,   19,   19,   20,   21,   22,
-       23,   24,    1,    1,   25,   26,   25,   25,   27,   28,
-       29,   29,   29,   29,   29,   29,   29,   29,   29,   29,
-       29,   29,   29,   29,   29,   29,   29,   30,   29,   29,
-       31,   32,   33,   34,   29,   35,   36,   37,   38,   39,
-
-       40,   41,   42,   43,   44,   29,   45,   46,   47,   48,
-       49,   29,   29,   50,   51,   52,   53,   29,   54,   30,
-       29,   29,   55,   56,   57,   58,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
-    } ;
-
-static yyconst int yy_meta[59] =
-    {   0,
-        1,    1,    2,    1,    1,    1,    1,    3,    1,    1,
-        1,    1,    1,    1,    1,    1,    4,    4,    4,    1,
-        1,    1,    1,    1,    4,    4,    4,    4,    5,    5,
-        1,    1,    1,    1,    1,    4,    4,    4,    4,    4,
-        4,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    1,    1,    1,    1
-    } ;
-
-static yyconst short int yy_base[206] =
-    {   0,
-        0,    0,  307,  308,  308,  308,  283,   54,  282,   53,
-      272,  308,  308,  280,  279,  308,  278,   44,   54,   72,
-       54,  308,  308,   44,  277,   51,    0,  308,  308,  276,
-      263,  249,  246,   43,   44,  249,   47,  248,   37,  244,
-      252,  238,  240,  249,  234,   61,  244,  308,   45,  308,
-      308,  308,   75,  308,  283,  308,  308,  308,   56,  100,
-      308,  308,  308,   96,  308,    0,  308,   99,  114,   88,
-      130,    0,  262,  308,  308,  308,  261,    0,  308,  248,
-      247,  242,  240,  228,  230,  236,  222,  224,  228,  223,
-      224,  222,    0,    0,  232,  222,  222,    0,  215,  222,
+/*
+_____               __  ___          __            ____        _      __
+/ ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+/ (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+\___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+/___/             /_/
 
-      228,  220,  210,  218,  308,  308,  308,  138,  308,    0,
-      141,  153,  308,  102,  144,  156,    0,  308,  308,    0,
-      225,  220,  204,  209,  193,  195,  183,   85,  195,  195,
-      195,  193,  183,  175,  175,  180,  172,  182,  175,  159,
-      168,  176,  308,  181,  184,  308,  175,    0,  175,  165,
-      173,    0,  176,  175,    0,  158,  172,  161,  152,    0,
-      141,  151,  143,    0,    0,  140,  187,  196,    0,  131,
-      120,  118,    0,  115,  107,  100,    0,   95,   95,   95,
-        0,    0,   82,   82,   88,   79,   72,    0,    0,    0,
-        0,   70,    0,    0,    0,   47,    0,    0,  308,  237,
+See Copyright Notice in gmMachine.h
 
-      242,  244,  249,  254,   78
-    } ;
+*/
 
-static yyconst short int yy_def[206] =
-    {   0,
-      199,    1,  199,  199,  199,  199,  199,  200,  199,  199,
-      201,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  202,  199,  199,  199,
-      203,  202,  202,  202,  202,  202,  202,  202,  202,  202,
-      202,  202,  202,  202,  202,  202,  202,  199,  199,  199,
-      199,  199,  200,  199,  200,  199,  199,  199,  201,  201,
-      199,  199,  199,  199,  199,  204,  199,  199,  199,  199,
-      199,  205,  199,  199,  199,  199,  199,  202,  199,  203,
-      199,  202,  202,  202,  202,  202,  202,  202,  202,  202,
-      202,  202,  202,  202,  202,  202,  202,  202,  202,  202,
+#include "gmConfig.h"
+#include "gmScanner.h"
+#include "gmCodeTree.h"
+#define YYSTYPE gmCodeTreeNode *
+#include "gmParser.cpp.h"
 
-      202,  202,  202,  202,  199,  199,  199,  199,  199,  204,
-      199,  199,  199,  199,  199,  199,  205,  199,  199,  202,
-      202,  202,  202,  202,  202,  202,  202,  202,  202,  202,
-      202,  202,  202,  202,  202,  202,  202,  202,  202,  199,
-      199,  199,  199,  199,  199,  199,  202,  202,  202,  202,
-      202,  202,  202,  202,  202,  202,  202,  202,  202,  202,
-      202,  202,  202,  202,  202,  202,  199,  199,  202,  202,
-      202,  202,  202,  202,  202,  202,  202,  202,  202,  202,
-      202,  202,  202,  202,  202,  202,  202,  202,  202,  202,
-      202,  202,  202,  202,  202,  202,  202,  202,    0,  199,
+#include <string.h>
 
-      199,  199,  199,  199,  199
-    } ;
+/*
+Tokens, longest match first
+
+slash star ... star slash  comment, not nested, may run to the end of the source
+slash slash ...            comment to the end of the line
+[ \t\v\r\n\f]              white space
+keywords                   local global member inline and or if else while for foreach in dowhile break
+                           continue null return function table this true false fork switch case default
+[a-zA-Z_][a-zA-Z0-9_]*     IDENTIFIER
+0[xX][a-fA-F0-9]+          CONSTANT_HEX
+0[bB][01]+                 CONSTANT_BINARY
+[0-9]+                     CONSTANT_INT
+'(\\.|[^\\'])+'            CONSTANT_CHAR
+[0-9]+{SCI}{FL}?           CONSTANT_FLOAT, SCI is [Ee][+-]?[0-9]+ and FL is f or F
+[0-9]*"."[0-9]+{SCI}?{FL}? CONSTANT_FLOAT
+[0-9]+"."[0-9]*{SCI}?{FL}? CONSTANT_FLOAT
+\"(\\.|[^\\"])*\"          CONSTANT_STRING, . is any character but newline
+`([^`]|``)*`               CONSTANT_STRING
+&& ||                      KEYWORD_AND KEYWORD_OR
+>>= <<= += -= *= /= %= &= |= ^= >> << <= >= == !=    SYMBOL_...
+; { } , = ( ) [ ] . ! - + * / % < > & | ^ ~ :        the character
+anything else              TOKEN_ERROR, one character
+
+gmlineno counts the newlines in comments, white space and tokens.
+*/
 
-static yyconst short int yy_nxt[367] =
-    {   0,
-        4,    5,    6,    7,    8,    9,   10,   11,   12,   13,
-       14,   15,   16,   17,   18,   19,   20,   21,   21,   22,
-       23,   24,   25,   26,   27,   27,   27,   27,   27,   27,
-       28,    4,   29,   30,   31,   32,   33,   34,   35,   36,
-       37,   38,   27,   39,   27,   40,   41,   42,   43,   44,
-       45,   46,   27,   47,   48,   49,   50,   51,   54,   57,
-       64,   64,   64,  107,   65,   73,   74,  105,   68,   66,
-       69,   69,   69,   76,   77,   58,   67,   93,   84,   54,
-       71,  117,   89,   86,   94,   55,   68,   60,   69,   69,
-       69,   85,   87,   71,  198,   90,  101,   70,   71,   91,
+GM_THREAD_LOCAL char * gmtext = NULL;
+GM_THREAD_LOCAL int gmlineno = 1;
+static GM_THREAD_LOCAL gmScanner * s_scanner = NULL;
 
-      106,   72,  199,  102,  114,  114,   55,   59,   70,  197,
-      103,   71,   64,   64,   64,  111,  111,  111,  114,  114,
-      196,  195,  108,  109,  154,  112,  113,  194,   68,  155,
-       69,   69,   69,  193,  192,  108,  109,  191,  112,  113,
-       71,  115,  190,  115,  189,  188,  116,  116,  116,  140,
-      187,  140,  186,   71,  141,  141,  141,  111,  111,  111,
-      116,  116,  116,  185,  144,  184,  144,  142,  143,  145,
-      145,  145,  116,  116,  116,  141,  141,  141,  183,  182,
-      142,  143,  181,  146,  141,  141,  141,  167,  180,  167,
-      179,  178,  168,  168,  168,  109,  146,  145,  145,  145,
+#define GM_PAD 8 // NUL bytes after the source, covers word reads
 
-      145,  145,  145,  168,  168,  168,  177,  176,  109,  175,
-      174,  113,  168,  168,  168,  173,  172,  171,  170,  169,
-      166,  165,  164,  143,  113,  163,  162,  161,  160,  159,
-      158,  157,  156,  153,  152,  151,  143,   53,   53,   53,
-       53,   53,   59,   59,  150,   59,   59,   78,   78,   80,
-       80,   80,   80,   80,  110,  149,  110,  110,  110,  148,
-      147,  139,  138,  137,  136,  135,  134,  133,  132,  131,
-      130,  129,  128,  127,  126,  125,  124,  123,  122,  121,
-      120,   80,   81,  119,  118,  199,  104,  100,   99,   98,
-       97,   96,   95,   92,   88,   83,   82,   81,   79,   75,
+enum
+{
+	GM_SPACE = 1,
+	GM_LETTER = 2,
+	GM_DIGIT = 4,
+	GM_HEX = 8,
+};
+
+// character classes, filled at static initialisation
+static struct gmScannerClasses
+{
+	gmuint8 m_class[256];
 
-       63,   62,   61,   60,   56,   52,  199,    3,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199
-    } ;
+	gmScannerClasses()
+	{
+		memset(m_class, 0, sizeof(m_class));
+		const char * space = " \t\v\r\n\f";
+		while(*space) { m_class[(unsigned char) *space++] = GM_SPACE; }
+		for(int c = 'a'; c <= 'z'; ++c) { m_class[c] = GM_LETTER; m_class[c - 'a' + 'A'] = GM_LETTER; }
+		m_class['_'] = GM_LETTER;
+		for(int c = '0'; c <= '9'; ++c) { m_class[c] = GM_DIGIT | GM_HEX; }
+		for(int c = 'a'; c <= 'f'; ++c) { m_class[c] |= GM_HEX; m_class[c - 'a' + 'A'] |= GM_HEX; }
+	}
+} s_classes;
 
-static yyconst short int yy_chk[367] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    8,   10,
-       18,   18,   18,   59,   19,   24,   24,   49,   21,   19,
-       21,   21,   21,   26,   26,   10,   19,   39,   34,   53,
-       21,  205,   37,   35,   39,    8,   20,   59,   20,   20,
-       20,   34,   35,   21,  196,   37,   46,   20,   20,   37,
+#define GM_IS(C, CLASS) (s_classes.m_class[(unsigned char) (C)] & (CLASS))
 
-       49,   20,   60,   46,   70,   70,   53,   60,   20,  192,
-       46,   20,   64,   64,   64,   68,   68,   68,  114,  114,
-      187,  186,   64,   64,  128,   68,   68,  185,   69,  128,
-       69,   69,   69,  184,  183,   64,   64,  180,   68,   68,
-       69,   71,  179,   71,  178,  176,   71,   71,   71,  108,
-      175,  108,  174,   69,  108,  108,  108,  111,  111,  111,
-      115,  115,  115,  172,  112,  171,  112,  111,  111,  112,
-      112,  112,  116,  116,  116,  140,  140,  140,  170,  166,
-      111,  111,  163,  116,  141,  141,  141,  142,  162,  142,
-      161,  159,  142,  142,  142,  141,  116,  144,  144,  144,
 
-      145,  145,  145,  167,  167,  167,  158,  157,  141,  156,
-      154,  145,  168,  168,  168,  153,  151,  150,  149,  147,
-      139,  138,  137,  168,  145,  136,  135,  134,  133,  132,
-      131,  130,  129,  127,  126,  125,  168,  200,  200,  200,
-      200,  200,  201,  201,  124,  201,  201,  202,  202,  203,
-      203,  203,  203,  203,  204,  123,  204,  204,  204,  122,
-      121,  104,  103,  102,  101,  100,   99,   97,   96,   95,
-       92,   91,   90,   89,   88,   87,   86,   85,   84,   83,
-       82,   81,   80,   77,   73,   55,   47,   45,   44,   43,
-       42,   41,   40,   38,   36,   33,   32,   31,   30,   25,
+//
+// Eight characters at a time.  A byte mask has the high bit of each byte set for the
+// characters it selects.
+//
 
-       17,   15,   14,   11,    9,    7,    3,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199
-    } ;
+#define GM_BYTES(C) ((gmuint64) (C) * 0x0101010101010101ULL)
+#define GM_HIGH GM_BYTES(0x80)
+#define GM_LOW GM_BYTES(0x7f)
 
-static yy_state_type yy_state_buf[YY_BUF_SIZE + 2], *yy_state_ptr;
-static char *yy_full_match;
-static int yy_lp;
-#define REJECT \
-{ \
-*yy_cp = yy_hold_char; /* undo effects of setting up yytext */ \
-yy_cp = yy_full_match; /* restore poss. backed-over text */ \
-++yy_lp; \
-goto find_rule; \
+static inline gmuint64 gmReadWord(const char * a_pos)
+{
+	gmuint64 word;
+	memcpy(&word, a_pos, sizeof(word));
+	return word;
 }
-#define yymore() yymore_used_but_not_detected
-#define YY_MORE_ADJ 0
-char *yytext;
-#line 1 "gmScanner.l"
-#define INITIAL 0
-/*
-    _____               __  ___          __            ____        _      __
-   / ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
-  / (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
-  \___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
-                                               /___/             /_/
-                                             
-  See Copyright Notice in gmMachine.h
-
-*/
-#line 22 "gmScanner.l"
-
-#include <stdio.h>
-#include "gmConfig.h"
-#include "gmParser.cpp.h"
-
-#line 583 "gmScanner.cpp"
-
-/* Macros after this point can all be overridden by user definitions in
- * section 1.
- */
 
-#ifndef YY_SKIP_YYWRAP
-#ifdef __cplusplus
-extern "C" int yywrap YY_PROTO(( void ));
-#else
-extern int yywrap YY_PROTO(( void ));
-#endif
-#endif
-
-#ifndef YY_NO_UNPUT
-static void yyunput YY_PROTO(( int c, char *buf_ptr ));
-#endif
-
-#ifndef yytext_ptr
-static void yy_flex_strncpy YY_PROTO(( char *, yyconst char *, int ));
-#endif
-
-#ifndef YY_NO_INPUT
-#ifdef __cplusplus
-static int yyinput YY_PROTO(( void ));
-#else
-static int input YY_PROTO(( void ));
-#endif
-#endif
-
-#if YY_STACK_USED
-static int yy_start_stack_ptr = 0;
-static int yy_start_stack_depth = 0;
-static int *yy_start_stack = 0;
-#ifndef YY_NO_PUSH_STATE
-static void yy_push_state YY_PROTO(( int new_state ));
-#endif
-#ifndef YY_NO_POP_STATE
-static void yy_pop_state YY_PROTO(( void ));
-#endif
-#ifndef YY_NO_TOP_STATE
-static int yy_top_state YY_PROTO(( void ));
-#endif
+// the zero bytes of a_word
+static inline gmuint64 gmZeroBytes(gmuint64 a_word)
+{
+	return ~(((a_word & GM_LOW) + GM_LOW) | a_word) & GM_HIGH;
+}
 
-#else
-#define YY_NO_PUSH_STATE 1
-#define YY_NO_POP_STATE 1
-#define YY_NO_TOP_STATE 1
-#endif
+// the bytes of a_word in a_low..a_high, a_word must not have high bits set
+static inline gmuint64 gmRangeBytes(gmuint64 a_word, int a_low, int a_high)
+{
+	return (a_word + GM_BYTES(0x80 - a_low)) & ~(a_word + GM_BYTES(0x7f - a_high)) & GM_HIGH;
+}
 
-#ifdef YY_MALLOC_DECL
-YY_MALLOC_DECL
-#else
-#if __STDC__
-#ifndef __cplusplus
-#include <stdlib.h>
-#endif
-#else
-/* Just try to get by without declaring the routines.  This will fail
- * miserably on non-ANSI systems for which sizeof(size_t) != sizeof(int)
- * or sizeof(void*) != sizeof(int).
- */
-#endif
-#endif
+// the bytes before the first byte of a_stop in memory order, a_stop must not be 0
+static inline gmuint64 gmBytesBefore(gmuint64 a_stop)
+{
+#if GM_LITTLE_ENDIAN
+	return ((a_stop & (0 - a_stop)) - 1) & GM_HIGH;
+#else // GM_LITTLE_ENDIAN
+	a_stop |= a_stop >> 8; a_stop |= a_stop >> 16; a_stop |= a_stop >> 32;
+	return ~a_stop & GM_HIGH;
+#endif // GM_LITTLE_ENDIAN
+}
 
-/* Amount of stuff to slurp up with each read. */
-#ifndef YY_READ_BUF_SIZE
-#define YY_READ_BUF_SIZE 8192
-#endif
+static inline int gmCountBytes(gmuint64 a_mask)
+{
+	return (int) (((a_mask >> 7) * GM_BYTES(1)) >> 56);
+}
 
-/* Copy whatever the last rule matched to the standard output. */
+// the number of identifier characters [a-zA-Z0-9_] at a_pos, up to 8
+static inline int gmIdentifierBytes(const char * a_pos)
+{
+	gmuint64 word = gmReadWord(a_pos);
+	gmuint64 low = word & GM_LOW;
+	gmuint64 letters = gmRangeBytes(low | GM_BYTES(0x20), 'a', 'z') | gmRangeBytes(low, '0', '9') | gmZeroBytes(low ^ GM_BYTES('_'));
+	gmuint64 stop = (~letters | word) & GM_HIGH;
+	return (stop) ? gmCountBytes(gmBytesBefore(stop)) : 8;
+}
 
-#ifndef ECHO
-/* This used to be an fputs(), but since the string might contain NUL's,
- * we now use fwrite().
- */
-#define ECHO (void) fwrite( yytext, yyleng, 1, yyout )
-#endif
 
-/* Gets input and stuffs it into "buf".  number of characters read, or YY_NULL,
- * is returned in "result".
- */
-/*
-#ifndef YY_INPUT
-#define YY_INPUT(buf,result,max_size) \
-	if ( yy_current_buffer->yy_is_interactive ) \
-		{ \
-		int c = '*', n; \
-		for ( n = 0; n < max_size && \
-			     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
-			buf[n] = (char) c; \
-		if ( c == '\n' ) \
-			buf[n++] = (char) c; \
-		if ( c == EOF && ferror( yyin ) ) \
-			YY_FATAL_ERROR( "input in flex scanner failed" ); \
-		result = n; \
-		} \
-	else if ( ((result = fread( buf, 1, max_size, yyin )) == 0) \
-		  && ferror( yyin ) ) \
-		YY_FATAL_ERROR( "input in flex scanner failed" );
-#endif
-*/
-// _GD_ added cast for 64bit build
-#ifndef YY_INPUT
-#define YY_INPUT(buf,result,max_size) \
-	if ( yy_current_buffer->yy_is_interactive ) \
-		{ \
-		int c = '*', n; \
-		for ( n = 0; n < max_size && \
-		     	     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
-			buf[n] = (char) c; \
-		if ( c == '\n' ) \
-			buf[n++] = (char) c; \
-		if ( c == EOF && ferror( yyin ) ) \
-			YY_FATAL_ERROR( "input in flex scanner failed" ); \
-		result = n; \
-		} \
-	else if ( ((result = (int)fread( buf, 1, max_size, yyin )) == 0 ) \
-		  && ferror( yyin ) ) \
-		YY_FATAL_ERROR( "input in flex scanner failed" );
-#endif
+static int gmCountLines(const char * a_from, const char * a_to)
+{
+	int lines = 0;
+	while(a_from < a_to)
+	{
+		const char * nl = (const char *) memchr(a_from, '\n', a_to - a_from);
+		if(nl == NULL) break;
+		++lines;
+		a_from = nl + 1;
+	}
+	return lines;
+}
 
-/* No semi-colon after return; correct usage is to write "yyterminate();" -
- * we don't want an extra ';' after the "return" because that will cause
- * some compilers to complain about unreachable statements.
- */
-#ifndef yyterminate
-#define yyterminate() return YY_NULL
-#endif
 
-/* Number of entries by which start-condition stack grows. */
-#ifndef YY_START_STACK_INCR
-#define YY_START_STACK_INCR 25
-#endif
+static int gmKeyword(const char * a_text, int a_length)
+{
+#define GM_KEYWORD(NAME, TOKEN) if(a_length == (int) sizeof(NAME) - 1 && memcmp(a_text, NAME, a_length) == 0) return TOKEN;
+	switch(a_text[0])
+	{
+		case 'a' : GM_KEYWORD("and", KEYWORD_AND) break;
+		case 'b' : GM_KEYWORD("break", KEYWORD_BREAK) break;
+		case 'c' : GM_KEYWORD("continue", KEYWORD_CONTINUE) GM_KEYWORD("case", KEYWORD_CASE) break;
+		case 'd' : GM_KEYWORD("dowhile", KEYWORD_DOWHILE) GM_KEYWORD("default", KEYWORD_DEFAULT) break;
+		case 'e' : GM_KEYWORD("else", KEYWORD_ELSE) break;
+		case 'f' : GM_KEYWORD("for", KEYWORD_FOR) GM_KEYWORD("foreach", KEYWORD_FOREACH) GM_KEYWORD("function", KEYWORD_FUNCTION)
+		           GM_KEYWORD("false", KEYWORD_FALSE) GM_KEYWORD("fork", KEYWORD_FORK) break;
+		case 'g' : GM_KEYWORD("global", KEYWORD_GLOBAL) break;
+		case 'i' : GM_KEYWORD("if", KEYWORD_IF) GM_KEYWORD("in", KEYWORD_IN) GM_KEYWORD("inline", KEYWORD_INLINE) break;
+		case 'l' : GM_KEYWORD("local", KEYWORD_LOCAL) break;
+		case 'm' : GM_KEYWORD("member", KEYWORD_MEMBER) break;
+		case 'n' : GM_KEYWORD("null", KEYWORD_NULL) break;
+		case 'o' : GM_KEYWORD("or", KEYWORD_OR) break;
+		case 'r' : GM_KEYWORD("return", KEYWORD_RETURN) break;
+		case 's' : GM_KEYWORD("switch", KEYWORD_SWITCH) break;
+		case 't' : GM_KEYWORD("table", KEYWORD_TABLE) GM_KEYWORD("this", KEYWORD_THIS) GM_KEYWORD("true", KEYWORD_TRUE) break;
+		case 'w' : GM_KEYWORD("while", KEYWORD_WHILE) break;
+		default : break;
+	}
+#undef GM_KEYWORD
+	return IDENTIFIER;
+}
 
-/* Report a fatal error. */
-#ifndef YY_FATAL_ERROR
-#define YY_FATAL_ERROR(msg) yy_fatal_error( msg )
-#endif
 
-/* Default declaration of generated scanner - a define so the user can
- * easily add parameters.
- */
-#ifndef YY_DECL
-#define YY_DECL int yylex YY_PROTO(( void ))
-#endif
+// [Ee][+-]?[0-9]+, returns a_pos if there is none
+static char * gmScanExponent(char * a_pos)
+{
+	if(*a_pos != 'e' && *a_pos != 'E') return a_pos;
+	char * p = a_pos + 1;
+	if(*p == '+' || *p == '-') ++p;
+	if(!GM_IS(*p, GM_DIGIT)) return a_pos;
+	while(GM_IS(*p, GM_DIGIT)) ++p;
+	return p;
+}
 
-/* Code executed at the beginning of each rule, after yytext and yyleng
- * have been set up.
- */
-#ifndef YY_USER_ACTION
-#define YY_USER_ACTION
-#endif
 
-/* Code executed at the end of each rule. */
-#ifndef YY_BREAK
-#define YY_BREAK break;
-#endif
+// a_pos is at a digit, or a '.' followed by a digit
+static char * gmScanNumber(char * a_pos, int &a_token)
+{
+	char * p = a_pos;
+
+	if(p[0] == '0' && (p[1] == 'x' || p[1] == 'X') && GM_IS(p[2], GM_HEX))
+	{
+		p += 2;
+		while(GM_IS(*p, GM_HEX)) ++p;
+		a_token = CONSTANT_HEX;
+		return p;
+	}
+	if(p[0] == '0' && (p[1] == 'b' || p[1] == 'B') && (p[2] == '0' || p[2] == '1'))
+	{
+		p += 2;
+		while(*p == '0' || *p == '1') ++p;
+		a_token = CONSTANT_BINARY;
+		return p;
+	}
+
+	while(GM_IS(*p, GM_DIGIT)) ++p;
+	bool digits = (p != a_pos);
+
+	if(*p == '.' && (digits || GM_IS(p[1], GM_DIGIT)))
+	{
+		++p;
+		while(GM_IS(*p, GM_DIGIT)) ++p;
+		p = gmScanExponent(p);
+	}
+	else
+	{
+		char * e = gmScanExponent(p);
+		if(e == p)
+		{
+			a_token = CONSTANT_INT;
+			return p;
+		}
+		p = e;
+	}
+	if(*p == 'f' || *p == 'F') ++p;
+	a_token = CONSTANT_FLOAT;
+	return p;
+}
 
-#define YY_RULE_SETUP \
-	YY_USER_ACTION
 
-YY_DECL
-   {
-   register yy_state_type yy_current_state;
-   register char *yy_cp, *yy_bp;
-   register int yy_act;
+// a_pos is at the opening quote of a '' or "" constant, returns NULL if it is not closed
+static char * gmScanQuoted(char * a_pos, char a_quote, bool a_allowEmpty)
+{
+	char * p = a_pos + 1;
+	for(;;)
+	{
+		char c = *p;
+		if(c == a_quote)
+		{
+			return (a_allowEmpty || p > a_pos + 1) ? p + 1 : NULL;
+		}
+		if(c == '\\')
+		{
+			if(p[1] == '\n' || p[1] == '\0') return NULL;
+			p += 2;
+		}
+		else if(c == '\0')
+		{
+			return NULL;
+		}
+		else
+		{
+			++p;
+		}
+	}
+}
 
-#line 29 "gmScanner.l"
 
+// a_pos is at the opening `, `` inside the string is a `, returns NULL if it is not closed
+static char * gmScanBackQuoted(char * a_pos)
+{
+	char * p = a_pos + 1;
+	char * end = NULL;
+	for(;;)
+	{
+		const char * q = strchr(p, '`');
+		if(q == NULL) return end;
+		p = (char *) q + 1;
+		end = p;
+		if(*p != '`') return end;
+		++p;
+	}
+}
 
-#line 754 "gmScanner.cpp"
 
-   if ( yy_init )
-      {
-      yy_init = 0;
+gmScanner::gmScanner(const char * a_source, int a_length)
+{
+	if(a_length < 0) a_length = (int) strlen(a_source);
+	m_source = GM_NEW( char[a_length + GM_PAD] );
+	memcpy(m_source, a_source, a_length);
+	memset(m_source + a_length, 0, GM_PAD);
+	// like the string it replaces, the source ends at the first NUL
+	m_end = m_source + strlen(m_source);
+	m_pos = m_source;
+	m_text = m_source;
+	m_hold = *m_pos;
+	m_line = 1;
+}
 
-#ifdef YY_USER_INIT
-      YY_USER_INIT;
-#endif
 
-      if ( ! yy_start )
-         yy_start = 1;  /* first start state */
+gmScanner::~gmScanner()
+{
+	if(s_scanner == this) s_scanner = NULL;
+	delete [] m_source;
+}
 
-      if ( ! yyin )
-         yyin = stdin;
 
-      if ( ! yyout )
-         yyout = stdout;
+gmScanner * gmScanner::SetCurrent(gmScanner * a_scanner)
+{
+	gmScanner * previous = s_scanner;
+	s_scanner = a_scanner;
+	return previous;
+}
 
-      if ( ! yy_current_buffer )
-         yy_current_buffer =
-            yy_create_buffer( yyin, YY_BUF_SIZE );
 
-      yy_load_buffer_state();
-      }
+// white space and comments, counting lines
+char * gmScanner::SkipSpace(char * a_pos)
+{
+	char * p = a_pos;
+	for(;;)
+	{
+		char c = *p;
+		if(GM_IS(c, GM_SPACE))
+		{
+			// one character, then runs of spaces, tabs and line ends a word at a time, \v and \f
+			// one at a time.  The first character may have just been put back by Lex(), a word
+			// read over it would stall.
+			if(c == '\n') ++m_line;
+			++p;
+			while(GM_IS(*p, GM_SPACE))
+			{
+				gmuint64 word = gmReadWord(p);
+				gmuint64 newline = gmZeroBytes(word ^ GM_BYTES('\n'));
+				gmuint64 space = gmZeroBytes(word ^ GM_BYTES(' ')) | gmZeroBytes(word ^ GM_BYTES('\t')) | gmZeroBytes(word ^ GM_BYTES('\r'));
+				gmuint64 stop = ~(space | newline) & GM_HIGH;
+				gmuint64 run = (stop) ? gmBytesBefore(stop) : GM_HIGH;
+				if(newline) m_line += gmCountBytes(newline & run);
+				p += gmCountBytes(run);
+				if(stop) break;
+			}
+		}
+		else if(c == '/' && p[1] == '*')
+		{
+			// find the closing */, at the end of the source if there is none
+			char * from = p + 2;
+			p = m_end;
+			for(char * star = from; (star = (char *) memchr(star, '*', m_end - star)) != NULL; ++star)
+			{
+				if(star[1] == '/')
+				{
+					p = star + 2;
+					break;
+				}
+			}
+			m_line += gmCountLines(from, p);
+		}
+		else if(c == '/' && p[1] == '/')
+		{
+			char * nl = (char *) memchr(p + 2, '\n', m_end - (p + 2));
+			p = (nl) ? nl : m_end;
+		}
+		else
+		{
+			break;
+		}
+	}
+	return p;
+}
 
-   while ( 1 )    /* loops until end-of-file is reached */
-      {
-      yy_cp = yy_c_buf_p;
 
-      /* Support of yytext. */
-      *yy_cp = yy_hold_char;
+int gmScanner::Lex()
+{
+	*m_pos = m_hold;
+	char * p = SkipSpace(m_pos);
 
-      /* yy_bp points to the position in yy_ch_buf of the start of
-       * the current run.
-       */
-      yy_bp = yy_cp;
+	char * start = p;
+	char * end = p + 1;
+	int token;
+	unsigned char c = (unsigned char) *p;
 
-		yy_current_state = yy_start;
-		yy_state_ptr = yy_state_buf;
-		*yy_state_ptr++ = yy_current_state;
-yy_match:
-		do
+	if(GM_IS(c, GM_LETTER))
+	{
+		for(;;)
+		{
+			int length = gmIdentifierBytes(end);
+			end += length;
+			if(length < 8) break;
+		}
+		token = gmKeyword(start, (int) (end - start));
+	}
+	else if(GM_IS(c, GM_DIGIT) || (c == '.' && GM_IS(p[1], GM_DIGIT)))
+	{
+		end = gmScanNumber(p, token);
+	}
+	else
+	{
+		char n = p[1];
+		switch(c)
+		{
+			case '\0' :
 			{
-			register YY_CHAR yy_c = yy_ec[YY_SC_TO_UI(*yy_cp)];
-			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
+				m_pos = p;
+				m_hold = '\0';
+				m_text = p;
+				return 0;
+			}
+			case '\'' :
+			case '"' :
+			{
+				char * close = gmScanQuoted(p, (char) c, c == '"');
+				if(close)
+				{
+					end = close;
+					token = (c == '"') ? CONSTANT_STRING : CONSTANT_CHAR;
+					m_line += gmCountLines(start, end);
+				}
+				else
 				{
-				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 200 )
-					yy_c = yy_meta[(unsigned int) yy_c];
+					token = TOKEN_ERROR;
 				}
-			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-			*yy_state_ptr++ = yy_current_state;
-			++yy_cp;
+				break;
 			}
-		while ( yy_base[yy_current_state] != 308 );
-
-yy_find_action:
-		yy_current_state = *--yy_state_ptr;
-		yy_lp = yy_accept[yy_current_state];
-find_rule: /* we branch to this label when backing up */
-		for ( ; ; ) /* until we find what rule we matched */
+			case '`' :
 			{
-			if ( yy_lp && yy_lp < yy_accept[yy_current_state + 1] )
+				char * close = gmScanBackQuoted(p);
+				if(close)
 				{
-				yy_act = yy_acclist[yy_lp];
-					{
-					yy_full_match = yy_cp;
-					break;
-					}
+					end = close;
+					token = CONSTANT_STRING;
+					m_line += gmCountLines(start, end);
 				}
-			--yy_cp;
-			yy_current_state = *--yy_state_ptr;
-			yy_lp = yy_accept[yy_current_state];
+				else
+				{
+					token = TOKEN_ERROR;
+				}
+				break;
 			}
-
-      YY_DO_BEFORE_ACTION;
-
-		if ( yy_act != YY_END_OF_BUFFER )
+			case '&' : if(n == '&') { ++end; token = KEYWORD_AND; } else if(n == '=') { ++end; token = SYMBOL_ASGN_BAND; } else token = '&'; break;
+			case '|' : if(n == '|') { ++end; token = KEYWORD_OR; } else if(n == '=') { ++end; token = SYMBOL_ASGN_BOR; } else token = '|'; break;
+			case '>' :
 			{
-			int yyl;
-			for ( yyl = 0; yyl < yyleng; ++yyl )
-				if ( yytext[yyl] == '\n' )
-					++yylineno;
+				if(n == '>') { ++end; if(p[2] == '=') { ++end; token = SYMBOL_ASGN_BSR; } else token = SYMBOL_RIGHT_SHIFT; }
+				else if(n == '=') { ++end; token = SYMBOL_GTE; }
+				else token = '>';
+				break;
 			}
-
-do_action:  /* This label is used only to access EOF actions. */
-
-
-      switch ( yy_act )
-   { /* beginning of action switch */
-case 1:
-YY_RULE_SETUP
-#line 31 "gmScanner.l"
-{
-            int c;
-
-            while((c = yyinput()) != 0 && c != EOF)
-                {
-                if(c == '*')
-                    {
-                    if((c = yyinput()) == '/')
-                        break;
-                    else
-                        unput(c);
-                    }
-                }
-            }
-	YY_BREAK
-case 2:
-YY_RULE_SETUP
-#line 46 "gmScanner.l"
-{ /* eat up comments */       }
-	YY_BREAK
-case 3:
-YY_RULE_SETUP
-#line 48 "gmScanner.l"
-{ return(KEYWORD_LOCAL);      }
-	YY_BREAK
-case 4:
-YY_RULE_SETUP
-#line 49 "gmScanner.l"
-{ return(KEYWORD_GLOBAL);     }
-	YY_BREAK
-case 5:
-YY_RULE_SETUP
-#line 50 "gmScanner.l"
-{ return(KEYWORD_MEMBER);     }
-	YY_BREAK
-case 6:
-YY_RULE_SETUP
-#line 51 "gmScanner.l"
-{ return(KEYWORD_AND);        }
-	YY_BREAK
-case 7:
-YY_RULE_SETUP
-#line 52 "gmScanner.l"
-{ return(KEYWORD_OR);         }
-	YY_BREAK
-case 8:
-YY_RULE_SETUP
-#line 53 "gmScanner.l"
-{ return(KEYWORD_IF);         }
-	YY_BREAK
-case 9:
-YY_RULE_SETUP
-#line 54 "gmScanner.l"
-{ return(KEYWORD_ELSE);       }
-	YY_BREAK
-case 10:
-YY_RULE_SETUP
-#line 55 "gmScanner.l"
-{ return(KEYWORD_WHILE);      }
-	YY_BREAK
-case 11:
-YY_RULE_SETUP
-#line 56 "gmScanner.l"
-{ return(KEYWORD_FOR);        }
-	YY_BREAK
-case 12:
-YY_RULE_SETUP
-#line 57 "gmScanner.l"
-{ return(KEYWORD_FOREACH);    }
-	YY_BREAK
-case 13:
-YY_RULE_SETUP
-#line 58 "gmScanner.l"
-{ return(KEYWORD_IN);         }
-	YY_BREAK
-case 14:
-YY_RULE_SETUP
-#line 59 "gmScanner.l"
-{ return(KEYWORD_DOWHILE);    }
-	YY_BREAK
-case 15:
-YY_RULE_SETUP
-#line 60 "gmScanner.l"
-{ return(KEYWORD_BREAK);      }
-	YY_BREAK
-case 16:
-YY_RULE_SETUP
-#line 61 "gmScanner.l"
-{ return(KEYWORD_CONTINUE);   }
-	YY_BREAK
-case 17:
-YY_RULE_SETUP
-#line 62 "gmScanner.l"
-{ return(KEYWORD_NULL);       }
-	YY_BREAK
-case 18:
-YY_RULE_SETUP
-#line 63 "gmScanner.l"
-{ return(KEYWORD_RETURN);     }
-	YY_BREAK
-case 19:
-YY_RULE_SETUP
-#line 64 "gmScanner.l"
-{ return(KEYWORD_FUNCTION);   }
-	YY_BREAK
-case 20:
-YY_RULE_SETUP
-#line 65 "gmScanner.l"
-{ return(KEYWORD_TABLE);      }
-	YY_BREAK
-case 21:
-YY_RULE_SETUP
-#line 66 "gmScanner.l"
-{ return(KEYWORD_THIS);       }
-	YY_BREAK
-case 22:
-YY_RULE_SETUP
-#line 67 "gmScanner.l"
-{ return(KEYWORD_TRUE);       }
-	YY_BREAK
-case 23:
-YY_RULE_SETUP
-#line 68 "gmScanner.l"
-{ return(KEYWORD_FALSE);      }
-	YY_BREAK
-case 24:
-YY_RULE_SETUP
-#line 69 "gmScanner.l"
-{ return(KEYWORD_FORK);      }
-	YY_BREAK
-case 25:
-YY_RULE_SETUP
-#line 70 "gmScanner.l"
-{ return(KEYWORD_SWITCH);     }
-	YY_BREAK
-case 26:
-YY_RULE_SETUP
-#line 71 "gmScanner.l"
-{ return(KEYWORD_CASE);       }
-	YY_BREAK
-case 27:
-YY_RULE_SETUP
-#line 72 "gmScanner.l"
-{ return(KEYWORD_DEFAULT);    }
-	YY_BREAK
-case 28:
-YY_RULE_SETUP
-#line 74 "gmScanner.l"
-{ return(IDENTIFIER);         }
-	YY_BREAK
-case 29:
-YY_RULE_SETUP
-#line 76 "gmScanner.l"
-{ return(CONSTANT_HEX);       }
-	YY_BREAK
-case 30:
-YY_RULE_SETUP
-#line 77 "gmScanner.l"
-{ return(CONSTANT_BINARY);    }
-	YY_BREAK
-case 31:
-YY_RULE_SETUP
-#line 78 "gmScanner.l"
-{ return(CONSTANT_INT);       }
-	YY_BREAK
-case 32:
-YY_RULE_SETUP
-#line 79 "gmScanner.l"
-{ return(CONSTANT_CHAR);      }
-	YY_BREAK
-case 33:
-YY_RULE_SETUP
-#line 80 "gmScanner.l"
-{ return(CONSTANT_FLOAT);     }
-	YY_BREAK
-case 34:
-YY_RULE_SETUP
-#line 81 "gmScanner.l"
-{ return(CONSTANT_FLOAT);     }
-	YY_BREAK
-case 35:
-YY_RULE_SETUP
-#line 82 "gmScanner.l"
-{ return(CONSTANT_FLOAT);     }
-	YY_BREAK
-case 36:
-YY_RULE_SETUP
-#line 83 "gmScanner.l"
-{ return(CONSTANT_STRING);    }
-	YY_BREAK
-case 37:
-YY_RULE_SETUP
-#line 84 "gmScanner.l"
-{ return(CONSTANT_STRING);    }
-	YY_BREAK
-case 38:
-YY_RULE_SETUP
-#line 86 "gmScanner.l"
-{ return(KEYWORD_AND);        }
-	YY_BREAK
-case 39:
-YY_RULE_SETUP
-#line 87 "gmScanner.l"
-{ return(KEYWORD_OR);         }
-	YY_BREAK
-case 40:
-YY_RULE_SETUP
-#line 88 "gmScanner.l"
-{ return(SYMBOL_ASGN_BSR);    }
-	YY_BREAK
-case 41:
-YY_RULE_SETUP
-#line 89 "gmScanner.l"
-{ return(SYMBOL_ASGN_BSL);    }
-	YY_BREAK
-case 42:
-YY_RULE_SETUP
-#line 90 "gmScanner.l"
-{ return(SYMBOL_ASGN_ADD);    }
-	YY_BREAK
-case 43:
-YY_RULE_SETUP
-#line 91 "gmScanner.l"
-{ return(SYMBOL_ASGN_MINUS);  }
-	YY_BREAK
-case 44:
-YY_RULE_SETUP
-#line 92 "gmScanner.l"
-{ return(SYMBOL_ASGN_TIMES);  }
-	YY_BREAK
-case 45:
-YY_RULE_SETUP
-#line 93 "gmScanner.l"
-{ return(SYMBOL_ASGN_DIVIDE); }
-	YY_BREAK
-case 46:
-YY_RULE_SETUP
-#line 94 "gmScanner.l"
-{ return(SYMBOL_ASGN_REM);    }
-	YY_BREAK
-case 47:
-YY_RULE_SETUP
-#line 95 "gmScanner.l"
-{ return(SYMBOL_ASGN_BAND);   }
-	YY_BREAK
-case 48:
-YY_RULE_SETUP
-#line 96 "gmScanner.l"
-{ return(SYMBOL_ASGN_BOR);    }
-	YY_BREAK
-case 49:
-YY_RULE_SETUP
-#line 97 "gmScanner.l"
-{ return(SYMBOL_ASGN_BXOR);   }
-	YY_BREAK
-case 50:
-YY_RULE_SETUP
-#line 98 "gmScanner.l"
-{ return(SYMBOL_RIGHT_SHIFT); }
-	YY_BREAK
-case 51:
-YY_RULE_SETUP
-#line 99 "gmScanner.l"
-{ return(SYMBOL_LEFT_SHIFT);  }
-	YY_BREAK
-case 52:
-YY_RULE_SETUP
-#line 100 "gmScanner.l"
-{ return(SYMBOL_LTE);         }
-	YY_BREAK
-case 53:
-YY_RULE_SETUP
-#line 101 "gmScanner.l"
-{ return(SYMBOL_GTE);         }
-	YY_BREAK
-case 54:
-YY_RULE_SETUP
-#line 102 "gmScanner.l"
-{ return(SYMBOL_EQ);          }
-	YY_BREAK
-case 55:
-YY_RULE_SETUP
-#line 103 "gmScanner.l"
-{ return(SYMBOL_NEQ);         }
-	YY_BREAK
-case 56:
-YY_RULE_SETUP
-#line 104 "gmScanner.l"
-{ return(';');                }
-	YY_BREAK
-case 57:
-YY_RULE_SETUP
-#line 105 "gmScanner.l"
-{ return('{');                }
-	YY_BREAK
-case 58:
-YY_RULE_SETUP
-#line 106 "gmScanner.l"
-{ return('}');                }
-	YY_BREAK
-case 59:
-YY_RULE_SETUP
-#line 107 "gmScanner.l"
-{ return(',');                }
-	YY_BREAK
-case 60:
-YY_RULE_SETUP
-#line 108 "gmScanner.l"
-{ return('=');                }
-	YY_BREAK
-case 61:
-YY_RULE_SETUP
-#line 109 "gmScanner.l"
-{ return('(');                }
-	YY_BREAK
-case 62:
-YY_RULE_SETUP
-#line 110 "gmScanner.l"
-{ return(')');                }
-	YY_BREAK
-case 63:
-YY_RULE_SETUP
-#line 111 "gmScanner.l"
-{ return('[');                }
-	YY_BREAK
-case 64:
-YY_RULE_SETUP
-#line 112 "gmScanner.l"
-{ return(']');                }
-	YY_BREAK
-case 65:
-YY_RULE_SETUP
-#line 113 "gmScanner.l"
-{ return('.');                }
-	YY_BREAK
-case 66:
-YY_RULE_SETUP
-#line 114 "gmScanner.l"
-{ return('!');                }
-	YY_BREAK
-case 67:
-YY_RULE_SETUP
-#line 115 "gmScanner.l"
-{ return('-');                }
-	YY_BREAK
-case 68:
-YY_RULE_SETUP
-#line 116 "gmScanner.l"
-{ return('+');                }
-	YY_BREAK
-case 69:
-YY_RULE_SETUP
-#line 117 "gmScanner.l"
-{ return('*');                }
-	YY_BREAK
-case 70:
-YY_RULE_SETUP
-#line 118 "gmScanner.l"
-{ return('/');                }
-	YY_BREAK
-case 71:
-YY_RULE_SETUP
-#line 119 "gmScanner.l"
-{ return('%');                }
-	YY_BREAK
-case 72:
-YY_RULE_SETUP
-#line 120 "gmScanner.l"
-{ return('<');                }
-	YY_BREAK
-case 73:
-YY_RULE_SETUP
-#line 121 "gmScanner.l"
-{ return('>');                }
-	YY_BREAK
-case 74:
-YY_RULE_SETUP
-#line 122 "gmScanner.l"
-{ return('&');                }
-	YY_BREAK
-case 75:
-YY_RULE_SETUP
-#line 123 "gmScanner.l"
-{ return('|');                }
-	YY_BREAK
-case 76:
-YY_RULE_SETUP
-#line 124 "gmScanner.l"
-{ return('^');                }
-	YY_BREAK
-case 77:
-YY_RULE_SETUP
-#line 125 "gmScanner.l"
-{ return('~');                }
-	YY_BREAK
-case 78:
-YY_RULE_SETUP
-#line 126 "gmScanner.l"
-{ return(':');                }
-	YY_BREAK
-case 79:
-YY_RULE_SETUP
-#line 127 "gmScanner.l"
-{ return(':');                }
-	YY_BREAK
-case 80:
-YY_RULE_SETUP
-#line 129 "gmScanner.l"
-{                             }
-	YY_BREAK
-case 81:
-YY_RULE_SETUP
-#line 130 "gmScanner.l"
-{ return(TOKEN_ERROR);        }
-	YY_BREAK
-case 82:
-YY_RULE_SETUP
-#line 132 "gmScanner.l"
-ECHO;
-	YY_BREAK
-#line 1268 "gmScanner.cpp"
-			case YY_STATE_EOF(INITIAL):
-				yyterminate();
-
-   case YY_END_OF_BUFFER:
-      {
-      /* Amount of text matched not including the EOB char. */
-      int yy_amount_of_matched_text = (int) (yy_cp - yytext_ptr) - 1;
-
-      /* Undo the effects of YY_DO_BEFORE_ACTION. */
-      *yy_cp = yy_hold_char;
-
-      if ( yy_current_buffer->yy_buffer_status == YY_BUFFER_NEW )
-         {
-         /* We're scanning a new file or input source.  It's
-          * possible that this happened because the user
-          * just pointed yyin at a new source and called
-          * yylex().  If so, then we have to assure
-          * consistency between yy_current_buffer and our
-          * globals.  Here is the right place to do so, because
-          * this is the first action (other than possibly a
-          * back-up) that will match for the new input source.
-          */
-         yy_n_chars = yy_current_buffer->yy_n_chars;
-         yy_current_buffer->yy_input_file = yyin;
-         yy_current_buffer->yy_buffer_status = YY_BUFFER_NORMAL;
-         }
-
-      /* Note that here we test for yy_c_buf_p "<=" to the position
-       * of the first EOB in the buffer, since yy_c_buf_p will
-       * already have been incremented past the NUL character
-       * (since all states make transitions on EOB to the
-       * end-of-buffer state).  Contrast this with the test
-       * in input().
-       */
-      if ( yy_c_buf_p <= &yy_current_buffer->yy_ch_buf[yy_n_chars] )
-         { /* This was really a NUL. */
-         yy_state_type yy_next_state;
-
-         yy_c_buf_p = yytext_ptr + yy_amount_of_matched_text;
-
-         yy_current_state = yy_get_previous_state();
-
-         /* Okay, we're now positioned to make the NUL
-          * transition.  We couldn't have
-          * yy_get_previous_state() go ahead and do it
-          * for us because it doesn't know how to deal
-          * with the possibility of jamming (and we don't
-          * want to build jamming into it because then it
-          * will run more slowly).
-          */
-
-         yy_next_state = yy_try_NUL_trans( yy_current_state );
-
-         yy_bp = yytext_ptr + YY_MORE_ADJ;
-
-         if ( yy_next_state )
-            {
-            /* Consume the NUL. */
-            yy_cp = ++yy_c_buf_p;
-            yy_current_state = yy_next_state;
-            goto yy_match;
-            }
-
-         else
-            {
-				yy_cp = yy_c_buf_p;
-            goto yy_find_action;
-            }
-         }
-
-      else switch ( yy_get_next_buffer() )
-         {
-         case EOB_ACT_END_OF_FILE:
-            {
-            yy_did_buffer_switch_on_eof = 0;
-
-            if ( yywrap() )
-               {
-               /* Note: because we've taken care in
-                * yy_get_next_buffer() to have set up
-                * yytext, we can now set up
-                * yy_c_buf_p so that if some total
-                * hoser (like flex itself) wants to
-                * call the scanner after we return the
-                * YY_NULL, it'll still work - another
-                * YY_NULL will get returned.
-                */
-               yy_c_buf_p = yytext_ptr + YY_MORE_ADJ;
-
-               yy_act = YY_STATE_EOF(YY_START);
-               goto do_action;
-               }
-
-            else
-               {
-               if ( ! yy_did_buffer_switch_on_eof )
-                  YY_NEW_FILE;
-               }
-            break;
-            }
-
-         case EOB_ACT_CONTINUE_SCAN:
-            yy_c_buf_p =
-               yytext_ptr + yy_amount_of_matched_text;
-
-            yy_current_state = yy_get_previous_state();
-
-            yy_cp = yy_c_buf_p;
-            yy_bp = yytext_ptr + YY_MORE_ADJ;
-            goto yy_match;
-
-         case EOB_ACT_LAST_MATCH:
-            yy_c_buf_p =
-            &yy_current_buffer->yy_ch_buf[yy_n_chars];
-
-            yy_current_state = yy_get_previous_state();
-
-            yy_cp = yy_c_buf_p;
-            yy_bp = yytext_ptr + YY_MORE_ADJ;
-            goto yy_find_action;
-         }
-      break;
-      }
-
-   default:
-      YY_FATAL_ERROR(
-         "fatal flex scanner internal error--no action found" );
-   } /* end of action switch */
-      } /* end of scanning one token */
-   } /* end of yylex */
-
-
-/* yy_get_next_buffer - try to read in a new buffer
- *
- * Returns a code representing an action:
- * EOB_ACT_LAST_MATCH -
- * EOB_ACT_CONTINUE_SCAN - continue scanning from current position
- * EOB_ACT_END_OF_FILE - end of file
- */
-
-static int yy_get_next_buffer()
-   {
-   register char *dest = yy_current_buffer->yy_ch_buf;
-   register char *source = yytext_ptr;
-   register int number_to_move, i;
-   int ret_val;
-
-   if ( yy_c_buf_p > &yy_current_buffer->yy_ch_buf[yy_n_chars + 1] )
-      YY_FATAL_ERROR(
-      "fatal flex scanner internal error--end of buffer missed" );
-
-   if ( yy_current_buffer->yy_fill_buffer == 0 )
-      { /* Don't try to fill the buffer, so this is an EOF. */
-      if ( yy_c_buf_p - yytext_ptr - YY_MORE_ADJ == 1 )
-         {
-         /* We matched a singled characater, the EOB, so
-          * treat this as a final EOF.
-          */
-         return EOB_ACT_END_OF_FILE;
-         }
-
-      else
-         {
-         /* We matched some text prior to the EOB, first
-          * process it.
-          */
-         return EOB_ACT_LAST_MATCH;
-         }
-      }
-
-   /* Try to read more data. */
-
-   /* First move last chars to start of buffer. */
-   number_to_move = (int) (yy_c_buf_p - yytext_ptr) - 1;
-
-   for ( i = 0; i < number_to_move; ++i )
-      *(dest++) = *(source++);
-
-   if ( yy_current_buffer->yy_buffer_status == YY_BUFFER_EOF_PENDING )
-      /* don't do the read, it's not guaranteed to return an EOF,
-       * just force an EOF
-       */
-      yy_n_chars = 0;
-
-   else
-      {
-      int num_to_read =
-         yy_current_buffer->yy_buf_size - number_to_move - 1;
-
-      while ( num_to_read <= 0 )
-         { /* Not enough room in the buffer - grow it. */
-#ifdef YY_USES_REJECT
-         YY_FATAL_ERROR(
-"input buffer overflow, can't enlarge buffer because scanner uses REJECT" );
-#else
-
-         /* just a shorter name for the current buffer */
-         YY_BUFFER_STATE b = yy_current_buffer;
-
-         int yy_c_buf_p_offset =
-            (int) (yy_c_buf_p - b->yy_ch_buf);
-
-         if ( b->yy_is_our_buffer )
-            {
-            //_GD_
-            int oldSize = b->yy_buf_size;
-
-            int new_size = b->yy_buf_size * 2;
-
-            if ( new_size <= 0 )
-               b->yy_buf_size += b->yy_buf_size / 8;
-            else
-               b->yy_buf_size *= 2;
-
-            /* Include room in for 2 EOB chars. */
-            //_GD_ b->yy_ch_buf = (char *)
-            //_GD_ yy_flex_realloc( (void *) b->yy_ch_buf,
-            //_GD_       b->yy_buf_size + 2 );
-            //_GD_
-            void* newBytes = yy_flex_alloc( b->yy_buf_size + 2 );
-            memcpy(newBytes, b->yy_ch_buf, oldSize));
-            yy_flex_free(b->yy_ch_buf);
-            b->yy_ch_buf = newBytes;
-            }
-         else
-            /* Can't grow it, we don't own it. */
-            b->yy_ch_buf = 0;
-
-         if ( ! b->yy_ch_buf )
-            YY_FATAL_ERROR(
-            "fatal error - scanner input buffer overflow" );
-
-         yy_c_buf_p = &b->yy_ch_buf[yy_c_buf_p_offset];
-
-         num_to_read = yy_current_buffer->yy_buf_size -
-                  number_to_move - 1;
-#endif
-         }
-
-      if ( num_to_read > YY_READ_BUF_SIZE )
-         num_to_read = YY_READ_BUF_SIZE;
-
-      /* Read in more data. */
-      YY_INPUT( (&yy_current_buffer->yy_ch_buf[number_to_move]),
-         yy_n_chars, num_to_read );
-      }
-
-   if ( yy_n_chars == 0 )
-      {
-      if ( number_to_move == YY_MORE_ADJ )
-         {
-         ret_val = EOB_ACT_END_OF_FILE;
-         yyrestart( yyin );
-         }
-
-      else
-         {
-         ret_val = EOB_ACT_LAST_MATCH;
-         yy_current_buffer->yy_buffer_status =
-            YY_BUFFER_EOF_PENDING;
-         }
-      }
-
-   else
-      ret_val = EOB_ACT_CONTINUE_SCAN;
-
-   yy_n_chars += number_to_move;
-   yy_current_buffer->yy_ch_buf[yy_n_chars] = YY_END_OF_BUFFER_CHAR;
-   yy_current_buffer->yy_ch_buf[yy_n_chars + 1] = YY_END_OF_BUFFER_CHAR;
-
-   yytext_ptr = &yy_current_buffer->yy_ch_buf[0];
-
-   return ret_val;
-   }
-
-
-/* yy_get_previous_state - get the state just before the EOB char was reached */
-
-static yy_state_type yy_get_previous_state()
-   {
-   register yy_state_type yy_current_state;
-   register char *yy_cp;
-
-	yy_current_state = yy_start;
-	yy_state_ptr = yy_state_buf;
-	*yy_state_ptr++ = yy_current_state;
-
-   for ( yy_cp = yytext_ptr + YY_MORE_ADJ; yy_cp < yy_c_buf_p; ++yy_cp )
-      {
-		register YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 1);
-		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
+			case '<' :
 			{
-			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 200 )
-				yy_c = yy_meta[(unsigned int) yy_c];
+				if(n == '<') { ++end; if(p[2] == '=') { ++end; token = SYMBOL_ASGN_BSL; } else token = SYMBOL_LEFT_SHIFT; }
+				else if(n == '=') { ++end; token = SYMBOL_LTE; }
+				else token = '<';
+				break;
+			}
+			case '+' : if(n == '=') { ++end; token = SYMBOL_ASGN_ADD; } else token = '+'; break;
+			case '-' : if(n == '=') { ++end; token = SYMBOL_ASGN_MINUS; } else token = '-'; break;
+			case '*' : if(n == '=') { ++end; token = SYMBOL_ASGN_TIMES; } else token = '*'; break;
+			case '/' : if(n == '=') { ++end; token = SYMBOL_ASGN_DIVIDE; } else token = '/'; break;
+			case '%' : if(n == '=') { ++end; token = SYMBOL_ASGN_REM; } else token = '%'; break;
+			case '^' : if(n == '=') { ++end; token = SYMBOL_ASGN_BXOR; } else token = '^'; break;
+			case '=' : if(n == '=') { ++end; token = SYMBOL_EQ; } else token = '='; break;
+			case '!' : if(n == '=') { ++end; token = SYMBOL_NEQ; } else token = '!'; break;
+			case ';' : case '{' : case '}' : case ',' : case '(' : case ')' :
+			case '[' : case ']' : case '.' : case '~' : case ':' :
+			{
+				token = c;
+				break;
+			}
+			default :
+			{
+				token = TOKEN_ERROR;
+				break;
 			}
-		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-		*yy_state_ptr++ = yy_current_state;
-      }
-
-   return yy_current_state;
-   }
-
-
-/* yy_try_NUL_trans - try to make a transition on the NUL character
- *
- * synopsis
- * next_state = yy_try_NUL_trans( current_state );
- */
-
-#ifdef YY_USE_PROTOS
-static yy_state_type yy_try_NUL_trans( yy_state_type yy_current_state )
-#else
-static yy_state_type yy_try_NUL_trans( yy_current_state )
-yy_state_type yy_current_state;
-#endif
-   {
-   register int yy_is_jam;
-
-	register YY_CHAR yy_c = 1;
-	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-		{
-		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 200 )
-			yy_c = yy_meta[(unsigned int) yy_c];
 		}
-	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	*yy_state_ptr++ = yy_current_state;
-	yy_is_jam = (yy_current_state == 199);
-
-   return yy_is_jam ? 0 : yy_current_state;
-   }
-
-
-#ifndef YY_NO_UNPUT
-#ifdef YY_USE_PROTOS
-static void yyunput( int c, register char *yy_bp )
-#else
-static void yyunput( c, yy_bp )
-int c;
-register char *yy_bp;
-#endif
-   {
-   register char *yy_cp = yy_c_buf_p;
-
-   /* undo effects of setting up yytext */
-   *yy_cp = yy_hold_char;
-
-   if ( yy_cp < yy_current_buffer->yy_ch_buf + 2 )
-      { /* need to shift things up to make room */
-      /* +2 for EOB chars. */
-      register int number_to_move = yy_n_chars + 2;
-      register char *dest = &yy_current_buffer->yy_ch_buf[
-               yy_current_buffer->yy_buf_size + 2];
-      register char *source =
-            &yy_current_buffer->yy_ch_buf[number_to_move];
-
-      while ( source > yy_current_buffer->yy_ch_buf )
-         *--dest = *--source;
-
-      yy_cp += (int) (dest - source);
-      yy_bp += (int) (dest - source);
-      yy_n_chars = yy_current_buffer->yy_buf_size;
-
-      if ( yy_cp < yy_current_buffer->yy_ch_buf + 2 )
-         YY_FATAL_ERROR( "flex scanner push-back overflow" );
-      }
-
-   *--yy_cp = (char) c;
-
-	if ( c == '\n' )
-		--yylineno;
-
-   yytext_ptr = yy_bp;
-   yy_hold_char = *yy_cp;
-   yy_c_buf_p = yy_cp;
-   }
-#endif   /* ifndef YY_NO_UNPUT */
-
-
-#ifdef __cplusplus
-static int yyinput()
-#else
-static int input()
-#endif
-   {
-   int c;
-
-   *yy_c_buf_p = yy_hold_char;
-
-   if ( *yy_c_buf_p == YY_END_OF_BUFFER_CHAR )
-      {
-      /* yy_c_buf_p now points to the character we want to return.
-       * If this occurs *before* the EOB characters, then it's a
-       * valid NUL; if not, then we've hit the end of the buffer.
-       */
-      if ( yy_c_buf_p < &yy_current_buffer->yy_ch_buf[yy_n_chars] )
-         /* This was really a NUL. */
-         *yy_c_buf_p = '\0';
-
-      else
-         { /* need more input */
-         yytext_ptr = yy_c_buf_p;
-         ++yy_c_buf_p;
-
-         switch ( yy_get_next_buffer() )
-            {
-            case EOB_ACT_END_OF_FILE:
-               {
-               if ( yywrap() )
-                  {
-                  yy_c_buf_p =
-                  yytext_ptr + YY_MORE_ADJ;
-                  return EOF;
-                  }
-
-               if ( ! yy_did_buffer_switch_on_eof )
-                  YY_NEW_FILE;
-#ifdef __cplusplus
-               return yyinput();
-#else
-               return input();
-#endif
-               }
-
-            case EOB_ACT_CONTINUE_SCAN:
-               yy_c_buf_p = yytext_ptr + YY_MORE_ADJ;
-               break;
-
-            case EOB_ACT_LAST_MATCH:
-#ifdef __cplusplus
-               YY_FATAL_ERROR(
-               "unexpected last match in yyinput()" );
-#else
-               YY_FATAL_ERROR(
-               "unexpected last match in input()" );
-#endif
-            }
-         }
-      }
-
-   c = *(unsigned char *) yy_c_buf_p;  /* cast for 8-bit char's */
-   *yy_c_buf_p = '\0';  /* preserve yytext */
-   yy_hold_char = *++yy_c_buf_p;
-
-	if ( c == '\n' )
-		++yylineno;
-
-   return c;
-   }
-
-
-#ifdef YY_USE_PROTOS
-void yyrestart( FILE *input_file )
-#else
-void yyrestart( input_file )
-FILE *input_file;
-#endif
-   {
-   if ( ! yy_current_buffer )
-      yy_current_buffer = yy_create_buffer( yyin, YY_BUF_SIZE );
-
-   yy_init_buffer( yy_current_buffer, input_file );
-   yy_load_buffer_state();
-   }
-
-
-#ifdef YY_USE_PROTOS
-void yy_switch_to_buffer( YY_BUFFER_STATE new_buffer )
-#else
-void yy_switch_to_buffer( new_buffer )
-YY_BUFFER_STATE new_buffer;
-#endif
-   {
-   if ( yy_current_buffer == new_buffer )
-      return;
-
-   if ( yy_current_buffer )
-      {
-      /* Flush out information for old buffer. */
-      *yy_c_buf_p = yy_hold_char;
-      yy_current_buffer->yy_buf_pos = yy_c_buf_p;
-      yy_current_buffer->yy_n_chars = yy_n_chars;
-      }
-
-   yy_current_buffer = new_buffer;
-   yy_load_buffer_state();
-
-   /* We don't actually know whether we did this switch during
-    * EOF (yywrap()) processing, but the only time this flag
-    * is looked at is after yywrap() is called, so it's safe
-    * to go ahead and always set it.
-    */
-   yy_did_buffer_switch_on_eof = 1;
-   }
-
-
-#ifdef YY_USE_PROTOS
-void yy_load_buffer_state( void )
-#else
-void yy_load_buffer_state()
-#endif
-   {
-   yy_n_chars = yy_current_buffer->yy_n_chars;
-   yytext_ptr = yy_c_buf_p = yy_current_buffer->yy_buf_pos;
-   yyin = yy_current_buffer->yy_input_file;
-   yy_hold_char = *yy_c_buf_p;
-   }
-
-
-#ifdef YY_USE_PROTOS
-YY_BUFFER_STATE yy_create_buffer( FILE *file, int size )
-#else
-YY_BUFFER_STATE yy_create_buffer( file, size )
-FILE *file;
-int size;
-#endif
-   {
-   YY_BUFFER_STATE b;
-
-   b = (YY_BUFFER_STATE) yy_flex_alloc( sizeof( struct yy_buffer_state ) );
-   if ( ! b )
-      YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
-
-   b->yy_buf_size = size;
-
-   /* yy_ch_buf has to be 2 characters longer than the size given because
-    * we need to put in 2 end-of-buffer characters.
-    */
-   b->yy_ch_buf = (char *) yy_flex_alloc( b->yy_buf_size + 2 );
-   if ( ! b->yy_ch_buf )
-      YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
-
-   b->yy_is_our_buffer = 1;
-
-   yy_init_buffer( b, file );
-
-   return b;
-   }
-
-
-#ifdef YY_USE_PROTOS
-void yy_delete_buffer( YY_BUFFER_STATE b )
-#else
-void yy_delete_buffer( b )
-YY_BUFFER_STATE b;
-#endif
-   {
-   if ( ! b )
-      return;
-
-   if ( b == yy_current_buffer )
-      yy_current_buffer = (YY_BUFFER_STATE) 0;
-
-   if ( b->yy_is_our_buffer )
-      yy_flex_free( (void *) b->yy_ch_buf );
-
-   yy_flex_free( (void *) b );
-   }
-
-
-#ifndef YY_ALWAYS_INTERACTIVE
-#ifndef YY_NEVER_INTERACTIVE
-extern int isatty YY_PROTO(( int ));
-#endif
-#endif
-
-#ifdef YY_USE_PROTOS
-void yy_init_buffer( YY_BUFFER_STATE b, FILE *file )
-#else
-void yy_init_buffer( b, file )
-YY_BUFFER_STATE b;
-FILE *file;
-#endif
-
-
-   {
-   yy_flush_buffer( b );
-
-   b->yy_input_file = file;
-   b->yy_fill_buffer = 1;
-
-#if YY_ALWAYS_INTERACTIVE
-   b->yy_is_interactive = 1;
-#else
-#if YY_NEVER_INTERACTIVE
-   b->yy_is_interactive = 0;
-#else
-   b->yy_is_interactive = file ? (isatty( fileno(file) ) > 0) : 0;
-#endif
-#endif
-   }
-
-
-#ifdef YY_USE_PROTOS
-void yy_flush_buffer( YY_BUFFER_STATE b )
-#else
-void yy_flush_buffer( b )
-YY_BUFFER_STATE b;
-#endif
-
-   {
-   b->yy_n_chars = 0;
-
-   /* We always need two end-of-buffer characters.  The first causes
-    * a transition to the end-of-buffer state.  The second causes
-    * a jam in that state.
-    */
-   b->yy_ch_buf[0] = YY_END_OF_BUFFER_CHAR;
-   b->yy_ch_buf[1] = YY_END_OF_BUFFER_CHAR;
-
-   b->yy_buf_pos = &b->yy_ch_buf[0];
-
-   b->yy_at_bol = 1;
-   b->yy_buffer_status = YY_BUFFER_NEW;
-
-   if ( b == yy_current_buffer )
-      yy_load_buffer_state();
-   }
-
-
-#ifndef YY_NO_SCAN_BUFFER
-#ifdef YY_USE_PROTOS
-YY_BUFFER_STATE yy_scan_buffer( char *base, yy_size_t size )
-#else
-YY_BUFFER_STATE yy_scan_buffer( base, size )
-char *base;
-yy_size_t size;
-#endif
-   {
-   YY_BUFFER_STATE b;
-
-   if ( size < 2 ||
-        base[size-2] != YY_END_OF_BUFFER_CHAR ||
-        base[size-1] != YY_END_OF_BUFFER_CHAR )
-      /* They forgot to leave room for the EOB's. */
-      return 0;
-
-   b = (YY_BUFFER_STATE) yy_flex_alloc( sizeof( struct yy_buffer_state ) );
-   if ( ! b )
-      YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
-
-   b->yy_buf_size = size - 2; /* "- 2" to take care of EOB's */
-   b->yy_buf_pos = b->yy_ch_buf = base;
-   b->yy_is_our_buffer = 0;
-   b->yy_input_file = 0;
-   b->yy_n_chars = b->yy_buf_size;
-   b->yy_is_interactive = 0;
-   b->yy_at_bol = 1;
-   b->yy_fill_buffer = 0;
-   b->yy_buffer_status = YY_BUFFER_NEW;
-
-   yy_switch_to_buffer( b );
-
-   return b;
-   }
-#endif
-
-
-#ifndef YY_NO_SCAN_STRING
-#ifdef YY_USE_PROTOS
-YY_BUFFER_STATE yy_scan_string( yyconst char *str )
-#else
-YY_BUFFER_STATE yy_scan_string( str )
-yyconst char *str;
-#endif
-   {
-   int len;
-   for ( len = 0; str[len]; ++len )
-      ;
-
-   return yy_scan_bytes( str, len );
-   }
-#endif
-
-
-#ifndef YY_NO_SCAN_BYTES
-#ifdef YY_USE_PROTOS
-YY_BUFFER_STATE yy_scan_bytes( yyconst char *bytes, int len )
-#else
-YY_BUFFER_STATE yy_scan_bytes( bytes, len )
-yyconst char *bytes;
-int len;
-#endif
-   {
-   YY_BUFFER_STATE b;
-   char *buf;
-   yy_size_t n;
-   int i;
-
-   /* Get memory for full buffer, including space for trailing EOB's. */
-   n = len + 2;
-   buf = (char *) yy_flex_alloc( n );
-   if ( ! buf )
-      YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
-
-   for ( i = 0; i < len; ++i )
-      buf[i] = bytes[i];
-
-   buf[len] = buf[len+1] = YY_END_OF_BUFFER_CHAR;
-
-   b = yy_scan_buffer( buf, n );
-   if ( ! b )
-      YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
-
-   /* It's okay to grow etc. this buffer, and we should throw it
-    * away when we're done.
-    */
-   b->yy_is_our_buffer = 1;
-
-   return b;
-   }
-#endif
-
-
-#ifndef YY_NO_PUSH_STATE
-#ifdef YY_USE_PROTOS
-static void yy_push_state( int new_state )
-#else
-static void yy_push_state( new_state )
-int new_state;
-#endif
-   {
-   if ( yy_start_stack_ptr >= yy_start_stack_depth )
-      {
-      yy_size_t new_size;
-
-      yy_start_stack_depth += YY_START_STACK_INCR;
-      new_size = yy_start_stack_depth * sizeof( int );
-
-      if ( ! yy_start_stack )
-         yy_start_stack = (int *) yy_flex_alloc( new_size );
-
-      else
-         yy_start_stack = (int *) yy_flex_realloc(
-               (void *) yy_start_stack, new_size );
-
-      if ( ! yy_start_stack )
-         YY_FATAL_ERROR(
-         "out of memory expanding start-condition stack" );
-      }
-
-   yy_start_stack[yy_start_stack_ptr++] = YY_START;
-
-   BEGIN(new_state);
-   }
-#endif
-
-
-#ifndef YY_NO_POP_STATE
-static void yy_pop_state()
-   {
-   if ( --yy_start_stack_ptr < 0 )
-      YY_FATAL_ERROR( "start-condition stack underflow" );
-
-   BEGIN(yy_start_stack[yy_start_stack_ptr]);
-   }
-#endif
-
-
-#ifndef YY_NO_TOP_STATE
-static int yy_top_state()
-   {
-   return yy_start_stack[yy_start_stack_ptr - 1];
-   }
-#endif
-
-#ifndef YY_EXIT_FAILURE
-#define YY_EXIT_FAILURE 2
-#endif
-
-#ifdef YY_USE_PROTOS
-static void yy_fatal_error( yyconst char msg[] )
-#else
-static void yy_fatal_error( msg )
-char msg[];
-#endif
-   {
-   (void) fprintf( stderr, "%s\n", msg );
-   exit( YY_EXIT_FAILURE );
-   }
-
-
-
-/* Redefine yyless() so it works in section 3 code. */
-
-#undef yyless
-#define yyless(n) \
-   do \
-      { \
-      /* Undo effects of setting up yytext. */ \
-      yytext[yyleng] = yy_hold_char; \
-      yy_c_buf_p = yytext + n - YY_MORE_ADJ; \
-      yy_hold_char = *yy_c_buf_p; \
-      *yy_c_buf_p = '\0'; \
-      yyleng = n; \
-      } \
-   while ( 0 )
-
-
-/* Internal utility routines. */
-
-#ifndef yytext_ptr
-#ifdef YY_USE_PROTOS
-static void yy_flex_strncpy( char *s1, yyconst char *s2, int n )
-#else
-static void yy_flex_strncpy( s1, s2, n )
-char *s1;
-yyconst char *s2;
-int n;
-#endif
-   {
-   register int i;
-   for ( i = 0; i < n; ++i )
-      s1[i] = s2[i];
-   }
-#endif
-
-
-#ifdef YY_USE_PROTOS
-static void *yy_flex_alloc( yy_size_t size )
-#else
-static void *yy_flex_alloc( size )
-yy_size_t size;
-#endif
-   {
-   //_GD_ return (void *) malloc( size );
-   return (void *) GM_NEW( char [size] );
-   }
-
-/*#ifdef YY_USE_PROTOS
-static void *yy_flex_realloc( void *ptr, yy_size_t size )
-#else
-static void *yy_flex_realloc( ptr, size )
-void *ptr;
-yy_size_t size;
-#endif
-   {
-    * The cast to (char *) in the following accommodates both
-    * implementations that use char* generic pointers, and those
-    * that use void* generic pointers.  It works with the latter
-    * because both ANSI C and C++ allow castless assignment from
-    * any pointer type to void*, and deal with argument conversions
-    * as though doing an assignment.
-    *
-   //_GD_ return (void *) realloc( (char *) ptr, size );
-   }
-*/
-#ifdef YY_USE_PROTOS
-static void yy_flex_free( void *ptr )
-#else
-static void yy_flex_free( ptr )
-void *ptr;
-#endif
-   {
-   //_GD_ free( ptr );
-   delete [] (char*) ptr;
-   }
-
-#if YY_MAIN
-int main()
-   {
-   yylex();
-   return 0;
-   }
-#endif
-#line 132 "gmScanner.l"
+	}
+
+	// NUL terminate the token text in place, the next Lex() puts the character back
+	m_text = start;
+	m_pos = end;
+	m_hold = *end;
+	*end = '\0';
+	return token;
+}
 
 
-// yywrap
-int gmwrap()
+int gmlex(gmCodeTreeNode ** a_value)
 {
-  return(1);
+	GM_ASSERT(s_scanner);
+	int token = s_scanner->Lex();
+	gmtext = s_scanner->GetText();
+	gmlineno = s_scanner->GetLine();
+	return token;
 }
-
-
-
@@ -15,18 +15,57 @@ See Copyright Notice in gmMachine.h
 #include "gmConfig.h"
 
 //
-// gmscanner.cpp, gmparser.cpp.h and gmparser.cpp are created by flex and bison
-// see fontend.bat for more details.
+// gmparser.cpp.h and gmparser.cpp are created by bison, see gmfrontend.bat for more details.
+// gmParser.y asks for a pure parser, so the generated files hold no parse state and are not edited by hand.
 //
 
-// fwd decl for flex
-typedef struct yy_buffer_state * YY_BUFFER_STATE;
-YY_BUFFER_STATE gm_scan_string(const char * str);
-YY_BUFFER_STATE gm_scan_bytes(const char *bytes, int len);
-void gm_delete_buffer(YY_BUFFER_STATE b);
-int gmlex();
-extern char * gmtext;
-extern int gmlineno;
+/*!
+	\class gmScanner
+	\brief gmScanner splits script source into tokens for the parser.
+
+	Hand written in place of the flex scanner generated from gmScanner.l, it returns the same tokens,
+	token text and line numbers.  gmScanner.l is kept as the reference, examples/ScannerDiff checks
+	the two scanners against each other.  Each scanner holds its own state, the parser reads tokens
+	from the current thread's scanner through gmlex(), see gmCodeTree::Lock().
+*/
+class gmScanner
+{
+public:
+
+	/// \brief gmScanner() copies a_length bytes of a_source, or up to the NUL if a_length is -1.
+	gmScanner(const char * a_source, int a_length = -1);
+	~gmScanner();
+
+	/// \brief Lex() returns the next token, 0 at the end of the source.
+	int Lex();
+
+	/// \brief GetText() returns the NUL terminated text of the last token, valid until the next Lex().
+	inline char * GetText() const { return m_text; }
+
+	/// \brief GetLine() returns the line the last token ended on.
+	inline int GetLine() const { return m_line; }
+
+	/// \brief SetCurrent() sets the scanner gmlex() reads from on this thread, returns the previous one.
+	static gmScanner * SetCurrent(gmScanner * a_scanner);
+
+private:
+
+	char * SkipSpace(char * a_pos);
+
+	char * m_source;   ///< copy of the source, padded with NUL so words can be read past the end
+	char * m_end;
+	char * m_pos;      ///< start of the next token
+	char * m_text;
+	char m_hold;       ///< character overwritten by the NUL ending m_text
+	int m_line;
+};
+
+class gmCodeTreeNode;
+
+// parser interface, gmlex() sets gmtext and gmlineno from the current scanner, tokens have no value
+int gmlex(gmCodeTreeNode ** a_value);
+extern GM_THREAD_LOCAL char * gmtext;
+extern GM_THREAD_LOCAL int gmlineno;
 
 #endif // _GMSCANNER_H_
 
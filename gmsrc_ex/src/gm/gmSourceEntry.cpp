@@ -0,0 +1,422 @@
+/*
+_____               __  ___          __            ____        _      __
+/ ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+/ (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+\___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+/___/             /_/
+
+See Copyright Notice in gmMachine.h
+
+*/
+
+#include "gmConfig.h"
+#include "gmSourceEntry.h"
+
+/*
+Packed debug info
+
+Strings and function debug info are each stored once per source entry as an item, a varint byte count
+followed by that many bytes.  A string item holds the 0 terminated string.  A function item holds
+
+name                  varint  // string offset + 1, 0 for none
+num_symbols           varint  // 0 or params + locals
+symbols               varint  // string offset, for each symbol
+line_info_count       varint
+line_info             zigzag varint address delta, zigzag varint line delta, for each entry
+
+Source code is compressed with a byte oriented LZ77.  Each sequence is a token, high nibble literal
+count and low nibble match length - 4, each 15 followed by extra bytes of up to 255, the literals, then
+a 2 byte offset back to the match.  The last sequence has literals only.
+*/
+
+#define GM_SOURCE_LZ_MIN_MATCH 4
+#define GM_SOURCE_LZ_HASH_BITS 12
+
+
+static inline void gmSourceAppend(gmArraySimple<gmuint8> &a_data, const void * a_bytes, gmuint32 a_length)
+{
+	gmuint32 count = a_data.Count();
+	a_data.SetCount(count + a_length);
+	memcpy(a_data.GetData() + count, a_bytes, a_length);
+}
+
+
+static inline void gmSourceWriteVarint(gmArraySimple<gmuint8> &a_data, gmuint32 a_value)
+{
+	while(a_value >= 0x80)
+	{
+		a_data.InsertLast((gmuint8) (a_value | 0x80));
+		a_value >>= 7;
+	}
+	a_data.InsertLast((gmuint8) a_value);
+}
+
+
+static inline gmuint32 gmSourceReadVarint(const gmuint8 * &a_data)
+{
+	gmuint32 value = 0;
+	int shift = 0;
+	for(;;)
+	{
+		gmuint8 byte = *(a_data++);
+		value |= (gmuint32) (byte & 0x7f) << shift;
+		if((byte & 0x80) == 0) return value;
+		shift += 7;
+	}
+}
+
+
+static inline gmuint32 gmSourceZigZag(int a_value) { return ((gmuint32) a_value << 1) ^ (gmuint32) (a_value >> 31); }
+static inline int gmSourceUnZigZag(gmuint32 a_value) { return (int) (a_value >> 1) ^ -(int) (a_value & 1); }
+
+
+// total bytes of an item, its count and contents
+static inline gmuint32 gmSourceItemSize(const gmuint8 * a_item)
+{
+	const gmuint8 * data = a_item;
+	gmuint32 length = gmSourceReadVarint(data);
+	return (gmuint32) (data - a_item) + length;
+}
+
+
+static inline gmuint32 gmSourceHash(const gmuint8 * a_data, gmuint32 a_length)
+{
+	gmuint32 hash = 2166136261u;
+	for(gmuint32 i = 0; i < a_length; ++i)
+	{
+		hash ^= a_data[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+
+static inline const char * gmSourceString(const gmArraySimple<gmuint8> &a_strings, gmuint32 a_offset)
+{
+	const gmuint8 * data = a_strings.GetData() + a_offset;
+	gmSourceReadVarint(data);
+	return (const char *) data;
+}
+
+
+static void gmSourceWriteLength(gmArraySimple<gmuint8> &a_out, int a_length)
+{
+	for(; a_length >= 255; a_length -= 255)
+	{
+		a_out.InsertLast((gmuint8) 255);
+	}
+	a_out.InsertLast((gmuint8) a_length);
+}
+
+
+static void gmSourceCompress(const gmuint8 * a_data, int a_length, gmArraySimple<gmuint8> &a_out)
+{
+	int table[1 << GM_SOURCE_LZ_HASH_BITS];
+	memset(table, 0xff, sizeof(table));
+
+	int anchor = 0, pos = 0;
+	while(pos + GM_SOURCE_LZ_MIN_MATCH <= a_length)
+	{
+		gmuint32 sequence;
+		memcpy(&sequence, a_data + pos, sizeof(sequence));
+		gmuint32 hash = (sequence * 2654435761u) >> (32 - GM_SOURCE_LZ_HASH_BITS);
+		int candidate = table[hash];
+		table[hash] = pos;
+
+		if(candidate < 0 || pos - candidate > 0xffff || memcmp(a_data + candidate, a_data + pos, GM_SOURCE_LZ_MIN_MATCH) != 0)
+		{
+			++pos;
+			continue;
+		}
+
+		int match = GM_SOURCE_LZ_MIN_MATCH;
+		while(pos + match < a_length && a_data[candidate + match] == a_data[pos + match])
+		{
+			++match;
+		}
+
+		int literals = pos - anchor;
+		int extra = match - GM_SOURCE_LZ_MIN_MATCH;
+		a_out.InsertLast((gmuint8) ((gmMin(literals, 15) << 4) | gmMin(extra, 15)));
+		if(literals >= 15) gmSourceWriteLength(a_out, literals - 15);
+		gmSourceAppend(a_out, a_data + anchor, literals);
+		int offset = pos - candidate;
+		a_out.InsertLast((gmuint8) offset);
+		a_out.InsertLast((gmuint8) (offset >> 8));
+		if(extra >= 15) gmSourceWriteLength(a_out, extra - 15);
+
+		pos += match;
+		anchor = pos;
+	}
+
+	int literals = a_length - anchor;
+	a_out.InsertLast((gmuint8) (gmMin(literals, 15) << 4));
+	if(literals >= 15) gmSourceWriteLength(a_out, literals - 15);
+	gmSourceAppend(a_out, a_data + anchor, literals);
+}
+
+
+static void gmSourceDecompress(const gmuint8 * a_data, gmuint8 * a_out, int a_length)
+{
+	gmuint8 * out = a_out;
+	gmuint8 * end = a_out + a_length;
+	for(;;)
+	{
+		gmuint8 token = *(a_data++);
+		int literals = token >> 4;
+		if(literals == 15)
+		{
+			gmuint8 byte;
+			do { byte = *(a_data++); literals += byte; } while(byte == 255);
+		}
+		memcpy(out, a_data, literals);
+		out += literals;
+		a_data += literals;
+		if(out >= end)
+		{
+			return;
+		}
+
+		int offset = a_data[0] | (a_data[1] << 8);
+		a_data += 2;
+		int match = (token & 15);
+		if(match == 15)
+		{
+			gmuint8 byte;
+			do { byte = *(a_data++); match += byte; } while(byte == 255);
+		}
+		match += GM_SOURCE_LZ_MIN_MATCH;
+
+		// may overlap
+		const gmuint8 * from = out - offset;
+		while(match--)
+		{
+			*(out++) = *(from++);
+		}
+	}
+}
+
+
+gmSourceEntry::gmSourceEntry(gmMachine * a_machine, gmuint32 a_id, bool a_compact)
+{
+	m_machine = a_machine;
+	m_id = a_id;
+	m_compact = a_compact;
+	m_source = NULL;
+	m_filename = NULL;
+	m_compressed = NULL;
+	m_compressedSize = 0;
+	m_sourceLength = 0;
+	m_numStrings = 0;
+	m_numFunctions = 0;
+}
+
+
+gmSourceEntry::~gmSourceEntry()
+{
+	if(m_source) delete [] m_source;
+	if(m_filename) delete [] m_filename;
+	if(m_compressed) delete [] m_compressed;
+}
+
+
+void gmSourceEntry::SetSource(const char * a_source, const char * a_filename)
+{
+	if(HasSource())
+	{
+		return;
+	}
+
+	int flen = (int) strlen(a_filename);
+	m_filename = GM_NEW( char[flen + 1] );
+	memcpy(m_filename, a_filename, flen + 1);
+
+	m_sourceLength = (int) strlen(a_source);
+	if(m_compact)
+	{
+		gmArraySimple<gmuint8> compressed;
+		gmSourceCompress((const gmuint8 *) a_source, m_sourceLength, compressed);
+		if((int) compressed.Count() < m_sourceLength)
+		{
+			m_compressedSize = (int) compressed.Count();
+			m_compressed = GM_NEW( gmuint8[m_compressedSize] );
+			memcpy(m_compressed, compressed.GetData(), m_compressedSize);
+			return;
+		}
+	}
+
+	m_source = GM_NEW( char[m_sourceLength + 1] );
+	memcpy(m_source, a_source, m_sourceLength + 1);
+}
+
+
+const char * gmSourceEntry::GetSource()
+{
+	if(m_source == NULL && m_compressed)
+	{
+		m_source = GM_NEW( char[m_sourceLength + 1] );
+		gmSourceDecompress(m_compressed, (gmuint8 *) m_source, m_sourceLength);
+		m_source[m_sourceLength] = '\0';
+		delete [] m_compressed;
+		m_compressed = NULL;
+		m_compressedSize = 0;
+	}
+	return m_source;
+}
+
+
+gmuint32 gmSourceEntry::Intern(gmArraySimple<gmuint8> &a_data, gmArraySimple<gmuint32> &a_hash, gmuint32 &a_count, const gmuint8 * a_item, gmuint32 a_length)
+{
+	// keep the table at most half full
+	if((a_count + 1) * 2 > a_hash.Count())
+	{
+		gmuint32 size = (a_hash.Count()) ? a_hash.Count() * 2 : 64;
+		gmArraySimple<gmuint32> old;
+		old = a_hash;
+		a_hash.SetCount(size);
+		memset(a_hash.GetData(), 0, sizeof(gmuint32) * size);
+		for(gmuint32 i = 0; i < old.Count(); ++i)
+		{
+			if(old[i] == 0) continue;
+			const gmuint8 * item = a_data.GetData() + old[i] - 1;
+			gmuint32 slot = gmSourceHash(item, gmSourceItemSize(item)) & (size - 1);
+			while(a_hash[slot]) slot = (slot + 1) & (size - 1);
+			a_hash[slot] = old[i];
+		}
+	}
+
+	gmuint32 mask = a_hash.Count() - 1;
+	gmuint32 slot = gmSourceHash(a_item, a_length) & mask;
+	while(a_hash[slot])
+	{
+		gmuint32 offset = a_hash[slot] - 1;
+		const gmuint8 * item = a_data.GetData() + offset;
+		if(gmSourceItemSize(item) == a_length && memcmp(item, a_item, a_length) == 0)
+		{
+			return offset;
+		}
+		slot = (slot + 1) & mask;
+	}
+
+	gmuint32 offset = a_data.Count();
+	gmSourceAppend(a_data, a_item, a_length);
+	a_hash[slot] = offset + 1;
+	++a_count;
+	return offset;
+}
+
+
+gmuint32 gmSourceEntry::AddFunction(const gmFunctionInfo &a_info)
+{
+	gmArraySimple<gmuint8> item, body;
+
+	// strings
+	gmuint32 name = 0;
+	if(a_info.m_debugName)
+	{
+		gmuint32 length = (gmuint32) strlen(a_info.m_debugName) + 1;
+		gmSourceWriteVarint(item, length);
+		gmSourceAppend(item, a_info.m_debugName, length);
+		name = Intern(m_strings, m_stringHash, m_numStrings, item.GetData(), item.Count()) + 1;
+	}
+	gmSourceWriteVarint(body, name);
+
+	int numSymbols = (a_info.m_symbols) ? a_info.m_numParams + a_info.m_numLocals : 0;
+	gmSourceWriteVarint(body, numSymbols);
+	for(int i = 0; i < numSymbols; ++i)
+	{
+		gmuint32 length = (gmuint32) strlen(a_info.m_symbols[i]) + 1;
+		item.Reset();
+		gmSourceWriteVarint(item, length);
+		gmSourceAppend(item, a_info.m_symbols[i], length);
+		gmSourceWriteVarint(body, Intern(m_strings, m_stringHash, m_numStrings, item.GetData(), item.Count()));
+	}
+
+	// line info as deltas
+	int lineInfoCount = (a_info.m_lineInfo) ? a_info.m_lineInfoCount : 0;
+	gmSourceWriteVarint(body, lineInfoCount);
+	int address = 0, line = 0;
+	for(int i = 0; i < lineInfoCount; ++i)
+	{
+		gmSourceWriteVarint(body, gmSourceZigZag(a_info.m_lineInfo[i].m_address - address));
+		gmSourceWriteVarint(body, gmSourceZigZag(a_info.m_lineInfo[i].m_lineNumber - line));
+		address = a_info.m_lineInfo[i].m_address;
+		line = a_info.m_lineInfo[i].m_lineNumber;
+	}
+
+	item.Reset();
+	gmSourceWriteVarint(item, body.Count());
+	gmSourceAppend(item, body.GetData(), body.Count());
+	return Intern(m_functions, m_functionHash, m_numFunctions, item.GetData(), item.Count());
+}
+
+
+int gmSourceEntry::GetLine(gmuint32 a_offset, int a_address) const
+{
+	const gmuint8 * data = m_functions.GetData() + a_offset;
+	gmSourceReadVarint(data); // size
+	gmSourceReadVarint(data); // name
+	gmuint32 numSymbols = gmSourceReadVarint(data);
+	for(gmuint32 i = 0; i < numSymbols; ++i)
+	{
+		gmSourceReadVarint(data);
+	}
+
+	// as gmFunctionObject::GetLine(), the line of the last entry at or before the address
+	gmuint32 lineInfoCount = gmSourceReadVarint(data);
+	int address = 0, line = 0, prevLine = 0;
+	for(gmuint32 i = 0; i < lineInfoCount; ++i)
+	{
+		address += gmSourceUnZigZag(gmSourceReadVarint(data));
+		line += gmSourceUnZigZag(gmSourceReadVarint(data));
+		if(a_address < address)
+		{
+			return (i > 0) ? prevLine : line;
+		}
+		prevLine = line;
+	}
+	return line;
+}
+
+
+void gmSourceEntry::Unpack(gmuint32 a_offset, gmFunctionInfo &a_info, gmArraySimple<const char *> &a_symbols, gmArraySimple<gmLineInfo> &a_lineInfo) const
+{
+	const gmuint8 * data = m_functions.GetData() + a_offset;
+	gmSourceReadVarint(data); // size
+
+	gmuint32 name = gmSourceReadVarint(data);
+	a_info.m_debugName = (name) ? gmSourceString(m_strings, name - 1) : NULL;
+
+	gmuint32 numSymbols = gmSourceReadVarint(data);
+	a_symbols.SetCount(numSymbols);
+	for(gmuint32 i = 0; i < numSymbols; ++i)
+	{
+		a_symbols[i] = gmSourceString(m_strings, gmSourceReadVarint(data));
+	}
+	a_info.m_symbols = (numSymbols) ? a_symbols.GetData() : NULL;
+
+	gmuint32 lineInfoCount = gmSourceReadVarint(data);
+	a_lineInfo.SetCount(lineInfoCount);
+	int address = 0, line = 0;
+	for(gmuint32 i = 0; i < lineInfoCount; ++i)
+	{
+		address += gmSourceUnZigZag(gmSourceReadVarint(data));
+		line += gmSourceUnZigZag(gmSourceReadVarint(data));
+		a_lineInfo[i].m_address = address;
+		a_lineInfo[i].m_lineNumber = line;
+	}
+	a_info.m_lineInfoCount = (int) lineInfoCount;
+	a_info.m_lineInfo = (lineInfoCount) ? a_lineInfo.GetData() : NULL;
+}
+
+
+unsigned int gmSourceEntry::GetMemoryUsage() const
+{
+	unsigned int size = sizeof(gmSourceEntry);
+	if(m_source) size += m_sourceLength + 1;
+	if(m_filename) size += (unsigned int) strlen(m_filename) + 1;
+	size += m_compressedSize;
+	size += m_strings.Count() + m_functions.Count();
+	size += (m_stringHash.Count() + m_functionHash.Count()) * sizeof(gmuint32);
+	return size;
+}
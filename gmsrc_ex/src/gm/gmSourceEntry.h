@@ -0,0 +1,88 @@
+/*
+_____               __  ___          __            ____        _      __
+/ ___/__ ___ _  ___ /  |/  /__  ___  / /_____ __ __/ __/_______(_)__  / /_
+/ (_ / _ `/  ' \/ -_) /|_/ / _ \/ _ \/  '_/ -_) // /\ \/ __/ __/ / _ \/ __/
+\___/\_,_/_/_/_/\__/_/  /_/\___/_//_/_/\_\\__/\_, /___/\__/_/ /_/ .__/\__/
+/___/             /_/
+
+See Copyright Notice in gmMachine.h
+
+*/
+
+#ifndef _GMSOURCEENTRY_H_
+#define _GMSOURCEENTRY_H_
+
+#include "gmConfig.h"
+#include "gmListDouble.h"
+#include "gmArraySimple.h"
+#include "gmCodeGenHooks.h"
+
+class gmMachine;
+
+/*!
+	\class gmSourceEntry
+	\brief gmSourceEntry holds source code added to a machine in debug mode, by source id.
+
+	With compact debug info, see gmMachine::SetCompactDebugInfo(), the source is held compressed and
+	decompressed the first time it is asked for.  The debug info of functions compiled in that mode is
+	packed here instead of in each function, see gmFunctionObject, and unpacked when a function needs it.
+	Line lookups read the packed info directly, so an exception only decompresses the one source file.
+*/
+class gmSourceEntry : public gmListDoubleNode<gmSourceEntry>
+{
+public:
+
+	gmSourceEntry(gmMachine * a_machine, gmuint32 a_id, bool a_compact);
+	~gmSourceEntry();
+
+	inline gmuint32 GetId() const { return m_id; }
+	inline gmMachine * GetMachine() const { return m_machine; }
+
+	/// \brief SetSource() copies the source code and file name, compressing the source if compact.
+	void SetSource(const char * a_source, const char * a_filename);
+
+	/// \brief HasSource()
+	inline bool HasSource() const { return m_filename != NULL; }
+
+	/// \brief GetSource() returns the source code, decompressing it on first use.  NULL if it was not set.
+	const char * GetSource();
+
+	/// \brief GetFilename()
+	inline const char * GetFilename() const { return m_filename; }
+
+	/// \brief AddFunction() packs the debug info of a function, storing identical debug info once.
+	/// \return the offset of the debug info.
+	gmuint32 AddFunction(const gmFunctionInfo &a_info);
+
+	/// \brief GetLine() returns the source line of a byte code address from packed function debug info.
+	int GetLine(gmuint32 a_offset, int a_address) const;
+
+	/// \brief Unpack() fills the debug info members of a_info from packed function debug info.
+	///        The symbols and line info are decoded into a_symbols and a_lineInfo.
+	void Unpack(gmuint32 a_offset, gmFunctionInfo &a_info, gmArraySimple<const char *> &a_symbols, gmArraySimple<gmLineInfo> &a_lineInfo) const;
+
+	/// \brief GetMemoryUsage() returns the bytes held for source and packed debug info.
+	unsigned int GetMemoryUsage() const;
+
+private:
+
+	gmuint32 Intern(gmArraySimple<gmuint8> &a_data, gmArraySimple<gmuint32> &a_hash, gmuint32 &a_count, const gmuint8 * a_item, gmuint32 a_length);
+
+	gmMachine * m_machine;
+	gmuint32 m_id;
+	bool m_compact;
+	char * m_source;                        ///< source code, NULL while compressed
+	char * m_filename;
+	gmuint8 * m_compressed;                 ///< compressed source, when compact and not yet decompressed
+	int m_compressedSize;
+	int m_sourceLength;
+
+	gmArraySimple<gmuint8> m_strings;       ///< unique strings of packed debug info
+	gmArraySimple<gmuint32> m_stringHash;   ///< open addressed offsets + 1 into m_strings
+	gmuint32 m_numStrings;
+	gmArraySimple<gmuint8> m_functions;     ///< unique packed function debug info
+	gmArraySimple<gmuint32> m_functionHash; ///< open addressed offsets + 1 into m_functions
+	gmuint32 m_numFunctions;
+};
+
+#endif // _GMSOURCEENTRY_H_
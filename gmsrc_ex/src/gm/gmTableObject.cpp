@@ -496,6 +496,27 @@ void gmTableObject::Resize(gmMachine * a_machine)
 
 
 
+void gmTableObject::Reserve(gmMachine * a_machine, int a_count)
+{
+	if(m_slotsUsed != 0)
+	{
+		return;
+	}
+
+	// Set() grows once three quarters of the slots are used
+	int size = MIN_TABLE_SIZE;
+	while(size - (size / 4) <= a_count)
+	{
+		size *= 2;
+	}
+	if(size > m_tableSize)
+	{
+		if(m_nodes) a_machine->Sys_Free(m_nodes);
+		AllocSize(a_machine, size);
+	}
+}
+
+
 void gmTableObject::AllocSize(gmMachine * a_machine, int a_size)
 {
 	GM_ASSERT((a_size & (a_size-1)) == 0 ); //Check for power of 2 size
@@ -76,6 +76,8 @@ public:
 	void Set(gmMachine * a_machine, int a_index, const char *a_value);
 
 	inline int Count() const { return m_slotsUsed; }
+	/// \brief Reserve() sizes an empty table to take a_count entries without growing.
+	void Reserve(gmMachine * a_machine, int a_count);
 	gmTableObject * Duplicate(gmMachine * a_machine);
 	void CopyTo(gmMachine * a_machine, gmTableObject *a_copyTo);
 
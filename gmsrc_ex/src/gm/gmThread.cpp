@@ -29,6 +29,53 @@ See Copyright Notice in gmMachine.h
 #define PUSHNULL top->m_type = GM_NULL; top->m_value.m_ref = 0; ++top;
 
 // helper functions
+
+// Get and set the element of a user type with a raw index, see gmMachine::RegisterTypeRawIndex().
+// false leaves it to the type's operator.
+static GM_FORCEINLINE bool gmRawGetInd(gmMachine * a_machine, gmVariable * a_operands)
+{
+	const gmUserObject * user = (const gmUserObject *) GM_MOBJECT(a_machine, a_operands[0].m_value.m_ref);
+	if(user->m_rawIndex == GM_RAWINDEX_NONE || a_operands[1].m_type != GM_INT) return false;
+	const gmRawArray * array = (const gmRawArray *) user->m_user;
+	gmuint32 index = (gmuint32) a_operands[1].m_value.m_int;
+	if(index >= (gmuint32) array->m_size) return false;
+	switch(user->m_rawIndex)
+	{
+	case GM_RAWINDEX_FLOAT32 : a_operands->SetFloat(((const float *) array->m_data)[index]); return true;
+	case GM_RAWINDEX_INT32 : a_operands->SetInt(((const gmint32 *) array->m_data)[index]); return true;
+#if GM_USE_VECTOR3_STACK
+	case GM_RAWINDEX_VEC3 : a_operands->SetVector((const float *) array->m_data + index * 3); return true;
+#endif // GM_USE_VECTOR3_STACK
+	default : return false;
+	}
+}
+
+static GM_FORCEINLINE bool gmRawSetInd(gmMachine * a_machine, const gmVariable * a_operands)
+{
+	const gmUserObject * user = (const gmUserObject *) GM_MOBJECT(a_machine, a_operands[0].m_value.m_ref);
+	if(user->m_rawIndex == GM_RAWINDEX_NONE || a_operands[1].m_type != GM_INT) return false;
+	const gmRawArray * array = (const gmRawArray *) user->m_user;
+	gmuint32 index = (gmuint32) a_operands[1].m_value.m_int;
+	if(index >= (gmuint32) array->m_size) return false;
+	const gmVariable &value = a_operands[2];
+	switch(user->m_rawIndex)
+	{
+	case GM_RAWINDEX_FLOAT32 :
+		if(value.m_type == GM_FLOAT) { ((float *) array->m_data)[index] = value.m_value.m_float; return true; }
+		if(value.m_type == GM_INT) { ((float *) array->m_data)[index] = (float) value.m_value.m_int; return true; }
+		return false;
+	case GM_RAWINDEX_INT32 :
+		if(value.m_type == GM_INT) { ((gmint32 *) array->m_data)[index] = value.m_value.m_int; return true; }
+		return false;
+#if GM_USE_VECTOR3_STACK
+	case GM_RAWINDEX_VEC3 :
+		if(value.m_type == GM_VEC3) { value.GetVector((float *) array->m_data + index * 3); return true; }
+		return false;
+#endif // GM_USE_VECTOR3_STACK
+	default : return false;
+	}
+}
+
 void gmGetLineFromString(const char * a_string, int a_line, char * a_buffer, int a_len)
 {
 	const char * cp = a_string, * eol;
@@ -62,6 +109,7 @@ gmThread::gmThread(gmMachine * a_machine, int a_initialByteSize)
 	m_size = a_initialByteSize / sizeof(gmVariable);
 	m_stack = GM_NEW( gmVariable[m_size] );
 	m_top = 0;
+	m_stale = 0;
 	m_base = 0;
 	m_numParameters = 0;
 #if GMDEBUG_SUPPORT
@@ -81,6 +129,7 @@ gmThread::gmThread(gmMachine * a_machine, int a_initialByteSize)
 	m_user = 0;
 
 	m_priority = 0;
+	m_callContext = 0;
 }
 
 
@@ -108,6 +157,7 @@ void gmThread::GCScanRoots(gmMachine* a_machine, gmGarbageCollector* a_gc)
 			a_gc->GetNextObject(object);
 		}
 	}
+	Sys_SetStale();
 
 	// mark signals
 	gmSignal * signal = m_signals;
@@ -146,6 +196,7 @@ void gmThread::Mark(gmuint32 a_mark)
 			if(object->NeedsMark(a_mark)) object->Mark(m_machine, a_mark);
 		}
 	}
+	Sys_SetStale();
 
 	// mark signals
 	gmSignal * signal = m_signals;
@@ -199,6 +250,107 @@ void gmThread::UpdateThreadTime(float a_time)
 }
 #endif
 
+GM_FORCEINLINE gmThread::State gmThread::Sys_CallNative(gmFunctionObject * a_fn, int a_numParameters, const gmuint8 ** a_ip, const gmuint8 ** a_cp)
+{
+	//
+	// Its a native function call, call it now as we cannot stack wind natives.  this avoids
+	// pushing a gmStackFrame.  Parameters are passed in place, the return value overwrites 'this'.
+	//
+
+	m_numParameters = (short) a_numParameters;
+	int lastBase = m_base;
+	int lastTop = m_top;
+	m_base = m_top - a_numParameters;
+
+	int result;
+	if(a_fn->m_cFunctor)
+		result = (*a_fn->m_cFunctor)(this);
+	else
+		result = a_fn->m_cFunction(this);
+
+	// Write barrier old local objects at native pop time
+	{
+		gmGarbageCollector* gc = m_machine->GetGC();
+		if( !gc->IsOff() )
+		{
+			for(int index = m_base; index < m_top; ++index)
+			{
+				if(m_stack[index].IsReference())
+				{
+					gmObject * object = GM_MOBJECT(m_machine, m_stack[index].m_value.m_ref);
+					gc->WriteBarrier(object);
+				}
+			}
+		}
+	}
+
+	// handle state
+	if(result == GM_SYS_STATE)
+	{
+		// this is special case, a bit messy.
+		return PushStackFrame(a_numParameters - GM_STATE_NUM_PARAMS, a_ip, a_cp);
+	}
+
+	// NOTE: It is not currently safe for a C binding to kill this thread.
+	//       Since we cant unwind mixed script and native functions anyway, 
+	//       perhaps the safest thing would be for ALWAYS delay killed threads 
+	//       from deletion.
+
+	// push a null if the function did not return anything
+	if(lastTop == m_top)
+	{
+		m_stack[m_base - 2] = gmVariable(GM_NULL, 0);
+	}
+	else
+	{
+		m_stack[m_base - 2] = m_stack[m_top - 1];
+	}
+
+	// Restore the stack
+	m_top = m_base - 1;
+	m_base = lastBase;
+
+	// check the call result
+	if(result != GM_OK)
+	{
+		const gmuint8 * returnAddress = (a_ip) ? *a_ip : NULL;
+
+		if(result == GM_SYS_YIELD)
+		{
+			m_machine->Sys_RemoveSignals(this);
+			m_instruction = returnAddress;
+			return SYS_YIELD;
+		}
+		else if(result == GM_SYS_BLOCK)
+		{
+			m_instruction = returnAddress;
+			m_machine->Sys_SwitchState(this, BLOCKED);
+			return BLOCKED;
+		}
+		else if(result == GM_SYS_SLEEP)
+		{
+			m_instruction = returnAddress;
+			m_machine->Sys_SwitchState(this, SLEEPING);
+			return SLEEPING;
+		}
+		else if(result == GM_SYS_KILL)
+		{
+			return KILLED;
+		}
+		return SYS_EXCEPTION;
+	}
+
+	if(!m_frame) // C called C function, no stack frame, so signal killed.
+	{
+		return KILLED;
+	}
+
+	// return result
+	return RUNNING;
+}
+
+
+
 // RAGE AGAINST THE VIRTUAL MACHINE =)
 gmThread::State gmThread::Sys_Execute(gmVariable * a_return)
 {
@@ -251,7 +403,7 @@ gmThread::State gmThread::Sys_Execute(gmVariable * a_return)
 #ifdef GM_CHECK_USER_BREAK_CALLBACK // This may be defined in gmConfig_p.h
 		// Check external source to break execution with exception eg. Check for CTRL-BREAK
 		// Endless loop protection could be implemented with this, or in a similar manner.
-		if( gmMachine::s_userBreakCallback && gmMachine::s_userBreakCallback(this) )
+		if( m_machine->GetUserBreakCallback() && m_machine->GetUserBreakCallback()(this) )
 		{
 			GMTHREAD_LOG("User break. Execution halted.");
 			goto LabelException;
@@ -379,6 +531,8 @@ gmThread::State gmThread::Sys_Execute(gmVariable * a_return)
 				operand = top - 2; 
 				--top; 
 
+				if(operand->m_type >= GM_USER && gmRawGetInd(m_machine, operand)) break;
+
 				register gmType t0 = operand[0].m_type;
 				register gmType t1 = operand[1].m_type;
 
@@ -423,6 +577,7 @@ gmThread::State gmThread::Sys_Execute(gmVariable * a_return)
 			{ 
 				operand = top - 3; 
 				top -= 3; 
+				if(operand->m_type >= GM_USER && gmRawSetInd(m_machine, operand)) break;
 				gmOperatorFunction op = OPERATOR(operand->m_type, O_SETIND); 
 				if(op) 
 				{ 
@@ -483,6 +638,21 @@ gmThread::State gmThread::Sys_Execute(gmVariable * a_return)
 
 				break;
 			}
+		case BC_GETDOTX :
+		case BC_GETDOTY :
+		case BC_GETDOTZ :
+			{
+#if(GM_USE_VECTOR3_STACK)
+				operand = top - 1;
+				if(operand->m_type == GM_VEC3)
+				{
+					operand->SetFloat((&operand->m_value.m_vec3.x)[instruction32[-1] - BC_GETDOTX]);
+					instruction += sizeof(gmptr);
+					break;
+				}
+#endif // GM_USE_VECTOR3_STACK
+				// other types get the member as BC_GETDOT
+			}
 		case BC_GETDOT :
 			{
 				operand = top - 1;
@@ -778,7 +948,20 @@ gmThread::State gmThread::Sys_Execute(gmVariable * a_return)
 
 				gmVariable * callFunc = &m_stack[m_base - numParams];
 
-				State res = PushStackFrame(numParams, &instruction, &code);
+				// native functions are called directly, skipping the generic frame push.  The callee
+				// type is checked once here, natives check their own parameter count and script
+				// functions pad or drop parameters in PushStackFrame(), so there is no count to check.
+				State res;
+				operand = top - numParams - 1;
+				if(operand->m_type == GM_FUNCTION && 
+				  ((fn = (gmFunctionObject *) GM_MOBJECT(m_machine, operand->m_value.m_ref))->m_cFunction || fn->m_cFunctor))
+				{
+					res = Sys_CallNative(fn, numParams, &instruction, &code);
+				}
+				else
+				{
+					res = PushStackFrame(numParams, &instruction, &code);
+				}
 				top = GetTop(); 
 				base = GetBase();
 
@@ -810,6 +993,47 @@ gmThread::State gmThread::Sys_Execute(gmVariable * a_return)
 				}
 				return res;
 			}
+		case BC_TAILCALL :
+			{
+				SetTop(top);
+
+				int numParams = (int) OPCODE_INT(instruction);
+
+				// script functions reuse this frame, anything else is a normal call followed by BC_RETV
+				State res;
+				operand = top - numParams - 1;
+				if(operand->m_type == GM_FUNCTION && 
+				  !((fn = (gmFunctionObject *) GM_MOBJECT(m_machine, operand->m_value.m_ref))->m_cFunction || fn->m_cFunctor))
+				{
+					res = Sys_ReplaceStackFrame(numParams, &instruction, &code);
+				}
+				else
+				{
+					res = PushStackFrame(numParams, &instruction, &code);
+				}
+				top = GetTop(); 
+				base = GetBase();
+
+				if(res == RUNNING)
+				{
+#if GMDEBUG_SUPPORT
+					if(m_debugFlags && m_machine->GetDebugMode() && m_machine->m_call)
+					{
+						m_instruction = instruction;
+						if(m_machine->m_call(this)) return RUNNING;
+					}
+#endif // GMDEBUG_SUPPORT
+					break;
+				}
+				if(res == SYS_YIELD) return RUNNING;
+				if(res == SYS_EXCEPTION) goto LabelException;
+				if(res == KILLED)
+				{
+					if(a_return) *a_return = m_stack[m_top - 1];
+					m_machine->Sys_SwitchState(this, KILLED);
+				}
+				return res;
+			}
 		case BC_RET :
 			{
 				PUSHNULL;
@@ -861,9 +1085,14 @@ gmThread::State gmThread::Sys_Execute(gmVariable * a_return)
 				newthr->m_frame->m_prev = 0;
 				newthr->m_frame->m_returnAddress = 0;
 				newthr->m_frame->m_returnBase = 0;
+				newthr->m_frame->m_tailCalls = 0;
 
 				newthr->m_base = 2;
 				newthr->m_instruction = instruction + sizeof(gmptr); // skip branch on other thread
+				if(m_callContext)
+				{
+					m_machine->Sys_PromoteCallThread(this); // the forked thread is handed our id
+				}
 				newthr->PushInt( GetId() );
 
 				instruction = code + OPCODE_PTR_NI( instruction );   // branch
@@ -1120,6 +1349,10 @@ LabelException:
 	// exception handler
 	//
 	m_instruction = instruction;
+	if(m_callContext)
+	{
+		m_machine->Sys_PromoteCallThread(this); // exception threads are kept around by id
+	}
 
 	// spit out error info
 	LogLineFile();
@@ -1131,9 +1364,10 @@ LabelException:
 #endif
 
 	// call machine exception handler
-	if(gmMachine::s_machineCallback)
+	gmMachineCallback machineCallback = m_machine->GetMachineCallback();
+	if(machineCallback)
 	{
-		if(gmMachine::s_machineCallback(m_machine, MC_THREAD_EXCEPTION, this))
+		if(machineCallback(m_machine, MC_THREAD_EXCEPTION, this))
 		{
 #if GMDEBUG_SUPPORT
 			// if we are being debugged, put this thread into a limbo state, waiting for delete.
@@ -1177,6 +1411,39 @@ void gmThread::Sys_Reset(int a_id)
 
 
 
+bool gmThread::Sys_SetupLocals(gmFunctionObject * a_fn, int a_base, int a_numParameters)
+{
+	GM_ASSERT(m_top == a_base + a_numParameters);
+	if(!Touch(a_fn->GetNumParamsLocals() - a_numParameters + a_fn->GetMaxStackSize()))
+	{
+		m_machine->GetLog().LogEntry("stack overflow");
+		return false;
+	}
+
+	// null missing params and the locals read before they are written, extra params are overwritten by the locals
+	int index = (a_numParameters < a_fn->GetNumParams()) ? m_top : a_base + a_fn->GetNumParams();
+	int end = a_base + a_fn->GetNumParams() + a_fn->GetNumClearLocals();
+	for(; index < end; ++index)
+	{
+		m_stack[index].Nullify();
+	}
+
+	// the other locals are written before they are read, but the collector marks them before that, so they
+	// are nulled too where they may hold objects freed by the last collection.
+	int top = a_base + a_fn->GetNumParamsLocals();
+	if(top > m_stale)
+	{
+		for(index = (end > m_stale) ? end : m_stale; index < top; ++index)
+		{
+			m_stack[index].Nullify();
+		}
+		m_stale = top;
+	}
+	return true;
+}
+
+
+
 gmThread::State gmThread::PushStackFrame(int a_numParameters, const gmuint8 ** a_ip, const gmuint8 ** a_cp)
 {
 	// calculate new stack base
@@ -1186,7 +1453,10 @@ gmThread::State gmThread::PushStackFrame(int a_numParameters, const gmuint8 ** a
 	{
 		// This may not be the best place to signal, but we at least want a valid 'this'
 		m_base = base; // Init so some thread queries work
-		m_machine->Sys_SignalCreateThread(this);
+		if(!m_callContext) // call contexts signal if they are promoted, see gmMachine::Sys_PromoteCallThread()
+		{
+			m_machine->Sys_SignalCreateThread(this);
+		}
 
 #if(GM_USE_THREAD_TIMERS)
 		threadTime.Reset();
@@ -1203,124 +1473,19 @@ gmThread::State gmThread::PushStackFrame(int a_numParameters, const gmuint8 ** a
 
 	if(fn->m_cFunction || fn->m_cFunctor)
 	{
-		//
-		// Its a native function call, call it now as we cannot stack wind natives.  this avoids
-		// pushing a gmStackFrame.
-		//
-
-		m_numParameters = (short) a_numParameters;
-		int lastBase = m_base;
-		int lastTop = m_top;
-		m_base = base;
-
-		int result = 0;
-		if(fn->m_cFunctor)
-			result = (*fn->m_cFunctor)(this);
-		else if(fn->m_cFunction)
-			result = fn->m_cFunction(this);		
-
-		// Write barrier old local objects at native pop time
-		{
-			gmGarbageCollector* gc = m_machine->GetGC();
-			if( !gc->IsOff() )
-			{
-				for(int index = m_base; index < m_top; ++index)
-				{
-					if(m_stack[index].IsReference())
-					{
-						gmObject * object = GM_MOBJECT(m_machine, m_stack[index].m_value.m_ref);
-						gc->WriteBarrier(object);
-					}
-				}
-			}
-		}
-
-		// handle state
-		if(result == GM_SYS_STATE)
-		{
-			// this is special case, a bit messy.
-			return PushStackFrame(a_numParameters - GM_STATE_NUM_PARAMS, a_ip, a_cp);
-		}
-
-		// NOTE: It is not currently safe for a C binding to kill this thread.
-		//       Since we cant unwind mixed script and native functions anyway, 
-		//       perhaps the safest thing would be for ALWAYS delay killed threads 
-		//       from deletion.
-
-		// push a null if the function did not return anything
-		if(lastTop == m_top)
-		{
-			m_stack[m_base - 2] = gmVariable(GM_NULL, 0);
-		}
-		else
-		{
-			m_stack[m_base - 2] = m_stack[m_top - 1];
-		}
-
-		// Restore the stack
-		m_top = m_base - 1;
-		m_base = lastBase;
-
-		// check the call result
-		if(result != GM_OK)
-		{
-			const gmuint8 * returnAddress = (a_ip) ? *a_ip : NULL;
-
-			if(result == GM_SYS_YIELD)
-			{
-				m_machine->Sys_RemoveSignals(this);
-				m_instruction = returnAddress;
-				return SYS_YIELD;
-			}
-			else if(result == GM_SYS_BLOCK)
-			{
-				m_instruction = returnAddress;
-				m_machine->Sys_SwitchState(this, BLOCKED);
-				return BLOCKED;
-			}
-			else if(result == GM_SYS_SLEEP)
-			{
-				m_instruction = returnAddress;
-				m_machine->Sys_SwitchState(this, SLEEPING);
-				return SLEEPING;
-			}
-			else if(result == GM_SYS_KILL)
-			{
-				return KILLED;
-			}
-			return SYS_EXCEPTION;
-		}
-
-		if(!m_frame) // C called C function, no stack frame, so signal killed.
-		{
-			return KILLED;
-		}
-
-		// return result
-		return RUNNING;
+		return Sys_CallNative(fn, a_numParameters, a_ip, a_cp);
 	}
 
 	//
 	// Its a script function call, push a stack frame
 	//
 
-	int clearSize = fn->GetNumParamsLocals() - a_numParameters;
-	if(!Touch(clearSize + fn->GetMaxStackSize())) 
+	fn->Materialize();
+	if(!Sys_SetupLocals(fn, base, a_numParameters))
 	{
-		m_machine->GetLog().LogEntry("stack overflow");
 		return SYS_EXCEPTION;
 	}
 
-	// zero missing params and locals.
-	if(a_numParameters <= fn->GetNumParams())
-	{
-		memset(GetTop(), 0, sizeof(gmVariable) * clearSize);
-	}
-	else
-	{
-		memset(&m_stack[base + fn->GetNumParams()], 0, sizeof(gmVariable) * fn->GetNumLocals());
-	}
-
 	// push a new stack frame
 	gmStackFrame * frame = m_machine->Sys_AllocStackFrame();
 	frame->m_prev = m_frame;
@@ -1328,6 +1493,7 @@ gmThread::State gmThread::PushStackFrame(int a_numParameters, const gmuint8 ** a
 
 	// cache new frame variables
 	m_frame->m_returnBase = m_base;
+	m_frame->m_tailCalls = 0;
 
 	if(a_ip)
 	{
@@ -1347,6 +1513,49 @@ gmThread::State gmThread::PushStackFrame(int a_numParameters, const gmuint8 ** a
 
 
 
+gmThread::State gmThread::Sys_ReplaceStackFrame(int a_numParameters, const gmuint8 ** a_ip, const gmuint8 ** a_cp)
+{
+	int base = m_top - a_numParameters;
+	gmFunctionObject * fn = (gmFunctionObject *) GM_MOBJECT(m_machine, m_stack[base - 1].m_value.m_ref);
+	GM_ASSERT(m_frame && m_stack[base - 1].m_type == GM_FUNCTION && !fn->m_cFunction && !fn->m_cFunctor);
+	fn->Materialize();
+
+	// Write barrier the locals of the frame being replaced
+	{
+		gmGarbageCollector* gc = m_machine->GetGC();
+		if( !gc->IsOff() )
+		{
+			for(int index = m_base - 2; index < base - 2; ++index)
+			{
+				if(m_stack[index].IsReference())
+				{
+					gmObject * object = GM_MOBJECT(m_machine, m_stack[index].m_value.m_ref);
+					gc->WriteBarrier(object);
+				}
+			}
+		}
+	}
+
+	// move this, fp and params down over the current frame
+	memmove(&m_stack[m_base - 2], &m_stack[base - 2], sizeof(gmVariable) * (a_numParameters + 2));
+	m_top = m_base + a_numParameters;
+
+	if(!Sys_SetupLocals(fn, m_base, a_numParameters))
+	{
+		return SYS_EXCEPTION;
+	}
+
+	// the frame keeps its return address and base
+	++m_frame->m_tailCalls;
+	*a_ip = (const gmuint8 *) fn->GetByteCode();
+	*a_cp = *a_ip;
+	m_top = m_base + fn->GetNumParamsLocals();
+
+	return RUNNING;
+}
+
+
+
 gmThread::State gmThread::Sys_PopStackFrame(const gmuint8 * &a_ip, const gmuint8 * &a_cp)
 {
 	if(m_frame == NULL)
@@ -1421,6 +1630,13 @@ void gmThread::LogLineFile()
 
 
 
+void gmThread::Sys_Promote()
+{
+	m_machine->Sys_PromoteCallThread(this);
+}
+
+
+
 bool gmThread::Touch(int a_extra)
 {
 	// Grow stack if necessary.  NOTE: Use better growth metric if needed.
@@ -1444,6 +1660,7 @@ bool gmThread::Touch(int a_extra)
 		if(m_stack) 
 			delete[] m_stack; 
 		m_stack = stack; 
+		if(m_stale > m_top) m_stale = m_top;
 	}
 	return true;
 }
@@ -1467,6 +1684,10 @@ void gmThread::LogCallStack()
 			const char * source, *filename = "";
 			m_machine->GetSourceCode(fn->GetSourceId(), source, filename);
 			m_machine->GetLog().LogEntry("%s(%d): %s", filename, fn->GetLine(ip), fn->GetDebugName());
+			if(frame->m_tailCalls)
+			{
+				m_machine->GetLog().LogEntry("  (%d tail call frames elided)", frame->m_tailCalls);
+			}
 		}
 		base = frame->m_returnBase;
 		ip = frame->m_returnAddress;
@@ -38,6 +38,7 @@ struct gmStackFrame
 	gmStackFrame * m_prev;
 	const gmuint8 * m_returnAddress;
 	int m_returnBase;
+	int m_tailCalls; //!< number of calls that reused this frame via BC_TAILCALL, ie. frames elided from the call stack
 };
 
 /// \class gmThread
@@ -80,6 +81,10 @@ public:
 	void Mark(gmuint32 a_mark);
 #endif //GM_USE_INCGC
 
+	/// \brief Sys_SetStale() is called by the collector as it marks the stack, or for a pooled thread whose stack is
+	///        not marked.  The stack above the top may then hold objects the collection frees, see Sys_SetupLocals().
+	inline void Sys_SetStale() { m_stale = m_top; }
+
 	/// \brief Sys_Execute() will perform execution on this thread.  a this, function references, params and stack
 	///        frame must be pushed before a call to execute will succeed.
 	/// \param a_return will be set to the return variable iff Sys_Execute returns gmThread::KILLED. 
@@ -272,6 +277,7 @@ public:
 	/// \return true on success
 	bool Touch(int a_extra);
 
+	/// \brief GetId() returns the thread id, GM_INVALID_THREAD for a call context.  Sys_Promote() first where the id is kept.
 	inline int GetId() const { return m_id; }
 	inline const gmuint8 * GetInstruction() const { return m_instruction; }
 	inline State GetState() const { return m_state; }
@@ -279,6 +285,13 @@ public:
 	inline gmuint32 GetThreadTime() const { return m_machine->GetTime() - m_startTime; }
 	inline void Sys_SetTimeStamp(gmuint32 a_timeStamp) { m_timeStamp = a_timeStamp; }
 	inline void Sys_SetStartTime(gmuint32 a_startTime) { m_startTime = a_startTime; }
+	inline void Sys_SetId(int a_id) { m_id = a_id; }
+
+	/// \brief IsCallContext() returns true while the thread runs a synchronous call without an id, see gmMachine::Sys_AcquireCallThread().
+	inline bool IsCallContext() const { return m_callContext != 0; }
+	inline void Sys_SetCallContext(bool a_callContext) { m_callContext = (gmuint8) a_callContext; }
+	/// \brief Sys_Promote() gives a call context its id and makes it an ordinary thread, see gmMachine::Sys_PromoteCallThread().
+	void Sys_Promote();
 
 	/// \brief GetSystemMemUsed will return the number of bytes allocated by the system.
 	inline unsigned int GetSystemMemUsed() const { return (m_size * sizeof(gmVariable)) + sizeof(this); }
@@ -326,6 +339,23 @@ private:
 	/// \return RUNNING, KILLED or SYS_EXCEPTION
 	State Sys_PopStackFrame(const gmuint8 * &a_ip, const gmuint8 * &a_cp);
 
+	/// \brief Sys_ReplaceStackFrame() will replace the current script stack frame with a call to the script function
+	///        at tos.  this, fp and params are moved down over the current frame.  Used by BC_TAILCALL.
+	/// \return RUNNING or SYS_EXCEPTION
+	State Sys_ReplaceStackFrame(int a_numParameters, const gmuint8 ** a_ip, const gmuint8 ** a_cp);
+
+	/// \brief Sys_CallNative() will call a c bound function in place on the stack.  this, fp and params must be
+	///        pushed.  No gmStackFrame is allocated.
+	/// \param a_fn is the function, must have m_cFunction or m_cFunctor set.
+	/// \return gmThreadState, as for PushStackFrame()
+	State Sys_CallNative(gmFunctionObject * a_fn, int a_numParameters, const gmuint8 ** a_ip, const gmuint8 ** a_cp);
+
+	/// \brief Sys_SetupLocals() makes room for a_fn's frame at a_base and nulls the missing params and the locals
+	///        that need it, see gmFunctionObject::GetNumClearLocals().
+	///        Shared by PushStackFrame() and Sys_ReplaceStackFrame(), m_top must be a_base + a_numParameters.
+	/// \return false on stack overflow
+	bool Sys_SetupLocals(gmFunctionObject * a_fn, int a_base, int a_numParameters);
+
 	void LogLineFile();
 
 	// stack members
@@ -335,6 +365,7 @@ private:
 	int m_top;
 	int m_base;
 	gmStackFrame * m_frame;
+	int m_stale; //!< the stack from here up may hold objects freed by the last collection
 
 	// thread members
 	State m_state;
@@ -347,6 +378,7 @@ private:
 	short m_numParameters;
 
 	gmuint8 m_priority;
+	gmuint8 m_callContext;
 };
 
 
@@ -357,6 +389,12 @@ private:
 //
 
 
+inline gmType gmLibType::Get(const gmThread * a_thread) const
+{
+	return Get(a_thread->GetMachine());
+}
+
+
 inline const gmFunctionObject * gmThread::GetFunctionObject() const
 {
 	const gmVariable * fnVar = GetFunction();
@@ -15,6 +15,25 @@ See Copyright Notice in gmMachine.h
 #include "gmConfig.h"
 #include "gmVariable.h"
 
+/// \brief gmRawIndex is the element layout of a user type the interpreter indexes itself, see gmMachine::RegisterTypeRawIndex().
+enum gmRawIndex
+{
+	GM_RAWINDEX_NONE = 0,
+	GM_RAWINDEX_FLOAT32,
+	GM_RAWINDEX_INT32,
+#if GM_USE_VECTOR3_STACK
+	GM_RAWINDEX_VEC3, // x, y, z floats per element
+#endif // GM_USE_VECTOR3_STACK
+};
+
+/// \struct gmRawArray
+/// \brief gmRawArray begins the native object of a user type with a raw index, its packed elements and their count.
+struct gmRawArray
+{
+	void * m_data;
+	int m_size;
+};
+
 /// \class gmUserObject
 /// \brief
 class gmUserObject : public gmObject
@@ -31,6 +50,7 @@ public:
 #endif //GM_USE_INCGC
 
 	int m_userType;
+	gmuint8 m_rawIndex; ///< gmRawIndex of the type when allocated, see gmMachine::RegisterTypeRawIndex()
 	void * m_user;
 };
 
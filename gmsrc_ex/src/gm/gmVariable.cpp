@@ -17,7 +17,7 @@ See Copyright Notice in gmMachine.h
 #include "gmGCRoot.h"
 
 // Init statics and constants
-gmVariable gmVariable::s_null = gmVariable(GM_NULL, 0);
+const gmVariable gmVariable::s_null = gmVariable(GM_NULL, 0);
 
 
 const char * gmVariable::AsString(gmMachine * a_machine, char * a_buffer, int a_len) const
@@ -85,7 +85,7 @@ struct gmEnumData
 ///        The gm runtime stack operates on gmVariable types.
 struct gmVariable
 {
-	static gmVariable s_null;
+	static const gmVariable s_null;
 
 	gmType m_type;
 	union
@@ -2,15 +2,15 @@ rem Strip CR from compiler script files
 ..\..\bin\StripCR gmParser.y /nobak
 ..\..\bin\StripCR gmScanner.l /nobak
 ..\..\bin\StripCR flex.skl /nobak
-..\..\bin\StripCR bison.hairy /nobak
-..\..\bin\StripCR bison.simple /nobak
-rem generate compiler
-..\..\bin\bison -o gmParser.cpp -d -l -p gm gmParser.y  
-..\..\bin\flex -ogmScanner.cpp -Pgm -Sflex.skl gmScanner.l
+rem generate parser, gmScanner.cpp is hand written
+rem gmParser.y needs bison 3 or later on the path, eg win_bison from winflexbison, ..\..\bin\bison is too old
+bison -o gmParser.cpp --defines=gmParser.cpp.h -l -p gm gmParser.y
+rem generate the flex reference scanner checked against gmScanner.cpp by examples\ScannerDiff
+..\..\bin\flex -o..\examples\ScannerDiff\gmScannerFlex.cpp -Pgmflex -Sflex.skl gmScanner.l
 
 rem Strip CR generated files
 ..\..\bin\StripCR gmParser.cpp /nobak
-..\..\bin\StripCR gmScanner.cpp /nobak
+..\..\bin\StripCR ..\examples\ScannerDiff\gmScannerFlex.cpp /nobak
 
 rem use following for verbose bison
-rem ..\..\bin\bison -o gmParser.cpp -d -l -v -p gm gmParser.y  
+rem bison -o gmParser.cpp --defines=gmParser.cpp.h -l -v -p gm gmParser.y  
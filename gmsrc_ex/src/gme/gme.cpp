@@ -10,6 +10,8 @@
 #include "gmmathlib.h"
 #include "gmstringlib.h"
 #include "gmarraylib.h"
+#include "gmtypedarraylib.h"
+#include "gmvec3batchlib.h"
 #include "gmsystemlib.h"
 #include "gmvector3lib.h"
 
@@ -378,6 +380,10 @@ void main(int argc, char * argv[], char * envp[])
   gmBindMathLib(g_machine);
   gmBindStringLib(g_machine);
   gmBindArrayLib(g_machine);
+  gmBindTypedArrayLib(g_machine);
+#if GM_VEC3BATCH_LIB && GM_USE_VECTOR3_STACK
+  gmBindVec3BatchLib(g_machine);
+#endif
 #if GM_SYSTEM_LIB
   gmBindSystemLib(g_machine);
 #endif
@@ -82,6 +82,9 @@ static void PrintByteCode(FILE * a_fp, const void * a_byteCode, int a_byteCodeLe
       case BC_LINE : cp = "line"; break;
 
       case BC_GETDOT : cp = "get dot"; opiptr = true; break;
+      case BC_GETDOTX : cp = "get dot x"; opiptr = true; break;
+      case BC_GETDOTY : cp = "get dot y"; opiptr = true; break;
+      case BC_GETDOTZ : cp = "get dot z"; opiptr = true; break;
       case BC_SETDOT : cp = "set dot"; opiptr = true; break;
       case BC_GETIND : cp = "get index"; break;
       case BC_SETIND : cp = "set index"; break;
@@ -92,6 +95,7 @@ static void PrintByteCode(FILE * a_fp, const void * a_byteCode, int a_byteCodeLe
       case BC_BRZK : cp = "brzk"; opiptr = true; break;
       case BC_BRNZK : cp = "brnzk"; opiptr = true; break;
       case BC_CALL : cp = "call"; opiptr = true; break;
+      case BC_TAILCALL : cp = "tail call"; opiptr = true; break;
       case BC_RET : cp = "ret"; break;
       case BC_RETV : cp = "retv"; break;
       case BC_FOREACH : cp = "foreach"; opiptr = true; break;
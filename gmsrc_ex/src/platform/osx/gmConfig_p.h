@@ -46,6 +46,7 @@ See Copyright Notice in gmMachine.h
 #define GM_NL                 "\r\n" // "\n"
 #define GM_FORCEINLINE        inline  // inline
 #define GM_INLINE             inline
+#define GM_THREAD_LOCAL       __thread // per OS thread storage for statics, see gmCodeTree
 #define _gmstricmp            strcasecmp
 #define _gmsnprintf           snprintf // snprintf
 #define _gmvsnprintf          vsnprintf // vsnprintf
@@ -34,6 +34,7 @@
 #define GM_NL                 "\r\n" // "\n"
 #define GM_FORCEINLINE        inline
 #define GM_INLINE             inline
+#define GM_THREAD_LOCAL       // single threaded
 #define _gmstricmp            strcasecmp
 #define _gmsnprintf           snprintf
 #define _gmvsnprintf          vsnprintf
@@ -45,6 +45,7 @@
 #define GM_NL                 "\r\n" // "\n"
 #define GM_FORCEINLINE        inline  // inline
 #define GM_INLINE             inline
+#define GM_THREAD_LOCAL       __thread // per OS thread storage for statics, see gmCodeTree
 #define _gmstricmp            strcasecmp
 #define _gmsnprintf           snprintf // snprintf
 #define _gmvsnprintf          vsnprintf // vsnprintf
@@ -63,6 +63,7 @@
 #define GM_NL                 "\r\n" // "\n"
 #define GM_FORCEINLINE        __forceinline // inline
 #define GM_INLINE             inline
+#define GM_THREAD_LOCAL       __declspec(thread) // per OS thread storage for statics, see gmCodeTree
 #define _gmstricmp            stricmp // strcasecmp
 #define _gmsnprintf           _snprintf // snprintf
 #define _gmvsnprintf          _vsnprintf // vsnprintf